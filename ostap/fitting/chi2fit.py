@@ -63,11 +63,20 @@ C2FIT . __getitem__ = lambda s , i : s.param ( i )
 #  h1 = ...
 #  h .hFit ( [ h0 , h1 ] )
 #  @endcode 
+#  The fit method can be specified:
+#  - <code>'minimize'</code> : iterative minimization (default)
+#  - <code>'linear'</code>   : direct linear least squares 
+#  - <code>'nnls'</code>     : non-negative linear least squares 
+#  @code
+#  h .hFit ( [ h0 , h1 ] , method = 'nnls' )
+#  @endcode 
+#  @see Ostap::Math::Chi2Fit::Method
 def _h_Fit_ ( self                              ,
               components                        ,
               draw = False                      ,
               interpolate = True                ,
-              selector    = lambda i,x,y : True ) :
+              selector    = lambda i,x,y : True ,
+              method      = 'minimize'          ) :
     """(Chi_2)-fit the histogram with the set of ``components''
     
     The ``components'' could be histograms, functions and other
@@ -80,6 +89,12 @@ def _h_Fit_ ( self                              ,
     >>> h1 = ...
     >>> h .hFit ( [ h0 , h1 ] )
     
+    The fit method can be specified:
+    - 'minimize' : iterative minimization (default)
+    - 'linear'   : direct linear least squares 
+    - 'nnls'     : non-negative linear least squares 
+    
+    >>> h .hFit ( [ h0 , h1 ] , method = 'nnls' )
     """
     DATA =   VE.Vector
     CMPS = DATA.Vector
@@ -113,7 +128,12 @@ def _h_Fit_ ( self                              ,
             cmps[ j ].push_back ( cp ) 
             
 
-    _c2Fit = Ostap.Math.Chi2Fit ( data , cmps )
+    methods = { 'minimize' : C2FIT.Minimize    ,
+                'linear'   : C2FIT.Linear      ,
+                'nnls'     : C2FIT.NonNegative }
+    assert method.lower() in methods, "hFit: invalid method '%s'" % method 
+
+    _c2Fit = Ostap.Math.Chi2Fit ( data , cmps , methods [ method.lower() ] )
 
     if draw :
         
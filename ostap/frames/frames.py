@@ -147,6 +147,29 @@ def _fr_statCov_ ( frame       ,
     return stat1 , stat2 , cov2 , length
 
 
+# =============================================================================
+## Create the booker to fill many histograms and counters in one event loop
+#  @code
+#  frame  = ...
+#  booker = frame.booker() 
+#  booker.project ( h1 , 'pt'   , 'y>2' )
+#  booker.project ( h2 , 'mass'         )
+#  booker.statVar ( s1 , 'pt*pt'        )
+#  booker.run ()  ## the single event loop 
+#  @endcode
+#  @see Ostap::DataFrameBooker
+def _fr_booker_ ( self ) :
+    """Create the booker to fill many histograms and counters in one event loop
+    >>> frame  = ...
+    >>> booker = frame.booker() 
+    >>> booker.project ( h1 , 'pt'   , 'y>2' )
+    >>> booker.project ( h2 , 'mass'         )
+    >>> booker.statVar ( s1 , 'pt*pt'        )
+    >>> booker.run ()  ## the single event loop 
+    - see Ostap::DataFrameBooker
+    """
+    return Ostap.DataFrameBooker ( self )
+
 # =============================================================================
 ## Simplified print out for the  frame 
 #  @code 
@@ -176,6 +199,7 @@ DataFrame .__repr__   = _fr_print_
 DataFrame .nEff       = _fr_nEff_
 DataFrame .statVar    = _fr_statVar_
 DataFrame .statCov    = _fr_statCov_
+DataFrame .booker     = _fr_booker_
 
 
 from ostap.stats.statvars import  data_decorate 
@@ -244,6 +268,7 @@ _new_methods_       = (
     DataFrame.nEff             ,
     DataFrame.statVar          ,
     DataFrame.statCov          ,
+    DataFrame.booker           ,
     DataFrame.nEff             ,
     #
     DataFrame.get_moment       , 
@@ -0,0 +1,108 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# @file ostap/frames/tests/test_frames_booker.py
+# Test module for Ostap::DataFrameBooker:
+# the histograms and counters, booked lazily and filled in one event loop,
+# are compared with the individual HistoProject/StatVar results
+# Copyright (c) Ostap developpers.
+# =============================================================================
+""" Test module for Ostap::DataFrameBooker:
+the histograms and counters, booked lazily and filled in one event loop,
+are compared with the individual HistoProject/StatVar results
+"""
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' ==  __name__ : logger = getLogger ( 'ostap.test_frames_booker' )
+else                       : logger = getLogger ( __name__                  )
+# =============================================================================
+import ROOT, os
+from ostap.core.core     import Ostap, hID
+from ostap.frames.frames import DataFrame
+from ostap.utils.cleanup import CleanUp
+
+tmpdir = CleanUp().tmpdir
+fname  = os.path.join ( tmpdir , 'test_frame_booker.root' )
+tname  = "myTree"
+
+## prepare an input tree
+tdf = DataFrame ( 10000 )
+tdf.Define ( "b1" , "(double) tdfentry_"        ) \
+   .Define ( "x"  , "std::sin ( 0.1 * b1 )"     ) \
+   .Define ( "y"  , "std::cos ( 0.3 * b1 )"     ) \
+   .Define ( "z"  , "std::sin ( 0.7 * b1 + 1 )" ) .Snapshot ( tname , fname )
+
+frame = DataFrame ( tname , fname )
+
+## the same histograms?
+def same ( h1 , h2 ) :
+    if h1.GetNcells () != h2.GetNcells () : return False
+    for i in range ( h1.GetNcells () ) :
+        c1 , c2 = h1.GetBinContent ( i ) , h2.GetBinContent ( i )
+        e1 , e2 = h1.GetBinError   ( i ) , h2.GetBinError   ( i )
+        if abs ( c1 - c2 ) > 1.e-9 * ( 1 + abs ( c2 ) ) : return False
+        if abs ( e1 - e2 ) > 1.e-9 * ( 1 + abs ( e2 ) ) : return False
+    return True
+
+# =============================================================================
+def test_frame_booker () :
+
+    ## the histograms and counters, filled in one event loop
+    b1 = ROOT.TH1D ( hID () , '' , 20 , -1 , 1 )
+    b2 = ROOT.TH1D ( hID () , '' , 20 , -1 , 1 )
+    b3 = ROOT.TH2D ( hID () , '' , 10 , -1 , 1 , 10 , -1 , 1 )
+    b4 = ROOT.TH3D ( hID () , '' ,  5 , -1 , 1 ,  5 , -1 , 1 , 5 , -1 , 1 )
+    s1 = Ostap.WStatEntity ()
+    s2 = Ostap.WStatEntity ()
+
+    booker = frame.booker ()
+    assert booker.project  ( b1 , 'x'                       ).isSuccess () , 'Cannot book projection'
+    assert booker.project  ( b2 , 'x'         , '(y>0)*z*z' ).isSuccess () , 'Cannot book projection'
+    assert booker.project2 ( b3 , 'x' , 'y'   , 'z>0'       ).isSuccess () , 'Cannot book projection'
+    assert booker.project3 ( b4 , 'x' , 'y' , 'z'           ).isSuccess () , 'Cannot book projection'
+    assert booker.statVar  ( s1 , 'x*y'                     ).isSuccess () , 'Cannot book statistic'
+    assert booker.statVar  ( s2 , 'x+z'       , '1+y'       ).isSuccess () , 'Cannot book statistic'
+
+    ## nothing is filled before the event loop
+    assert 6 == booker.size ()         , 'Invalid number of booked actions'
+    assert 0 == b1.GetEntries ()       , 'Histogram is filled before the event loop'
+    assert 0 == s1.nEntries   ()       , 'Counter is filled before the event loop'
+
+    assert 6 == booker.run  ()         , 'Invalid number of delivered results'
+    assert 0 == booker.size ()         , 'Actions are not cleared after the event loop'
+
+    ## the same with the individual event loops
+    h1 = b1.Clone ( hID () ) ; h1.Reset ()
+    h2 = b2.Clone ( hID () ) ; h2.Reset ()
+    h3 = b3.Clone ( hID () ) ; h3.Reset ()
+    h4 = b4.Clone ( hID () ) ; h4.Reset ()
+    Ostap.HistoProject.project  ( frame , h1 , 'x'                       )
+    Ostap.HistoProject.project  ( frame , h2 , 'x'         , '(y>0)*z*z' )
+    Ostap.HistoProject.project2 ( frame , h3 , 'x' , 'y'   , 'z>0'       )
+    Ostap.HistoProject.project3 ( frame , h4 , 'x' , 'y' , 'z'           )
+    r1 = Ostap.StatVar.statVar  ( frame , 'x*y'                     )
+    r2 = Ostap.StatVar.statVar  ( frame , 'x+z'       , '1+y'       )
+
+    for b , h in ( ( b1 , h1 ) , ( b2 , h2 ) , ( b3 , h3 ) , ( b4 , h4 ) ) :
+        assert 0 < h.GetEntries () , 'Empty histogram!'
+        assert same ( b , h )      , 'Booked histogram differs from HistoProject'
+
+    for s , r in ( ( s1 , r1 ) , ( s2 , r2 ) ) :
+        logger.info ( 'Booked %s vs %s' % ( s , r ) )
+        assert s.nEntries () == r.nEntries ()                                  , 'Different number of entries'
+        assert abs ( s.sumw       () - r.sumw       () ) < 1.e-9 * ( 1 + abs ( r.sumw () ) ) , 'Different sum of weights'
+        assert abs ( s.mean       () - r.mean       () ) < 1.e-9 * ( 1 + abs ( r.mean () ) ) , 'Different mean'
+        assert abs ( s.dispersion () - r.dispersion () ) < 1.e-9 * ( 1 + r.dispersion () )   , 'Different dispersion'
+
+    logger.info ( 'DataFrameBooker is OK' )
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_frame_booker ()
+
+# =============================================================================
+# The END
+# =============================================================================
@@ -452,6 +452,151 @@ def _h1_legendre_fast_ ( h1 , degree , xmin = inf_neg , xmax = inf_pos ) :
     return func 
         
     
+# =============================================================================
+## fast parameterization of 1D-histogram with the function, that is linear in
+#  its parameters, via direct solution of the weighted least squares problem
+#  for the bin averages (no TF1, no MINUIT)
+#  @code
+#  histo = ...
+#  func  = Ostap.Math.Bernstein ( 5 , histo.xmin() , histo.xmax() ) 
+#  func , result = histo.param_fast ( func ) 
+#  func , result = histo.param_fast ( func , shape = Ostap.Utils.HistoParam.Increasing ) 
+#  @endcode
+#  @see Ostap::Utils::HistoParam
+def _h1_param_fast_ ( h1 , func , shape = None , xmin = inf_neg , xmax = inf_pos ) :
+    """Fast parameterization of 1D-histogram with the function, that is linear
+    in its parameters, via direct solution of weighted least squares problem
+    >>> histo = ...
+    >>> func  = Ostap.Math.Bernstein ( 5 , histo.xmin() , histo.xmax() ) 
+    >>> func , result = histo.param_fast ( func ) 
+    >>> func , result = histo.param_fast ( func , shape = Ostap.Utils.HistoParam.Increasing )
+    >>> print ( result.chi2() , result.ndf() , result.cov2 ( 0 , 0 ) )
+    - see Ostap.Utils.HistoParam
+    """
+    xmin  = max ( xmin , h1.xmin() ) 
+    xmax  = min ( xmax , h1.xmax() )
+    assert xmin < xmax , 'Invalid xmin/xmax: %s/%s' % ( xmin , xmax )
+    
+    param = Ostap.Utils.HistoParam ( h1 , xmin , xmax )
+    if shape is None : result = param.fit ( func )
+    else             : result = param.fit ( func , shape ) 
+    
+    if result.status().isFailure() :
+        logger.warning ( 'Fit status is %s [%s]' % ( result.status() , type ( func ).__name__ ) )
+        
+    return func , result 
+
+# =============================================================================
+## fast parameterization of 1D-histogram as Bernstein polynomial
+#  @code
+#  histo = ...
+#  func , result = histo.bernstein_fast ( 5 )
+#  func , result = histo.bernstein_fast ( 5 , shape = Ostap.Utils.HistoParam.Positive )
+#  @endcode
+#  @see Ostap::Utils::HistoParam
+def _h1_bernstein_fast_ ( h1 , degree , shape = None , xmin = inf_neg , xmax = inf_pos ) :
+    """Fast parameterization of 1D-histogram as Bernstein polynomial
+    >>> histo = ...
+    >>> func , result = histo.bernstein_fast ( 5 )
+    >>> func , result = histo.bernstein_fast ( 5 , shape = Ostap.Utils.HistoParam.Positive )
+    - see Ostap.Utils.HistoParam
+    """
+    xmin = max ( xmin , h1.xmin() ) 
+    xmax = min ( xmax , h1.xmax() )
+    func = Ostap.Math.Bernstein ( degree , xmin , xmax )
+    return _h1_param_fast_ ( h1 , func , shape , xmin , xmax )
+
+# =============================================================================
+## fast parameterization of 1D-histogram as positive Bernstein polynomial
+#  @see Ostap::Utils::HistoParam
+def _h1_positive_fast_ ( h1 , degree , xmin = inf_neg , xmax = inf_pos ) :
+    """Fast parameterization of 1D-histogram as positive Bernstein polynomial
+    >>> histo = ...
+    >>> func , result = histo.positive_fast ( 5 )
+    - see Ostap.Utils.HistoParam
+    """
+    return _h1_bernstein_fast_ ( h1 , degree , Ostap.Utils.HistoParam.Positive , xmin , xmax )
+
+# =============================================================================
+## fast parameterization of 1D-histogram as monotonic Bernstein polynomial
+#  @see Ostap::Utils::HistoParam
+def _h1_monotonic_fast_ ( h1 , degree , increasing = True , xmin = inf_neg , xmax = inf_pos ) :
+    """Fast parameterization of 1D-histogram as monotonic Bernstein polynomial
+    >>> histo = ...
+    >>> func , result = histo.monotonic_fast ( 5 , increasing = False )
+    - see Ostap.Utils.HistoParam
+    """
+    HP    = Ostap.Utils.HistoParam
+    shape = HP.Increasing if increasing else HP.Decreasing
+    return _h1_bernstein_fast_ ( h1 , degree , shape , xmin , xmax )
+
+# =============================================================================
+## fast parameterization of 1D-histogram as monotonic convex/concave Bernstein polynomial
+#  @see Ostap::Utils::HistoParam
+def _h1_convex_fast_ ( h1 , degree , increasing = True , convex = True , xmin = inf_neg , xmax = inf_pos ) :
+    """Fast parameterization of 1D-histogram as monotonic convex/concave Bernstein polynomial
+    >>> histo = ...
+    >>> func , result = histo.convex_fast ( 5 , increasing = True , convex = False )
+    - see Ostap.Utils.HistoParam
+    """
+    HP = Ostap.Utils.HistoParam
+    if   convex and increasing : shape = HP.ConvexIncreasing
+    elif convex                : shape = HP.ConvexDecreasing
+    elif increasing            : shape = HP.ConcaveIncreasing
+    else                       : shape = HP.ConcaveDecreasing 
+    return _h1_bernstein_fast_ ( h1 , degree , shape , xmin , xmax )
+
+# =============================================================================
+## fast parameterization of 1D-histogram as Chebyshev sum
+#  @see Ostap::Utils::HistoParam
+def _h1_chebyshev_fast_ ( h1 , degree , xmin = inf_neg , xmax = inf_pos ) :
+    """Fast parameterization of 1D-histogram as Chebyshev sum
+    >>> histo = ...
+    >>> func , result = histo.chebyshev_fast ( 5 )
+    - see Ostap.Utils.HistoParam
+    """
+    xmin = max ( xmin , h1.xmin() ) 
+    xmax = min ( xmax , h1.xmax() )
+    func = Ostap.Math.ChebyshevSum ( degree , xmin , xmax )
+    return _h1_param_fast_ ( h1 , func , None , xmin , xmax )
+
+# =============================================================================
+## fast parameterization of 1D-histogram as polynomial
+#  @see Ostap::Utils::HistoParam
+def _h1_polynomial_fast_ ( h1 , degree , xmin = inf_neg , xmax = inf_pos ) :
+    """Fast parameterization of 1D-histogram as polynomial
+    >>> histo = ...
+    >>> func , result = histo.polynomial_fast ( 3 )
+    - see Ostap.Utils.HistoParam
+    """
+    xmin = max ( xmin , h1.xmin() ) 
+    xmax = min ( xmax , h1.xmax() )
+    func = Ostap.Math.Polynomial ( degree , xmin , xmax )
+    return _h1_param_fast_ ( h1 , func , None , xmin , xmax )
+
+# =============================================================================
+## fast parameterization of 1D-histogram as B-spline
+#  @see Ostap::Utils::HistoParam
+def _h1_bspline_fast_ ( h1 , degree = 3 , knots = 3 , xmin = inf_neg , xmax = inf_pos ) :
+    """Fast parameterization of 1D-histogram as B-spline
+    >>> histo = ...
+    >>> func , result = histo.bSpline_fast ( degree = 3 , knots = 3 )
+    >>> func , result = histo.bSpline_fast ( degree = 3 , knots = [ 0.1 , 0.2, 0.8, 0.9 ] )
+    - see Ostap.Utils.HistoParam
+    """
+    xmin = max ( xmin , h1.xmin() ) 
+    xmax = min ( xmax , h1.xmax() )
+    #
+    if isinstance ( knots , integer_types ) and 0 <= knots :
+        func = Ostap.Math.BSpline ( xmin , xmax , knots , degree )
+    else :
+        from ostap.math.base import doubles
+        _knots = doubles ( xmin , xmax ) 
+        for k in knots : _knots.push_back( k )
+        func = Ostap.Math.BSpline ( _knots , degree )
+    #
+    return _h1_param_fast_ ( h1 , func , None , xmin , xmax )
+    
 # =============================================================================
 ## represent 1D-histo as Fourier polynomial
 #  @code
@@ -1158,6 +1303,14 @@ for t in ( ROOT.TH1D , ROOT.TH1F ) :
     t.convexspline   = _h1_convexspline_ 
     t.concavespline  = _h1_concavespline_ 
     t.legendre_fast  = _h1_legendre_fast_
+    t.param_fast     = _h1_param_fast_
+    t.bernstein_fast = _h1_bernstein_fast_
+    t.positive_fast  = _h1_positive_fast_
+    t.monotonic_fast = _h1_monotonic_fast_
+    t.convex_fast    = _h1_convex_fast_
+    t.chebyshev_fast = _h1_chebyshev_fast_
+    t.polynomial_fast= _h1_polynomial_fast_
+    t.bSpline_fast   = _h1_bspline_fast_
 
 _new_methods_ += [
     _h1_bernstein_     ,
@@ -1179,6 +1332,14 @@ _new_methods_ += [
     _h1_convexspline_  ,
     _h1_concavespline_ ,
     _h1_legendre_fast_ ,
+    _h1_param_fast_      ,
+    _h1_bernstein_fast_  ,
+    _h1_positive_fast_   ,
+    _h1_monotonic_fast_  ,
+    _h1_convex_fast_     ,
+    _h1_chebyshev_fast_  ,
+    _h1_polynomial_fast_ ,
+    _h1_bspline_fast_    ,
     ]
 
 # =============================================================================
@@ -0,0 +1,95 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developpers.
+# =============================================================================
+# @file ostap/histos/tests/test_histos_accumulator.py
+# Test module for Ostap::Utils::HistoAccumulator
+# - It compares the accumulated 1D,2D&3D-histograms with TH1::Fill
+# =============================================================================
+"""Test module for Ostap::Utils::HistoAccumulator
+- It compares the accumulated 1D,2D&3D-histograms with TH1::Fill
+"""
+# =============================================================================
+__author__ = "Ostap developers"
+__all__    = () ## nothing to import
+# =============================================================================
+import ROOT, random
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' == __name__  or '__builtin__' == __name__ :
+    logger = getLogger ( 'ostap.test_histos_accumulator' )
+else :
+    logger = getLogger ( __name__ )
+# =============================================================================
+logger.info ( 'Test for histogram accumulator')
+# =============================================================================
+from   ostap.core.core      import hID, Ostap
+import ostap.histos.histos
+from   builtins             import range
+from   array                import array
+
+## number of points
+N  = 100000
+
+def _compare_ ( h , a ) :
+    """Compare the histogram, filled with TH1::Fill, with the accumulated one"""
+    assert h.GetEntries() == a.GetEntries() , 'Invalid number of entries!'
+    for b in range ( h.GetNcells() ) :
+        assert abs ( h.GetBinContent ( b ) - a.GetBinContent ( b ) ) < 1.e-9 , 'Invalid bin content!'
+        assert abs ( h.GetBinError   ( b ) - a.GetBinError   ( b ) ) < 1.e-9 , 'Invalid bin error!'
+    ## the moments are exact, not from the bin centers
+    for axis in range ( 1 , h.GetDimension() + 1 ) :
+        assert abs ( h.GetMean ( axis ) - a.GetMean ( axis ) ) < 1.e-9 , 'Invalid mean!'
+        assert abs ( h.GetRMS  ( axis ) - a.GetRMS  ( axis ) ) < 1.e-9 , 'Invalid RMS!'
+
+# =============================================================================
+def test_accumulator () :
+
+    edges = array ( 'd' , [ -5 , -1 , 0 , 0.5 , 1 , 5 ] )
+    h1 = ROOT.TH1D ( hID() , '' , 100 , -3 , 3 )
+    h2 = ROOT.TH2D ( hID() , '' ,  20 , -3 , 3 , len ( edges ) - 1 , edges )
+    h3 = ROOT.TH3D ( hID() , '' ,  10 , -3 , 3 , 10 , -3 , 3 , 10 , -3 , 3 )
+    for h in ( h1 , h2 , h3 ) : h.Sumw2()
+
+    a1 = Ostap.Utils.HistoAccumulator ( h1 )
+    a2 = Ostap.Utils.HistoAccumulator ( h2 )
+    a3 = Ostap.Utils.HistoAccumulator ( h3 )
+
+    for i in range ( N ) :
+        x , y , z = random.gauss ( 0 , 1.5 ) , random.gauss ( 0 , 1.5 ) , random.gauss ( 0 , 1.5 )
+        w = random.uniform ( 0 , 2 )
+        h1.Fill ( x , w )         ; a1.fill ( x , w )
+        h2.Fill ( x , y , w )     ; a2.fill ( x , y , w )
+        h3.Fill ( x , y , z , w ) ; a3.fill ( x , y , z , w )
+
+    for h , a in ( ( h1 , a1 ) , ( h2 , a2 ) , ( h3 , a3 ) ) :
+        r = h.Clone ( hID() )
+        a.update ( r )
+        _compare_ ( h , r )
+
+    ## unit weights: fill(x,y) for 2D and fill(x,y,z) for 3D
+    for h in ( h2 , h3 ) : h.Reset()
+    a2.reset () ; a3.reset ()
+    for i in range ( 1000 ) :
+        x , y , z = random.gauss ( 0 , 1.5 ) , random.gauss ( 0 , 1.5 ) , random.gauss ( 0 , 1.5 )
+        h2.Fill ( x , y )     ; a2.fill ( x , y )
+        h3.Fill ( x , y , z ) ; a3.fill ( x , y , z )
+
+    for h , a in ( ( h2 , a2 ) , ( h3 , a3 ) ) :
+        r = h.Clone ( hID() )
+        a.update ( r )
+        _compare_ ( h , r )
+
+    logger.info ( 'Accumulated histograms are OK' )
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_accumulator ()
+
+# =============================================================================
+# The END
+# =============================================================================
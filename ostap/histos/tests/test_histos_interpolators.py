@@ -0,0 +1,138 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developers.
+# =============================================================================
+# @file ostap/histos/tests/test_histos_interpolators.py
+# Test module for the prepared histogram interpolators
+# - It compares Ostap::Math::HistoInterpolator1D/2D/3D with
+#   Ostap::Math::HistoInterpolation, including the points at the edges
+# =============================================================================
+"""Test module for the prepared histogram interpolators
+- It compares Ostap::Math::HistoInterpolator1D/2D/3D with
+  Ostap::Math::HistoInterpolation, including the points at the edges
+"""
+# =============================================================================
+__author__ = "Ostap developers"
+__all__    = () ## nothing to import
+# =============================================================================
+import ROOT, random
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' == __name__  or '__builtin__' == __name__ :
+    logger = getLogger ( 'ostap.test_histos_interpolators' )
+else :
+    logger = getLogger ( __name__ )
+# =============================================================================
+from   ostap.core.core      import hID, Ostap
+import ostap.histos.histos
+from   builtins             import range
+from   array                import array
+
+HI    = Ostap.Math.HistoInterpolation
+types = ( HI.Nearest , HI.Linear , HI.Quadratic , HI.Cubic )
+
+## uniform and non-uniform binnings
+edges = array ( 'd' , [ 0 , 0.05 , 0.1 , 0.2 , 0.3 , 0.45 , 0.6 , 0.8 , 1.0 ] )
+h1u   = ROOT.TH1D ( hID() , '' , 10 , 0 , 1 )
+h1n   = ROOT.TH1D ( hID() , '' , len ( edges ) - 1 , edges )
+h2    = ROOT.TH2D ( hID() , '' , 8 , 0 , 1 , 6 , 0 , 1 )
+h3    = ROOT.TH3D ( hID() , '' , 5 , 0 , 1 , 4 , 0 , 1 , 6 , 0 , 1 )
+for h in ( h1u , h1n , h2 , h3 ) : h.Sumw2()
+
+for i in range ( 20000 ) :
+    x , y , z = random.random () , random.random () , random.random ()
+    w = 1 + x * x + y - z
+    h1u.Fill ( x , w )
+    h1n.Fill ( x , w )
+    h2 .Fill ( x , y , w )
+    h3 .Fill ( x , y , z , w )
+
+## the test points: random, edges, bin centres and (for extrapolation) outside
+def points ( axis , extrapolate ) :
+    pnts = [ random.random () for i in range ( 20 ) ]
+    pnts += [ axis.GetXmin () , axis.GetXmax () ]
+    pnts += [ axis.GetBinCenter ( i ) for i in range ( 1 , axis.GetNbins () + 1 ) ]
+    if extrapolate : pnts += [ -0.1 , 1.1 ]
+    return pnts
+
+## equal values with errors?
+def same ( v1 , v2 ) :
+    return abs ( v1.value () - v2.value () ) <= 1.e-10 * ( 1 + abs ( v2.value () ) ) and \
+           abs ( v1.cov2  () - v2.cov2  () ) <= 1.e-10 * ( 1 + abs ( v2.cov2  () ) )
+
+## all combinations of flags: (edges, extrapolate, density)
+flags = [ ( e , x , d ) for e in ( True , False ) for x in ( False , True ) for d in ( False , True ) ]
+
+# =============================================================================
+def test_interpolators_1D () :
+
+    for h in ( h1u , h1n ) :
+        axis = h.GetXaxis ()
+        xmax = axis.GetXmax ()
+        for t in types :
+            for e , x , d in flags :
+                ip = Ostap.Math.HistoInterpolator1D ( h , t , e , x , d )
+                for p in points ( axis , x ) :
+                    v1 = ip ( p )
+                    if not e and not x and p == xmax :
+                        ## the documented difference: the legacy 1D interpolation
+                        #  returns the empty value here, the prepared one uses
+                        #  the last bin (as the legacy 2D/3D interpolation)
+                        v2 = HI.interpolate_1D ( h , p , t , e , x , d )
+                        assert 0 == v2.value () and 0 == v2.cov2 () , 'Legacy value at xmax is not empty!'
+                        v2 = HI.interpolate_1D ( h , p * ( 1 - 1.e-12 ) , t , e , x , d )
+                        assert abs ( v1.value () - v2.value () ) < 1.e-8 * ( 1 + abs ( v2.value () ) ) , \
+                               'Invalid value at xmax for type=%s' % t
+                        continue
+                    v2 = HI.interpolate_1D ( h , p , t , e , x , d )
+                    assert same ( v1 , v2 ) , \
+                           'Mismatch at x=%s type=%s edges=%s extrapolate=%s density=%s: %s vs %s' % ( p , t , e , x , d , v1 , v2 )
+                    assert v1.value () == ip.value ( p ) , 'Value-only path differs at x=%s' % p
+
+    logger.info ( 'HistoInterpolator1D is OK' )
+
+# =============================================================================
+def test_interpolators_2D () :
+
+    for tx in types :
+        for ty in types :
+            for e , x , d in flags :
+                ip = Ostap.Math.HistoInterpolator2D ( h2 , tx , ty , e , x , d )
+                for px in points ( h2.GetXaxis () , x ) :
+                    for py in points ( h2.GetYaxis () , x )[::3] :
+                        v1 = ip ( px , py )
+                        v2 = HI.interpolate_2D ( h2 , px , py , tx , ty , e , x , d )
+                        assert same ( v1 , v2 ) , \
+                               'Mismatch at (%s,%s) types=%s/%s flags=%s: %s vs %s' % ( px , py , tx , ty , ( e , x , d ) , v1 , v2 )
+
+    logger.info ( 'HistoInterpolator2D is OK' )
+
+# =============================================================================
+def test_interpolators_3D () :
+
+    for t in types :
+        for e , x , d in flags :
+            ip = Ostap.Math.HistoInterpolator3D ( h3 , t , t , t , e , x , d )
+            for px in points ( h3.GetXaxis () , x )[::2] :
+                for py in points ( h3.GetYaxis () , x )[::4] :
+                    for pz in points ( h3.GetZaxis () , x )[::4] :
+                        v1 = ip ( px , py , pz )
+                        v2 = HI.interpolate_3D ( h3 , px , py , pz , t , t , t , e , x , d )
+                        assert same ( v1 , v2 ) , \
+                               'Mismatch at (%s,%s,%s) type=%s flags=%s: %s vs %s' % ( px , py , pz , t , ( e , x , d ) , v1 , v2 )
+
+    logger.info ( 'HistoInterpolator3D is OK' )
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_interpolators_1D ()
+    test_interpolators_2D ()
+    test_interpolators_3D ()
+
+# =============================================================================
+# The END
+# =============================================================================
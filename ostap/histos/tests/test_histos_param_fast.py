@@ -0,0 +1,159 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developpers.
+# =============================================================================
+# @file ostap/histos/tests/test_histos_param_fast.py
+# Test module for Ostap::Utils::HistoParam
+# - It checks the fast parameterization of 1D-histograms via direct linear solves
+# - It checks the number of threads used by HistoParam::fit_many
+# =============================================================================
+"""Test module for Ostap::Utils::HistoParam
+- It checks the fast parameterization of 1D-histograms via direct linear solves
+- It checks the number of threads used by HistoParam::fit_many
+"""
+# =============================================================================
+__author__ = "Ostap developers"
+__all__    = () ## nothing to import
+# =============================================================================
+import ROOT, random
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' == __name__  or '__builtin__' == __name__ :
+    logger = getLogger ( 'ostap.test_histos_param_fast' )
+else :
+    logger = getLogger ( __name__ )
+# =============================================================================
+logger.info ( 'Test for fast histogram parameterization')
+# =============================================================================
+from   ostap.core.core      import hID, Ostap
+import ostap.histos.histos
+import ostap.histos.param
+from   builtins             import range
+
+## number of points
+N  = 100000
+
+## the histogram that records the threads reading it
+ROOT.gInterpreter.Declare ( """
+#include <set>
+#include <mutex>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include "TH1D.h"
+#include "Ostap/Bernstein.h"
+#include "Ostap/HistoParam.h"
+namespace OstapTest
+{
+  /// the histogram that records the threads reading its content
+  class ThreadHisto : public TH1D
+  {
+  public:
+    ThreadHisto ( const TH1D& h ) : TH1D ( h ) {}
+    Double_t GetBinContent ( Int_t bin ) const override
+    {
+      std::this_thread::sleep_for ( std::chrono::microseconds ( 200 ) ) ;
+      { std::lock_guard<std::mutex> lock ( s_mutex ) ; s_threads.insert ( std::this_thread::get_id () ) ; }
+      return TH1D::GetBinContent ( bin ) ;
+    }
+    static std::mutex                     s_mutex   ;
+    static std::set<std::thread::id>      s_threads ;
+  } ;
+  std::mutex                ThreadHisto::s_mutex   {} ;
+  std::set<std::thread::id> ThreadHisto::s_threads {} ;
+  /// fit the copies of the histogram, return the number of used threads (-1 for failed fits)
+  inline int fit_many_threads ( const TH1D& h , const unsigned int n , const unsigned short nthreads )
+  {
+    std::vector<std::unique_ptr<ThreadHisto>> histos ;
+    std::vector<const TH1*>                   ptrs   ;
+    for ( unsigned int i = 0 ; i < n ; ++i )
+    {
+      histos.emplace_back ( new ThreadHisto ( h ) ) ;
+      ptrs  .push_back    ( histos.back ().get () ) ;
+    }
+    std::vector<Ostap::Math::Bernstein> funcs ( n , Ostap::Math::Bernstein ( 3 , 0 , 1 ) ) ;
+    ThreadHisto::s_threads.clear () ;
+    const auto results = Ostap::Utils::HistoParam::fit_many ( ptrs , funcs , 0 , 1 , nthreads ) ;
+    for ( const auto& r : results ) { if ( r.status ().isFailure () ) { return -1 ; } }
+    return ThreadHisto::s_threads.size () ;
+  }
+}
+""" )
+
+# =============================================================================
+def test_param_fast () :
+
+    h = ROOT.TH1D ( hID() , '' , 50 , 0 , 1 )
+    h.Sumw2()
+
+    ## increasing convex density: f(x) ~ 1 + x^2
+    while h.GetEntries() < N :
+        x = random.uniform ( 0 , 1 )
+        if random.uniform ( 0 , 2 ) < 1 + x * x : h.Fill ( x )
+
+    ## unconstrained fits
+    for name , args in ( ( 'bernstein_fast'  , ( 3 , ) ) ,
+                         ( 'chebyshev_fast'  , ( 3 , ) ) ,
+                         ( 'polynomial_fast' , ( 3 , ) ) ,
+                         ( 'bSpline_fast'    , ( 3 , 2 ) ) ) :
+        func , r = getattr ( h , name ) ( *args )
+        assert r.status().isSuccess() , 'Fit failed for %s' % name
+        assert r.ndf() == 50 - func.npars() , 'Invalid ndf for %s' % name
+        assert r.chi2() < 3 * r.ndf()       , 'Bad chi2 %s for %s' % ( r.chi2() , name )
+        for i in range ( 1 , 51 , 7 ) :
+            x = h.GetBinCenter ( i )
+            assert abs ( func ( x ) - h.GetBinContent ( i ) ) < 5 * h.GetBinError ( i ) , \
+                   'Invalid %s at x=%s' % ( name , x )
+        assert all ( 0 < r.cov2 ( i , i ) for i in range ( func.npars() ) ) , \
+               'Invalid covariance for %s' % name
+        logger.info ( '%-16s chi2/ndf=%.2f/%d' % ( name , r.chi2() , r.ndf() ) )
+
+    ## constrained fits
+    for name , func , r in ( ( 'positive'           , ) + h.positive_fast  ( 4 ) ,
+                             ( 'increasing'         , ) + h.monotonic_fast ( 4 , True  ) ,
+                             ( 'convex increasing'  , ) + h.convex_fast    ( 4 , True , True ) ) :
+        assert r.status().isSuccess() , 'Fit failed for %s' % name
+        assert r.chi2() < 3 * r.ndf() , 'Bad chi2 %s for %s' % ( r.chi2() , name )
+        pars = [ func.par ( i ) for i in range ( func.npars() ) ]
+        assert all ( 0 <= p for p in pars ) , 'Negative coefficients for %s' % name
+        if 'increasing' in name :
+            assert all ( pars [ i ] <= pars [ i + 1 ] + 1.e-9 for i in range ( len ( pars ) - 1 ) ) , \
+                   'Non-monotonic coefficients for %s' % name
+        logger.info ( '%-16s chi2/ndf=%.2f/%d' % ( name , r.chi2() , r.ndf() ) )
+
+    ## the wrong shape is penalized by chi2
+    func , r = h.monotonic_fast ( 4 , False )
+    assert r.status().isSuccess() and 3 * r.ndf() < r.chi2() , 'Decreasing shape must not fit!'
+
+    logger.info ( 'Fast parameterizations are OK' )
+
+# =============================================================================
+def test_param_fit_many () :
+
+    h = ROOT.TH1D ( hID() , '' , 50 , 0 , 1 )
+    h.Sumw2()
+    for i in range ( 10000 ) : h.Fill ( random.uniform ( 0 , 1 ) )
+
+    ThreadPool = Ostap.Utils.ThreadPool
+    ThreadPool.setConcurrency ( 4 )
+    try :
+        for nthreads , expected in ( ( 1 , 1 ) , ( 2 , 2 ) , ( 3 , 3 ) , ( 0 , 4 ) ) :
+            used = ROOT.OstapTest.fit_many_threads ( h , 16 , nthreads )
+            logger.info ( 'fit_many nthreads=%d: %d threads are used' % ( nthreads , used ) )
+            assert 0 <= used         , 'Fit failed for nthreads=%d' % nthreads
+            assert expected == used  , 'fit_many with nthreads=%d uses %d threads' % ( nthreads , used )
+    finally :
+        ThreadPool.setConcurrency ( 0 )
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_param_fast     ()
+    test_param_fit_many ()
+
+# =============================================================================
+# The END
+# =============================================================================
@@ -0,0 +1,106 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developpers.
+# =============================================================================
+# @file ostap/histos/tests/test_histos_sampler.py
+# Test module for Ostap::Utils::HistoSampler
+# - It tests sampling of 1D&2D-histograms and compares the throughput
+#   with TH1::GetRandom/TH2::GetRandom2
+# =============================================================================
+"""Test module for Ostap::Utils::HistoSampler
+- It tests sampling of 1D&2D-histograms and compares the throughput
+  with TH1::GetRandom/TH2::GetRandom2
+"""
+# =============================================================================
+__author__ = "Ostap developers"
+__all__    = () ## nothing to import
+# =============================================================================
+import ROOT, random
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' == __name__  or '__builtin__' == __name__ :
+    logger = getLogger ( 'ostap.test_histos_sampler' )
+else :
+    logger = getLogger ( __name__ )
+# =============================================================================
+logger.info ( 'Test for histogram sampler')
+# =============================================================================
+from   ostap.core.core      import hID, Ostap
+from   ostap.utils.timing   import timing
+import ostap.histos.histos
+from   builtins             import range
+
+## number of points to be generated
+N  = 1000000
+
+h1 = ROOT.TH1D ( hID() , '' , 200 , -5 , 5 )
+h2 = ROOT.TH2D ( hID() , '' ,  50 , -5 , 5 , 50 , -5 , 5 )
+
+random.seed ( 10 )
+for i in range ( 100000 ) :
+    h1.Fill ( random.gauss ( 0.5 , 1.0 ) )
+    h2.Fill ( random.gauss ( 0.5 , 1.0 ) , random.gauss ( -0.5 , 2.0 ) )
+
+# =============================================================================
+def test_sampler_1D () :
+
+    sampler = Ostap.Utils.HistoSampler ( h1 )
+    rng     = Ostap.Utils.RandomStream ( 12345 )
+
+    with timing ( 'TH1::GetRandom' , logger = logger ) as t1 :
+        for i in range ( N // 10 ) : h1.GetRandom()
+
+    with timing ( 'HistoSampler'   , logger = logger ) as t2 :
+        points = sampler.sample ( N , rng )
+
+    with timing ( 'HistoSampler/MT' , logger = logger ) as t3 :
+        points_mt = sampler.sample ( N , rng , 0 , 0 )
+
+    if t2.delta > 0 and t3.delta > 0 :
+        logger.info ( 'Throughput: GetRandom %.3g/s, HistoSampler %.3g/s, HistoSampler/MT %.3g/s' % (
+            0.1 * N / max ( t1.delta , 1.e-9 ) , N / t2.delta , N / t3.delta ) )
+
+    assert points == points_mt , 'Multithreaded sampling is not reproducible!'
+
+    hs = h1.clone() ; hs.Reset()
+    for x in points : hs.Fill ( x )
+
+    logger.info ( 'Means  : %s vs %s' % ( h1.mean () , hs.mean () ) )
+    logger.info ( 'RMSs   : %s vs %s' % ( h1.rms  () , hs.rms  () ) )
+    assert abs ( h1.GetMean () - hs.GetMean () ) < 0.02 , 'Mean is not reproduced!'
+    assert abs ( h1.GetRMS  () - hs.GetRMS  () ) < 0.02 , 'RMS  is not reproduced!'
+
+# =============================================================================
+def test_sampler_2D () :
+
+    sampler = Ostap.Utils.HistoSampler ( h2 )
+    rng     = Ostap.Utils.RandomStream ( 12345 )
+
+    with timing ( 'TH2::GetRandom2' , logger = logger ) :
+        x = ROOT.Double ( 0 )
+        y = ROOT.Double ( 0 )
+        for i in range ( N // 10 ) : h2.GetRandom2 ( x , y )
+
+    with timing ( 'HistoSampler'    , logger = logger ) :
+        points = sampler.sample ( N , rng , 0 , 0 )
+
+    hs = h2.clone() ; hs.Reset()
+    for i in range ( N ) : hs.Fill ( points [ 2 * i ] , points [ 2 * i + 1 ] )
+
+    logger.info ( 'Means  : (%s,%s) vs (%s,%s)' % ( h2.GetMean ( 1 ) , h2.GetMean ( 2 ) ,
+                                                    hs.GetMean ( 1 ) , hs.GetMean ( 2 ) ) )
+    assert abs ( h2.GetMean ( 1 ) - hs.GetMean ( 1 ) ) < 0.02 , 'Mean(x) is not reproduced!'
+    assert abs ( h2.GetMean ( 2 ) - hs.GetMean ( 2 ) ) < 0.02 , 'Mean(y) is not reproduced!'
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_sampler_1D ()
+    test_sampler_2D ()
+
+# =============================================================================
+# The END
+# =============================================================================
@@ -0,0 +1,167 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developers.
+# =============================================================================
+# @file ostap/math/tests/test_math_chi2fit.py
+# Test module for the direct fit methods of Ostap::Math::Chi2Fit
+# - Linear mode is compared with the weighted least squares solution
+# - NonNegative mode is compared with the exact NNLS solution,
+#   including the parameter at the bound
+# =============================================================================
+""" Test module for the direct fit methods of Ostap::Math::Chi2Fit
+- Linear mode is compared with the weighted least squares solution
+- NonNegative mode is compared with the exact NNLS solution,
+  including the parameter at the bound
+"""
+# =============================================================================
+__author__ = "Ostap developers"
+__all__    = () ## nothing to import
+# =============================================================================
+import ROOT, random, math, itertools
+from   ostap.core.core      import Ostap, VE
+from   builtins             import range
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' == __name__  or '__builtin__' == __name__ :
+    logger = getLogger ( 'test_math_chi2fit' )
+else :
+    logger = getLogger ( __name__ )
+# =============================================================================
+
+Chi2Fit = Ostap.Math.Chi2Fit
+NBINS   = 40
+
+## the components: peak, flat and slope (without uncertainties)
+shapes  = (
+    lambda x : math.exp ( -0.5 * ( ( x - 0.5 ) / 0.1 ) ** 2 ) ,
+    lambda x : 1.0 ,
+    lambda x : x   ,
+    )
+xs      = [ ( i + 0.5 ) / NBINS for i in range ( NBINS ) ]
+cmps    = [ [ f ( x ) for x in xs ] for f in shapes ]
+
+## make the data as the given mixture with the Gaussian noise
+def make_data ( coeffs ) :
+    data = []
+    for i in range ( NBINS ) :
+        v = sum ( c * cmp [ i ] for c , cmp in zip ( coeffs , cmps ) )
+        e = math.sqrt ( abs ( v ) ) + 1
+        data.append ( ( random.gauss ( v , e ) , e * e ) )
+    return data
+
+## the weighted normal equations for the subset of components
+def normal ( data , index ) :
+    G = [ [ sum ( cmps [ j ][ i ] * cmps [ k ][ i ] / data [ i ][ 1 ] for i in range ( NBINS ) ) for k in index ] for j in index ]
+    b = [   sum ( cmps [ j ][ i ] * data [ i ][ 0 ] / data [ i ][ 1 ] for i in range ( NBINS ) ) for j in index ]
+    return G , b
+
+## solve the linear system via Gauss-Jordan elimination
+def solve ( G , b ) :
+    n = len ( b )
+    A = [ list ( G [ i ] ) + [ b [ i ] ] for i in range ( n ) ]
+    for c in range ( n ) :
+        p = max ( range ( c , n ) , key = lambda r : abs ( A [ r ][ c ] ) )
+        A [ c ] , A [ p ] = A [ p ] , A [ c ]
+        for r in range ( n ) :
+            if r != c :
+                f = A [ r ][ c ] / A [ c ][ c ]
+                A [ r ] = [ a - f * ac for a , ac in zip ( A [ r ] , A [ c ] ) ]
+    return [ A [ i ][ n ] / A [ i ][ i ] for i in range ( n ) ]
+
+## chi2 for the given parameters
+def chi2 ( data , params ) :
+    return sum ( ( data [ i ][ 0 ] - sum ( p * c [ i ] for p , c in zip ( params , cmps ) ) ) ** 2 / data [ i ][ 1 ] for i in range ( NBINS ) )
+
+## the weighted least squares solution for the subset of components
+def lstsq ( data , index ) :
+    G , b  = normal ( data , index )
+    z      = solve  ( G , b ) if index else []
+    params = [ 0.0 ] * len ( cmps )
+    for j , v in zip ( index , z ) : params [ j ] = v
+    return params
+
+## the exact NNLS solution: the best feasible solution over all active sets
+def nnls ( data ) :
+    best = None
+    for n in range ( len ( cmps ) + 1 ) :
+        for index in itertools.combinations ( range ( len ( cmps ) ) , n ) :
+            params = lstsq ( data , index )
+            if any ( p < 0 for p in params ) : continue
+            c2 = chi2 ( data , params )
+            if best is None or c2 < best [ 0 ] : best = c2 , params
+    return best [ 1 ]
+
+## run Chi2Fit with the given method
+def chi2fit ( data , method ) :
+    DATA = Chi2Fit.DATA
+    d    = DATA ()
+    for v , e2 in data : d.push_back ( VE ( v , e2 ) )
+    cc   = Chi2Fit.CMPS ()
+    for cmp in cmps :
+        c = DATA ()
+        for v in cmp : c.push_back ( VE ( v , 0 ) )
+        cc.push_back ( c )
+    return Chi2Fit ( d , cc , method )
+
+# =============================================================================
+def test_chi2fit_linear () :
+
+    data = make_data ( ( 200 , 10 , -30 ) )
+    fit  = chi2fit   ( data , Chi2Fit.Linear )
+    assert fit.status ().isSuccess () , 'Linear fit failed: %s' % fit.status ()
+
+    ref  = lstsq ( data , ( 0 , 1 , 2 ) )
+    G, b = normal ( data , ( 0 , 1 , 2 ) )
+    for j , p in enumerate ( ref ) :
+        ## the covariance is the inverse of G
+        unit = [ 1.0 if j == k else 0.0 for k in range ( 3 ) ]
+        cov  = solve ( G , unit )
+        logger.info ( 'Linear: parameter #%d %s (expected %.6g)' % ( j , fit.param ( j ) , p ) )
+        assert abs ( fit.param ( j ).value () - p ) < 1.e-6 * ( 1 + abs ( p ) ) , 'Invalid parameter #%d' % j
+        for k in range ( 3 ) :
+            assert abs ( fit.cov2 ( j , k ) - cov [ k ] ) < 1.e-6 * ( 1 + abs ( cov [ k ] ) ) , 'Invalid covariance (%d,%d)' % ( j , k )
+
+    c2 = chi2 ( data , ref )
+    assert abs ( fit.chi2 () - c2 ) < 1.e-6 * ( 1 + c2 ) , 'Invalid chi2'
+    assert 1 == fit.niters () , 'Reweighting without uncertainties of components'
+
+# =============================================================================
+def test_chi2fit_nnls () :
+
+    ## the unconstrained solution has the negative slope
+    data = make_data ( ( 200 , 10 , -30 ) )
+    ref  = nnls      ( data )
+    assert 0 in ref , 'No active constraint in the reference solution'
+
+    fit  = chi2fit   ( data , Chi2Fit.NonNegative )
+    assert fit.status ().isSuccess () , 'NNLS fit failed: %s' % fit.status ()
+    for j , p in enumerate ( ref ) :
+        logger.info ( 'NNLS:   parameter #%d %s (expected %.6g)' % ( j , fit.param ( j ) , p ) )
+        assert abs ( fit.param ( j ).value () - p ) < 1.e-6 * ( 1 + abs ( p ) ) , 'Invalid parameter #%d' % j
+        if 0 == p :
+            assert 0 == fit.param ( j ).cov2 () , 'Non-zero error for the parameter at the bound'
+
+    c2 = chi2 ( data , ref )
+    assert abs ( fit.chi2 () - c2 ) < 1.e-6 * ( 1 + c2 ) , 'Invalid chi2'
+
+    ## the positive mixture: NNLS coincides with the linear fit
+    data = make_data ( ( 200 , 10 , 30 ) )
+    f1   = chi2fit   ( data , Chi2Fit.Linear      )
+    f2   = chi2fit   ( data , Chi2Fit.NonNegative )
+    if all ( 0 < f1.param ( j ).value () for j in range ( 3 ) ) :
+        for j in range ( 3 ) :
+            assert abs ( f1.param ( j ).value () - f2.param ( j ).value () ) < 1.e-8 * ( 1 + abs ( f1.param ( j ).value () ) ) , \
+                   'NNLS differs from linear fit for #%d' % j
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_chi2fit_linear ()
+    test_chi2fit_nnls   ()
+
+# =============================================================================
+# The END
+# =============================================================================
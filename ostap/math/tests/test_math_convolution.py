@@ -0,0 +1,58 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developpers.
+# =============================================================================
+## @file ostap/math/tests/test_math_convolution.py
+#  Test module for Ostap::Math::Convolution
+# =============================================================================
+""" Test module for Ostap::Math::Convolution
+"""
+# =============================================================================
+from   __future__        import print_function
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' ==  __name__ : logger = getLogger ( 'test_math_convolution' )
+else                       : logger = getLogger ( __name__                )
+# =============================================================================
+import ROOT, math
+import ostap.math.models
+from   ostap.core.core      import Ostap
+from   ostap.utils.timing   import timing
+
+# =============================================================================
+def test_convolution () :
+
+    signal     = Ostap.Math.Gauss ( 0.0 , 1.0 )
+    resolution = Ostap.Math.Gauss ( 0.0 , 0.5 )
+
+    cnv = Ostap.Math.Convolution ( signal , resolution , -8 , 8 , -4 , 4 , 1024 )
+
+    def check ( sigma ) :
+        exact = Ostap.Math.Gauss ( 0.0 , math.sqrt ( 1 + sigma ** 2 ) )
+        return max ( abs ( cnv ( x ) - exact ( x ) ) for x in [ -6 + 0.01 * i for i in range ( 1200 ) ] )
+
+    dmax = check ( 0.5 )
+    logger.info ( 'FFT size %d, maximal deviation %.3g' % ( cnv.size () , dmax ) )
+    assert dmax < 1.e-4 , 'Convolution is not reproduced!'
+
+    assert not cnv.update () , 'Convolution is recalculated without the reason!'
+
+    resolution.setSigma ( 0.7 )
+    with timing ( 'Update resolution' , logger = logger ) :
+        assert cnv.update () , 'Convolution is not updated!'
+
+    dmax = check ( 0.7 )
+    logger.info ( 'Updated, maximal deviation %.3g' % dmax )
+    assert dmax < 1.e-4 , 'Convolution is not reproduced!'
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_convolution ()
+
+# =============================================================================
+# The END
+# =============================================================================
@@ -0,0 +1,131 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developpers.
+# =============================================================================
+## @file ostap/math/tests/test_math_dalitz_integrator.py
+#  Test module for the Dalitz-plot integration grid Ostap::Math::DalitzIntegrator
+#  The grid integrals are compared with the analytic area for massless
+#  particles and with the 1D integrals of Ostap::Kinematics::Dalitz::dRds1
+#  @see Ostap::Math::DalitzIntegrator
+# =============================================================================
+""" Test module for the Dalitz-plot integration grid Ostap::Math::DalitzIntegrator
+The grid integrals are compared with the analytic area for massless
+particles and with the 1D integrals of Ostap::Kinematics::Dalitz::dRds1
+"""
+# =============================================================================
+from   __future__        import print_function
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' ==  __name__ : logger = getLogger ( 'test_math_dalitz_integrator' )
+else                       : logger = getLogger ( __name__                      )
+# =============================================================================
+import ROOT, math
+from   ostap.core.core      import Ostap
+
+## the integrands and the 1D references are C++ functions
+ROOT.gInterpreter.Declare ( """
+#include <cmath>
+#include "Ostap/Dalitz.h"
+#include "Ostap/DalitzIntegrator.h"
+#include "Ostap/Integrator.h"
+#include "Ostap/Workspace.h"
+namespace OstapTest
+{
+  /// the test functions of (s1,s2)
+  inline Ostap::Math::DalitzIntegrator::function2 dp_func ( const int k )
+  {
+    switch ( k )
+    {
+    case 0  : return [] ( double    , double    ) { return 1.0     ; } ;
+    case 1  : return [] ( double s1 , double s2 ) { return s1 * s2 ; } ;
+    default : return [] ( double s1 , double s2 ) { return std::exp ( -0.1 * s1 ) * s2 * s2 ; } ;
+    }
+  }
+  /// the grid integral
+  inline double dp_grid ( const Ostap::Kinematics::Dalitz& d , const int k , const unsigned short nthreads )
+  { return Ostap::Math::DalitzIntegrator ( d ).integrate ( dp_func ( k ) , nthreads ) ; }
+  /// the grid integral with the tabulated values
+  inline double dp_table ( const Ostap::Kinematics::Dalitz& d , const int k , const int t )
+  {
+    const Ostap::Math::DalitzIntegrator integrator ( d ) ;
+    std::vector<double> values ;
+    integrator.evaluate ( dp_func ( t ) , values ) ;
+    return integrator.integrate ( dp_func ( k ) , values ) ;
+  }
+  /// the reference: 1D integral over s1 of the analytic integral over s2
+  inline double dp_ref ( const Ostap::Kinematics::Dalitz& d , const int k )
+  {
+    auto fun = [&d,k] ( double s1 ) -> double
+    {
+      const std::pair<double,double> r = d.s2_minmax_for_s1 ( s1 ) ;
+      const double a = r.first , b = r.second ;
+      switch ( k )
+      {
+      case 0  : return b - a ;
+      case 1  : return s1 * ( b * b - a * a ) / 2 ;
+      default : return std::exp ( -0.1 * s1 ) * ( b * b * b - a * a * a ) / 3 ;
+      }
+    } ;
+    Ostap::Math::WorkSpace ws ;
+    return Ostap::Math::Integrator().integrate ( fun , d.s1_min () , d.s1_max () , ws ) ;
+  }
+  /// the reference phase space: 1D integral of dR/ds1
+  inline double dp_ps ( const Ostap::Kinematics::Dalitz& d )
+  {
+    Ostap::Math::WorkSpace ws ;
+    return Ostap::Math::Integrator().integrate
+      ( [&d] ( double s1 ) { return d.dRds1 ( s1 ) ; } , d.s1_min () , d.s1_max () , ws ) ;
+  }
+}
+""" )
+
+dalitz_plots = (
+    Ostap.Kinematics.Dalitz ( 5.0 , 0   , 0   , 0   ) , ## massless
+    Ostap.Kinematics.Dalitz ( 5.0 , 0.1 , 0.2 , 0.3 ) ,
+    Ostap.Kinematics.Dalitz ( 5.3 , 0.5 , 0.5 , 3.0 ) , ## heavy particle
+    Ostap.Kinematics.Dalitz ( 3.1 , 1.0 , 1.0 , 1.0 ) , ## close to threshold
+    )
+
+# =============================================================================
+def test_dalitz_integrator () :
+
+    for d in dalitz_plots :
+
+        integrator = Ostap.Math.DalitzIntegrator ( d )
+        s          = d.s ()
+
+        ## the area and the phase space volume
+        area = ROOT.OstapTest.dp_ref ( d , 0 )
+        ps   = ROOT.OstapTest.dp_ps  ( d )
+        logger.info ( 'M=%.2f m=(%.1f,%.1f,%.1f): area %-.10g (ref %-.10g) phase space %-.10g (ref %-.10g)' % (
+            d.M () , d.m1 () , d.m2 () , d.m3 () , integrator.area () , area , integrator.phase_space () , ps ) )
+        assert abs ( integrator.area        () - area ) < 1.e-7 * area , 'Invalid area'
+        assert abs ( integrator.phase_space () - ps   ) < 1.e-7 * ps   , 'Invalid phase space'
+        if 0 == d.m1 () == d.m2 () == d.m3 () :
+            ## massless particles: the triangle and R3 = pi^2 s / 8
+            assert abs ( integrator.area        () - 0.5 * s * s            ) < 1.e-10 * s * s , 'Invalid massless area'
+            assert abs ( integrator.phase_space () - math.pi ** 2 * s / 8.0 ) < 1.e-10 * s     , 'Invalid massless phase space'
+
+        ## the integrals of the functions: sequential and in threads
+        for k in ( 0 , 1 , 2 ) :
+            ref = ROOT.OstapTest.dp_ref  ( d , k )
+            r1  = ROOT.OstapTest.dp_grid ( d , k , 1 )
+            r4  = ROOT.OstapTest.dp_grid ( d , k , 4 )
+            assert abs ( r1 - ref ) < 1.e-7 * abs ( ref ) , 'Invalid integral #%d: %s vs %s' % ( k , r1 , ref )
+            assert abs ( r4 - r1  ) < 1.e-12 * abs ( r1 ) , 'Different integrals in threads #%d' % k
+
+        ## the tabulated values: integral of 1*(s1*s2) is the integral of s1*s2
+        assert abs ( ROOT.OstapTest.dp_table ( d , 0 , 1 ) - ROOT.OstapTest.dp_grid ( d , 1 , 1 ) ) < \
+               1.e-12 * abs ( ROOT.OstapTest.dp_grid ( d , 1 , 1 ) ) , 'Invalid integral with the table'
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_dalitz_integrator ()
+
+# =============================================================================
+# The END
+# =============================================================================
@@ -0,0 +1,129 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developpers.
+# =============================================================================
+## @file ostap/math/tests/test_math_gausskronrod.py
+#  Test module for the reentrant Gauss-Kronrod integration
+#  Ostap::Math::Integrator::gk_integrate
+#  The results are compared with the known integrals and with GSL QAG
+# =============================================================================
+""" Test module for the reentrant Gauss-Kronrod integration
+Ostap::Math::Integrator::gk_integrate
+The results are compared with the known integrals and with GSL QAG
+"""
+# =============================================================================
+from   __future__        import print_function
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' ==  __name__ : logger = getLogger ( 'test_math_gausskronrod' )
+else                       : logger = getLogger ( __name__                 )
+# =============================================================================
+import ROOT, math
+from   ostap.core.core      import Ostap
+
+## the integrands are C++ functions: the batch mode runs them in threads
+ROOT.gInterpreter.Declare ( """
+#include <cmath>
+#include "Ostap/Integrator.h"
+#include "Ostap/Workspace.h"
+namespace OstapTest
+{
+  inline Ostap::Math::Integrator::function1 gk_func ( const int k )
+  {
+    switch ( k )
+    {
+    case 0  : return [] ( double x ) { return std::sin  ( x ) ; } ;
+    case 1  : return [] ( double x ) { return std::exp  ( x ) ; } ;
+    case 2  : return [] ( double x ) { return std::exp  ( -0.5 * x * x ) ; } ;
+    case 3  : return [] ( double x ) { return 1 / ( 1 + x * x ) ; } ;
+    case 4  : return [] ( double x ) { return x * x * x ; } ;
+    case 5  : return [] ( double x ) { return 1 / std::sqrt ( x ) ; } ;
+    default : return [] ( double x ) { return std::log  ( x ) ; } ;
+    }
+  }
+  inline Ostap::Math::Integrator::Result gk_one ( const int k , const double a , const double b )
+  { return Ostap::Math::Integrator().gk_integrate ( gk_func ( k ) , a , b ) ; }
+  inline double gsl_one ( const int k , const double a , const double b )
+  {
+    Ostap::Math::WorkSpace ws ;
+    return Ostap::Math::Integrator().integrate ( gk_func ( k ) , a , b , ws ) ;
+  }
+  inline Ostap::Math::Integrator::Results gk_batch
+  ( const std::vector<int>& ks , const std::vector<double>& as , const std::vector<double>& bs , const unsigned short n )
+  {
+    Ostap::Math::Integrator::Tasks tasks ;
+    for ( std::size_t i = 0 ; i < ks.size () ; ++i ) { tasks.push_back ( { gk_func ( ks [ i ] ) , as [ i ] , bs [ i ] } ) ; }
+    return Ostap::Math::Integrator().gk_integrate ( tasks , n ) ;
+  }
+  // the integrand calls the integrator: \\int_0^1\\int_0^1 (x+y) dy dx = 1
+  inline Ostap::Math::Integrator::Result gk_nested ()
+  {
+    const Ostap::Math::Integrator integrator ;
+    return integrator.gk_integrate
+      ( [&integrator] ( double x )
+        { return std::get<1> ( integrator.gk_integrate ( [x] ( double y ) { return x + y ; } , 0 , 1 ) ) ; } , 0 , 1 ) ;
+  }
+}
+""" )
+
+## (function, xmin, xmax, exact value, compare with GSL)
+integrals = (
+    ( 0 ,   0 , math.pi , 2                        , True  ) ,
+    ( 1 ,   0 , 1       , math.e - 1               , True  ) ,
+    ( 2 , -10 , 10      , math.sqrt ( 2 * math.pi ) , True  ) ,
+    ( 3 ,  -1 , 1       , math.pi / 2              , True  ) ,
+    ( 4 ,  -2 , 3       , 16.25                    , True  ) ,
+    ( 5 ,   0 , 1       , 2                        , False ) , ## singular at x=0
+    ( 6 ,   0 , 1       , -1                       , False ) , ## singular at x=0
+    )
+
+# =============================================================================
+def test_gausskronrod () :
+
+    for k , a , b , exact , gsl in integrals :
+        r      = ROOT.OstapTest.gk_one ( k , a , b )
+        status = ROOT.std.get[0] ( r )
+        value  = ROOT.std.get[1] ( r )
+        error  = ROOT.std.get[2] ( r )
+        logger.info ( 'Integral #%d: %-.12g +- %.2g (exact %-.12g)' % ( k , value , error , exact ) )
+        assert 0 == status , 'Invalid status %s for #%d' % ( status , k )
+        assert abs ( value - exact ) < 1.e-7 * max ( 1 , abs ( exact ) ) , 'Invalid integral #%d' % k
+        if gsl :
+            vgsl = ROOT.OstapTest.gsl_one ( k , a , b )
+            assert abs ( value - vgsl ) < 1.e-8 * max ( 1 , abs ( exact ) ) , 'Different from GSL for #%d' % k
+
+# =============================================================================
+def test_gausskronrod_batch () :
+
+    ks = ROOT.std.vector('int')    ()
+    av = ROOT.std.vector('double') ()
+    bv = ROOT.std.vector('double') ()
+    for i in range ( 50 ) :
+        for k , a , b , exact , gsl in integrals :
+            ks.push_back ( k ) ; av.push_back ( a ) ; bv.push_back ( b )
+
+    for n in ( 1 , 4 ) :
+        results = ROOT.OstapTest.gk_batch ( ks , av , bv , n )
+        assert len ( results ) == len ( ks ) , 'Invalid number of results'
+        for i , r in enumerate ( results ) :
+            single = ROOT.OstapTest.gk_one ( ks [ i ] , av [ i ] , bv [ i ] )
+            assert ROOT.std.get[0] ( r ) == ROOT.std.get[0] ( single ) and \
+                   ROOT.std.get[1] ( r ) == ROOT.std.get[1] ( single ) , 'Batch differs from single integral #%d' % i
+        logger.info ( 'Batch of %d integrals in %d threads is OK' % ( len ( results ) , n ) )
+
+    r = ROOT.OstapTest.gk_nested ()
+    assert 0 == ROOT.std.get[0] ( r ) and abs ( ROOT.std.get[1] ( r ) - 1 ) < 1.e-10 , 'Invalid nested integral'
+    logger.info ( 'Nested integration is OK' )
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_gausskronrod       ()
+    test_gausskronrod_batch ()
+
+# =============================================================================
+# The END
+# =============================================================================
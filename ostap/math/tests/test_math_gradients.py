@@ -0,0 +1,80 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developpers.
+# =============================================================================
+## @file ostap/math/tests/test_math_gradients.py
+#  Test module for the analytic parameter gradients of the peak shapes
+#  The analytic derivatives are compared with the symmetric finite differences
+# =============================================================================
+""" Test module for the analytic parameter gradients of the peak shapes
+The analytic derivatives are compared with the symmetric finite differences
+"""
+# =============================================================================
+from   __future__        import print_function
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' ==  __name__ : logger = getLogger ( 'test_math_gradients' )
+else                       : logger = getLogger ( __name__              )
+# =============================================================================
+import ROOT
+from   array                import array
+import ostap.math.models
+from   ostap.core.core      import Ostap
+
+# =============================================================================
+## the shapes to be tested
+shapes = (
+    Ostap.Math.BifurcatedGauss ( 0.3 , 1.1 , 0.7 ) ,
+    Ostap.Math.CrystalBall     ( 0.3 , 1.1 , 1.5 , 3   ) ,
+    Ostap.Math.StudentT        ( 0.3 , 1.1 , 3.5 ) ,
+    Ostap.Math.Bukin           ( 0.3 , 1.1 , 0.2 , 0.4 , 0.3 ) ,
+    Ostap.Math.Bukin           ( 0.3 , 1.1 , -0.3 , 0.4 , 0.6 ) ,
+    Ostap.Math.Apolonios       ( 0.3 , 1.1 , 1.5 , 2   , 1.2 ) ,
+    Ostap.Math.Apolonios2      ( 0.3 , 1.1 , 0.7 , 1.5 ) ,
+    )
+
+# =============================================================================
+## compare the analytic gradient with the finite differences
+def check_gradient ( shape ) :
+
+    N    = shape.npars ()
+    grad = array ( 'd' , N * [ 0.0 ] )
+
+    dmax = 0
+    for i in range ( 0 , 33 ) :
+        x = -6 + 0.37 * i
+        f = shape.gradient ( x , grad )
+        assert abs ( f - shape ( x ) ) <= 1.e-12 * abs ( f ) , \
+               'Invalid value for %s at x=%s' % ( type ( shape ).__name__ , x )
+        for k in range ( N ) :
+            p  = shape.par ( k )
+            h  = 1.e-6 * max ( 1.0 , abs ( p ) )
+            s1 = type ( shape ) ( shape )
+            s2 = type ( shape ) ( shape )
+            s1.setPar ( k , p + h )
+            s2.setPar ( k , p - h )
+            fd = ( s1 ( x ) - s2 ( x ) ) / ( 2 * h )
+            d  = abs ( fd - grad [ k ] ) / max ( 1.e-6 , abs ( fd ) + abs ( grad [ k ] ) )
+            dmax = max ( dmax , d )
+
+    return dmax
+
+# =============================================================================
+def test_gradients () :
+
+    for shape in shapes :
+        dmax = check_gradient ( shape )
+        logger.info ( '%-16s maximal deviation: %.3g' % ( type ( shape ).__name__ , dmax ) )
+        assert dmax < 1.e-4 , 'Invalid gradient for %s' % type ( shape ).__name__
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_gradients ()
+
+# =============================================================================
+# The END
+# =============================================================================
@@ -0,0 +1,197 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developers.
+# =============================================================================
+# @file ostap/math/tests/test_math_kinematics_batch.py
+# Test module for the columnar kinematics Ostap::Kinematics::Batch
+# - each batch kernel is compared element-wise with the scalar function
+#   from Ostap::Kinematics for random 4-vectors
+# =============================================================================
+""" Test module for the columnar kinematics Ostap::Kinematics::Batch
+- each batch kernel is compared element-wise with the scalar function
+  from Ostap::Kinematics for random 4-vectors
+"""
+# =============================================================================
+__author__ = "Ostap developers"
+__all__    = () ## nothing to import
+# =============================================================================
+import ROOT
+from   ostap.core.core      import Ostap
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' == __name__  or '__builtin__' == __name__ :
+    logger = getLogger ( 'test_math_kinematics_batch' )
+else :
+    logger = getLogger ( __name__ )
+# =============================================================================
+
+## the comparison is done in C++: random columns, batch kernels and scalar loops
+ROOT.gInterpreter.Declare ( """
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "Ostap/Kinematics.h"
+#include "Ostap/KinematicsBatch.h"
+namespace OstapTest
+{
+  /// the columns of random 4-vectors with the given masses
+  struct KBColumns
+  {
+    KBColumns ( const std::size_t n , std::mt19937& g , const double mmin , const double mmax )
+      : x ( n ) , y ( n ) , z ( n ) , e ( n )
+    {
+      std::uniform_real_distribution<double> p ( -5 , 5 ) , m ( mmin , mmax ) ;
+      for ( std::size_t i = 0 ; i < n ; ++i )
+      {
+        x [ i ] = p ( g ) ; y [ i ] = p ( g ) ; z [ i ] = p ( g ) ;
+        const double mass = m ( g ) ;
+        e [ i ] = std::sqrt ( x [ i ] * x [ i ] + y [ i ] * y [ i ] + z [ i ] * z [ i ] + mass * mass ) ;
+      }
+    }
+    Ostap::LorentzVector lv ( const std::size_t i ) const
+    { return Ostap::LorentzVector ( x [ i ] , y [ i ] , z [ i ] , e [ i ] ) ; }
+    Ostap::Vector3D      v3 ( const std::size_t i ) const
+    { return Ostap::Vector3D      ( x [ i ] , y [ i ] , z [ i ] ) ; }
+    std::vector<double> x , y , z , e ;
+  } ;
+  /// the maximal relative deviation between the columns
+  inline double kb_delta ( const std::vector<double>& a , const std::vector<double>& b )
+  {
+    double d = 0 ;
+    for ( std::size_t i = 0 ; i < a.size () ; ++i )
+    { d = std::max ( d , std::abs ( a [ i ] - b [ i ] ) / ( 1 + std::abs ( b [ i ] ) ) ) ; }
+    return d ;
+  }
+  /// compare the batch kernel with the scalar function
+  inline double kb_check ( const std::string& what , const std::size_t n , const unsigned int seed )
+  {
+    std::mt19937 g ( seed ) ;
+    const KBColumns D ( n , g , 0.1 , 0.5 ) ;  // light daughters
+    const KBColumns A ( n , g , 0.1 , 0.5 ) ;
+    const KBColumns M ( n , g , 2.0 , 5.0 ) ;  // heavy mothers
+    const KBColumns P ( n , g , 5.0 , 9.0 ) ;
+    std::vector<double> batch ( n ) , scalar ( n ) ;
+    //
+    namespace K = Ostap::Kinematics ;
+    namespace B = Ostap::Kinematics::Batch ;
+    if      ( "mass2" == what )
+    {
+      B::mass2 ( n , M.x.data () , M.y.data () , M.z.data () , M.e.data () , batch.data () ) ;
+      for ( std::size_t i = 0 ; i < n ; ++i ) { scalar [ i ] = M.lv ( i ).M2 () ; }
+    }
+    else if ( "mass" == what )
+    {
+      B::mass  ( n , M.x.data () , M.y.data () , M.z.data () , M.e.data () , batch.data () ) ;
+      for ( std::size_t i = 0 ; i < n ; ++i ) { scalar [ i ] = M.lv ( i ).M  () ; }
+    }
+    else if ( "kallen" == what )
+    {
+      B::kallen ( n , M.x.data () , D.y.data () , A.z.data () , batch.data () ) ;
+      for ( std::size_t i = 0 ; i < n ; ++i ) { scalar [ i ] = K::kallen ( M.x [ i ] , D.y [ i ] , A.z [ i ] ) ; }
+    }
+    else if ( "restMomentum" == what )
+    {
+      B::restMomentum ( n ,
+                        D.x.data () , D.y.data () , D.z.data () , D.e.data () ,
+                        M.x.data () , M.y.data () , M.z.data () , M.e.data () , batch.data () ) ;
+      for ( std::size_t i = 0 ; i < n ; ++i ) { scalar [ i ] = K::restMomentum ( D.lv ( i ) , M.lv ( i ) ) ; }
+    }
+    else if ( "restEnergy" == what )
+    {
+      B::restEnergy   ( n ,
+                        D.x.data () , D.y.data () , D.z.data () , D.e.data () ,
+                        M.x.data () , M.y.data () , M.z.data () , M.e.data () , batch.data () ) ;
+      for ( std::size_t i = 0 ; i < n ; ++i ) { scalar [ i ] = K::restEnergy   ( D.lv ( i ) , M.lv ( i ) ) ; }
+    }
+    else if ( "transverseMomentumDir" == what )
+    {
+      B::transverseMomentumDir ( n ,
+                                 D.x.data () , D.y.data () , D.z.data () ,
+                                 M.x.data () , M.y.data () , M.z.data () , batch.data () ) ;
+      for ( std::size_t i = 0 ; i < n ; ++i ) { scalar [ i ] = K::transverseMomentumDir ( D.v3 ( i ) , M.v3 ( i ) ) ; }
+    }
+    else if ( "decayAngle3" == what )
+    {
+      B::decayAngle ( n ,
+                      P.x.data () , P.y.data () , P.z.data () , P.e.data () ,
+                      M.x.data () , M.y.data () , M.z.data () , M.e.data () ,
+                      D.x.data () , D.y.data () , D.z.data () , D.e.data () , batch.data () ) ;
+      for ( std::size_t i = 0 ; i < n ; ++i ) { scalar [ i ] = K::decayAngle ( P.lv ( i ) , M.lv ( i ) , D.lv ( i ) ) ; }
+    }
+    else if ( "decayAngle2" == what )
+    {
+      B::decayAngle ( n ,
+                      D.x.data () , D.y.data () , D.z.data () , D.e.data () ,
+                      M.x.data () , M.y.data () , M.z.data () , M.e.data () , batch.data () ) ;
+      for ( std::size_t i = 0 ; i < n ; ++i ) { scalar [ i ] = K::decayAngle ( D.lv ( i ) , M.lv ( i ) ) ; }
+    }
+    else if ( "cosThetaRest" == what )
+    {
+      B::cosThetaRest ( n ,
+                        D.x.data () , D.y.data () , D.z.data () , D.e.data () ,
+                        A.x.data () , A.y.data () , A.z.data () , A.e.data () ,
+                        M.x.data () , M.y.data () , M.z.data () , M.e.data () , batch.data () ) ;
+      for ( std::size_t i = 0 ; i < n ; ++i ) { scalar [ i ] = K::cosThetaRest ( D.lv ( i ) , A.lv ( i ) , M.lv ( i ) ) ; }
+    }
+    else if ( "armenterosPodolanskiX" == what )
+    {
+      B::armenterosPodolanskiX ( n ,
+                                 D.x.data () , D.y.data () , D.z.data () ,
+                                 A.x.data () , A.y.data () , A.z.data () , batch.data () ) ;
+      for ( std::size_t i = 0 ; i < n ; ++i ) { scalar [ i ] = K::armenterosPodolanskiX ( D.v3 ( i ) , A.v3 ( i ) ) ; }
+    }
+    else if ( "boost" == what )
+    {
+      std::vector<double> rx ( n ) , ry ( n ) , rz ( n ) , re ( n ) ;
+      B::boost ( n ,
+                 D.x.data () , D.y.data () , D.z.data () , D.e.data () ,
+                 M.x.data () , M.y.data () , M.z.data () , M.e.data () ,
+                 rx.data () , ry.data () , rz.data () , re.data () ) ;
+      double d = 0 ;
+      for ( std::size_t i = 0 ; i < n ; ++i )
+      {
+        const Ostap::LorentzVector r = K::boost ( D.lv ( i ) , M.lv ( i ) ) ;
+        d = std::max ( { d ,
+              std::abs ( rx [ i ] - r.Px () ) / ( 1 + std::abs ( r.Px () ) ) ,
+              std::abs ( ry [ i ] - r.Py () ) / ( 1 + std::abs ( r.Py () ) ) ,
+              std::abs ( rz [ i ] - r.Pz () ) / ( 1 + std::abs ( r.Pz () ) ) ,
+              std::abs ( re [ i ] - r.E  () ) / ( 1 + std::abs ( r.E  () ) ) } ) ;
+      }
+      return d ;
+    }
+    else { return -1 ; }
+    //
+    return kb_delta ( batch , scalar ) ;
+  }
+}
+""" )
+
+kernels = ( 'mass2'                 , 'mass'                  , 'kallen'       ,
+            'restMomentum'          , 'restEnergy'            ,
+            'transverseMomentumDir' , 'decayAngle3'           , 'decayAngle2'  ,
+            'cosThetaRest'          , 'armenterosPodolanskiX' , 'boost'        )
+
+# =============================================================================
+def test_kinematics_batch () :
+
+    for seed , n in ( ( 1 , 1 ) , ( 2 , 7 ) , ( 3 , 1000 ) , ( 4 , 10001 ) ) :
+        for k in kernels :
+            d = ROOT.OstapTest.kb_check ( k , n , seed )
+            assert 0 <= d     , 'Unknown kernel %s' % k
+            assert d < 1.e-10 , 'Batch %s differs from scalar by %.3g (n=%d)' % ( k , d , n )
+
+    logger.info ( 'All %d batch kernels agree with the scalar functions' % len ( kernels ) )
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_kinematics_batch ()
+
+# =============================================================================
+# The END
+# =============================================================================
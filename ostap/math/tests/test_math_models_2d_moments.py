@@ -0,0 +1,124 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developpers.
+# =============================================================================
+## @file ostap/math/tests/test_math_models_2d_moments.py
+#  Test module for the precomputed moment tables of the 2D phase-space models
+#  The integrals via the tables are compared with the direct numerical
+#  integration of the model for several parameter sets and integration ranges
+#  @see Ostap::Math::PS2DPol
+#  @see Ostap::Math::PS2DPolSym
+#  @see Ostap::Math::PS2DPol2
+#  @see Ostap::Math::PS2DPol2Sym
+#  @see Ostap::Math::PS2DPol3
+#  @see Ostap::Math::PS2DPol3Sym
+#  @see Ostap::Math::ExpoPS2DPol
+# =============================================================================
+""" Test module for the precomputed moment tables of the 2D phase-space models
+The integrals via the tables are compared with the direct numerical
+integration of the model for several parameter sets and integration ranges
+"""
+# =============================================================================
+from   __future__        import print_function
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' ==  __name__ : logger = getLogger ( 'test_math_models_2d_moments' )
+else                       : logger = getLogger ( __name__                      )
+# =============================================================================
+import ROOT, random
+import ostap.math.models
+from   ostap.core.core      import Ostap, SE
+
+## the references are the direct integrals of the model
+ROOT.gInterpreter.Declare ( """
+#include <cmath>
+#include <algorithm>
+#include "Ostap/Models2D.h"
+#include "Ostap/Integrator.h"
+#include "Ostap/Workspace.h"
+namespace OstapTest
+{
+  /// relative difference
+  inline double m2d_delta ( const double a , const double b )
+  { return std::abs ( a - b ) / std::max ( 1.e-12 , std::abs ( a ) + std::abs ( b ) ) ; }
+  /** maximal relative difference of integral/integrateX/integrateY
+   *  with the direct numerical integration of the model
+   */
+  template <class MODEL>
+  inline double m2d_check ( const MODEL& model ,
+                            const double x1 , const double x2 ,
+                            const double y1 , const double y2 )
+  {
+    const Ostap::Math::Integrator integrator {} ;
+    const Ostap::Math::WorkSpace  ws         {} ;
+    const double xm = 0.5 * ( x1 + x2 ) ;
+    const double ym = 0.5 * ( y1 + y2 ) ;
+    //
+    const double i2 = integrator.integrate
+      ( [&model] ( double x , double y ) { return model ( x , y ) ; } , x1 , x2 , y1 , y2 ) ;
+    const double ix = integrator.integrate
+      ( [&model,ym] ( double x ) { return model ( x , ym ) ; } , x1 , x2 , ws ) ;
+    const double iy = integrator.integrate
+      ( [&model,xm] ( double y ) { return model ( xm , y ) ; } , y1 , y2 , ws ) ;
+    //
+    return std::max ( { m2d_delta ( model.integral   ( x1 , x2 , y1 , y2 ) , i2 ) ,
+                        m2d_delta ( model.integrateX ( ym , x1 , x2 )      , ix ) ,
+                        m2d_delta ( model.integrateY ( xm , y1 , y2 )      , iy ) } ) ;
+  }
+}
+""" )
+
+xmin , xmax = 0.0 , 2.0
+mmax        = 3.0
+
+psx = Ostap.Math.PhaseSpaceNL ( xmin + 1.e-5 * ( xmax - xmin ) , xmax - 1.e-5 * ( xmax - xmin ) , 3 , 7 )
+psy = Ostap.Math.PhaseSpaceNL ( xmin + 1.e-5 * ( xmax - xmin ) , xmax - 1.e-5 * ( xmax - xmin ) , 2 , 5 )
+
+## the models with the moment tables
+models = (
+    Ostap.Math.PS2DPol     ( psx , psy , 2 , 3 , xmin , xmax , xmin , xmax ) ,
+    Ostap.Math.PS2DPolSym  ( psx , 2 , xmin , xmax ) ,
+    Ostap.Math.ExpoPS2DPol ( psy , xmin , xmax , 2 , 3 , xmin , xmax ) ,
+    Ostap.Math.PS2DPol2    ( psx , psy , mmax , 2 , 3 , xmin , xmax , xmin , xmax ) ,
+    Ostap.Math.PS2DPol2Sym ( psx , mmax , 2 , xmin , xmax ) ,
+    Ostap.Math.PS2DPol3    ( psx , psy , mmax , 2 , 3 , xmin , xmax , xmin , xmax ) ,
+    Ostap.Math.PS2DPol3Sym ( psx , mmax , 2 , xmin , xmax ) ,
+    )
+
+## the integration ranges: full, partial and crossing the kinematic boundary
+ranges = (
+    ( xmin , xmax , xmin , xmax ) ,
+    ( 0.2  , 1.3  , 0.5  , 1.9  ) ,
+    ( 1.1  , 1.9  , 0.9  , 1.7  ) ,
+    ( 0.05 , 0.7  , 1.2  , 1.95 ) ,
+    )
+
+# =============================================================================
+def test_models_2d_moments () :
+
+    cnt = SE ()
+    for model in models :
+        ## several parameter sets: the same tables are reused
+        for trial in range ( 3 ) :
+            for i in range ( model.npars () ) :
+                model.setPar ( i , random.uniform ( -3 , 3 ) )
+            if hasattr ( model , 'setTau' ) : model.setTau ( random.uniform ( -2 , 2 ) )
+            for x1 , x2 , y1 , y2 in ranges :
+                d = ROOT.OstapTest.m2d_check ( model , x1 , x2 , y1 , y2 )
+                assert d < 1.e-5 , 'Invalid integrals for %s: %.3g (%.2f,%.2f,%.2f,%.2f)' % (
+                    type ( model ).__name__ , d , x1 , x2 , y1 , y2 )
+                cnt += d
+
+    logger.info ( 'Relative deviations of the integrals: %s' % cnt )
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_models_2d_moments ()
+
+# =============================================================================
+# The END
+# =============================================================================
@@ -0,0 +1,139 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developpers.
+# =============================================================================
+## @file ostap/math/tests/test_math_shapenll.py
+#  Test module for the unbinned negative log-likelihood Ostap::Math::ShapeNLL
+#  - the gradient is compared with the symmetric differences of the likelihood,
+#    including the negative values of the parameters used as |p|
+#  - the fit with Minuit2 from the negative start values of sigmas
+#  @see Ostap::Math::ShapeNLL
+# =============================================================================
+""" Test module for the unbinned negative log-likelihood Ostap::Math::ShapeNLL
+- the gradient is compared with the symmetric differences of the likelihood,
+  including the negative values of the parameters used as |p|
+- the fit with Minuit2 from the negative start values of sigmas
+"""
+# =============================================================================
+from   __future__        import print_function
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' ==  __name__ : logger = getLogger ( 'test_math_shapenll' )
+else                       : logger = getLogger ( __name__             )
+# =============================================================================
+import ROOT
+import ostap.math.models
+from   ostap.core.core      import Ostap
+
+## the checks are done in C++
+ROOT.gInterpreter.Declare ( """
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+#include <algorithm>
+#include "Math/Factory.h"
+#include "Math/Minimizer.h"
+#include "Ostap/Peaks.h"
+#include "Ostap/ShapeNLL.h"
+namespace OstapTest
+{
+  /// the data: Gaussian peak with the exponential tail
+  inline std::vector<double> nll_data ( const std::size_t n , const unsigned int seed )
+  {
+    std::mt19937 g ( seed ) ;
+    std::normal_distribution<double>      peak ( 0.3 , 1.1 ) ;
+    std::exponential_distribution<double> tail ( 0.5 ) ;
+    std::uniform_real_distribution<double> u   ( 0   , 1   ) ;
+    std::vector<double> data ( n ) ;
+    for ( double& x : data ) { x = u ( g ) < 0.9 ? peak ( g ) : 0.3 - tail ( g ) ; }
+    return data ;
+  }
+  /// maximal deviation of the gradient from the symmetric differences of NLL
+  template <class SHAPE>
+  inline double nll_check ( const SHAPE& shape , const std::vector<double>& pars )
+  {
+    const Ostap::Math::ShapeNLL<SHAPE> nll ( shape , nll_data ( 1000 , 17 ) , -6 , 5 ) ;
+    const unsigned int N = nll.NDim () ;
+    std::vector<double> g ( N ) ;
+    nll.Gradient ( pars.data () , g.data () ) ;
+    double dmax = 0 ;
+    for ( unsigned int k = 0 ; k < N ; ++k )
+    {
+      const double h = 1.e-3 * std::max ( 1.0 , std::abs ( pars [ k ] ) ) ;
+      std::vector<double> pp ( pars ) , pm ( pars ) ;
+      pp [ k ] += h ;
+      pm [ k ] -= h ;
+      const double fd = ( nll ( pp.data () ) - nll ( pm.data () ) ) / ( 2 * h ) ;
+      dmax = std::max ( dmax , std::abs ( g [ k ] - fd ) / ( 1 + std::abs ( fd ) ) ) ;
+    }
+    return dmax ;
+  }
+  /// fit BifurcatedGauss with Minuit2: ( status , NLL , peak , |sigmaL| , |sigmaR| )
+  inline std::vector<double> nll_fit ( const double peak , const double sigmaL , const double sigmaR )
+  {
+    const Ostap::Math::ShapeNLL<Ostap::Math::BifurcatedGauss> nll
+      ( Ostap::Math::BifurcatedGauss () , nll_data ( 5000 , 42 ) , -3 , 4 ) ;
+    std::unique_ptr<ROOT::Math::Minimizer> m
+      { ROOT::Math::Factory::CreateMinimizer ( "Minuit2" , "Migrad" ) } ;
+    m -> SetFunction ( nll ) ;
+    m -> SetVariable ( 0 , "peak"   , peak   , 0.1 ) ;
+    m -> SetVariable ( 1 , "sigmaL" , sigmaL , 0.1 ) ;
+    m -> SetVariable ( 2 , "sigmaR" , sigmaR , 0.1 ) ;
+    m -> SetPrintLevel ( 0 ) ;
+    const bool ok = m -> Minimize () ;
+    const double* x = m -> X () ;
+    return { ok ? 0.0 + m -> Status () : -1.0 , m -> MinValue () ,
+             x [ 0 ] , std::abs ( x [ 1 ] ) , std::abs ( x [ 2 ] ) } ;
+  }
+}
+""" )
+
+## the shapes and the parameters, including negative values of |p|-parameters
+shapes = (
+    ( Ostap.Math.BifurcatedGauss ( 0.3 , 1.1 , 0.7 )           , ( 0.1 ,  1.3 ,  0.9 ) ) ,
+    ( Ostap.Math.BifurcatedGauss ( 0.3 , 1.1 , 0.7 )           , ( 0.1 , -1.3 , -0.9 ) ) ,
+    ( Ostap.Math.CrystalBall     ( 0.3 , 1.1 , 1.5 , 3   )     , ( 0.2 , -1.2 ,  1.3 , -2.5 ) ) ,
+    ( Ostap.Math.StudentT        ( 0.3 , 1.1 , 3.5 )           , ( 0.2 , -1.2 , -3.0 ) ) ,
+    ( Ostap.Math.Bukin           ( 0.3 , 1.1 , 0.2 , 0.4 , 0.3 ) , ( 0.2 , -1.2 , -0.1 , -0.3 , 0.4 ) ) ,
+    ( Ostap.Math.Apolonios       ( 0.3 , 1.1 , 1.5 , 2   , 1.2 ) , ( 0.2 , -1.2 ,  1.3 , -2.5 , -1.0 ) ) ,
+    ( Ostap.Math.Apolonios2      ( 0.3 , 1.1 , 0.7 , 1.5 )     , ( 0.2 , -1.2 ,  0.8 , -1.3 ) ) ,
+    )
+
+# =============================================================================
+def test_shapenll_gradient () :
+
+    for shape , pars in shapes :
+        p    = ROOT.std.vector('double') ( pars )
+        dmax = ROOT.OstapTest.nll_check ( shape , p )
+        logger.info ( '%-16s %-36s maximal deviation: %.3g' % ( type ( shape ).__name__ , pars , dmax ) )
+        assert dmax < 1.e-3 , 'Invalid NLL gradient for %s at %s' % ( type ( shape ).__name__ , pars )
+
+# =============================================================================
+def test_shapenll_fit () :
+
+    r1 = ROOT.OstapTest.nll_fit ( 0.0 ,  0.5 ,  2.0 )
+    r2 = ROOT.OstapTest.nll_fit ( 0.0 , -0.5 , -2.0 )
+    logger.info ( 'Fit from positive sigmas: %s' % list ( r1 ) )
+    logger.info ( 'Fit from negative sigmas: %s' % list ( r2 ) )
+
+    for r in ( r1 , r2 ) :
+        assert 0 == r [ 0 ]                 , 'Fit failed, status %s' % r [ 0 ]
+        assert 0.5 < r [ 3 ] < 2 and 0.5 < r [ 4 ] < 2 , 'Invalid sigmas %s' % list ( r )
+
+    assert abs ( r1 [ 1 ] - r2 [ 1 ] ) < 1.e-3 , 'Different minima %s vs %s'   % ( r1 [ 1 ] , r2 [ 1 ] )
+    for k in ( 2 , 3 , 4 ) :
+        assert abs ( r1 [ k ] - r2 [ k ] ) < 5.e-3 , 'Different parameters %s vs %s' % ( list ( r1 ) , list ( r2 ) )
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_shapenll_gradient ()
+    test_shapenll_fit      ()
+
+# =============================================================================
+# The END
+# =============================================================================
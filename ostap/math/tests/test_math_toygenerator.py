@@ -0,0 +1,86 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developpers.
+# =============================================================================
+## @file ostap/math/tests/test_math_toygenerator.py
+#  Test module for Ostap::Math::ToyGenerator and Ostap::Math::ToyGenerator2D
+# =============================================================================
+""" Test module for Ostap::Math::ToyGenerator and Ostap::Math::ToyGenerator2D
+"""
+# =============================================================================
+from   __future__        import print_function
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' ==  __name__ : logger = getLogger ( 'test_math_toygenerator' )
+else                       : logger = getLogger ( __name__                 )
+# =============================================================================
+import ROOT
+import ostap.math.models
+from   ostap.core.core      import Ostap, SE
+from   ostap.utils.timing   import timing
+
+## number of events to be generated
+N = 1000000
+
+# =============================================================================
+def test_toygen_1D () :
+
+    gauss = Ostap.Math.Gauss ( 0.5 , 1.0 )
+    gen   = Ostap.Math.ToyGenerator ( gauss , -5 , 5 )
+    rng   = Ostap.Utils.RandomStream ( 12345 )
+
+    logger.info ( 'ToyGenerator: %d bins' % gen.size () )
+
+    ## compare the tabulated CDF with the exact one
+    dmax = 0
+    for i in range ( 1 , 100 ) :
+        x    = -5 + 0.1 * i
+        dmax = max ( dmax , abs ( gen.cdf ( x ) - gauss.integral ( -5 , x ) / gen.integral () ) )
+    logger.info ( 'Maximal CDF deviation: %.3g' % dmax )
+    assert dmax < 1.e-5 , 'CDF is not reproduced!'
+
+    with timing ( 'ToyGenerator'    , logger = logger ) :
+        toys    = gen.generate ( N , rng )
+    with timing ( 'ToyGenerator/MT' , logger = logger ) :
+        toys_mt = gen.generate ( N , rng , 0 , 0 )
+
+    assert toys == toys_mt , 'Multithreaded generation is not reproducible!'
+
+    cnt = SE ()
+    for x in toys : cnt += x
+    logger.info ( 'Mean/RMS: %s/%s' % ( cnt.mean () , cnt.rms () ) )
+    assert abs ( cnt.mean ().value () - 0.5 ) < 0.01 , 'Mean is not reproduced!'
+    assert abs ( cnt.rms  ()          - 1.0 ) < 0.01 , 'RMS  is not reproduced!'
+
+# =============================================================================
+def test_toygen_2D () :
+
+    pos = Ostap.Math.Positive2D ( 2 , 2 , 0 , 2 , 0 , 2 )
+    for i in range ( pos.npars () ) : pos.setPar ( i , 0.5 * i )
+
+    gen = Ostap.Math.ToyGenerator2D ( pos )
+    rng = Ostap.Utils.RandomStream ( 12345 )
+
+    logger.info ( 'ToyGenerator2D: %dx%d grid' % ( gen.nX () , gen.nY () ) )
+
+    with timing ( 'ToyGenerator2D/MT' , logger = logger ) :
+        toys = gen.generate ( N , rng , 0 , 0 )
+
+    ## compare the fraction of events in the corner with the integral
+    n = sum ( 1 for i in range ( N ) if toys [ 2 * i ] < 1 and toys [ 2 * i + 1 ] < 1 )
+    f = pos.integral ( 0 , 1 , 0 , 1 ) / pos.integral ()
+    logger.info ( 'Fraction: %.4f vs %.4f' % ( float ( n ) / N , f ) )
+    assert abs ( float ( n ) / N - f ) < 0.005 , 'Fraction is not reproduced!'
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_toygen_1D ()
+    test_toygen_2D ()
+
+# =============================================================================
+# The END
+# =============================================================================
@@ -0,0 +1,97 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developpers.
+# =============================================================================
+## @file ostap/parallel/tests/test_parallel_threadpool.py
+#  Test module for Ostap::Utils::ThreadPool and Ostap::Utils::TaskGroup
+#  The tasks are C++ functions: the python callables can't run in the workers
+# =============================================================================
+""" Test module for Ostap::Utils::ThreadPool and Ostap::Utils::TaskGroup
+The tasks are C++ functions: the python callables can't run in the workers
+"""
+# =============================================================================
+from   __future__        import print_function
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' ==  __name__ : logger = getLogger ( 'test_parallel_threadpool' )
+else                       : logger = getLogger ( __name__                   )
+# =============================================================================
+import ROOT
+from   ostap.core.core      import Ostap
+
+ROOT.gInterpreter.Declare ( """
+#include <atomic>
+#include <stdexcept>
+#include "Ostap/ThreadPool.h"
+namespace OstapTest
+{
+  // sum of integers in [0,N) by chunks
+  inline unsigned long tp_sum ( Ostap::Utils::TaskGroup& group , unsigned long N )
+  {
+    std::atomic<unsigned long> sum { 0 } ;
+    group.parallel_for ( 0 , N , 0 , [&sum] ( std::size_t b , std::size_t e )
+                         { unsigned long s = 0 ; for ( std::size_t i = b ; i < e ; ++i ) { s += i ; } sum += s ; } ) ;
+    group.wait () ;
+    return sum ;
+  }
+  // the nested loops: the waiting thread executes the pending tasks
+  inline unsigned long tp_nested ( Ostap::Utils::TaskGroup& group , unsigned long N , unsigned long M )
+  {
+    std::atomic<unsigned long> sum { 0 } ;
+    group.parallel_for ( 0 , N , 1 , [&sum,M] ( std::size_t b , std::size_t e )
+                         {
+                           for ( std::size_t i = b ; i < e ; ++i )
+                           {
+                             Ostap::Utils::TaskGroup inner ;
+                             inner.parallel_for ( 0 , M , 0 , [&sum] ( std::size_t ib , std::size_t ie ) { sum += ie - ib ; } ) ;
+                             inner.wait () ;
+                           }
+                         } ) ;
+    group.wait () ;
+    return sum ;
+  }
+  // the exception from the task: return true if it is re-thrown from wait
+  inline bool tp_throw ( Ostap::Utils::TaskGroup& group )
+  {
+    group.run ( [] () { throw std::runtime_error ( "task failure" ) ; } ) ;
+    try                                { group.wait () ; }
+    catch ( const std::runtime_error& ) { return true  ; }
+    return false ;
+  }
+}
+""" )
+
+# =============================================================================
+def test_threadpool () :
+
+    N = 1000000
+    group = Ostap.Utils.TaskGroup ()
+
+    assert ROOT.OstapTest.tp_sum ( group , N ) == N * ( N - 1 ) // 2 , 'Invalid sum!'
+    logger.info ( 'ThreadPool: %d workers' % Ostap.Utils.ThreadPool.instance().size() )
+
+    assert ROOT.OstapTest.tp_nested ( group , 64 , 1000 ) == 64 * 1000 , 'Invalid nested sum!'
+
+    ## the exception is re-thrown and the group is reusable after wait
+    assert ROOT.OstapTest.tp_throw ( group ) , 'Exception is not re-thrown!'
+    assert not group.cancelled ()            , 'Group is still cancelled!'
+    assert ROOT.OstapTest.tp_sum ( group , N ) == N * ( N - 1 ) // 2 , 'Invalid sum after failure!'
+
+    ## the explicit cancellation is reset by wait as well
+    group.cancel ()
+    group.wait   ()
+    assert ROOT.OstapTest.tp_sum ( group , N ) == N * ( N - 1 ) // 2 , 'Invalid sum after cancel!'
+
+    logger.info ( 'ThreadPool is OK' )
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_threadpool ()
+
+# =============================================================================
+# The END
+# =============================================================================
@@ -0,0 +1,104 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developers.
+# =============================================================================
+# @file ostap/stats/tests/test_stats_snapshot.py
+# Test module for the columnar snapshot paths of UStat and HistoProject
+# - the empty data are reported by UStat as InvalidItem1
+# - projections of the empty snapshot succeed and leave histograms empty
+# =============================================================================
+""" Test module for the columnar snapshot paths of UStat and HistoProject
+- the empty data are reported by UStat as InvalidItem1
+- projections of the empty snapshot succeed and leave histograms empty
+"""
+# =============================================================================
+__author__ = "Ostap developers"
+__all__    = () ## nothing to import
+# =============================================================================
+import ROOT, random
+from   ostap.core.core      import Ostap, hID, dsID
+from   builtins             import range
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' == __name__  or '__builtin__' == __name__ :
+    logger = getLogger ( 'test_stats_snapshot' )
+else :
+    logger = getLogger ( __name__ )
+# =============================================================================
+
+x      = ROOT.RooRealVar ( 'snap_x' , 'x' , -5 , 5 )
+y      = ROOT.RooRealVar ( 'snap_y' , 'y' , -5 , 5 )
+z      = ROOT.RooRealVar ( 'snap_z' , 'z' , -5 , 5 )
+varset = ROOT.RooArgSet  ( x , y , z )
+
+# =============================================================================
+def test_ustat_empty () :
+
+    data  = ROOT.RooDataSet ( dsID () , 'empty' , varset )
+    mean  = ROOT.RooRealVar ( 'snap_mean'  , 'mean'  , 0 )
+    sigma = ROOT.RooRealVar ( 'snap_sigma' , 'sigma' , 1 )
+    pdf   = ROOT.RooGaussian ( 'snap_gauss' , 'gauss' , x , mean , sigma )
+
+    histo = ROOT.TH1D ( hID () , '' , 20 , 0 , 1 )
+    tStat = ROOT.Double ( -1 )
+    sc    = Ostap.UStat.calculate ( pdf , data , histo , tStat , ROOT.RooArgSet ( x ) )
+
+    assert Ostap.UStat.InvalidItem1 == sc.getCode () , 'Invalid status %s for empty data' % sc
+    assert 0 == histo.GetEntries ()                 , 'Histogram is filled for empty data'
+    logger.info ( 'UStat for empty data: %s' % sc )
+
+# =============================================================================
+def test_project_empty () :
+
+    data = ROOT.RooDataSet ( dsID () , 'empty' , varset )
+    snap = Ostap.DataSnapshot ( data )
+    assert snap.empty () , 'Snapshot is not empty!'
+
+    h1 = ROOT.TH1D ( hID () , '' , 10 , -5 , 5 )
+    h2 = ROOT.TH2D ( hID () , '' , 10 , -5 , 5 , 10 , -5 , 5 )
+    h3 = ROOT.TH3D ( hID () , '' , 10 , -5 , 5 , 10 , -5 , 5 , 10 , -5 , 5 )
+
+    sc1 = Ostap.HistoProject.project  ( snap , h1 , 'snap_x' )
+    sc2 = Ostap.HistoProject.project2 ( snap , h2 , 'snap_x' , 'snap_y' )
+    sc3 = Ostap.HistoProject.project3 ( snap , h3 , 'snap_x' , 'snap_y' , 'snap_z' , 'snap_x>0' )
+
+    for sc , h in ( ( sc1 , h1 ) , ( sc2 , h2 ) , ( sc3 , h3 ) ) :
+        assert sc.isSuccess ()      , 'Projection of empty snapshot failed: %s' % sc
+        assert 0 == h.GetEntries () , 'Histogram is filled from empty snapshot'
+
+    logger.info ( 'Projections of empty snapshot are OK' )
+
+# =============================================================================
+def test_project () :
+
+    data = ROOT.RooDataSet ( dsID () , 'data' , varset )
+    href = ROOT.TH1D ( hID () , '' , 10 , -5 , 5 )
+    for i in range ( 1000 ) :
+        x.setVal ( random.gauss ( 0 , 1 ) )
+        y.setVal ( random.gauss ( 0 , 1 ) )
+        z.setVal ( random.gauss ( 0 , 1 ) )
+        data.add ( varset )
+        if 0 < y.getVal () : href.Fill ( x.getVal () )
+
+    snap = Ostap.DataSnapshot ( data )
+    h1   = ROOT.TH1D ( hID () , '' , 10 , -5 , 5 )
+    sc   = Ostap.HistoProject.project ( snap , h1 , 'snap_x' , 'snap_y>0' )
+    assert sc.isSuccess () , 'Projection failed: %s' % sc
+    for i in range ( 1 , 11 ) :
+        assert h1.GetBinContent ( i ) == href.GetBinContent ( i ) , 'Invalid bin %d' % i
+
+    logger.info ( 'Projection of snapshot is OK' )
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_ustat_empty   ()
+    test_project_empty ()
+    test_project       ()
+
+# =============================================================================
+# The END
+# =============================================================================
@@ -1223,6 +1223,7 @@ def _add_response_chain ( chain , *args ) :
 #  @param options       options to be used in TMVA Reader
 #  @param verbose       verbose operation?
 #  @param aux           obligatory for the cuts method, where it represents the efficiency cutoff 
+#  @param nthreads      number of threads for TMVA evaluation (one TMVA reader per thread)
 def addChoppingResponse ( dataset                     , ## input dataset to be updated
                           chopper                     , ## chopping category/formula 
                           N                           , ## number of categrories
@@ -1233,7 +1234,8 @@ def addChoppingResponse ( dataset                     , ## input dataset to be u
                           suffix        = '_response' , ## suffix for TMVA-variable 
                           options       =  ''         , ## TMVA-reader options
                           verbose       = True        , ## verbosity flag 
-                          aux           = 0.9         ) :
+                          aux           = 0.9         , ## for Cuts method : efficiency cut-off
+                          nthreads      = 1           ) : ## number of threads for TMVA evaluation
     """
     Helper function to add TMVA/chopping  response into dataset
     >>> tar_file = trainer.tar_file
@@ -1271,12 +1273,12 @@ def addChoppingResponse ( dataset                     , ## input dataset to be u
 
     if   isinstance ( dataset , ROOT.TChain  ) :
         sc , newdata = _add_response_chain ( dataset , chopper ,  category_name , N ,
-                                        _inputs , _maps , options , prefix , suffix , aux )
+                                        _inputs , _maps , options , prefix , suffix , aux , nthreads )
         if sc.isFailure() : logger.error ( 'Error from Ostap::TMVA::addChoppingResponse %s' % sc )
         return newdata 
     elif isinstance ( dataset , ROOT.TTree   ) :
         sc , newdata = _add_response_tree  ( dataset , chopper ,  category_name , N ,
-                                        _inputs , _maps , options , prefix , suffix , aux )
+                                        _inputs , _maps , options , prefix , suffix , aux , nthreads )
         if sc.isFailure() : logger.error ( 'Error from Ostap::TMVA::addChoppingResponse %s' % sc )
         return newdata 
                                         
@@ -1315,7 +1317,8 @@ def addChoppingResponse ( dataset                     , ## input dataset to be u
                                           options  ,
                                           prefix   ,
                                           suffix   ,
-                                          aux      )
+                                          aux      ,
+                                          nthreads )
 
     if sc.isFailure() : logger.error ( 'Error from Ostap::TMVA::addChoppingResponse %s' % sc )
         
@@ -32,7 +32,8 @@ __author__  = 'Vanya BELYAEV  Ivan.Belyaev@itep.ru'
 __date__    = "2019-05-14"
 __version__ = '$Revision$'
 __all__     = (
-    'sPlot1D'  , ## 1D-splot
+    'sPlot1D'      , ## 1D-splot
+    'add_sweights' , ## native sWeights for TTree/RooDataSet 
     )
 # =============================================================================
 import ROOT
@@ -181,6 +182,57 @@ class sPlot1D(object) :
         return self.__hweights
     
 
+# =============================================================================
+## Calculate sWeights using the native C++ engine and add them
+#  to TTree or RooDataSet as new branches/variables <code>yield_name+suffix</code>.
+#  The sFactor statistics (sum of sWeights and sum of squared sWeights)
+#  are calculated in the same loop
+#  @code
+#  pdf   = ...  ## extended model, fitted to data with only yields floating  
+#  data  = ...  ## TTree or RooDataSet  
+#  splot = add_sweights ( pdf , data , nthreads = 4 ) 
+#  for n , sf in zip ( splot.names () , splot.sFactors () ) : print ( n , sf )  
+#  @endcode
+#  @attention RooFit is not thread-safe: use <code>nthreads>1</code>
+#             only for simple component PDFs
+#  @see Ostap::SPlot
+def add_sweights ( pdf , data , suffix = '_sw' , nthreads = 1 ) :
+    """Calculate sWeights using the native C++ engine and add them 
+    to TTree or RooDataSet as new branches/variables ``yield_name+suffix''.
+    The sFactor statistics are calculated in the same loop
+    >>> pdf   = ...  ## extended model, fitted to data with only yields floating  
+    >>> data  = ...  ## TTree or RooDataSet  
+    >>> splot = add_sweights ( pdf , data , nthreads = 4 ) 
+    >>> for n , sf in zip ( splot.names () , splot.sFactors () ) : print ( n , sf )  
+    - see Ostap.SPlot
+    """
+    assert isinstance ( pdf     , PDF              ) and \
+           isinstance ( pdf.pdf , ROOT.RooAddPdf   ) and \
+           len ( pdf.alist1 ) ==  len ( pdf.alist2 )     , 'Invalid type of PDF!'
+
+    from ostap.core.core import Ostap, ROOTCWD 
+    splot = Ostap.SPlot ( pdf.alist1 , pdf.alist2 , pdf.vars )
+    
+    if isinstance ( data , ROOT.TTree ) :
+        
+        assert not isinstance ( data , ROOT.TChain ) , 'add_sweights: TChain is not supported!'
+        
+        from ostap.io.root_file import REOPEN 
+        tdir = data.GetDirectory ()
+        with ROOTCWD() , REOPEN ( tdir ) as tfile :
+            tdir.cd ()
+            sc = splot.addWeights ( data , suffix , nthreads )
+            if   sc.isFailure ()       : logger.error ( 'Ostap::SPlot::addWeights: error %s' % sc )
+            elif tfile.IsWritable ()   : tfile.Write ( "" , ROOT.TObject.kOverwrite )
+            else : logger.error ( "Can't write TTree back to the file" )
+            
+    else :
+        
+        sc = splot.addWeights ( data , suffix , nthreads )
+        if sc.isFailure () : logger.error ( 'Ostap::SPlot::addWeights: error %s' % sc )
+
+    return splot 
+
 ## =============================================================================
 if '__main__' == __name__ :
     
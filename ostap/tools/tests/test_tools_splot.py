@@ -0,0 +1,119 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developers.
+# =============================================================================
+# @file ostap/tools/tests/test_tools_splot.py
+# Test module for the native sPlot engine Ostap::SPlot
+# - It compares sWeights with RooStats::SPlot for Gaussian signal and
+#   exponential background
+# =============================================================================
+""" Test module for the native sPlot engine Ostap::SPlot
+- It compares sWeights with RooStats::SPlot for Gaussian signal and
+  exponential background
+"""
+# =============================================================================
+__author__ = "Ostap developers"
+__all__    = () ## nothing to import
+# =============================================================================
+import ROOT, random
+import ostap.fitting.roofit
+import ostap.fitting.models as     Models
+from   ostap.core.core      import VE, dsID
+from   ostap.logger.utils   import rooSilent
+from   ostap.tools.splot    import add_sweights
+from   builtins             import range
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' == __name__  or '__builtin__' == __name__ :
+    logger = getLogger ( 'test_tools_splot' )
+else :
+    logger = getLogger ( __name__ )
+# =============================================================================
+
+## make simple test mass
+mass    = ROOT.RooRealVar ( 'test_mass' , 'Some test mass' , 0 , 10 )
+
+## book very simple data set
+varset  = ROOT.RooArgSet  ( mass )
+dataset = ROOT.RooDataSet ( dsID() , 'Test Data set' , varset )
+
+m0 = VE ( 5 , 0.5**2 )
+
+## fill it with 2k signal and 4k exponential background events
+for i in range ( 0 , 2000 ) :
+    mass.value = m0.gauss ()
+    if mass.value in mass : dataset.add ( varset )
+
+while len ( dataset ) < 6000 :
+    v = random.expovariate ( 0.2 )
+    if v in mass :
+        mass.value = v
+        dataset.add ( varset )
+
+logger.info ( 'Dataset: %s' % dataset )
+
+# =============================================================================
+## compare sWeights from Ostap::SPlot with RooStats::SPlot
+def test_splot () :
+
+    model = Models.Fit1D (
+        name       = 'SP' ,
+        signal     = Models.Gauss_pdf ( 'GS' , xvar = mass , mean = m0.value() , sigma = m0.error() ) ,
+        background = Models.Bkg_pdf   ( 'BS' , xvar = mass , power = 0 ) )
+
+    with rooSilent () :
+
+        model.S = 2000
+        model.B = 4000
+        r , f = model.fitTo ( dataset , draw = False , silent = True )
+
+        ## sPlot requires the fixed shapes: refit the yields only
+        model.signal.mean    .fix ()
+        model.signal.sigma   .fix ()
+        model.background.tau .fix ()
+        r , f = model.fitTo ( dataset , draw = False , silent = True )
+
+    assert 0 == r.status () , 'Fit failed!'
+    yields = [ ( y.GetName () , y.getVal () ) for y in model.alist2 ]
+
+    ## native sWeights: sequential and multithreaded
+    splot1 = add_sweights ( model , dataset , suffix = '_os1' , nthreads = 1 )
+    splot2 = add_sweights ( model , dataset , suffix = '_os2' , nthreads = 2 )
+
+    ## sFactors: the sums of sWeights reproduce the fitted yields and
+    #  the sums of squared sWeights are the diagonal of the covariance
+    cov = splot1.covariance ()
+    for k , ( ( name , n ) , sf ) in enumerate ( zip ( yields , splot1.sFactors () ) ) :
+        logger.info ( 'Yield %-10s %10.2f sFactor %s' % ( name , n , sf ) )
+        assert abs ( sf.value () - n ) < 1.e-3 * n , 'Invalid sum of sWeights for %s' % name
+        assert abs ( sf.cov2 () - cov ( k , k ) ) < 1.e-6 * cov ( k , k ) , \
+               'Invalid sum of squared sWeights for %s' % name
+
+    ## sWeights from RooStats, added as <yield>_sw
+    with rooSilent () :
+        rsplot = ROOT.RooStats.SPlot ( 'rsplot' , 'RooStats sPlot' , dataset , model.pdf , model.alist2 )
+
+    dmax = 0
+    for i in range ( len ( dataset ) ) :
+        entry = dataset.get ( i )
+        for name , n in yields :
+            w  = entry.getRealValue ( name + '_sw'  )
+            w1 = entry.getRealValue ( name + '_os1' )
+            w2 = entry.getRealValue ( name + '_os2' )
+            assert abs ( w1 - w2 ) < 1.e-9 * ( 1 + abs ( w1 ) ) , 'Different sWeights for 1 and 2 threads!'
+            dmax = max ( dmax , abs ( w1 - w ) / ( 1 + abs ( w ) ) )
+
+    logger.info ( 'Maximal deviation from RooStats::SPlot: %.3g' % dmax )
+    assert dmax < 1.e-3 , 'sWeights differ from RooStats::SPlot!'
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_splot ()
+
+# =============================================================================
+# The END
+# =============================================================================
@@ -1400,6 +1400,7 @@ def _add_response_chain ( chain , *args ) :
 #  @param options  options to be used in TMVA Reader
 #  @param verbose  verbose operation?
 #  @param aux       obligatory for the cuts method, where it represents the efficiency cutoff
+#  @param nthreads  number of threads for TMVA evaluation (one TMVA reader per thread)
 def addTMVAResponse ( dataset                ,   ## input dataset to be updated
                       inputs                 ,   ## input variables 
                       weights_files          ,   ## files with TMVA weigths (tar/gz or xml)
@@ -1407,7 +1408,8 @@ def addTMVAResponse ( dataset                ,   ## input dataset to be updated
                       suffix   = '_response' ,   ## suffix for TMVA-variable
                       options  = ''          ,   ## TMVA-reader options
                       verbose  = True        ,   ## verbosity flag 
-                      aux      = 0.9         ) : ## for Cuts method : efficiency cut-off
+                      aux      = 0.9         ,   ## for Cuts method : efficiency cut-off
+                      nthreads = 1           ) : ## number of threads for TMVA evaluation
     """
     Helper function to add TMVA  response into dataset
     >>> tar_file = trainer.tar_file
@@ -1431,7 +1433,7 @@ def addTMVAResponse ( dataset                ,   ## input dataset to be updated
     from ostap.utils.basic import isatty
     options = opts_replace ( options , 'Color:'  , verbose and isatty() )
     
-    args = dataset , _inputs, _map, options, prefix , suffix , aux
+    args = dataset , _inputs, _map, options, prefix , suffix , aux , nthreads 
     
     if   isinstance ( dataset , ROOT.TChain     ) :
         sc , newdata = _add_response_chain ( *args )
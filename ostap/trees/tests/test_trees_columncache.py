@@ -0,0 +1,197 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developers.
+# =============================================================================
+# @file ostap/trees/tests/test_trees_columncache.py
+# - It tests the memory-mapped column cache
+# - It tests the size limit of the cache
+# - It tests the invalidation of the cache for the modified friend trees
+# @see Ostap::Trees::ColumnCache
+# =============================================================================
+""" Test module
+# - It tests the memory-mapped column cache
+# - It tests the size limit of the cache
+# - It tests the invalidation of the cache for the modified friend trees
+"""
+# =============================================================================
+__author__ = "Ostap developers"
+__all__    = () ## nothing to import
+# =============================================================================
+import ROOT, os, random
+import ostap.trees.trees
+from   ostap.core.core    import Ostap
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' == __name__  or '__builtin__' == __name__ :
+    logger = getLogger ( 'ostap/trees/tests/test_trees_columncache')
+else :
+    logger = getLogger ( __name__ )
+# =============================================================================
+from ostap.utils.cleanup import CleanUp
+data_dir   = CleanUp.tempdir ( prefix = 'test_trees_columncache_' )
+data_files = [ os.path.join ( data_dir , 'data_%d.root' % i ) for i in range ( 2 ) ]
+cache_dir  = CleanUp.tempdir ( prefix = 'test_trees_columncache_cache_' )
+Ostap.Trees.ColumnCache.setDirectory ( cache_dir )
+
+for data_file in data_files :
+
+    with ROOT.TFile.Open ( data_file , 'recreate' ) as test_file :
+        tree = ROOT.TTree ( 'S' , 'signal tree' )
+        tree.SetDirectory ( test_file )
+
+        from array import array
+        x = array ( 'd' , [0] )
+        y = array ( 'd' , [0] )
+        tree.Branch ( 'x' , x , 'x/D' )
+        tree.Branch ( 'y' , y , 'y/D' )
+
+        for i in range ( 10000 ) :
+            x[0] = random.gauss ( 0 , 1 )
+            y[0] = random.gauss ( 0 , 1 )
+            tree.Fill()
+
+        test_file.Write()
+
+# =============================================================================
+def test_column_cache () :
+
+    ColumnCache = Ostap.Trees.ColumnCache
+
+    chain = ROOT.TChain ( 'S' )
+    for f in data_files : chain.Add ( f )
+
+    ColumnCache.enable ( False )
+    s0 = chain.statVar ( 'x' )
+
+    ColumnCache.enable ( True  )
+    assert cache_dir == ColumnCache.directory () , 'Invalid cache directory!'
+    ## the partial range does not build the columns
+    before = len ( os.listdir ( cache_dir ) )
+    p0 = Ostap.StatVar.statVar ( chain , 'y' , 0 , 100 )
+    after  = len ( os.listdir ( cache_dir ) )
+    assert before == after and 100 == p0.nEntries () , 'The column is built for the partial range!'
+
+    s1 = chain.statVar ( 'x' ) ## build the column
+    ColumnCache.clear  ()
+    s2 = chain.statVar ( 'x' ) ## map the column
+
+    column = ColumnCache.get ( chain , 'x' )
+    ColumnCache.enable ( False )
+
+    assert column and column.size () == chain.GetEntries () , 'Invalid column!'
+    assert os.listdir ( cache_dir ) , 'Column is not persistent!'
+    assert not [ f for f in os.listdir ( data_dir ) if not f.endswith ( '.root' ) ] , \
+           'Files are written into the data directory!'
+
+    for s in ( s1 , s2 ) :
+        assert s.nEntries () == s0.nEntries ()        , 'Invalid number of entries!'
+        assert abs ( s.mean () - s0.mean () ) < 1.e-9 , 'Invalid mean!'
+
+    logger.info ( 'Column cache is OK: %d entries, mapped: %s' % ( column.size () , column.mapped () ) )
+
+# =============================================================================
+def test_column_cache_size () :
+
+    ColumnCache = Ostap.Trees.ColumnCache
+
+    chain = ROOT.TChain ( 'S' )
+    for f in data_files : chain.Add ( f )
+
+    cdir    = CleanUp.tempdir ( prefix = 'test_trees_columncache_size_' )
+    maxsize = ColumnCache.maxSize ()
+    ColumnCache.setDirectory ( cdir )
+    ColumnCache.enable       ( True )
+    ColumnCache.clear        ()
+
+    ## the room for one column only
+    ColumnCache.setMaxSize ( 8 * chain.GetEntries () + 4096 )
+    cx = ColumnCache.get ( chain , 'x' )
+    cy = ColumnCache.get ( chain , 'y' )
+    assert cx and cy , 'Columns are not cached!'
+    files = os.listdir ( cdir )
+    assert 1 == len ( files ) , 'The least recently used column is not removed: %s' % files
+
+    ## no room at all: nothing is cached, the results are the same
+    ColumnCache.clear      ()
+    ColumnCache.setMaxSize ( 1024 )
+    assert not ColumnCache.get ( chain , 'x' ) , 'Column larger than the limit is cached!'
+    s1 = chain.statVar ( 'x' )
+    ColumnCache.enable ( False )
+    s0 = chain.statVar ( 'x' )
+    assert s1.nEntries () == s0.nEntries () and abs ( s1.mean () - s0.mean () ) < 1.e-9 , \
+           'Invalid statistics without the cache!'
+
+    ColumnCache.setMaxSize   ( maxsize   )
+    ColumnCache.setDirectory ( cache_dir )
+    ColumnCache.clear        ()
+
+    logger.info ( 'Column cache size limit is OK' )
+
+# =============================================================================
+## write the friend trees with the variable z = scale * x
+def write_friends ( scale ) :
+    files = []
+    for data_file in data_files :
+        ffile = data_file.replace ( '.root' , '_friend.root' )
+        with ROOT.TFile.Open ( data_file , 'read' ) as f :
+            tree = f.Get ( 'S' )
+            xs   = [ e.x for e in tree ]
+        with ROOT.TFile.Open ( ffile , 'recreate' ) as test_file :
+            tree = ROOT.TTree ( 'F' , 'friend tree' )
+            tree.SetDirectory ( test_file )
+            from array import array
+            z = array ( 'd' , [0] )
+            tree.Branch ( 'z' , z , 'z/D' )
+            for x in xs :
+                z[0] = scale * x
+                tree.Fill()
+            test_file.Write()
+        files.append ( ffile )
+    return files
+
+# =============================================================================
+def test_column_cache_friends () :
+
+    ColumnCache = Ostap.Trees.ColumnCache
+
+    ## the chain with the friend
+    def friend_chain ( ffiles ) :
+        chain  = ROOT.TChain ( 'S' )
+        fchain = ROOT.TChain ( 'F' )
+        for f in data_files : chain .Add ( f )
+        for f in ffiles     : fchain.Add ( f )
+        chain.AddFriend ( fchain )
+        chain._friend = fchain
+        return chain
+
+    ColumnCache.enable ( True )
+    chain = friend_chain ( write_friends ( 1 ) )
+    k1    = ColumnCache.get ( chain , 'x' )
+    n1    = len ( os.listdir ( cache_dir ) )
+    s1    = chain.statVar ( 'z' )
+    ## the friend files are rewritten: the cached columns must not be reused
+    chain = friend_chain ( write_friends ( 2 ) )
+    k2    = ColumnCache.get ( chain , 'x' )
+    n2    = len ( os.listdir ( cache_dir ) )
+    s2    = chain.statVar ( 'z' )
+    ColumnCache.enable ( False )
+
+    assert k1 and k2 and n1 < n2 , 'Stale column for the modified friend!'
+    assert abs ( s2.mean () - 2 * s1.mean () ) < 1.e-9 * ( 1 + abs ( s1.mean () ) ) , \
+           'Stale values for the modified friend!'
+
+    logger.info ( 'Column cache with the friends is OK' )
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_column_cache         ()
+    test_column_cache_size    ()
+    test_column_cache_friends ()
+
+# =============================================================================
+# The END
+# =============================================================================
@@ -0,0 +1,195 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developers.
+# =============================================================================
+# @file ostap/trees/tests/test_trees_cutindex.py
+# - It tests the persistent cut-index cache
+# @see Ostap::Trees::CutIndex
+# =============================================================================
+""" Test module
+# - It tests the persistent cut-index cache
+"""
+# =============================================================================
+__author__ = "Ostap developers"
+__all__    = () ## nothing to import
+# =============================================================================
+import ROOT, os, random
+import ostap.trees.trees
+from   ostap.core.core    import Ostap
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' == __name__  or '__builtin__' == __name__ :
+    logger = getLogger ( 'ostap/trees/tests/test_trees_cutindex')
+else :
+    logger = getLogger ( __name__ )
+# =============================================================================
+from ostap.utils.cleanup import CleanUp
+data_dir   = CleanUp.tempdir ( prefix = 'test_trees_cutindex_' )
+data_files = [ os.path.join ( data_dir , 'data_%d.root' % i ) for i in range ( 2 ) ]
+
+for data_file in data_files :
+
+    with ROOT.TFile.Open ( data_file , 'recreate' ) as test_file :
+        tree = ROOT.TTree ( 'S' , 'signal tree' )
+        tree.SetDirectory ( test_file )
+
+        from array import array
+        x = array ( 'd' , [0] )
+        y = array ( 'd' , [0] )
+        tree.Branch ( 'x' , x , 'x/D' )
+        tree.Branch ( 'y' , y , 'y/D' )
+
+        for i in range ( 10000 ) :
+            x[0] = random.gauss ( 0 , 1 )
+            y[0] = random.gauss ( 0 , 1 )
+            tree.Fill()
+
+        test_file.Write()
+
+## the trees with the same name in different directories of one file
+dirs_file = os.path.join ( data_dir , 'data_dirs.root' )
+with ROOT.TFile.Open ( dirs_file , 'recreate' ) as test_file :
+    for d , mean in ( ( 'Sig' , 1 ) , ( 'Bkg' , -1 ) ) :
+        test_file.mkdir ( d ).cd()
+        tree = ROOT.TTree ( 'T' , 'tree in %s' % d )
+        from array import array
+        x = array ( 'd' , [0] )
+        tree.Branch ( 'x' , x , 'x/D' )
+        for i in range ( 1000 ) :
+            x[0] = random.gauss ( mean , 1 )
+            tree.Fill()
+        tree.Write()
+
+# =============================================================================
+def test_cut_index () :
+
+    CutIndex = Ostap.Trees.CutIndex
+
+    assert CutIndex.normalize ( ' y < 1 && x > 0 && y<1' ) == 'x>0&&y<1' , \
+           'Invalid normalization of cuts!'
+    ## && binds tighter than ||: no reordering with top-level ||
+    assert CutIndex.normalize ( 'a&&b||c' ) != CutIndex.normalize ( 'b||c&&a' ) , \
+           'Invalid normalization of cuts with ||!'
+    assert CutIndex.normalize ( 'b && a || c' ) == 'b&&a||c' , \
+           'Invalid normalization of cuts with ||!'
+    ## the string literals are untouched
+    assert CutIndex.normalize ( 'name == "a b" && x > 0' ) == 'name=="a b"&&x>0' , \
+           'Invalid normalization of cuts with strings!'
+    assert CutIndex.normalize ( "s == 'x && (y' && z" ) == "s=='x && (y'&&z" , \
+           'Invalid normalization of cuts with strings!'
+    assert CutIndex.normalize ( 'n == "a b"' ) != CutIndex.normalize ( 'n == "ab"' ) , \
+           'Different strings are normalized to the same cut!'
+
+    chain = ROOT.TChain ( 'S' )
+    for f in data_files : chain.Add ( f )
+
+    cuts  = 'x > 0 && y < 1'
+
+    CutIndex.enable ( False )
+    s0 = Ostap.StatVar.statVar ( chain , 'x*y' , cuts )
+
+    CutIndex.enable ( True  )
+    s1 = Ostap.StatVar.statVar ( chain , 'x*y' , cuts           ) ## build the index
+    s2 = Ostap.StatVar.statVar ( chain , 'x*y' , 'y<1 && x>0'   ) ## use the index
+    CutIndex.clear ()
+    s3 = Ostap.StatVar.statVar ( chain , 'x*y' , cuts           ) ## read the index
+
+    index = CutIndex.get ( chain , cuts )
+    CutIndex.enable ( False )
+
+    assert index and index.size () == s0.nEntries () , 'Invalid cut-index!'
+    assert os.path.isdir ( os.path.join ( data_dir , '.ostap_cutindex' ) ) , \
+           'Cut-index is not persistent!'
+
+    for s in ( s1 , s2 , s3 ) :
+        assert s.nEntries () == s0.nEntries ()        , 'Invalid number of entries!'
+        assert abs ( s.mean () - s0.mean () ) < 1.e-9 , 'Invalid mean!'
+
+    ## (a&&b)||c and b||(c&&a) must not share the index
+    cut1 = 'x>0&&y<1||y>1.5'
+    cut2 = 'y<1||y>1.5&&x>0'
+    CutIndex.enable ( False )
+    r1 = Ostap.StatVar.statVar ( chain , 'x' , cut1 )
+    r2 = Ostap.StatVar.statVar ( chain , 'x' , cut2 )
+    CutIndex.enable ( True  )
+    c1 = Ostap.StatVar.statVar ( chain , 'x' , cut1 )
+    c2 = Ostap.StatVar.statVar ( chain , 'x' , cut2 )
+    CutIndex.enable ( False )
+    assert r1.nEntries () != r2.nEntries () , 'Cuts must differ!'
+    assert c1.nEntries () == r1.nEntries () , 'Invalid number of entries for %s' % cut1
+    assert c2.nEntries () == r2.nEntries () , 'Invalid number of entries for %s' % cut2
+
+    ## the trees with the same name in different directories must not share the index
+    CutIndex.enable ( True )
+    counts = []
+    for d in ( 'Sig' , 'Bkg' ) :
+        t = ROOT.TChain ( '%s/T' % d )
+        t.Add ( dirs_file )
+        counts.append ( Ostap.StatVar.statVar ( t , 'x' , 'x>0' ).nEntries () )
+    CutIndex.enable ( False )
+    assert counts [ 0 ] > 500 > counts [ 1 ] , 'The trees in different directories share the index!'
+
+    logger.info ( 'Cut-index is OK: %d/%d entries' % ( index.size () , index.entries () ) )
+
+# =============================================================================
+## write the friend trees with the variable z = sign * |x|
+def write_friends ( sign ) :
+    files = []
+    for data_file in data_files :
+        ffile = data_file.replace ( '.root' , '_friend.root' )
+        with ROOT.TFile.Open ( data_file , 'read' ) as f :
+            tree = f.Get ( 'S' )
+            xs   = [ e.x for e in tree ]
+        with ROOT.TFile.Open ( ffile , 'recreate' ) as test_file :
+            tree = ROOT.TTree ( 'F' , 'friend tree' )
+            tree.SetDirectory ( test_file )
+            from array import array
+            z = array ( 'd' , [0] )
+            tree.Branch ( 'z' , z , 'z/D' )
+            for x in xs :
+                z[0] = sign * abs ( x )
+                tree.Fill()
+            test_file.Write()
+        files.append ( ffile )
+    return files
+
+# =============================================================================
+def test_cut_index_friends () :
+
+    CutIndex = Ostap.Trees.CutIndex
+
+    ## the chain with the friend
+    def friend_chain ( ffiles ) :
+        chain  = ROOT.TChain ( 'S' )
+        fchain = ROOT.TChain ( 'F' )
+        for f in data_files : chain .Add ( f )
+        for f in ffiles     : fchain.Add ( f )
+        chain.AddFriend ( fchain )
+        chain._friend = fchain
+        return chain
+
+    CutIndex.enable ( True )
+    chain = friend_chain ( write_friends ( +1 ) )
+    s1    = Ostap.StatVar.statVar ( chain , 'x' , 'z>0' )
+    ## the friend files are rewritten: the index must not be reused
+    chain = friend_chain ( write_friends ( -1 ) )
+    s2    = Ostap.StatVar.statVar ( chain , 'x' , 'z>0' )
+    CutIndex.enable ( False )
+
+    assert s1.nEntries () == chain.GetEntries () , 'Invalid number of entries with the friend!'
+    assert s2.nEntries () == 0                   , 'Stale index for the modified friend!'
+
+    logger.info ( 'Cut-index with the friends is OK' )
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_cut_index         ()
+    test_cut_index_friends ()
+
+# =============================================================================
+# The END
+# =============================================================================
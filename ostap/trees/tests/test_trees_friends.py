@@ -0,0 +1,108 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developers.
+# =============================================================================
+# @file ostap/trees/tests/test_trees_friends.py
+# - It tests the friend-tree mode for adding new branches
+# @see Ostap::Trees::add_friend_branch
+# =============================================================================
+""" Test module
+# - It tests the friend-tree mode for adding new branches
+"""
+# =============================================================================
+__author__ = "Ostap developers"
+__all__    = () ## nothing to import
+# =============================================================================
+import ROOT, os, random, math
+import ostap.trees.trees
+from   ostap.core.core    import Ostap
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' == __name__  or '__builtin__' == __name__ :
+    logger = getLogger ( 'ostap/trees/tests/test_trees_friends')
+else :
+    logger = getLogger ( __name__ )
+# =============================================================================
+from ostap.utils.cleanup import CleanUp
+data_dir   = CleanUp.tempdir ( prefix = 'test_trees_friends_' )
+data_files = [ os.path.join ( data_dir , 'data_%d.root' % i ) for i in range ( 4 ) ]
+
+for data_file in data_files :
+
+    with ROOT.TFile.Open ( data_file , 'recreate' ) as test_file :
+        tree = ROOT.TTree ( 'S' , 'signal tree' )
+        tree.SetDirectory ( test_file )
+
+        from array import array
+        x = array ( 'd' , [0] )
+        y = array ( 'd' , [0] )
+        tree.Branch ( 'x' , x , 'x/D' )
+        tree.Branch ( 'y' , y , 'y/D' )
+
+        for i in range ( 10000 ) :
+            x[0] = random.gauss ( 0 , 1 )
+            y[0] = random.gauss ( 0 , 1 )
+            tree.Fill()
+
+        test_file.Write()
+
+# =============================================================================
+def test_friend_branch () :
+
+    chain = ROOT.TChain ( 'S' )
+    for f in data_files : chain.Add ( f )
+
+    sizes = [ os.path.getsize ( f ) for f in data_files ]
+
+    chain = chain.add_friend_branch ( 'r' , 'sqrt(x*x+y*y)' )
+
+    assert chain.GetLeaf ( 'r' ) , 'New branch is not found!'
+    assert all ( os.path.getsize ( f ) == s for f , s in zip ( data_files , sizes ) ) , \
+           'Input files are modified!'
+
+    n = 0
+    for entry in chain :
+        assert abs ( entry.r - math.sqrt ( entry.x ** 2 + entry.y ** 2 ) ) < 1.e-12 , \
+               'Friend tree is misaligned!'
+        n += 1
+    assert n == len ( data_files ) * 10000 , 'Invalid number of entries!'
+
+    logger.info ( 'Friend tree is OK: %d entries' % n )
+
+# =============================================================================
+def test_friend_branch_outdir () :
+
+    chain = ROOT.TChain ( 'S' )
+    for f in data_files : chain.Add ( f )
+
+    ## the friend files go into the separate directory
+    out_dir = CleanUp.tempdir ( prefix = 'test_trees_friends_out_' )
+    before  = set ( os.listdir ( data_dir ) )
+
+    chain = chain.add_friend_branch ( 'phi' , 'atan2(y,x)' , outdir = out_dir )
+
+    assert chain.GetLeaf ( 'phi' ) , 'New branch is not found!'
+    assert set ( os.listdir ( data_dir ) ) == before , 'Files are written into the input directory!'
+    assert len ( os.listdir ( out_dir ) ) == len ( data_files ) , 'Invalid number of friend files!'
+
+    n = 0
+    for entry in chain :
+        assert abs ( entry.phi - math.atan2 ( entry.y , entry.x ) ) < 1.e-12 , \
+               'Friend tree is misaligned!'
+        n += 1
+    assert n == len ( data_files ) * 10000 , 'Invalid number of entries!'
+
+    logger.info ( 'Friend tree in %s is OK: %d entries' % ( out_dir , n ) )
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_friend_branch        ()
+    test_friend_branch_outdir ()
+
+# =============================================================================
+# The END
+# =============================================================================
@@ -0,0 +1,159 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developers.
+# =============================================================================
+# @file ostap/trees/tests/test_trees_statvar.py
+# - It tests the fast path of StatVar and SFactor for the primitive branches
+#   against the TTreeFormula path and the direct sums on TChain
+# - It tests the first entry of WStatEntity
+# =============================================================================
+""" Test module
+# - It tests the fast path of StatVar and SFactor for the primitive branches
+#   against the TTreeFormula path and the direct sums on TChain
+# - It tests the first entry of WStatEntity
+"""
+# =============================================================================
+__author__ = "Ostap developers"
+__all__    = () ## nothing to import
+# =============================================================================
+import ROOT, os, random
+import ostap.trees.trees
+from   ostap.core.core    import Ostap
+from   array              import array
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' == __name__  or '__builtin__' == __name__ :
+    logger = getLogger ( 'ostap/trees/tests/test_trees_statvar')
+else :
+    logger = getLogger ( __name__ )
+# =============================================================================
+from ostap.utils.cleanup import CleanUp
+data_dir   = CleanUp.tempdir ( prefix = 'test_trees_statvar_' )
+data_files = [ os.path.join ( data_dir , 'data_%d.root' % i ) for i in range ( 3 ) ]
+
+## the direct sums of sWeights
+sums = { 'S_sw' : [ 0.0 , 0.0 ] , 'B_sw' : [ 0.0 , 0.0 ] }
+
+for k , data_file in enumerate ( data_files ) :
+
+    with ROOT.TFile.Open ( data_file , 'recreate' ) as test_file :
+        tree = ROOT.TTree ( 'S' , 'signal tree' )
+        tree.SetDirectory ( test_file )
+
+        x    = array ( 'd' , [0] )
+        y    = array ( 'f' , [0] )
+        i    = array ( 'i' , [0] )
+        s_sw = array ( 'd' , [0] )
+        b_sw = array ( 'd' , [0] )
+        tree.Branch ( 'x'    , x    , 'x/D'    )
+        tree.Branch ( 'y'    , y    , 'y/F'    )
+        tree.Branch ( 'i'    , i    , 'i/I'    )
+        tree.Branch ( 'S_sw' , s_sw , 'S_sw/D' )
+        tree.Branch ( 'B_sw' , b_sw , 'B_sw/D' )
+
+        ## the files of different sizes
+        for j in range ( 1000 + 777 * k ) :
+            x    [0] = random.gauss   ( k , 1 )
+            y    [0] = random.uniform ( -1 , 1 )
+            i    [0] = random.randint ( 0 , 100 )
+            s_sw [0] = random.uniform ( -0.5 , 1.5 )
+            b_sw [0] = 1 - s_sw [0]
+            tree.Fill()
+            for name , v in ( ( 'S_sw' , s_sw [0] ) , ( 'B_sw' , b_sw [0] ) ) :
+                sums [ name ][ 0 ] += v
+                sums [ name ][ 1 ] += v * v
+
+        test_file.Write()
+
+## the same statistics?
+def same ( s1 , s2 ) :
+    return s1.nEntries () == s2.nEntries () and \
+           abs ( s1.mean       () - s2.mean       () ) < 1.e-10 * ( 1 + abs ( s2.mean () ) ) and \
+           abs ( s1.dispersion () - s2.dispersion () ) < 1.e-10 * ( 1 + s2.dispersion () )    and \
+           abs ( s1.sumw       () - s2.sumw       () ) < 1.e-10 * ( 1 + s2.sumw () )
+
+# =============================================================================
+def test_statvar_chain () :
+
+    chain = ROOT.TChain ( 'S' )
+    for f in data_files : chain.Add ( f )
+
+    ## primitive branch (fast path) vs. the expression (TTreeFormula path)
+    for v in ( 'x' , 'y' , 'i' ) :
+        s1 = Ostap.StatVar.statVar ( chain , v )
+        s2 = Ostap.StatVar.statVar ( chain , '%s+0' % v )
+        assert s1.nEntries () == chain.GetEntries () , 'Invalid number of entries for %s' % v
+        assert same ( s1 , s2 ) , 'Fast path differs for %s: %s vs %s' % ( v , s1 , s2 )
+        ## the range crossing the file boundaries
+        s1 = Ostap.StatVar.statVar ( chain , v         , 500 , 3500 )
+        s2 = Ostap.StatVar.statVar ( chain , '%s+0' % v , 500 , 3500 )
+        assert s1.nEntries () == 3000 , 'Invalid number of entries in range for %s' % v
+        assert same ( s1 , s2 ) , 'Fast path differs in range for %s: %s vs %s' % ( v , s1 , s2 )
+
+    ## several branches in one pass
+    names  = ROOT.std.vector('std::string')()
+    exprs  = ROOT.std.vector('std::string')()
+    for v in ( 'x' , 'y' , 'i' ) :
+        names.push_back ( v )
+        exprs.push_back ( '%s+0' % v )
+    r1 = ROOT.std.vector('Ostap::WStatEntity')()
+    r2 = ROOT.std.vector('Ostap::WStatEntity')()
+    n1 = Ostap.StatVar.statVars ( chain , r1 , names )
+    n2 = Ostap.StatVar.statVars ( chain , r2 , exprs )
+    assert n1 == n2 == chain.GetEntries () , 'Invalid number of processed entries'
+    for v , s1 , s2 in zip ( names , r1 , r2 ) :
+        assert same ( s1 , s2 ) , 'Fast statVars differs for %s: %s vs %s' % ( v , s1 , s2 )
+
+    logger.info ( 'StatVar fast path on TChain is OK' )
+
+# =============================================================================
+def test_sfactor_chain () :
+
+    chain = ROOT.TChain ( 'S' )
+    for f in data_files : chain.Add ( f )
+
+    names = ROOT.std.vector('std::string')()
+    for name in ( 'S_sw' , 'B_sw' ) : names.push_back ( name )
+
+    sfs = Ostap.SFactor.sFactor ( chain , names )
+    for name , sf in zip ( names , sfs ) :
+        s  = Ostap.SFactor.sFactor ( chain , name )
+        sw , sw2 = sums [ name ]
+        logger.info ( 'sFactor %s: %s' % ( name , sf ) )
+        assert abs ( sf.value () - sw  ) < 1.e-9 * ( 1 + abs ( sw ) ) , 'Invalid sum for %s'         % name
+        assert abs ( sf.cov2  () - sw2 ) < 1.e-9 * ( 1 + sw2 )        , 'Invalid sum of squares %s' % name
+        assert sf.value () == s.value () and sf.cov2 () == s.cov2 ()  , 'Different sFactors for %s' % name
+
+# =============================================================================
+def test_wstatentity_first () :
+
+    ## the single entry: zero dispersion
+    s = Ostap.WStatEntity ()
+    s.add ( 5.0 , 2.0 )
+    assert 5.0 == s.mean () and 0 == s.dispersion () , 'Invalid first entry: %s' % s
+
+    ## compare with the direct weighted formulas
+    values  = [ ( random.gauss ( 10 , 3 ) , random.uniform ( 0.1 , 2 ) ) for j in range ( 1000 ) ]
+    s       = Ostap.WStatEntity ()
+    for v , w in values : s.add ( v , w )
+    sw      = sum ( w     for v , w in values )
+    mean    = sum ( v * w for v , w in values ) / sw
+    disp    = sum ( w * ( v - mean ) ** 2 for v , w in values ) / sw
+    assert abs ( s.mean       () - mean ) < 1.e-10 * abs ( mean ) , 'Invalid mean'
+    assert abs ( s.dispersion () - disp ) < 1.e-10 * abs ( disp ) , 'Invalid dispersion'
+
+    logger.info ( 'WStatEntity is OK: %s' % s )
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_statvar_chain      ()
+    test_sfactor_chain      ()
+    test_wstatentity_first  ()
+
+# =============================================================================
+# The END
+# =============================================================================
@@ -1404,10 +1404,20 @@ def _chain_add_new_branch ( chain , name , function , verbose = True ) :
 ## add new branch to the tree
 #  @see Ostap::Trees::add_branch
 #  @see Ostap::IFuncTree 
+#  The block-wise calculation from the input expressions:
+#  @code
+#  tree.add_new_branch ( [ 'm' ] , ( [ 'px' , 'py' , 'pz' , 'e' ] , block_function ) ) 
+#  @endcode
+#  @see Ostap::Trees::BlockFunction
+#  @see Ostap::Kinematics::Batch
 def add_new_branch ( tree , name , function , verbose = True ) :
     """ Add new branch to the tree
     - see Ostap::Trees::add_branch
     - see Ostap::IFuncTree 
+    The block-wise calculation from the input expressions:
+    >>> tree.add_new_branch ( [ 'm' ] , ( [ 'px' , 'py' , 'pz' , 'e' ] , block_function ) ) 
+    - see Ostap::Trees::BlockFunction
+    - see Ostap::Kinematics::Batch
     """
     if isinstance (  tree  , ROOT.TChain ) :
         return _chain_add_new_branch ( tree , name , function , verbose )
@@ -1421,7 +1431,10 @@ def add_new_branch ( tree , name , function , verbose = True ) :
     for n in names : 
         assert not n in tree.branches() ,'Branch %s already exists!' % n
 
-    if isinstance   ( function , ( string_types , ROOT.TH1 ) ) :
+    block = isinstance ( function , tuple ) and 2 == len ( function )
+    
+    if   block : pass 
+    elif isinstance ( function , ( string_types , ROOT.TH1 ) ) :
         the_function = function
     else : 
         ftype        = type  ( function )
@@ -1432,8 +1445,14 @@ def add_new_branch ( tree , name , function , verbose = True ) :
     tname = tree.GetName      ()
     tdir  = tree.GetDirectory ()
 
-    args  = [ n for n in names ] + [ function ]
-    args  = tuple ( args )
+    if block :
+        from ostap.core.core import strings
+        inputs , func = function 
+        if isinstance ( inputs , string_types ) : inputs = [ inputs ]
+        args  = strings ( *names ) , strings ( *inputs ) , func 
+    else     : 
+        args  = [ n for n in names ] + [ function ]
+        args  = tuple ( args )
     
     with ROOTCWD() , REOPEN ( tdir ) as tfile :
         
@@ -1452,7 +1471,133 @@ def add_new_branch ( tree , name , function , verbose = True ) :
         return tree                                             ## RETURN 
     
     
-ROOT.TTree.add_new_branch = add_new_branch 
+ROOT.TTree.add_new_branch = add_new_branch
+
+# ==============================================================================
+## is the callable implemented in C++ (and can be called from any thread)?
+def _cpp_callable_ ( func ) :
+    """Is the callable implemented in C++ (and can be called from any thread)?"""
+    cpp = tuple ( t for t in ( getattr ( ROOT , 'ObjectProxy' , None ) ,
+                               getattr ( ROOT , 'MethodProxy' , None ) ) if t )
+    return bool ( cpp ) and isinstance ( func , cpp )
+
+# ==============================================================================
+## add new branch(es) to the tree/chain as the separate, compact friend tree:
+#  the new columns for each file of the chain are written (concurrently)
+#  into the new file, aligned entry-by-entry with the input tree,
+#  and the input files are not modified
+#  @code
+#  chain = ...
+#  chain = chain.add_friend_branch ( 'pt'  , 'sqrt(px*px+py*py)' )
+#  chain = chain.add_friend_branch ( [ 'm' ] , ( [ 'px' , 'py' , 'pz' , 'e' ] , block_function ) )
+#  @endcode
+#  @param tree     the input tree/chain
+#  @param name     the name(s) of new branch(es)
+#  @param function the expression(s) or (inputs, block_function) pair
+#  @param friend   the name of the friend tree
+#  @param nthreads number of concurrent jobs (0: all threads),
+#                  python block functions are always called from the main thread
+#  @param outdir   the directory for the friend files; by default the friend
+#                  file is placed next to the local input file in a writeable
+#                  directory, and into the temporary directory otherwise
+#                  (remote URLs, read-only storage)
+#  @return new chain with the friend tree attached
+#  @see Ostap::Trees::add_friend_branch
+#  @see Ostap::Trees::BlockFunction
+def add_friend_branch ( tree , name , function , friend = '' , nthreads = 0 , outdir = None ) :
+    """ Add new branch(es) to the tree/chain as the separate, compact friend tree:
+    the new columns for each file of the chain are written (concurrently)
+    into the new file, aligned entry-by-entry with the input tree,
+    and the input files are not modified
+    >>> chain = ...
+    >>> chain = chain.add_friend_branch ( 'pt'  , 'sqrt(px*px+py*py)' )
+    >>> chain = chain.add_friend_branch ( [ 'm' ] , ( [ 'px' , 'py' , 'pz' , 'e' ] , block_function ) )
+    The friend files are written into `outdir`, if specified;
+    otherwise next to the local input files in writeable directories,
+    and into the temporary directory for the remote or read-only inputs
+    >>> chain = chain.add_friend_branch ( 'pt'  , 'sqrt(px*px+py*py)' , outdir = '/scratch/friends' )
+    - see Ostap::Trees::add_friend_branch
+    - see Ostap::Trees::BlockFunction
+    """
+    if isinstance ( tree , ROOT.TChain ) : files = tree.files()
+    else :
+        tdir = tree.GetDirectory ()
+        assert tdir and tdir.GetFile () , 'Tree is not associated with the file!'
+        files = [ tdir.GetFile ().GetName () ]
+
+    names = name
+    if isinstance ( names , string_types ) : names = [ names ]
+    for n in names :
+        assert not n in tree.branches() ,'Branch %s already exists!' % n
+
+    cname  = tree.GetName ()
+    friend = friend if friend else '%s_%s' % ( cname , '_'.join ( names ) )
+
+    import os
+    from ostap.utils.basic import good_dir, make_dir
+    if outdir :
+        outdir = make_dir ( os.path.abspath ( os.path.expandvars ( os.path.expanduser ( outdir ) ) ) )
+        assert outdir , 'add_friend_branch: output directory is not writeable!'
+
+    ffiles = []
+    tmpdir = None 
+    for f in files :
+        base = '%s_%s.root' % ( os.path.splitext ( os.path.basename ( f ) ) [ 0 ] , friend )
+        if outdir : fdir = outdir
+        else :
+            ## local file in the writeable directory?
+            local = f
+            if   local.startswith ( 'file://' ) : local = local [ 7: ]
+            elif local.startswith ( 'file:'   ) : local = local [ 5: ]
+            fdir  = os.path.dirname ( os.path.abspath ( local ) )
+            if '://' in local or not good_dir ( fdir ) :
+                if not tmpdir :
+                    tmpdir = CleanUp.tempdir ( prefix = 'ostap_friends_' )
+                    logger.info ( "add_friend_branch: friend files are written into %s" % tmpdir )
+                fdir = tmpdir
+        ## the same basename from different directories: make it unique
+        ffile = os.path.join ( fdir , base )
+        k     = 0 
+        while ffile in ffiles :
+            k    += 1
+            ffile = os.path.join ( fdir , '%s_%d.root' % ( os.path.splitext ( base ) [ 0 ] , k ) )
+        ffiles.append ( ffile )
+
+    from ostap.core.core import strings
+    if isinstance ( function , tuple ) and 2 == len ( function ) :
+        inputs , func = function
+        if isinstance ( inputs , string_types ) : inputs = [ inputs ]
+        ## python callables need GIL: they can't be called from the worker threads
+        if 1 != nthreads and not _cpp_callable_ ( func ) :
+            logger.warning ( "add_friend_branch: python callable, use nthreads=1" )
+            nthreads = 1 
+        args = strings ( *inputs ) , func , 1024 , nthreads
+    else :
+        formulas = function
+        if isinstance ( formulas , string_types ) : formulas = [ formulas ]
+        assert len ( formulas ) == len ( names ) , 'Mismatch for names&expressions!'
+        args = strings ( *formulas ) , nthreads
+
+    sc = Ostap.Trees.add_friend_branch ( strings ( *files  ) , cname   ,
+                                         strings ( *ffiles ) , friend  ,
+                                         strings ( *names  ) , *args   )
+    if sc.isFailure() :
+        logger.error ( "Can't create friend tree %s, status %s" % ( friend , sc ) )
+        return tree
+
+    ## attach the friends (and keep them alive)
+    fchain  = ROOT.TChain ( friend )
+    for f in ffiles : fchain.Add ( f )
+    friends = list ( getattr ( tree , '_friends' , [] ) ) + [ fchain ]
+
+    newc = ROOT.TChain ( cname )
+    for f  in files   : newc.Add       ( f  )
+    for fr in friends : newc.AddFriend ( fr )
+    newc._friends = friends
+
+    return newc
+
+ROOT.TTree.add_friend_branch = add_friend_branch
 
 # =============================================================================
 from ostap.utils.cleanup import CleanUp
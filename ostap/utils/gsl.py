@@ -148,6 +148,8 @@ def _setHandler ( handler ) :
 
 # =============================================================================
 ## Make use ``global'' GSL handler
+#  @attention the GSL error policies are thread-local:
+#             the handler acts on the current thread only 
 #  @code
 #  setHandler ( None        ) ## clean up global  handlers 
 #  setHandler ( 'Ignore'    ) ## ignore all GSL erorrs 
@@ -75,9 +75,15 @@ add_library(ostap SHARED src/format.cpp
                          src/Binomial.cpp
                          src/BreitWigner.cpp
                          src/Choose.cpp
+                         src/ColumnCache.cpp
                          src/Combine.cpp
+                         src/Convolution.cpp
+                         src/CutIndex.cpp
                          src/Chi2Fit.cpp
                          src/Dalitz.cpp
+                         src/DalitzIntegrator.cpp
+                         src/DataFrameBooker.cpp
+                         src/DataSnapshot.cpp
                          src/EigenSystem.cpp   
                          src/Error2Exception.cpp   
                          src/Exception.cpp
@@ -89,16 +95,21 @@ add_library(ostap SHARED src/format.cpp
                          src/GSL_sentry.cpp 
                          src/GSL_utils.cpp 
                          src/Hesse.cpp
+                         src/HistoAccumulator.cpp
                          src/HistoDump.cpp
                          src/HistoInterpolation.cpp
+                         src/HistoInterpolators.cpp
                          src/HistoMake.cpp
+                         src/HistoParam.cpp
                          src/HistoProject.cpp
+                         src/HistoSampler.cpp
                          src/HistoStat.cpp
                          src/IFuncs.cpp
                          src/Interpolation.cpp
                          src/Iterator.cpp
 			 src/Integrator.cpp
                          src/Kinematics.cpp
+                         src/KinematicsBatch.cpp
                          src/Lomont.cpp
                          src/LorentzVectorWithError.cpp
                          src/Math.cpp
@@ -127,12 +138,15 @@ add_library(ostap SHARED src/format.cpp
                          src/PyBLOB.cpp
                          src/Polarization.cpp
                          src/SFactor.cpp
+                         src/SPlot.cpp
                          src/StatEntity.cpp
                          src/StatVar.cpp
                          src/StatusCode.cpp
                          src/Tee.cpp
                          src/Tensors.cpp
+                         src/ThreadPool.cpp
                          src/Tmva.cpp
+                         src/ToyGenerator.cpp
                          src/UStat.cpp
                          src/Valid.cpp
                          src/ValueWithError.cpp
@@ -145,6 +159,11 @@ add_library(ostap SHARED src/format.cpp
                          src/pcubature.cpp
                         )
 
+## columnar kinematics: allow the vectorization of loops with sqrt and comparisons
+if ( CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang" )
+  set_source_files_properties ( src/KinematicsBatch.cpp PROPERTIES COMPILE_FLAGS "-fno-math-errno -fno-trapping-math" )
+endif()
+
 ##target_compile_features    (ostap PUBLIC cxx_std_14 )
 target_link_libraries      (ostap ${ROOT_LIBRARIES} ${GSL_LIBRARIES} ${PYTHON_LIBRARIES})
 
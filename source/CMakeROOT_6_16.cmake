@@ -54,9 +54,15 @@ add_library(ostap SHARED src/format.cpp
                          src/Binomial.cpp
                          src/BreitWigner.cpp
                          src/Choose.cpp
+                         src/ColumnCache.cpp
                          src/Combine.cpp
+                         src/Convolution.cpp
+                         src/CutIndex.cpp
                          src/Chi2Fit.cpp
                          src/Dalitz.cpp
+                         src/DalitzIntegrator.cpp
+                         src/DataFrameBooker.cpp
+                         src/DataSnapshot.cpp
                          src/EigenSystem.cpp   
                          src/Error2Exception.cpp   
                          src/Exception.cpp
@@ -68,16 +74,21 @@ add_library(ostap SHARED src/format.cpp
                          src/GSL_sentry.cpp 
                          src/GSL_utils.cpp 
                          src/Hesse.cpp
+                         src/HistoAccumulator.cpp
                          src/HistoDump.cpp
                          src/HistoInterpolation.cpp
+                         src/HistoInterpolators.cpp
                          src/HistoMake.cpp
+                         src/HistoParam.cpp
                          src/HistoProject.cpp
+                         src/HistoSampler.cpp
                          src/HistoStat.cpp
                          src/IFuncs.cpp
                          src/Integrator.cpp
                          src/Interpolation.cpp
                          src/Iterator.cpp
                          src/Kinematics.cpp
+                         src/KinematicsBatch.cpp
                          src/Lomont.cpp
                          src/LorentzVectorWithError.cpp
                          src/Math.cpp
@@ -106,12 +117,15 @@ add_library(ostap SHARED src/format.cpp
                          src/PySelectorWithCuts.cpp
                          src/Polarization.cpp
                          src/SFactor.cpp
+                         src/SPlot.cpp
                          src/StatEntity.cpp
                          src/StatVar.cpp
                          src/StatusCode.cpp
                          src/Tee.cpp
                          src/Tensors.cpp
+                         src/ThreadPool.cpp
                          src/Tmva.cpp
+                         src/ToyGenerator.cpp
                          src/UStat.cpp
                          src/Valid.cpp
                          src/ValueWithError.cpp
@@ -124,6 +138,11 @@ add_library(ostap SHARED src/format.cpp
                          src/pcubature.cpp
                         )
 
+## columnar kinematics: allow the vectorization of loops with sqrt and comparisons
+if ( CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang" )
+  set_source_files_properties ( src/KinematicsBatch.cpp PROPERTIES COMPILE_FLAGS "-fno-math-errno -fno-trapping-math" )
+endif()
+
 set_target_properties(ostap
     PROPERTIES
     NO_SYSTEM_FROM_IMPORTED ON
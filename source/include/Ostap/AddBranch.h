@@ -4,9 +4,16 @@
 // ============================================================================
 // Include files 
 // ============================================================================
+// STD&STL
+// ============================================================================
+#include <string>
+#include <vector>
+#include <functional>
+// ============================================================================
 // Ostap
 // ============================================================================
 #include "Ostap/IFuncs.h"
+#include "Ostap/StatusCode.h"
 // ============================================================================
 // Forward declarations 
 // ============================================================================
@@ -56,6 +63,7 @@ namespace Ostap
      *  @param histo  the historgam to be  sampled
      *  @return new  branch 
      *  @see TH1::GetRandom 
+     *  @see Ostap::Utils::HistoSampler
      */
     TBranch* add_branch 
     ( TTree*               tree  , 
@@ -69,6 +77,7 @@ namespace Ostap
      *  @param histo  the historgam to be  sampled
      *  @return new  brances 
      *  @see TH2::GetRandom2 
+     *  @see Ostap::Utils::HistoSampler
      */
     TBranch* add_branch 
     ( TTree*               tree  , 
@@ -84,6 +93,7 @@ namespace Ostap
      *  @param histo  the historgam to be  sampled
      *  @return new  brances 
      *  @see TH3::GetRandom3 
+     *  @see Ostap::Utils::HistoSampler
      */
     TBranch* add_branch 
     ( TTree*               tree  , 
@@ -92,6 +102,157 @@ namespace Ostap
       const std::string&   namez , 
       const TH3&           histo ) ;
     // ========================================================================
+    /** @typedef BlockFunction
+     *  the function to calculate the new branches for the block of entries:
+     *  @code
+     *  void f ( const unsigned long   n       ,   // number of entries in block 
+     *           const double* const*  inputs  ,   // inputs  [i][k] 
+     *           double* const*        outputs ) ; // outputs [j][k]
+     *  @endcode
+     *  where <code>inputs[i][k]</code> is the value of i-th input expression
+     *  for k-th entry in the block and <code>outputs[j][k]</code> is the 
+     *  value of j-th new branch for k-th entry in the block
+     *  @see Ostap::Kinematics::Batch
+     */
+    typedef std::function<void(const unsigned long  ,
+                               const double* const* ,
+                               double* const*       )> BlockFunction ;
+    // ========================================================================
+    /** add new branches to TTree, calculated block-wise from 
+     *  the columns of input expressions.
+     *  The inputs are read for the block of entries, and the function 
+     *  is invoked once per block, e.g. with the columnar kinematics  
+     *  @code
+     *  using namespace Ostap::Kinematics ;
+     *  auto f = [] ( const unsigned long n , const double* const* i , double* const* o ) 
+     *  { Batch::mass ( n , i[0] , i[1] , i[2] , i[3] , o[0] ) ; } ;
+     *  add_branch ( tree , { "mass" } , { "px" , "py" , "pz" , "e" } , f ) ;
+     *  @endcode
+     *  @param tree      (UPDATE) input tree 
+     *  @param names     (INPUT)  names of new branches 
+     *  @param inputs    (INPUT)  input expressions 
+     *  @param func      (INPUT)  the function for the block of entries 
+     *  @param blocksize (INPUT)  the size of block 
+     *  @return the last new branch
+     *  @see Ostap::Trees::BlockFunction
+     *  @see Ostap::Kinematics::Batch
+     *  @author agent agent@local
+     *  @date 2026-10-19
+     */
+    TBranch* add_branch 
+    ( TTree*                          tree             , 
+      const std::vector<std::string>& names            ,
+      const std::vector<std::string>& inputs           ,
+      const BlockFunction&            func             , 
+      const unsigned long             blocksize = 1024 ) ;
+    // ========================================================================
+    /** calculate new branches for the tree and write them into the separate
+     *  compact tree <code>friend_name</code> in the file <code>friend_file</code>,
+     *  aligned entry-by-entry with the input tree, to be used as a friend.
+     *  The input tree is not modified.
+     *  @param tree        (INPUT) input tree 
+     *  @param friend_file (INPUT) the output file (recreated)
+     *  @param friend_name (INPUT) the name of the friend tree 
+     *  @param names       (INPUT) names of new branches 
+     *  @param inputs      (INPUT) input expressions 
+     *  @param func        (INPUT) the function for the block of entries 
+     *  @param blocksize   (INPUT) the size of block 
+     *  @return status code 
+     *  @see Ostap::Trees::BlockFunction
+     *  @see TTree::AddFriend
+     *  @author agent agent@local
+     *  @date 2026-10-19
+     */
+    Ostap::StatusCode add_friend_branch 
+    ( TTree*                          tree             , 
+      const std::string&              friend_file      , 
+      const std::string&              friend_name      , 
+      const std::vector<std::string>& names            ,
+      const std::vector<std::string>& inputs           ,
+      const BlockFunction&            func             , 
+      const unsigned long             blocksize = 1024 ) ;
+    // ========================================================================
+    /** calculate new branches for the tree from the expressions 
+     *  and write them into the separate compact friend tree 
+     *  @param tree        (INPUT) input tree 
+     *  @param friend_file (INPUT) the output file (recreated)
+     *  @param friend_name (INPUT) the name of the friend tree 
+     *  @param names       (INPUT) names of new branches 
+     *  @param formulas    (INPUT) the expressions for new branches  
+     *  @return status code 
+     *  @see TTree::AddFriend
+     *  @author agent agent@local
+     *  @date 2026-10-19
+     */
+    Ostap::StatusCode add_friend_branch 
+    ( TTree*                          tree        , 
+      const std::string&              friend_file , 
+      const std::string&              friend_name , 
+      const std::vector<std::string>& names       ,
+      const std::vector<std::string>& formulas    ) ;
+    // ========================================================================
+    /** calculate new branches for the tree <code>tree_name</code> 
+     *  for each input file, and write them into the friend tree 
+     *  <code>friend_name</code> in the corresponding output file.
+     *  The files are processed concurrently: the cost is proportional 
+     *  to the size of the new columns, and the input files are not modified.
+     *  @code
+     *  add_friend_branch ( { "f1.root" , "f2.root" } , "T" , 
+     *                      { "f1_mass.root" , "f2_mass.root" } , "T_mass" , 
+     *                      { "mass" } , { "px" , "py" , "pz" , "e" } , f ) ;
+     *  TChain friends ( "T_mass" ) ; ... 
+     *  chain.AddFriend ( &friends ) ;
+     *  @endcode
+     *  @attention <code>func</code> must be thread-safe 
+     *  @param input_files  (INPUT) the input files 
+     *  @param tree_name    (INPUT) the name of the input tree
+     *  @param friend_files (INPUT) the output files, one per input file
+     *  @param friend_name  (INPUT) the name of the friend trees 
+     *  @param names        (INPUT) names of new branches 
+     *  @param inputs       (INPUT) input expressions 
+     *  @param func         (INPUT) the function for the block of entries 
+     *  @param blocksize    (INPUT) the size of block 
+     *  @param nthreads     (INPUT) number of concurrent jobs (0: all threads)
+     *  @return status code 
+     *  @see Ostap::Utils::ThreadPool
+     *  @author agent agent@local
+     *  @date 2026-10-19
+     */
+    Ostap::StatusCode add_friend_branch 
+    ( const std::vector<std::string>& input_files      , 
+      const std::string&              tree_name        , 
+      const std::vector<std::string>& friend_files     , 
+      const std::string&              friend_name      , 
+      const std::vector<std::string>& names            ,
+      const std::vector<std::string>& inputs           ,
+      const BlockFunction&            func             , 
+      const unsigned long             blocksize = 1024 , 
+      const unsigned short            nthreads  = 0    ) ;
+    // ========================================================================
+    /** calculate new branches from the expressions for the tree 
+     *  <code>tree_name</code> for each input file, and write them into
+     *  the friend tree <code>friend_name</code> in the corresponding output file.
+     *  The files are processed concurrently.
+     *  @param input_files  (INPUT) the input files 
+     *  @param tree_name    (INPUT) the name of the input tree
+     *  @param friend_files (INPUT) the output files, one per input file
+     *  @param friend_name  (INPUT) the name of the friend trees 
+     *  @param names        (INPUT) names of new branches 
+     *  @param formulas     (INPUT) the expressions for new branches  
+     *  @param nthreads     (INPUT) number of concurrent jobs (0: all threads)
+     *  @return status code 
+     *  @author agent agent@local
+     *  @date 2026-10-19
+     */
+    Ostap::StatusCode add_friend_branch 
+    ( const std::vector<std::string>& input_files  , 
+      const std::string&              tree_name    , 
+      const std::vector<std::string>& friend_files , 
+      const std::string&              friend_name  , 
+      const std::vector<std::string>& names        ,
+      const std::vector<std::string>& formulas     , 
+      const unsigned short            nthreads = 0 ) ;
+    // ========================================================================
   } //                                        The end of namespace Ostap::Trees 
   // ==========================================================================
 } //                                                 The end of namesapce Ostap 
@@ -6,9 +6,15 @@
 // ============================================================================
 // Include files 
 // ============================================================================
+// STD&STL
+// ============================================================================
+#include <string>
+#include <vector>
+// ============================================================================
 // Ostap
 // ============================================================================
 #include "Ostap/IFuncs.h"
+#include "Ostap/StatusCode.h"
 // ============================================================================
 // Forward declarations 
 // ============================================================================
@@ -18,6 +24,7 @@ class TH2        ; // from ROOT
 class TH3        ; // from ROOT 
 class RooDataSet ; // from RooFit 
 class RooAbsReal ; // from RooFit 
+class RooArgList ; // from RooFit 
 // ============================================================================
 namespace Ostap
 {
@@ -53,6 +60,7 @@ namespace Ostap
      *  @param  histo   histogram to be sampled 
      *  @return the added variable 
      *  @see TH1::GetRandom 
+     *  @see Ostap::Utils::HistoSampler
      */
     const RooAbsReal* add_var 
     ( RooDataSet&             dataset , 
@@ -66,6 +74,7 @@ namespace Ostap
      *  @param  histo   histogram to be sampled 
      *  @return the added variable 
      *  @see TH2::GetRandom2
+     *  @see Ostap::Utils::HistoSampler
      */
     const RooAbsReal* add_var 
     ( RooDataSet&             dataset , 
@@ -81,6 +90,7 @@ namespace Ostap
      *  @param  histo   histogram to be sampled 
      *  @return the added variable 
      *  @see TH3::GetRandom3
+     *  @see Ostap::Utils::HistoSampler
      */
     const RooAbsReal* add_var 
     ( RooDataSet&             dataset , 
@@ -89,6 +99,21 @@ namespace Ostap
       const std::string&      namez   , 
       const TH3&              histo   ) ;
     // ========================================================================
+    /** add new columns to the dataset, filled from the array of values
+     *  - for the vector-store datasets the columns are appended 
+     *    and filled in place: no intermediate dataset is created, 
+     *    and the memory grows only by the size of new columns 
+     *  - for other storage types the columns are merged to the dataset
+     *  @param  dataset (UPDATE) the dataset
+     *  @param  vars    (INPUT)  the variables (RooRealVar or RooCategory) to be added
+     *  @param  values  (INPUT)  the values, row-major: <code>values[entry*nvars+ivar]</code>
+     *  @return status code 
+     */
+    Ostap::StatusCode add_columns 
+    ( RooDataSet&                dataset , 
+      const RooArgList&          vars    , 
+      const std::vector<double>& values  ) ;
+    // ========================================================================
   } //                                    The end of namespace Ostap::Functions 
   // ==========================================================================
 } //                                                 The end of namespace Ostap
@@ -22,6 +22,15 @@ namespace Ostap
     // ========================================================================
     /** @class Chi2Fit  Ostap/Chi2Fit.h
     *   Trivial chi2-fit 
+     *
+     *  Three fit methods are available:
+     *  - <code>Minimize</code>    : iterative GSL minimization (default)
+     *  - <code>Linear</code>      : direct weighted linear least squares:
+     *    the normal equations are solved using Cholesky decomposition, 
+     *    the uncertainties of components are accounted via iterative reweighting
+     *  - <code>NonNegative</code> : as <code>Linear</code>, but all parameters 
+     *    are non-negative (Lawson-Hanson algorithm). The parameters at the bound 
+     *    get zero uncertainties 
      *  @author Vanya BELYAEV Ivan.Belyaev@itep.ru
      *  @date   2012-05-26
      */
@@ -36,6 +45,14 @@ namespace Ostap
       /// the components 
       typedef std::vector<DATA>            CMPS ;
       // ======================================================================
+      /// the fit method 
+      enum Method 
+        {
+          Minimize    = 0 , // iterative GSL minimization 
+          Linear          , // direct linear least squares 
+          NonNegative       // non-negative linear least squares 
+        } ;
+      // ======================================================================
     public: 
       // ======================================================================
       /// fit with one component 
@@ -44,6 +61,14 @@ namespace Ostap
       /// fit with many component 
       Chi2Fit ( const DATA& data ,    // the data 
                 const CMPS& cmps ) ;  // the components
+      /// fit with one component using the given method 
+      Chi2Fit ( const DATA&  data   ,    // the data 
+                const DATA&  cmp    ,    // the component
+                const Method method ) ;  // the method 
+      /// fit with many component using the given method 
+      Chi2Fit ( const DATA&  data   ,    // the data 
+                const CMPS&  cmps   ,    // the components
+                const Method method ) ;  // the method 
       /// destructor 
       ~Chi2Fit () ; // destructor 
       // ======================================================================
@@ -57,6 +82,8 @@ namespace Ostap
       const CMPS& cmps () const { return m_cmps ; }      
       /// init values and steps 
       const DATA& init () const { return m_init ; }      
+      /// the fit method 
+      Method      method () const { return m_method ; }
       // ======================================================================
     public : // Fit results 
       // ======================================================================
@@ -68,9 +95,13 @@ namespace Ostap
                            const unsigned int i2 ) const ;
       /// the function at minimum
       double      chi2   () const { return m_chi2   ; } // the function at minimum
-      /// number of function calls 
+      /** number of function calls 
+       *  (number of Cholesky decompositions for linear methods)
+       */
       std::size_t ncalls () const { return m_calls  ; } // function calls 
-      /// number of iterations 
+      /** number of iterations 
+       *  (number of reweighting iterations for linear methods)
+       */
       std::size_t niters () const { return m_iters  ; }
       /// number of points 
       std::size_t points () const { return m_points ; }
@@ -91,6 +122,8 @@ namespace Ostap
       CMPS m_cmps ;
       // the init values and steps 
       DATA m_init ;
+      // the fit method 
+      Method m_method ;
       // ======================================================================
     private: // fit results 
       // ======================================================================
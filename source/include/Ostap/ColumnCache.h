@@ -0,0 +1,176 @@
+// ============================================================================
+#ifndef OSTAP_COLUMNCACHE_H
+#define OSTAP_COLUMNCACHE_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <string>
+#include <vector>
+#include <memory>
+// ============================================================================
+// Forward declarations
+// ============================================================================
+class TTree ; // from ROOT
+// ============================================================================
+namespace Ostap
+{
+  // ==========================================================================
+  namespace Trees
+  {
+    // ========================================================================
+    /** @class ColumnCache Ostap/ColumnCache.h
+     *  The opt-in process-wide cache of the primitive scalar branches,
+     *  materialized as the uncompressed arrays of doubles.
+     *
+     *  On the first access the requested branches are read (all of them
+     *  in one pass) and written into the local cache directory,
+     *  and later the files are memory-mapped, so the subsequent
+     *  loops read the values directly from the page cache,
+     *  without the decompression of ROOT baskets.
+     *  Since the cache is local, the remote and read-only inputs
+     *  are cached as well.
+     *
+     *  The cache directory is set by <code>setDirectory</code>,
+     *  otherwise it is the first writable of
+     *  <code>$OSTAP_COLUMN_CACHE</code>,
+     *  <code>$OSTAP_DIR/cache/columns</code>
+     *  (<code>$HOME/.ostap/cache/columns</code>) and
+     *  <code>$TMPDIR/ostap_columns_$UID</code>.
+     *  If no directory is writable, nothing is cached
+     *  and the tree is read as usual.
+     *
+     *  The total size of the cache is limited by <code>setMaxSize</code>
+     *  (or <code>$OSTAP_COLUMN_CACHE_SIZE</code> in MB, 4GB by default):
+     *  the least recently used columns are removed to make room for
+     *  the new ones, and the columns larger than the limit are not cached.
+     *
+     *  The columns are keyed by the identity of the input (file names,
+     *  sizes and modification times, tree name and number of entries,
+     *  the same for all friend trees) and the branch name, therefore
+     *  any change of the input files invalidates the cached columns.
+     *
+     *  @code
+     *  Ostap::Trees::ColumnCache::enable ( true ) ;
+     *  ...
+     *  auto columns = Ostap::Trees::ColumnCache::get ( tree , { "pt" , "eta" } ) ;
+     *  if ( !columns.empty() )
+     *  {
+     *    const double* pt = columns[0]->data() ;
+     *    ...
+     *  }
+     *  @endcode
+     *  @see Ostap::Trees::CutIndex
+     *  @author agent agent@local
+     *  @date   2026-10-19
+     */
+    class ColumnCache
+    {
+    public:
+      // ======================================================================
+      /** @class Column
+       *  The cached column: memory-mapped file
+       */
+      class Column
+      {
+      public:
+        // ====================================================================
+        /** map the column from the file
+         *  @param path the file name
+         *  @param key  the expected key of the column
+         */
+        Column ( const std::string& path , const std::string& key ) ;
+        /// destructor: unmap the file
+        ~Column () ;
+        // ====================================================================
+      public:
+        // ====================================================================
+        /// the values
+        const double* data   () const { return m_data   ; }
+        /// number of values
+        unsigned long size   () const { return m_size   ; }
+        /// memory-mapped column?
+        bool          mapped () const { return nullptr != m_map ; }
+        /// valid column?
+        bool          ok     () const { return nullptr != m_data ; }
+        // ====================================================================
+      private:
+        // ====================================================================
+        /// no copy
+        Column ( const Column& ) = delete ;
+        /// no assignement
+        Column& operator= ( const Column& ) = delete ;
+        // ====================================================================
+      private:
+        // ====================================================================
+        /// the mapped region
+        void*               m_map    { nullptr } ; // the mapped region
+        /// the length of the mapped region
+        unsigned long       m_length { 0       } ; // length of the mapped region
+        /// the values
+        const double*       m_data   { nullptr } ; // the values
+        /// number of values
+        unsigned long       m_size   { 0       } ; // number of values
+        // ====================================================================
+      } ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      typedef std::shared_ptr<const Column> COLUMN  ;
+      typedef std::vector<COLUMN>           COLUMNS ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** get the cached columns for the primitive scalar branches
+       *  (the missing columns are built in one pass over the tree)
+       *  @param tree  the tree
+       *  @param names the branch names
+       *  @return the columns (one per name), empty vector if the cache
+       *          is disabled, some branches are not primitive scalars,
+       *          the tree has the entry list or no input files,
+       *          the cache directory is not writable
+       *          or the columns do not fit into the cache
+       */
+      static COLUMNS get
+      ( TTree*                          tree  ,
+        const std::vector<std::string>& names ) ;
+      /** get the cached column for the primitive scalar branch
+       *  @param tree the tree
+       *  @param name the branch name
+       *  @return the column or <code>nullptr</code>
+       */
+      static COLUMN  get
+      ( TTree*                          tree  ,
+        const std::string&              name  ) ;
+      // ======================================================================
+      /// enable/disable the cache
+      static void enable  ( const bool value = true ) ;
+      /// is the cache enabled?
+      static bool enabled () ;
+      /// clear the in-memory cache (unmap all columns)
+      static void clear   () ;
+      // ======================================================================
+      /** set the directory for the persistent columns
+       *  @param dir the directory (empty: the default directory)
+       */
+      static void               setDirectory ( const std::string& dir = "" ) ;
+      /// the directory for the persistent columns (empty: no writable directory)
+      static std::string        directory    () ;
+      /** set the maximal size of the persistent cache
+       *  @param size the maximal size in bytes
+       */
+      static void               setMaxSize   ( const unsigned long long size ) ;
+      /// the maximal size of the persistent cache (bytes)
+      static unsigned long long maxSize      () ;
+      // ======================================================================
+    } ;
+    // ========================================================================
+  } //                                        The end of namespace Ostap::Trees
+  // ==========================================================================
+} //                                                 The end of namespace Ostap
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_COLUMNCACHE_H
+// ============================================================================
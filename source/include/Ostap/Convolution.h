@@ -0,0 +1,202 @@
+// ============================================================================
+#ifndef OSTAP_CONVOLUTION_H
+#define OSTAP_CONVOLUTION_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <vector>
+#include <complex>
+#include <memory>
+#include <functional>
+// ============================================================================
+namespace Ostap
+{
+  // ==========================================================================
+  namespace Math
+  {
+    // ========================================================================
+    /** @class Convolution Ostap/Convolution.h
+     *  Numerical convolution of the arbitrary 1D shape (the signal)
+     *  with the arbitrary resolution function via FFT
+     *  \f[ C(x) = \int f(x-t) r(t) dt \f]
+     *
+     *  - the signal is sampled in the range \f$ [x_{min},x_{max}]\f$,
+     *    and it is considered to be zero outside this range;
+     *  - the resolution is sampled in the window \f$ [t_{min},t_{max}]\f$,
+     *    and it is considered to be zero outside this window;
+     *  - the result is defined at \f$ [x_{min}+t_{min},x_{max}+t_{max}]\f$
+     *    and is linearly interpolated between the grid points.
+     *
+     *  The FFT plans (twiddle factors and bit-reversal tables) are shared
+     *  between all instances of the same size, the spectra of the signal and the
+     *  resolution are cached separately: <code>update</code> re-samples both
+     *  functions, but recalculates only the spectrum that actually changed.
+     *
+     *  @code
+     *  Ostap::Math::CrystalBall cb   ( 3.1 , 0.010 , 2 , 5 ) ;
+     *  Ostap::Math::Gauss       reso ( 0   , 0.005 ) ;
+     *  Ostap::Math::Convolution cnv  ( cb , reso , 3.0 , 3.2 , -0.05 , 0.05 ) ;
+     *  const double value = cnv ( 3.1 ) ;
+     *  reso.setSigma ( 0.007 ) ;
+     *  cnv.update () ;          // only the resolution spectrum is recalculated
+     *  @endcode
+     *
+     *  @see Ostap::Math::FourierSum::convolve
+     *  @author agent agent@local
+     *  @date   2026-10-19
+     */
+    class Convolution
+    {
+    public:
+      // ======================================================================
+      /// the function to be convolved
+      typedef std::function<double(double)> function1 ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** constructor from the signal and the resolution
+       *  @param signal     the signal
+       *  @param resolution the resolution function
+       *  @param xmin       low  edge of the signal range
+       *  @param xmax       high edge of the signal range
+       *  @param tmin       low  edge of the resolution window
+       *  @param tmax       high edge of the resolution window
+       *  @param nbins      number of bins for the signal range
+       */
+      Convolution
+      ( const function1&   signal          ,
+        const function1&   resolution      ,
+        const double       xmin            ,
+        const double       xmax            ,
+        const double       tmin            ,
+        const double       tmax            ,
+        const unsigned int nbins    = 1024 ) ;
+      // ======================================================================
+      /** constructor from the signal and resolution shapes
+       *  @attention the shapes are taken by reference,
+       *             and they must outlive the convolution object
+       *  @param signal     the signal
+       *  @param resolution the resolution function
+       *  @param xmin       low  edge of the signal range
+       *  @param xmax       high edge of the signal range
+       *  @param tmin       low  edge of the resolution window
+       *  @param tmax       high edge of the resolution window
+       *  @param nbins      number of bins for the signal range
+       */
+      template <class SIGNAL, class RESOLUTION>
+      Convolution
+      ( const SIGNAL&      signal          ,
+        const RESOLUTION&  resolution      ,
+        const double       xmin            ,
+        const double       xmax            ,
+        const double       tmin            ,
+        const double       tmax            ,
+        const unsigned int nbins    = 1024 )
+        : Convolution
+          ( function1 ( [&signal]     ( const double x ) -> double { return signal     ( x ) ; } ) ,
+            function1 ( [&resolution] ( const double t ) -> double { return resolution ( t ) ; } ) ,
+            xmin , xmax , tmin , tmax , nbins )
+      {}
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// evaluate the convolution
+      double operator() ( const double x ) const ;
+      // ======================================================================
+      /** evaluate the convolution for many points
+       *  @param n      number of points
+       *  @param x      the points
+       *  @param result (OUTPUT) the values
+       */
+      void evaluate
+      ( const std::size_t n      ,
+        const double*     x      ,
+        double*           result ) const ;
+      // ======================================================================
+      /// evaluate the convolution for many points
+      std::vector<double> evaluate ( const std::vector<double>& x ) const ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** update the convolution:
+       *  re-sample both functions and recalculate the spectrum
+       *  only for the function(s) that have changed
+       *  @return true if the convolution has been changed
+       */
+      bool update () ;
+      // ======================================================================
+      /// set the new signal
+      void setSignal     ( const function1& signal     ) ;
+      /// set the new resolution function
+      void setResolution ( const function1& resolution ) ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// low  edge of the convolution
+      double       xmin () const { return m_x0 ; }
+      /// high edge of the convolution
+      double       xmax () const { return m_x0 + ( m_result.size () - 1 ) * m_h ; }
+      /// the grid step
+      double       step () const { return m_h ; }
+      /// the size of FFT
+      unsigned int size () const { return m_size ; }
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// the FFT plan (opaque)
+      class Plan ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// sample the signal, return true if it has been changed
+      bool _sample_signal_     () ;
+      /// sample the resolution, return true if it has been changed
+      bool _sample_resolution_ () ;
+      /// calculate the result from two spectra
+      void _convolve_          () ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// the signal
+      function1                          m_signal     ;
+      /// the resolution
+      function1                          m_resolution ;
+      /// low edge of the signal range
+      double                             m_xmin       ;
+      /// low edge of the resolution window
+      double                             m_tmin       ;
+      /// the grid step
+      double                             m_h          ;
+      /// number of bins for the signal
+      unsigned int                       m_nf         ;
+      /// number of points for the resolution
+      unsigned int                       m_nr         ;
+      /// the FFT size
+      unsigned int                       m_size       ;
+      /// the FFT plan
+      std::shared_ptr<const Plan>        m_plan       ;
+      /// the sampled signal
+      std::vector<double>                m_fs         ;
+      /// the sampled resolution
+      std::vector<double>                m_rs         ;
+      /// the spectrum of the signal
+      std::vector<std::complex<double> > m_fspec      ;
+      /// the spectrum of the resolution
+      std::vector<std::complex<double> > m_rspec      ;
+      /// the convolution at the grid points
+      std::vector<double>                m_result     ;
+      /// the position of the first grid point
+      double                             m_x0         ;
+      // ======================================================================
+    } ;
+    // ========================================================================
+  } //                                         The end of namespace Ostap::Math
+  // ==========================================================================
+} //                                                 The end of namespace Ostap
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_CONVOLUTION_H
+// ============================================================================
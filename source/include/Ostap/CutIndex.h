@@ -0,0 +1,143 @@
+// ============================================================================
+#ifndef OSTAP_CUTINDEX_H
+#define OSTAP_CUTINDEX_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <string>
+#include <vector>
+#include <memory>
+#include <utility>
+// ============================================================================
+// Forward declarations
+// ============================================================================
+class TTree ; // from ROOT
+// ============================================================================
+namespace Ostap
+{
+  // ==========================================================================
+  namespace Trees
+  {
+    // ========================================================================
+    /** @class CutIndex Ostap/CutIndex.h
+     *  The list of entries that pass the selection criteria,
+     *  compressed as the sorted list of the contiguous ranges
+     *  <code>[begin,end)</code>.
+     *
+     *  The opt-in process-wide cache keeps the indices keyed by the
+     *  identity of the input (file names, sizes and modification times,
+     *  tree name and number of entries, the same for all friend trees)
+     *  and the normalized cut expression.
+     *  The indices are stored persistently in the directory
+     *  <code>.ostap_cutindex</code> alongside the first data file (if writable),
+     *  and the later loops with the same cuts iterate only over the
+     *  passing entries, skipping the evaluation of cuts.
+     *
+     *  @code
+     *  Ostap::Trees::CutIndex::enable ( true ) ;
+     *  ...
+     *  auto index = Ostap::Trees::CutIndex::get ( tree , "pt>1 && abs(eta)<2" ) ;
+     *  if ( index ) { for ( const auto& r : index->ranges() ) { ... } }
+     *  @endcode
+     *
+     *  @attention only the boolean cuts are cached: for the cuts that
+     *             are used as weights (values other than 0 and 1)
+     *             <code>get</code> returns <code>nullptr</code>
+     *  @author agent agent@local
+     *  @date   2026-10-19
+     */
+    class CutIndex
+    {
+    public:
+      // ======================================================================
+      /// the range of entries <code>[begin,end)</code>
+      typedef std::pair<unsigned long,unsigned long> Range  ;
+      /// the list of ranges
+      typedef std::vector<Range>                     Ranges ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// the empty index
+      CutIndex () = default ;
+      /** build the index: evaluate cuts for all entries of the tree
+       *  @param tree the tree
+       *  @param cuts the selection criteria
+       */
+      CutIndex ( TTree* tree , const std::string& cuts ) ;
+      /** constructor from the ranges
+       *  @param ranges  the sorted list of ranges of passing entries
+       *  @param entries total number of entries in the tree
+       */
+      CutIndex ( const Ranges& ranges , const unsigned long entries ) ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// add the entry (entries must be added in increasing order)
+      void add ( const unsigned long entry ) ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// the ranges of passing entries
+      const Ranges& ranges   () const { return m_ranges   ; }
+      /// number of passing entries
+      unsigned long size     () const { return m_size     ; }
+      /// total number of entries in the tree
+      unsigned long entries  () const { return m_entries  ; }
+      /// the cut is boolean (the index can be used instead of cuts)
+      bool          boolean  () const { return m_boolean  ; }
+      /// valid index?
+      bool          ok       () const { return m_ok       ; }
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** get the index from the cache (memory, then persistent storage),
+       *  or build it and put into the cache
+       *  @param tree the tree
+       *  @param cuts the selection criteria
+       *  @return the index, <code>nullptr</code> if the cache is disabled,
+       *          the cut is not boolean or the tree has the entry list
+       */
+      static std::shared_ptr<const CutIndex>
+      get ( TTree* tree , const std::string& cuts ) ;
+      // ======================================================================
+      /// enable/disable the cache
+      static void        enable    ( const bool value = true ) ;
+      /// is the cache enabled?
+      static bool        enabled   () ;
+      /// clear the in-memory cache
+      static void        clear     () ;
+      /** normalize the cut expression: remove the blanks and sort the
+       *  (unique) top-level conjuncts, e.g.
+       *  <code>"pt > 1 && eta<2 && pt>1"</code> becomes
+       *  <code>"eta<2&&pt>1"</code>.
+       *  The expressions with top-level <code>||</code> or <code>?:</code>
+       *  are kept verbatim (only the blanks are removed).
+       *  The quoted string literals are kept untouched.
+       */
+      static std::string normalize ( const std::string& cuts ) ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// the ranges
+      Ranges        m_ranges  {}        ; // the ranges
+      /// number of passing entries
+      unsigned long m_size    { 0     } ; // number of passing entries
+      /// total number of entries
+      unsigned long m_entries { 0     } ; // total number of entries
+      /// boolean cut?
+      bool          m_boolean { true  } ; // boolean cut?
+      /// valid index?
+      bool          m_ok      { false } ; // valid index?
+      // ======================================================================
+    } ;
+    // ========================================================================
+  } //                                        The end of namespace Ostap::Trees
+  // ==========================================================================
+} //                                                 The end of namespace Ostap
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_CUTINDEX_H
+// ============================================================================
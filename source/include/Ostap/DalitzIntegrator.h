@@ -0,0 +1,166 @@
+// ============================================================================
+#ifndef OSTAP_DALITZINTEGRATOR_H
+#define OSTAP_DALITZINTEGRATOR_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <cmath>
+#include <vector>
+#include <memory>
+#include <functional>
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/Dalitz.h"
+// ============================================================================
+namespace Ostap
+{
+  // ==========================================================================
+  namespace Math
+  {
+    // ========================================================================
+    /** @class DalitzIntegrator Ostap/DalitzIntegrator.h
+     *  Integration of functions \f$ f(s_1,s_2)\f$ over the Dalitz plot
+     *  using the precomputed boundary-adapted quadrature grid.
+     *
+     *  The grid is the product of Gauss-Legendre rules:
+     *  - for \f$ s_1 \f$ the substitution
+     *    \f$ s_1 = s_1^{min} + \frac{1}{2}(s_1^{max}-s_1^{min})(1-\cos\theta)\f$
+     *    is applied, that removes the square-root behaviour of the
+     *    Dalitz plot boundary near  \f$ s_1^{min}\f$ and \f$ s_1^{max}\f$;
+     *  - for  \f$ s_2 \f$ the nodes are placed between the
+     *    boundaries \f$ s_2^{min/max}(s_1)\f$ for each \f$ s_1\f$ node.
+     *
+     *  The nodes and the weights (including all Jacobians) are calculated
+     *  once per \f$ (M,m_1,m_2,m_3)\f$ and the grid size, and are cached
+     *  and shared between all integrators with the same configuration,
+     *  so that the integration of any function is just a weighted sum
+     *  over the grid points, optionally split into several threads.
+     *
+     *  @code
+     *  Ostap::Kinematics::Dalitz       dalitz ( 5 , 0.1 , 0.2 , 0.3 ) ;
+     *  Ostap::Math::DalitzIntegrator   integrator ( dalitz ) ;
+     *  auto   fun  = [] ( double s1 , double s2 ) { return s1 * s2 ; } ;
+     *  double norm = integrator.integrate ( fun ) ;
+     *  @endcode
+     *
+     *  @attention for multithreaded integration the function must be thread-safe
+     *  @see Ostap::Kinematics::Dalitz
+     *  @author agent agent@local
+     *  @date   2026-10-19
+     */
+    class DalitzIntegrator
+    {
+    public:
+      // ======================================================================
+      /// the function of two variables \f$ f(s_1,s_2)\f$
+      typedef std::function<double(double,double)> function2 ;
+      // ======================================================================
+      /** @struct Grid
+       *  the actual integration grid: the nodes and the weights
+       */
+      struct Grid
+      {
+        /// \f$ s_1 \f$ for the nodes
+        std::vector<double> s1 {} ;
+        /// \f$ s_2 \f$ for the nodes
+        std::vector<double> s2 {} ;
+        /// the weights (including all Jacobians)
+        std::vector<double> w  {} ;
+      } ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** constructor from the Dalitz plot and the grid size
+       *  @param dalitz the Dalitz plot
+       *  @param n1     number of nodes for \f$ s_1 \f$
+       *  @param n2     number of nodes for \f$ s_2 \f$ (for each  \f$ s_1 \f$ )
+       */
+      DalitzIntegrator
+      ( const Ostap::Kinematics::Dalitz& dalitz     ,
+        const unsigned short             n1    = 48 ,
+        const unsigned short             n2    = 48 ) ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** integrate the function over the Dalitz plot
+       *  \f$ I = \int\int_{\mathcal{D}} f(s_1,s_2) \mathrm{d}s_1 \mathrm{d}s_2 \f$
+       *  @param f        the function
+       *  @param nthreads number of threads
+       *  @return the integral
+       */
+      double integrate
+      ( const function2&     f            ,
+        const unsigned short nthreads = 1 ) const ;
+      // ======================================================================
+      /** integrate the function over the Dalitz plot with the phase space density
+       *  \f$ I = \int\int_{\mathcal{D}} f(s_1,s_2) R_3(s_1,s_2) \mathrm{d}s_1 \mathrm{d}s_2 \f$
+       *  @param f        the function
+       *  @param nthreads number of threads
+       *  @return the integral
+       *  @see Ostap::Kinematics::Dalitz::density
+       */
+      double integrate_ps
+      ( const function2&     f            ,
+        const unsigned short nthreads = 1 ) const
+      { return m_density * integrate ( f , nthreads ) ; }
+      // ======================================================================
+      /** evaluate the function at all grid points
+       *  (e.g. the efficiency map, to be reused for many integrals)
+       *  @param f        the function
+       *  @param values   (OUTPUT) the function values
+       *  @param nthreads number of threads
+       */
+      void evaluate
+      ( const function2&     f            ,
+        std::vector<double>& values       ,
+        const unsigned short nthreads = 1 ) const ;
+      // ======================================================================
+      /** integrate the product of the function and the tabulated values
+       *  \f$ I = \sum_i w_i f(s_{1,i},s_{2,i}) v_i \f$
+       *  @param f        the function
+       *  @param values   the tabulated values, e.g. from <code>evaluate</code>
+       *  @param nthreads number of threads
+       *  @return the integral
+       */
+      double integrate
+      ( const function2&           f            ,
+        const std::vector<double>& values       ,
+        const unsigned short       nthreads = 1 ) const ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// the area of the Dalitz plot \f$ \int\int_{\mathcal{D}} \mathrm{d}s_1 \mathrm{d}s_2 \f$
+      double area        () const { return m_area ; }
+      /// the integrated phase space
+      double phase_space () const { return m_density * m_area ; }
+      /// number of grid points
+      std::size_t size   () const { return m_grid->w.size() ; }
+      /// the grid
+      const Grid& grid   () const { return *m_grid ; }
+      /// the Dalitz plot
+      const Ostap::Kinematics::Dalitz& dalitz () const { return m_dalitz ; }
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// the Dalitz plot
+      Ostap::Kinematics::Dalitz   m_dalitz  ;      // the Dalitz plot
+      /// the grid
+      std::shared_ptr<const Grid> m_grid    ;      // the grid
+      /// the area of the Dalitz plot
+      double                      m_area    ;      // the area
+      /// the phase space density
+      double                      m_density ;      // the phase space density
+      // ======================================================================
+    } ;
+    // ========================================================================
+  } //                                         The end of namespace Ostap::Math
+  // ==========================================================================
+} //                                                 The end of namespace Ostap
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_DALITZINTEGRATOR_H
+// ============================================================================
@@ -0,0 +1,141 @@
+// ============================================================================
+#ifndef OSTAP_DATAFRAMEBOOKER_H
+#define OSTAP_DATAFRAMEBOOKER_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD & STL
+// ============================================================================
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/StatusCode.h"
+#include "Ostap/DataFrame.h"
+#include "Ostap/WStatEntity.h"
+// ============================================================================
+// Forward declarations
+// =============================================================================
+class TH1       ;     // ROOT
+class TH2       ;     // ROOT
+class TH3       ;     // ROOT
+// =============================================================================
+namespace Ostap
+{
+  // ==========================================================================
+  /** @class DataFrameBooker Ostap/DataFrameBooker.h
+   *  Lazy booking of many projections and statistics for the same DataFrame.
+   *
+   *  Each of  <code>HistoProject::project</code> and <code>StatVar::statVar</code>
+   *  for DataFrame triggers its own event loop.
+   *  Here all actions are booked lazily against the same frame,
+   *  and the single event loop is executed by <code>run</code>,
+   *  after which the results are delivered to the booked histograms/counters.
+   *
+   *  @code
+   *  DataFrame frame = ... ;
+   *  TH1D h1 ( ... ) , h2 ( ... ) ;
+   *  Ostap::WStatEntity s1 ;
+   *  Ostap::DataFrameBooker booker ( frame ) ;
+   *  booker.project ( &h1 , "pt"   , "y>2" ) ;
+   *  booker.project ( &h2 , "mass"         ) ;
+   *  booker.statVar ( s1  , "pt*pt"        ) ;
+   *  booker.run () ; // single event loop
+   *  @endcode
+   *
+   *  @attention the booked histograms and counters must be alive till
+   *             <code>run</code> is invoked
+   *  @see Ostap::HistoProject
+   *  @see Ostap::StatVar
+   *  @author agent agent@local
+   *  @date   2026-10-19
+   */
+  class DataFrameBooker
+  {
+  public:
+    // ========================================================================
+    /// constructor from the frame
+    DataFrameBooker ( DataFrame frame ) ;
+    /// destructor
+    ~DataFrameBooker () ;
+    // ========================================================================
+  public:
+    // ========================================================================
+    /** book the projection of DataFrame into the histogram
+     *  @param histo      (UPDATE) histogram
+     *  @param expression (INPUT)  expression
+     *  @param selection  (INPUT)  selection criteria/weight
+     */
+    Ostap::StatusCode project
+    ( TH1*                histo           ,
+      const std::string&  expression      ,
+      const std::string&  selection  = "" ) ;
+    // ========================================================================
+    /** book the projection of DataFrame into the histogram
+     *  @param histo       (UPDATE) histogram
+     *  @param xexpression (INPUT)  expression for x-axis
+     *  @param yexpression (INPUT)  expression for y-axis
+     *  @param selection   (INPUT)  selection criteria/weight
+     */
+    Ostap::StatusCode project2
+    ( TH2*                histo           ,
+      const std::string&  xexpression     ,
+      const std::string&  yexpression     ,
+      const std::string&  selection  = "" ) ;
+    // ========================================================================
+    /** book the projection of DataFrame into the histogram
+     *  @param histo       (UPDATE) histogram
+     *  @param xexpression (INPUT)  expression for x-axis
+     *  @param yexpression (INPUT)  expression for y-axis
+     *  @param zexpression (INPUT)  expression for z-axis
+     *  @param selection   (INPUT)  selection criteria/weight
+     */
+    Ostap::StatusCode project3
+    ( TH3*                histo           ,
+      const std::string&  xexpression     ,
+      const std::string&  yexpression     ,
+      const std::string&  zexpression     ,
+      const std::string&  selection  = "" ) ;
+    // ========================================================================
+    /** book the statistic for the <code>expression</code>
+     *  @param stat       (UPDATE) the counter
+     *  @param expression (INPUT)  the expression
+     *  @param cuts       (INPUT)  the selection
+     *  @see Ostap::StatVar::statVar
+     */
+    Ostap::StatusCode statVar
+    ( Ostap::WStatEntity& stat            ,
+      const std::string&  expression      ,
+      const std::string&  cuts       = "" ) ;
+    // ========================================================================
+  public:
+    // ========================================================================
+    /** run the single event loop for all booked actions and
+     *  deliver the results into the booked histograms/counters
+     *  @return number of delivered results
+     */
+    unsigned long run () ;
+    // ========================================================================
+    /// number of booked (and not yet delivered) actions
+    unsigned long size  () const { return m_actions.size() ; }
+    /// clear all booked actions (the event loop is not executed)
+    void          clear () { m_actions.clear() ; }
+    // ========================================================================
+  private:
+    // ========================================================================
+    /// the frame
+    std::unique_ptr<DataFrame>          m_frame   {} ; // the frame
+    /// the booked actions: deliver the result
+    std::vector<std::function<void()> > m_actions {} ; // the booked actions
+    // ========================================================================
+  } ;
+  // ==========================================================================
+} //                                                 The end of namespace Ostap
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_DATAFRAMEBOOKER_H
+// ============================================================================
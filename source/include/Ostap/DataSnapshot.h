@@ -0,0 +1,176 @@
+// ============================================================================
+#ifndef OSTAP_DATASNAPSHOT_H
+#define OSTAP_DATASNAPSHOT_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <limits>
+#include <string>
+#include <vector>
+#include <map>
+// ============================================================================
+// Forward declarations
+// ============================================================================
+class RooAbsData ; // RooFit
+// ============================================================================
+namespace Ostap
+{
+  // ==========================================================================
+  /** @class DataSnapshot Ostap/DataSnapshot.h
+   *  Columnar snapshot of <code>RooAbsData</code>: contiguous arrays of
+   *  doubles for all (or selected) variables plus the array of weights.
+   *  The snapshot is built once with a single scan over the data,
+   *  and then it can be used for fast repeated scans, avoiding
+   *  virtual <code>RooAbsData::get</code>, <code>RooAbsReal::getVal</code>
+   *  and <code>RooAbsData::weight</code> calls
+   *
+   *  Columns for arbitrary expressions are calculated (once) on demand
+   *  from the original dataset, therefore the dataset must outlive the snapshot
+   *  if derived columns are requested
+   *
+   *  @code
+   *  const RooAbsData& data = ... ;
+   *  DataSnapshot snap ( data ) ;
+   *  const DataSnapshot::Column& pt = snap.column ( "pt"      ) ;
+   *  const DataSnapshot::Column& c  = snap.column ( "pt>1000" ) ; // calculated once
+   *  const DataSnapshot::Column& w  = snap.weights() ;
+   *  @endcode
+   *  @see Ostap::StatVar
+   *  @see Ostap::HistoProject
+   *  @see Ostap::DataParam
+   *  @author agent agent@local
+   *  @date   2026-10-19
+   */
+  class DataSnapshot
+  {
+  public:
+    // ========================================================================
+    /// the actual type of column
+    typedef std::vector<double>       Column  ;
+    /// the actual type of the column names
+    typedef std::vector<std::string>  Names   ;
+    // ========================================================================
+    static_assert ( std::numeric_limits<unsigned long>::is_specialized   ,
+                    "Numeric_limist<unsigned long> are not specialized!" ) ;
+    static constexpr unsigned long LAST { std::numeric_limits<unsigned long>::max() } ;
+    // ========================================================================
+  public:
+    // ========================================================================
+    /** create the snapshot for all variables in dataset
+     *  @param data      (INPUT) the dataset
+     *  @param cut_range (INPUT) the cut-range
+     *  @param first     (INPUT) the first entry to be used
+     *  @param last      (INPUT) the last entry to be used (not included)
+     */
+    DataSnapshot
+    ( const RooAbsData&   data             ,
+      const std::string&  cut_range = ""   ,
+      const unsigned long first     = 0    ,
+      const unsigned long last      = LAST ) ;
+    // ========================================================================
+    /** create the snapshot for selected variables/expressions
+     *  @param data      (INPUT) the dataset
+     *  @param variables (INPUT) variables/expressions to be stored
+     *  @param cut_range (INPUT) the cut-range
+     *  @param first     (INPUT) the first entry to be used
+     *  @param last      (INPUT) the last entry to be used (not included)
+     */
+    DataSnapshot
+    ( const RooAbsData&   data             ,
+      const Names&        variables        ,
+      const std::string&  cut_range = ""   ,
+      const unsigned long first     = 0    ,
+      const unsigned long last      = LAST ) ;
+    // ========================================================================
+  public:
+    // ========================================================================
+    /// number of entries in snapshot
+    unsigned long size     () const { return m_weights.size  () ; }
+    /// empty snapshot?
+    bool          empty    () const { return m_weights.empty () ; }
+    /// weighted snapshot?
+    bool          weighted () const { return m_weighted          ; }
+    /// the weights
+    const Column& weights  () const { return m_weights           ; }
+    /// sum of weights
+    double        sumw     () const { return m_sumw              ; }
+    /// sum of squared weights
+    double        sumw2    () const { return m_sumw2             ; }
+    /// the dataset
+    const RooAbsData* data () const { return m_data              ; }
+    // ========================================================================
+  public:
+    // ========================================================================
+    /// does the snapshot have this column?
+    bool  has   ( const std::string& name ) const
+    { return m_columns.end () != m_columns.find ( name ) ; }
+    /// all known columns
+    Names names () const ;
+    // ========================================================================
+    /** get the column for the variable or expression
+     *  - if the column is not in snapshot, it is calculated
+     *    from the original dataset and stored
+     *  @param expression the name of variable or expression
+     *  @return the column
+     */
+    const Column& column ( const std::string& expression ) ;
+    // ========================================================================
+    /** add the named column, calculated  from the expression
+     *  @param name       the name of the new column
+     *  @param expression the expression
+     *  @return the column
+     */
+    const Column& add
+    ( const std::string& name       ,
+      const std::string& expression ) ;
+    // ========================================================================
+    /** get the column of weights, combined with selection
+     *  - if the selection is empty, the snapshot weights are returned
+     *  @param selection the selection/weight expression
+     *  @param result    (OUTPUT) the combined weights
+     *  @return reference to combined weights
+     */
+    const Column& weights
+    ( const std::string& selection ,
+      Column&            result    ) ;
+    // ========================================================================
+  private:
+    // ========================================================================
+    /// build the snapshot
+    void build ( const Names& variables ) ;
+    /// calculate the column from the dataset
+    void calculate ( const std::string& expression , Column& column ) const ;
+    // ========================================================================
+  private:
+    // ========================================================================
+    /// the original dataset (not owned)
+    const RooAbsData*           m_data      { nullptr } ;
+    /// cut range
+    std::string                 m_cut_range {}          ;
+    /// the first entry
+    unsigned long               m_first     { 0    }    ;
+    /// the last entry
+    unsigned long               m_last      { LAST }    ;
+    /// weighted ?
+    bool                        m_weighted  { false }   ;
+    /// the actual entries used (only for non-empty cut-range)
+    std::vector<unsigned long>  m_entries   {}          ;
+    /// weights
+    Column                      m_weights   {}          ;
+    /// sum of weights
+    double                      m_sumw      { 0 }       ;
+    /// sum of squared weights
+    double                      m_sumw2     { 0 }       ;
+    /// columns
+    std::map<std::string,Column> m_columns  {}          ;
+    // ========================================================================
+  } ;
+  // ==========================================================================
+} //                                                 The END of namespace Ostap
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_DATASNAPSHOT_H
+// ============================================================================
@@ -36,6 +36,17 @@ namespace Ostap
     // ========================================================================    
     /** @class GslError
      *  helper class to manipulate with GSL error handlers 
+     *
+     *  The single global GSL error handler is installed once
+     *  (by the first scope in the process), it dispatches the errors to the policy from the top of 
+     *  the thread-local stack of policies. 
+     *  The instances of this class (and derived classes) push 
+     *  the policy to the stack of the current thread at construction 
+     *  and remove it at destruction, therefore the scopes in 
+     *  different threads do not interfere. 
+     *  If the stack is empty, the error is dispatched to the handler 
+     *  that was active before the installation, or, if there was none,
+     *  handled as by GSL default handler (print and abort).
      *  @author Vanya BELYAEV Ivan.Belyaev@itep.ru
      */
     class GslError
@@ -52,7 +63,11 @@ namespace Ostap
       // ======================================================================
       typedef  void handler ( const char* , const char* , int , int ) ;
       GslError ( handler* h ) ;
-      handler*  m_previous ;
+      // ======================================================================
+    private: 
+      // ======================================================================
+      GslError ( const GslError& ) = delete ;
+      GslError& operator=( const GslError& ) = delete ;
       // ======================================================================
     };
     // ========================================================================
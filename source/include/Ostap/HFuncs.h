@@ -4,10 +4,15 @@
 // ============================================================================
 // Include files
 // ============================================================================
+// STD&STL
+// ============================================================================
+#include <memory>
+// ============================================================================
 // Ostap
 // ============================================================================
 #include "Ostap/IFuncs.h"
 #include "Ostap/HistoInterpolation.h"
+#include "Ostap/HistoInterpolators.h"
 // ============================================================================
 // ROOT
 // ============================================================================
@@ -177,6 +182,8 @@ namespace Ostap
       // ======================================================================
       ///  the histogram 
       TH1D           m_h1             {       } ; // the histogram
+      /// the prepared interpolator (created on demand)
+      mutable std::unique_ptr<Ostap::Math::HistoInterpolator1D> m_interpolator { nullptr } ; //!
       // ======================================================================
     } ;
     // ========================================================================
@@ -311,6 +318,8 @@ namespace Ostap
       // ======================================================================
       ///  the histogram 
       TH2D           m_h2             {       } ; // the histogram
+      /// the prepared interpolator (created on demand)
+      mutable std::unique_ptr<Ostap::Math::HistoInterpolator2D> m_interpolator { nullptr } ; //!
       // ======================================================================
     } ;
     // ========================================================================
@@ -468,6 +477,8 @@ namespace Ostap
       // ======================================================================
       ///  the histogram 
       TH3D           m_h3             {       } ; // the histogram
+      /// the prepared interpolator (created on demand)
+      mutable std::unique_ptr<Ostap::Math::HistoInterpolator3D> m_interpolator { nullptr } ; //!
       // ======================================================================
     } ; 
     // ========================================================================
@@ -27,6 +27,13 @@ namespace Ostap
       // ======================================================================
       /** @class Hesse Ostap/Hesse.h
        *  evaluate the hessian for the function
+       *
+       *  The second derivatives along independent directions can be 
+       *  calculated in parallel, see Hesse::calcHesse(unsigned short).
+       *  For this the function must be thread-safe, or the parameters 
+       *  must be clonable: each additional thread then uses its own copy
+       *  of the parameters, created by <code>clone</code> and 
+       *  released by <code>destroy</code>
        *  @author Vanya BELYAEV Ivan.Belyaev@itep.ru
        *  @date 2012-05-27
        */      
@@ -36,6 +43,10 @@ namespace Ostap
         // ====================================================================
         /// the actual type of function to be used for hessian calculation 
         typedef double (*function) ( const gsl_vector  * x, void* params ) ;
+        /// clone the parameters of the function (for multithreaded calculation)
+        typedef void*  (*clone_params)  ( void* params ) ;
+        /// delete the cloned parameters of the function 
+        typedef void   (*delete_params) ( void* params ) ;
         // ====================================================================
       public:
         // ====================================================================
@@ -44,11 +55,15 @@ namespace Ostap
          *  @param x      the point for hessian to be evaluated 
          *  @param params the parameters for the function 
          *  @param h the step-size (guess)
+         *  @param clone   clone the parameters for another thread (optional)
+         *  @param destroy delete the cloned parameters (optional)
          */
-        Hesse ( function          f      ,
-                const gsl_vector* x      ,
-                void*             params , 
-                const double      h      ) ;
+        Hesse ( function          f                 ,
+                const gsl_vector* x                 ,
+                void*             params            , 
+                const double      h                 , 
+                clone_params      clone   = nullptr , 
+                delete_params     destroy = nullptr ) ;
         /// destructor 
         ~Hesse() ;                                                // destructor 
         // ====================================================================
@@ -66,6 +81,16 @@ namespace Ostap
         Ostap::StatusCode calcHesse () ;
         Ostap::StatusCode calcCov2  () ;
         // ====================================================================
+        /** calculate the hessian, distributing the independent directions 
+         *  between several threads 
+         *  - the central point is evaluated only once 
+         *  - (i,j) and (j,i) directions are evaluated only once 
+         *  @attention the function must be thread-safe or the parameters 
+         *             must be clonable (see constructor) 
+         *  @param nthreads number of threads, 0 means "all available cores"
+         */
+        Ostap::StatusCode calcHesse ( const unsigned short nthreads ) ;
+        // ====================================================================
       public:
         // ====================================================================
         /// size of the problem
@@ -74,6 +99,8 @@ namespace Ostap
         const gsl_matrix* hesse () const { return m_hesse ; }
         /// get the inverse hesse ("covariance") matrix 
         const gsl_matrix* cov2  () const { return m_cov2  ; }
+        /// number of function calls for the last hessian calculation
+        unsigned long     ncalls () const { return m_ncalls ; }
         // ====================================================================
       private:
         // ====================================================================
@@ -83,8 +110,14 @@ namespace Ostap
         const gsl_vector* m_x      ; // the point 
         /// parameters 
         void*             m_params ; // the parameters 
+        /// clone the parameters 
+        clone_params      m_clone   ; // clone the parameters 
+        /// delete the cloned parameters 
+        delete_params     m_destroy ; // delete the cloned parameters 
         /// step-size 
         double            m_h      ; // the step-size 
+        /// number of function calls 
+        unsigned long     m_ncalls ; // number of function calls 
         // ====================================================================
       private:
         // ====================================================================
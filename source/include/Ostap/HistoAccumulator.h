@@ -0,0 +1,208 @@
+// ============================================================================
+#ifndef OSTAP_HISTOACCUMULATOR_H
+#define OSTAP_HISTOACCUMULATOR_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <atomic>
+#include <vector>
+#include <memory>
+// ============================================================================
+// Forward declarations
+// ============================================================================
+class TH1   ; // ROOT
+class TAxis ; // ROOT
+// ============================================================================
+namespace Ostap
+{
+  // ==========================================================================
+  namespace Utils
+  {
+    // ========================================================================
+    /** @class HistoAccumulator Ostap/HistoAccumulator.h
+     *  Thread-safe accumulator for 1D,2D and 3D-histograms.
+     *
+     *  The bins (sum of weights and sum of squared weights) are kept
+     *  in one contiguous array of atomic doubles, with the same global
+     *  bin numbering (including underflow/overflow bins) as <code>TH1</code>,
+     *  and the number of entries and the moments (mean, RMS, covariances,
+     *  exactly as for <code>TH1::Fill</code>) are kept in the striped counters.
+     *  Many threads fill the same accumulator concurrently without locks,
+     *  that avoids the private histogram per thread and the final merge.
+     *  At the end the content is copied into the histogram.
+     *
+     *  @code
+     *  TH2D histo ( ... ) ;
+     *  Ostap::Utils::HistoAccumulator acc { histo } ;
+     *  // in many threads:
+     *  acc.fill ( x , y , w ) ;
+     *  // at the end
+     *  acc.update ( histo ) ;
+     *  @endcode
+     *
+     *  @attention the bin is found exactly as <code>TAxis::FindFixBin</code>
+     *  @author agent agent@local
+     *  @date   2026-10-19
+     */
+    class HistoAccumulator
+    {
+    public:
+      // ======================================================================
+      /// constructor from the histogram (only the binning is used)
+      HistoAccumulator ( const TH1& histo ) ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** fill 1D-accumulator: <code>fill(x,w)</code> 
+       *  or 2D-accumulator with unit weight: <code>fill(x,y)</code> 
+       */
+      void fill ( const double x , const double w = 1 )
+      {
+        if ( 2 == m_dim ) { fill ( x , w , 1.0 ) ; return ; }            // RETURN
+        const std::size_t ix = m_axes [ 0 ].bin ( x ) ;
+        _fill_ ( ix , w , x , 0 , 0 , m_axes [ 0 ].inside ( ix ) ) ;
+      }
+      /** fill 2D-accumulator: <code>fill(x,y,w)</code> 
+       *  or 3D-accumulator with unit weight: <code>fill(x,y,z)</code> 
+       */
+      void fill ( const double x , const double y , const double w )
+      {
+        if ( 3 == m_dim ) { fill ( x , y , w , 1.0 ) ; return ; }        // RETURN
+        const std::size_t ix = m_axes [ 0 ].bin ( x ) ;
+        const std::size_t iy = m_axes [ 1 ].bin ( y ) ;
+        _fill_ ( ix + m_nx * iy , w , x , y , 0 , 
+                 m_axes [ 0 ].inside ( ix ) && m_axes [ 1 ].inside ( iy ) ) ;
+      }
+      /// fill 3D-accumulator
+      void fill ( const double x , const double y , const double z , const double w )
+      {
+        const std::size_t ix = m_axes [ 0 ].bin ( x ) ;
+        const std::size_t iy = m_axes [ 1 ].bin ( y ) ;
+        const std::size_t iz = m_axes [ 2 ].bin ( z ) ;
+        _fill_ ( ix + m_nx * ( iy + m_ny * iz ) , w , x , y , z , 
+                 m_axes [ 0 ].inside ( ix ) && 
+                 m_axes [ 1 ].inside ( iy ) && 
+                 m_axes [ 2 ].inside ( iz ) ) ;
+      }
+      /** fill the global bin 
+       *  @attention the moments (mean, RMS) are not updated
+       */
+      void fill_bin ( const std::size_t bin , const double w = 1 )
+      { _fill_ ( bin , w , 0 , 0 , 0 , false ) ; }
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** copy the content into the histogram
+       *  (the histogram must have the same number of bins)
+       */
+      void update  ( TH1& histo ) const ;
+      /// reset the content
+      void reset   () ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// dimension
+      unsigned short dimension () const { return m_dim ; }
+      /// number of global bins (including underflow/overflow bins)
+      std::size_t    size      () const { return m_size ; }
+      /// number of entries
+      unsigned long  entries   () const ;
+      /// sum of weights for the global bin
+      double         content   ( const std::size_t bin ) const
+      { return m_bins [ 2 * bin     ].load ( std::memory_order_relaxed ) ; }
+      /// sum of squared weights for the global bin
+      double         error2    ( const std::size_t bin ) const
+      { return m_bins [ 2 * bin + 1 ].load ( std::memory_order_relaxed ) ; }
+      // ======================================================================
+    private:
+      // ======================================================================
+      /** fill the global bin and (optionally) the moments 
+       *  @param bin   the global bin 
+       *  @param w     the weight 
+       *  @param x,y,z the values 
+       *  @param stats update the moments? (not for underflow/overflow bins)
+       */
+      void _fill_ ( const std::size_t bin   , 
+                    const double      w     , 
+                    const double      x     , 
+                    const double      y     , 
+                    const double      z     , 
+                    const bool        stats ) ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// the axis
+      struct Axis
+      {
+        /// default constructor (no binning: the only bin 0)
+        Axis () = default ;
+        /// constructor from ROOT axis
+        Axis ( const TAxis& axis ) ;
+        /// find the bin, exactly as <code>TAxis::FindFixBin</code>
+        std::size_t bin ( const double x ) const
+        {
+          if ( 0 == m_nbins  ) { return 0            ; }
+          if ( x < m_xmin    ) { return 0            ; }
+          if ( !( x < m_xmax ) ) { return m_nbins + 1 ; }
+          return m_edges.empty () ?
+            1 + std::size_t ( m_nbins * ( x - m_xmin ) / ( m_xmax - m_xmin ) ) : _bin_ ( x ) ;
+        }
+        /// find the bin for the variable binning
+        std::size_t _bin_ ( const double x ) const ;
+        /// is the bin inside the axis range (not underflow/overflow)?
+        bool inside ( const std::size_t bin ) const
+        { return 0 == m_nbins || ( 0 < bin && bin <= m_nbins ) ; }
+        /// number of bins
+        std::size_t         m_nbins { 0 } ;
+        /// the low edge
+        double              m_xmin  { 0 } ;
+        /// the high edge
+        double              m_xmax  { 0 } ;
+        /// the edges for the variable binning
+        std::vector<double> m_edges {}    ;
+      } ;
+      // ======================================================================
+      /** the number of moments, in the order of <code>TH1::GetStats</code>:
+       *  sumw, sumw2, sumwx, sumwx2, sumwy, sumwy2, sumwxy, sumwz, sumwz2, sumwxz, sumwyz 
+       */
+      enum { NStats = 11 } ;
+      /// the striped counter and moments (padded to the cache lines)
+      struct Stripe
+      {
+        std::atomic<unsigned long> m_n { 0 } ;
+        std::atomic<double>        m_stats [ NStats ] ;
+        char m_pad [ 128 - sizeof ( std::atomic<unsigned long> ) 
+                         - NStats * sizeof ( std::atomic<double> ) ] ;
+      } ;
+      /// number of stripes
+      enum { NStripes = 16 } ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// dimension
+      unsigned short                          m_dim    { 1 } ; // dimension
+      /// the axes
+      Axis                                    m_axes [ 3 ]   ; // the axes
+      /// number of global bins along x-axis (including underflow/overflow)
+      std::size_t                             m_nx     { 1 } ; // x-stride
+      /// number of global bins along y-axis (including underflow/overflow)
+      std::size_t                             m_ny     { 1 } ; // y-stride
+      /// total number of global bins
+      std::size_t                             m_size   { 0 } ; // number of bins
+      /// the bins: sum of weights and sum of squared weights
+      std::unique_ptr<std::atomic<double>[]>  m_bins   {}    ; // the bins
+      /// number of entries and the moments 
+      std::unique_ptr<Stripe[]>               m_stripes {}   ; // entries
+      // ======================================================================
+    } ;
+    // ========================================================================
+  } //                                        The end of namespace Ostap::Utils
+  // ==========================================================================
+} //                                                 The end of namespace Ostap
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_HISTOACCUMULATOR_H
+// ============================================================================
@@ -0,0 +1,326 @@
+// ============================================================================
+#ifndef OSTAP_HISTOINTERPOLATORS_H
+#define OSTAP_HISTOINTERPOLATORS_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD & STL
+// ============================================================================
+#include <vector>
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/ValueWithError.h"
+#include "Ostap/HistoInterpolation.h"
+// ============================================================================
+// forward declarations
+// ============================================================================
+class TAxis ; // from ROOT
+class TH1   ; // from ROOT
+class TH2   ; // from ROOT
+class TH3   ; // from ROOT
+// ============================================================================
+/** @file Ostap/HistoInterpolators.h
+ *  "Prepared" histogram interpolators: the histogram is converted once
+ *  into contiguous arrays of bin centres, contents and squared errors,
+ *  the bin lookup for uniform axes is O(1).
+ *  The results are the same as for Ostap::Math::HistoInterpolation
+ *  @see Ostap::Math::HistoInterpolation
+ *  @author agent agent@local
+ *  @date   2026-10-19
+ */
+// ============================================================================
+namespace Ostap
+{
+  // ==========================================================================
+  namespace Math
+  {
+    // ========================================================================
+    /** @class HistoAxis Ostap/HistoInterpolators.h
+     *  The prepared axis for histogram interpolation: bin edges,
+     *  bin centres and the (adjusted) interpolation type.
+     *  For each point it provides the interpolation stencil:
+     *  indices of bins and coefficients for values and for squared errors
+     *  @see Ostap::Math::HistoInterpolation
+     *  @author agent agent@local
+     *  @date   2026-10-19
+     */
+    class HistoAxis
+    {
+    public:
+      // ======================================================================
+      /// maximal size of the stencil
+      enum { MaxSize = 4 } ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** constructor from the axis
+       *  @param axis        (INPUT) the axis
+       *  @param t           (INPUT) interpolation type
+       *  @param edges       (INPUT) use the special treatment of edges ?
+       *  @param extrapolate (INPUT) use extrapolation ?
+       */
+      HistoAxis
+      ( const TAxis&                          axis                 ,
+        const HistoInterpolation::Type        t                    ,
+        const bool                            edges       = true   ,
+        const bool                            extrapolate = false  ) ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** get the interpolation stencil for the given point
+       *  @param x     (INPUT)  the point
+       *  @param index (OUTPUT) 0-based bin indices
+       *  @param cv    (OUTPUT) coefficients for the bin values
+       *  @param ce    (OUTPUT) coefficients for the squared bin errors
+       *  @return number of points in stencil, 0 for the point outside the axis
+       */
+      unsigned short stencil
+      ( const double  x     ,
+        unsigned int* index ,
+        double*       cv    ,
+        double*       ce    ) const ;
+      // ======================================================================
+      /// number of bins
+      unsigned int nbins   () const { return m_centres.size() ; }
+      /// uniform binning ?
+      bool         uniform () const { return m_uniform        ; }
+      /// the (adjusted) interpolation type
+      HistoInterpolation::Type type () const { return m_type  ; }
+      /// the bin width (0-based index)
+      double       width   ( const unsigned int i ) const
+      { return m_edges [ i + 1 ] - m_edges [ i ] ; }
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// find the bin: the same convention as TAxis::FindFixBin
+      unsigned int find ( const double x ) const ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// bin edges
+      std::vector<double>      m_edges       {} ;
+      /// bin centres
+      std::vector<double>      m_centres     {} ;
+      /// low edge
+      double                   m_xmin        { 0 } ;
+      /// high edge
+      double                   m_xmax        { 1 } ;
+      /// uniform binning?
+      bool                     m_uniform     { true } ;
+      /// the inverse bin width for uniform binning
+      double                   m_scale       { 1 } ;
+      /// the (adjusted) interpolation type
+      HistoInterpolation::Type m_type        { HistoInterpolation::Linear } ;
+      /// special treatment of edges?
+      bool                     m_edges_      { true  } ;
+      /// extrapolate ?
+      bool                     m_extrapolate { false } ;
+      // ======================================================================
+    } ;
+    // ========================================================================
+    /** @class HistoInterpolator1D Ostap/HistoInterpolators.h
+     *  Prepared interpolator for 1D-histogram
+     *  @see Ostap::Math::HistoInterpolation::interpolate_1D
+     *  @code
+     *  const TH1& h = ... ;
+     *  HistoInterpolator1D i ( h , HistoInterpolation::Cubic ) ;
+     *  ValueWithError v = i ( 0.5 ) ;   // value with error
+     *  double         w = i.value ( 0.5 ) ;   // value only
+     *  i.evaluate ( N , xs , results ) ;      // batch
+     *  @endcode
+     *  @attention For <code>edges=false</code> and no extrapolation the point
+     *  x=xmax is attributed to the last bin (as in interpolate_2D/interpolate_3D),
+     *  while HistoInterpolation::interpolate_1D returns the empty value here
+     *  @author agent agent@local
+     *  @date   2026-10-19
+     */
+    class HistoInterpolator1D
+    {
+    public:
+      // ======================================================================
+      /** constructor from the histogram
+       *  @param h1          (INPUT) input histogram
+       *  @param t           (INPUT) interpolation type
+       *  @param edges       (INPUT) use the special treatment of edges ?
+       *  @param extrapolate (INPUT) use extrapolation ?
+       *  @param density     (INPUT) rescale to density?
+       */
+      HistoInterpolator1D
+      ( const TH1&                     h1                                 ,
+        const HistoInterpolation::Type t           = HistoInterpolation::Linear ,
+        const bool                     edges       = true   ,
+        const bool                     extrapolate = false  ,
+        const bool                     density     = false  ) ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// get the interpolated value with error
+      Ostap::Math::ValueWithError operator() ( const double x ) const ;
+      /// get the interpolated value only
+      double value ( const double x ) const ;
+      // ======================================================================
+      /** batch evaluation: interpolated values only
+       *  @param n      (INPUT)  number of points
+       *  @param x      (INPUT)  x-values
+       *  @param result (OUTPUT) interpolated values
+       */
+      void evaluate
+      ( const unsigned long n      ,
+        const double*       x      ,
+        double*             result ) const ;
+      /// batch evaluation: interpolated values only
+      std::vector<double> evaluate ( const std::vector<double>& x ) const ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// x-axis
+      HistoAxis           m_x       ;
+      /// bin values (possibly as density)
+      std::vector<double> m_values  ;
+      /// squared bin errors (possibly as density)
+      std::vector<double> m_errors2 ;
+      // ======================================================================
+    } ;
+    // ========================================================================
+    /** @class HistoInterpolator2D Ostap/HistoInterpolators.h
+     *  Prepared interpolator for 2D-histogram
+     *  @see Ostap::Math::HistoInterpolation::interpolate_2D
+     *  @author agent agent@local
+     *  @date   2026-10-19
+     */
+    class HistoInterpolator2D
+    {
+    public:
+      // ======================================================================
+      /** constructor from the histogram
+       *  @param h2          (INPUT) input histogram
+       *  @param tx          (INPUT) interpolation type in x-direction
+       *  @param ty          (INPUT) interpolation type in y-direction
+       *  @param edges       (INPUT) use the special treatment of edges ?
+       *  @param extrapolate (INPUT) use extrapolation ?
+       *  @param density     (INPUT) rescale to density?
+       */
+      HistoInterpolator2D
+      ( const TH2&                     h2                                 ,
+        const HistoInterpolation::Type tx          = HistoInterpolation::Linear ,
+        const HistoInterpolation::Type ty          = HistoInterpolation::Linear ,
+        const bool                     edges       = true   ,
+        const bool                     extrapolate = false  ,
+        const bool                     density     = false  ) ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// get the interpolated value with error
+      Ostap::Math::ValueWithError operator()
+        ( const double x , const double y ) const ;
+      /// get the interpolated value only
+      double value ( const double x , const double y ) const ;
+      // ======================================================================
+      /** batch evaluation: interpolated values only
+       *  @param n      (INPUT)  number of points
+       *  @param x      (INPUT)  x-values
+       *  @param y      (INPUT)  y-values
+       *  @param result (OUTPUT) interpolated values
+       */
+      void evaluate
+      ( const unsigned long n      ,
+        const double*       x      ,
+        const double*       y      ,
+        double*             result ) const ;
+      /// batch evaluation: interpolated values only
+      std::vector<double> evaluate
+      ( const std::vector<double>& x ,
+        const std::vector<double>& y ) const ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// x-axis
+      HistoAxis           m_x       ;
+      /// y-axis
+      HistoAxis           m_y       ;
+      /// bin values (possibly as density), x-index runs fastest
+      std::vector<double> m_values  ;
+      /// squared bin errors (possibly as density)
+      std::vector<double> m_errors2 ;
+      // ======================================================================
+    } ;
+    // ========================================================================
+    /** @class HistoInterpolator3D Ostap/HistoInterpolators.h
+     *  Prepared interpolator for 3D-histogram
+     *  @see Ostap::Math::HistoInterpolation::interpolate_3D
+     *  @author agent agent@local
+     *  @date   2026-10-19
+     */
+    class HistoInterpolator3D
+    {
+    public:
+      // ======================================================================
+      /** constructor from the histogram
+       *  @param h3          (INPUT) input histogram
+       *  @param tx          (INPUT) interpolation type in x-direction
+       *  @param ty          (INPUT) interpolation type in y-direction
+       *  @param tz          (INPUT) interpolation type in z-direction
+       *  @param edges       (INPUT) use the special treatment of edges ?
+       *  @param extrapolate (INPUT) use extrapolation ?
+       *  @param density     (INPUT) rescale to density?
+       */
+      HistoInterpolator3D
+      ( const TH3&                     h3                                 ,
+        const HistoInterpolation::Type tx          = HistoInterpolation::Linear ,
+        const HistoInterpolation::Type ty          = HistoInterpolation::Linear ,
+        const HistoInterpolation::Type tz          = HistoInterpolation::Linear ,
+        const bool                     edges       = true   ,
+        const bool                     extrapolate = false  ,
+        const bool                     density     = false  ) ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// get the interpolated value with error
+      Ostap::Math::ValueWithError operator()
+        ( const double x , const double y , const double z ) const ;
+      /// get the interpolated value only
+      double value ( const double x , const double y , const double z ) const ;
+      // ======================================================================
+      /** batch evaluation: interpolated values only
+       *  @param n      (INPUT)  number of points
+       *  @param x      (INPUT)  x-values
+       *  @param y      (INPUT)  y-values
+       *  @param z      (INPUT)  z-values
+       *  @param result (OUTPUT) interpolated values
+       */
+      void evaluate
+      ( const unsigned long n      ,
+        const double*       x      ,
+        const double*       y      ,
+        const double*       z      ,
+        double*             result ) const ;
+      /// batch evaluation: interpolated values only
+      std::vector<double> evaluate
+      ( const std::vector<double>& x ,
+        const std::vector<double>& y ,
+        const std::vector<double>& z ) const ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// x-axis
+      HistoAxis           m_x       ;
+      /// y-axis
+      HistoAxis           m_y       ;
+      /// z-axis
+      HistoAxis           m_z       ;
+      /// bin values (possibly as density), x-index runs fastest
+      std::vector<double> m_values  ;
+      /// squared bin errors (possibly as density)
+      std::vector<double> m_errors2 ;
+      // ======================================================================
+    } ;
+    // ========================================================================
+  } //                                         The end of namespace Ostap::Math
+  // ==========================================================================
+} //                                                 The end of namespace Ostap
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_HISTOINTERPOLATORS_H
+// ============================================================================
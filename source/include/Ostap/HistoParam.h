@@ -0,0 +1,228 @@
+// ============================================================================
+#ifndef OSTAP_HISTOPARAM_H
+#define OSTAP_HISTOPARAM_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <atomic>
+#include <vector>
+#include <limits>
+#include <algorithm>
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/StatusCode.h"
+#include "Ostap/ValueWithError.h"
+#include "Ostap/ThreadPool.h"
+// ============================================================================
+// Forward declarations
+// ============================================================================
+class TH1 ; // ROOT
+// ============================================================================
+namespace Ostap
+{
+  // ==========================================================================
+  namespace Math
+  {
+    // ========================================================================
+    class Bernstein    ;
+    class ChebyshevSum ;
+    class LegendreSum  ;
+    class Polynomial   ;
+    class BSpline      ;
+    // ========================================================================
+  }
+  // ==========================================================================
+  namespace Utils
+  {
+    // ========================================================================
+    /** @class HistoParam Ostap/HistoParam.h
+     *  Parameterization of 1D-histograms by the functions,
+     *  that are linear in their parameters
+     *  (<code>Bernstein</code>, <code>ChebyshevSum</code>,
+     *  <code>LegendreSum</code>, <code>Polynomial</code>, <code>BSpline</code>).
+     *
+     *  The bin content is compared with the average of the function over
+     *  the bin, and the weighted least squares problem is solved directly
+     *  (normal equations, Cholesky decomposition) without iterative
+     *  minimization. The bins with zero uncertainty are ignored.
+     *
+     *  For Bernstein polynomials the shape constraints
+     *  (positive, monotonic, convex/concave) are imposed as the sufficient
+     *  linear inequality constraints for Bernstein coefficients,
+     *  and the problem is solved with the non-negative least squares.
+     *
+     *  @code
+     *  const TH1& histo = ... ;
+     *  Ostap::Utils::HistoParam param { histo } ;
+     *  Ostap::Math::Bernstein   poly  ( 5 , histo.GetXaxis()->GetXmin() , histo.GetXaxis()->GetXmax() ) ;
+     *  auto r = param.fit ( poly , Ostap::Utils::HistoParam::Increasing ) ;
+     *  if ( r.status().isSuccess() ) { ... poly ... r.cov2 ( 1 , 2 ) ... }
+     *  @endcode
+     *  @see Ostap::Math::Chi2Fit
+     *  @author agent agent@local
+     *  @date   2026-10-19
+     */
+    class HistoParam
+    {
+    public:
+      // ======================================================================
+      /// the shape constraints for Bernstein polynomials
+      enum Shape
+        {
+          Unconstrained     = 0 , // no constraints
+          Positive              , // positive
+          Increasing            , // positive, increasing
+          Decreasing            , // positive, decreasing
+          ConvexIncreasing      , // positive, increasing and convex
+          ConvexDecreasing      , // positive, decreasing and convex
+          ConcaveIncreasing     , // positive, increasing and concave
+          ConcaveDecreasing       // positive, decreasing and concave
+        } ;
+      // ======================================================================
+      /** @class Result
+       *  The result of parameterization
+       */
+      class Result
+      {
+        friend class HistoParam ;
+      public:
+        // ====================================================================
+        /// the status
+        const Ostap::StatusCode& status () const { return m_status ; }
+        /// chi2
+        double        chi2   () const { return m_chi2   ; }
+        /// number of bins used
+        unsigned long points () const { return m_points ; }
+        /// number of parameters
+        unsigned long npars  () const { return m_npars  ; }
+        /// number of degrees of freedom
+        long          ndf    () const { return long ( m_points ) - long ( m_npars ) ; }
+        /// the covariance matrix element
+        double        cov2   ( const unsigned short i ,
+                               const unsigned short j ) const
+        { return i < m_npars && j < m_npars ? m_cov2 [ i * m_npars + j ] : 0.0 ; }
+        // ====================================================================
+      private:
+        // ====================================================================
+        /// the status
+        Ostap::StatusCode   m_status { 0 } ; // the status
+        /// chi2
+        double              m_chi2   { 0 } ; // chi2
+        /// number of bins used
+        unsigned long       m_points { 0 } ; // number of bins
+        /// number of parameters
+        unsigned long       m_npars  { 0 } ; // number of parameters
+        /// the covariance matrix (row-major)
+        std::vector<double> m_cov2   {}    ; // covariance matrix
+        // ====================================================================
+      } ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** constructor from the histogram
+       *  @param histo the histogram
+       *  @param xmin  low edge of the fit range
+       *  @param xmax  high edge of the fit range
+       */
+      HistoParam
+      ( const TH1&   histo                                             ,
+        const double xmin  = -std::numeric_limits<double>::infinity () ,
+        const double xmax  =  std::numeric_limits<double>::infinity () ) ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// parameterize the histogram with Bernstein polynomial
+      Result fit ( Ostap::Math::Bernstein&    func                  ,
+                   const Shape                shape = Unconstrained ) const ;
+      /// parameterize the histogram with Chebyshev sum
+      Result fit ( Ostap::Math::ChebyshevSum& func ) const ;
+      /// parameterize the histogram with Legendre sum
+      Result fit ( Ostap::Math::LegendreSum&  func ) const ;
+      /// parameterize the histogram with polynomial
+      Result fit ( Ostap::Math::Polynomial&   func ) const ;
+      /// parameterize the histogram with B-spline
+      Result fit ( Ostap::Math::BSpline&      func ) const ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** parameterize many histograms in parallel
+       *  @param histos   the histograms
+       *  @param funcs    (UPDATE) the functions, one per histogram
+       *  @param xmin     low edge of the fit range
+       *  @param xmax     high edge of the fit range
+       *  @param nthreads number of threads (0: all threads of the pool, 1: sequential)
+       *  @return the results, one per histogram
+       */
+      template <class FUNCTION>
+      static std::vector<Result> fit_many
+      ( const std::vector<const TH1*>& histos                                                ,
+        std::vector<FUNCTION>&         funcs                                                 ,
+        const double                   xmin     = -std::numeric_limits<double>::infinity () ,
+        const double                   xmax     =  std::numeric_limits<double>::infinity () ,
+        const unsigned short           nthreads = 0                                          )
+      {
+        std::vector<Result> results ( histos.size () ) ;
+        const std::size_t   N = std::min ( histos.size () , funcs.size () ) ;
+        //
+        auto task = [&] ( const std::size_t begin , const std::size_t end )
+          {
+            for ( std::size_t i = begin ; i < end ; ++i )
+            {
+              if ( !histos [ i ] ) { continue ; }
+              results [ i ] = HistoParam ( *histos [ i ] , xmin , xmax ).fit ( funcs [ i ] ) ;
+            }
+          } ;
+        //
+        const std::size_t n = std::min<std::size_t>
+          ( 0 < nthreads ? nthreads : Ostap::Utils::ThreadPool::concurrency () , N ) ;
+        if ( n <= 1 ) { task ( 0 , N ) ; }
+        else
+        {
+          // n runners take the histograms one by one 
+          std::atomic<std::size_t> next { 0 } ;
+          Ostap::Utils::TaskGroup  group ;
+          for ( std::size_t k = 0 ; k < n ; ++k )
+          { group.run ( [&] () { for ( std::size_t i = next++ ; i < N ; i = next++ ) { task ( i , i + 1 ) ; } } ) ; }
+          group.wait () ;
+        }
+        return results ;
+      }
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// number of bins used for the fit
+      std::size_t size () const { return m_content.size () ; }
+      // ======================================================================
+    private:
+      // ======================================================================
+      /** solve the weighted least squares problem for the bin averages
+       *  @param F    the averages of basic functions over the bins
+       *  @param T    the transformation to non-negative parameters (or empty)
+       *  @param pars (output) the parameters
+       */
+      Result _solve_ ( const std::vector<double>& F    ,
+                       const std::vector<double>& T    ,
+                       std::vector<double>&       pars ) const ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// the low edges of bins
+      std::vector<double>                       m_low     {} ; // low edges
+      /// the high edges of bins
+      std::vector<double>                       m_high    {} ; // high edges
+      /// the bin contents
+      std::vector<Ostap::Math::ValueWithError>  m_content {} ; // contents
+      // ======================================================================
+    } ;
+    // ========================================================================
+  } //                                        The end of namespace Ostap::Utils
+  // ==========================================================================
+} //                                                 The end of namespace Ostap
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_HISTOPARAM_H
+// ============================================================================
@@ -24,6 +24,8 @@ class RooAbsReal ; // RooFit
 // =============================================================================
 namespace Ostap
 {  
+  // ==========================================================================
+  class DataSnapshot ; // Ostap 
   // ==========================================================================
   #if ROOT_VERSION_CODE< ROOT_VERSION(6,14,4)
     typedef ROOT::Experimental::TDataFrame DataFrame ;
@@ -194,6 +196,53 @@ namespace Ostap
       const std::string&  zexpression     ,
       const std::string&  selection  = "" ) ;
     // ========================================================================
+  public:  //   columnar snapshot 
+    // ========================================================================
+    /** make a projection of the columnar snapshot into the histogram 
+     *  @param data       (INPUT)  the columnar snapshot of data 
+     *  @param histo      (UPDATE) histogram 
+     *  @param expression (INPUT)  expression
+     *  @param selection  (INPUT)  selection criteria/weight 
+     *  @see Ostap::DataSnapshot
+     */
+    static Ostap::StatusCode project
+    ( DataSnapshot&       data            , 
+      TH1*                histo           ,
+      const std::string&  expression      ,
+      const std::string&  selection  = "" ) ;
+    // ========================================================================
+    /** make a projection of the columnar snapshot into the histogram 
+     *  @param data        (INPUT)  the columnar snapshot of data 
+     *  @param histo       (UPDATE) histogram 
+     *  @param xexpression (INPUT)  expression for x-axis 
+     *  @param yexpression (INPUT)  expression for y-axis 
+     *  @param selection   (INPUT)  selection criteria/weight 
+     *  @see Ostap::DataSnapshot
+     */
+    static Ostap::StatusCode project2
+    ( DataSnapshot&       data            , 
+      TH2*                histo           ,
+      const std::string&  xexpression     ,
+      const std::string&  yexpression     ,
+      const std::string&  selection  = "" ) ;
+    // ========================================================================
+    /** make a projection of the columnar snapshot into the histogram 
+     *  @param data        (INPUT)  the columnar snapshot of data 
+     *  @param histo       (UPDATE) histogram 
+     *  @param xexpression (INPUT)  expression for x-axis 
+     *  @param yexpression (INPUT)  expression for y-axis 
+     *  @param zexpression (INPUT)  expression for z-axis 
+     *  @param selection   (INPUT)  selection criteria/weight 
+     *  @see Ostap::DataSnapshot
+     */
+    static Ostap::StatusCode project3
+    ( DataSnapshot&       data            , 
+      TH3*                histo           ,
+      const std::string&  xexpression     ,
+      const std::string&  yexpression     ,
+      const std::string&  zexpression     ,
+      const std::string&  selection  = "" ) ;
+    // ========================================================================
   };
   // ==========================================================================
 } //                                                     end of namespace Ostap
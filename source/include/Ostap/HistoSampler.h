@@ -0,0 +1,178 @@
+// ============================================================================
+#ifndef OSTAP_HISTOSAMPLER_H
+#define OSTAP_HISTOSAMPLER_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/RandomStream.h"
+// ============================================================================
+// forward declarations
+// ============================================================================
+class TH1 ; // ROOT
+// ============================================================================
+namespace Ostap
+{
+  // ==========================================================================
+  namespace Utils
+  {
+    // ========================================================================
+    /** @class HistoSampler Ostap/HistoSampler.h
+     *  Prepared sampler for 1D,2D and 3D-histograms.
+     *
+     *  The bin is chosen using the Walker's alias tables,
+     *  that gives O(1) cost per draw independently on the number of bins,
+     *  and the point is distributed uniformly inside the bin,
+     *  in the same way as <code>TH1::GetRandom</code>,
+     *  <code>TH2::GetRandom2</code> and <code>TH3::GetRandom3</code>.
+     *
+     *  The random numbers are taken from the counter-based
+     *  <code>RandomStream</code>: the i-th point depends only on the stream and i,
+     *  therefore the generation is reproducible and can be split
+     *  into several threads without changing the result.
+     *
+     *  @code
+     *  TH2D histo = ... ;
+     *  const Ostap::Utils::HistoSampler sampler { histo } ;
+     *  const Ostap::Utils::RandomStream rng     { 12345 } ;
+     *  std::vector<double> points ( 2 * 1000000 ) ;
+     *  sampler.sample ( 1000000 , points.data() , rng , 0 , 4 ) ;
+     *  @endcode
+     *
+     *  @attention the bins with negative content as well as
+     *             underflow/overflow bins are ignored
+     *  @see TH1::GetRandom
+     *  @see TH2::GetRandom2
+     *  @see TH3::GetRandom3
+     *  @see Ostap::Utils::RandomStream
+     *  @author agent agent@local
+     *  @date   2026-10-19
+     */
+    class HistoSampler
+    {
+    public:
+      // ======================================================================
+      /// constructor from the histogram
+      HistoSampler ( const TH1& histo ) ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** sample the single point
+       *  @param rng   the random stream
+       *  @param index the index of the point in the stream
+       *  @param point (OUTPUT) the point, <code>dimension()</code> coordinates
+       */
+      void sample
+      ( const RandomStream& rng   ,
+        const std::uint64_t index ,
+        double*             point ) const ;
+      // ======================================================================
+      /** sample <code>n</code> points
+       *  @param n        number of points
+       *  @param points   (OUTPUT) the points, <code>n*dimension()</code> row-major array
+       *  @param rng      the random stream
+       *  @param first    the index of the first point in the stream
+       *  @param nthreads number of threads (0: all cores)
+       */
+      void sample
+      ( const std::size_t    n            ,
+        double*              points       ,
+        const RandomStream&  rng          ,
+        const std::uint64_t  first    = 0 ,
+        const unsigned short nthreads = 1 ) const ;
+      // ======================================================================
+      /** sample <code>n</code> points
+       *  @param n        number of points
+       *  @param rng      the random stream
+       *  @param first    the index of the first point in the stream
+       *  @param nthreads number of threads (0: all cores)
+       *  @return the points, <code>n*dimension()</code> row-major array
+       */
+      std::vector<double> sample
+      ( const std::size_t    n            ,
+        const RandomStream&  rng          ,
+        const std::uint64_t  first    = 0 ,
+        const unsigned short nthreads = 1 ) const ;
+      // ======================================================================
+      /** sample <code>n</code> points block-wise and invoke
+       *  <code>fun ( point )</code> for each point in order,
+       *  where <code>point</code> is <code>const double*</code>
+       *  with <code>dimension()</code> coordinates.
+       *  The memory is limited by the block size, while the points
+       *  are the same as for the single call of <code>sample</code>
+       *  @param n         number of points
+       *  @param rng       the random stream
+       *  @param fun       the function to be invoked for each point
+       *  @param first     the index of the first point in the stream
+       *  @param blocksize number of points in the block
+       *  @param nthreads  number of threads (0: all cores)
+       */
+      template <class FUNCTION>
+      void for_each
+      ( const std::size_t    n                 ,
+        const RandomStream&  rng               ,
+        FUNCTION             fun               ,
+        const std::uint64_t  first     = 0     ,
+        const std::size_t    blocksize = 65536 ,
+        const unsigned short nthreads  = 1     ) const
+      {
+        const std::size_t bsize = std::max ( blocksize , std::size_t ( 1 ) ) ;
+        std::vector<double> points ( std::min ( n , bsize ) * m_dim ) ;
+        for ( std::size_t b = 0 ; b < n ; b += bsize )
+        {
+          const std::size_t nb = std::min ( n - b , bsize ) ;
+          sample ( nb , points.data () , rng , first + b , nthreads ) ;
+          for ( std::size_t i = 0 ; i < nb ; ++i ) { fun ( points.data () + i * m_dim ) ; }
+        }
+      }
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// dimension of the histogram
+      unsigned short dimension () const { return m_dim ; }
+      /// number of (positive) bins to be sampled
+      std::size_t    size      () const { return m_prob.size  () ; }
+      /// empty sampler? (no positive bins)
+      bool           empty     () const { return m_prob.empty () ; }
+      /// sum of the positive bin contents
+      double         integral  () const { return m_integral ; }
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** get the new random stream, seeded from <code>gRandom</code>,
+       *  so that <code>gRandom->SetSeed(...)</code> makes the sampling reproducible
+       */
+      static RandomStream random_stream () ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// dimension
+      unsigned short             m_dim      { 1 } ; // dimension
+      /// the sum of positive bins
+      double                     m_integral { 0 } ; // sum of positive bins
+      /// the bin edges for x,y and z-axes
+      std::vector<double>        m_edges [ 3 ]    ; // the bin edges
+      /// the bin indices along x,y and z-axes for the positive bins
+      std::vector<unsigned int>  m_index [ 3 ]    ; // the bin indices
+      /// the alias table: probabilities
+      std::vector<double>        m_prob     {}    ; // probabilities
+      /// the alias table: aliases
+      std::vector<unsigned int>  m_alias    {}    ; // aliases
+      // ======================================================================
+    } ;
+    // ========================================================================
+  } //                                        The end of namespace Ostap::Utils
+  // ==========================================================================
+} //                                                 The end of namespace Ostap
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_HISTOSAMPLER_H
+// ============================================================================
@@ -7,6 +7,8 @@
 // STD&STL
 // ============================================================================
 #include <functional>
+#include <tuple>
+#include <vector>
 // ============================================================================
 // ============================================================================
 namespace Ostap
@@ -19,7 +21,7 @@ namespace Ostap
     class WorkSpace ; // forward decalration 
     // ========================================================================
     /** @class Integrator Ostap/Integrator.h 
-     *  simple numerical integrator for 1D&2D-cases 
+     *  simple numerical integrator for 1D,2D,3D&N-D-cases 
      */
     class Integrator 
     {
@@ -27,6 +29,32 @@ namespace Ostap
       // ======================================================================
       typedef std::function<double(double)>        function1 ;
       typedef std::function<double(double,double)> function2 ;
+      typedef std::function<double(double,double,double)> function3 ;
+      /// N-dimensional function: <code>f(x)</code>, where <code>x</code> is array of coordinates
+      typedef std::function<double(const double*)> functionN ;
+      /** batch N-dimensional function: 
+       *  <code>f(n,x,r)</code> calculates <code>n</code> values <code>r[i]</code> 
+       *  for points with coordinates <code>x[i*ndim+j]</code>
+       */
+      typedef std::function<void(std::size_t,const double*,double*)> functionV ;
+      // ======================================================================
+      /// the result of reentrant integration: (status, result, error)
+      typedef std::tuple<int,double,double>        Result    ;
+      typedef std::vector<Result>                  Results   ;
+      // ======================================================================
+      /** @struct Task 
+       *  the single 1D integration task for the batch integration
+       */
+      struct Task 
+      {
+        /// the function to be integrated
+        function1 func ;
+        /// low  integration edge 
+        double    xmin ;
+        /// high integration edge 
+        double    xmax ;
+      } ;
+      typedef std::vector<Task>                    Tasks     ;
       // ======================================================================
     public:
       // ======================================================================
@@ -110,6 +138,58 @@ namespace Ostap
         const double     xmax ,
         const WorkSpace& ws   ) const ;
       // ======================================================================
+      /** calculate the integral 
+       *  \f[ r = \int_{x_{min}}^{x_{max}}\int_{y_{min}}^{y_{max}}\int_{z_{min}}^{z_{max}}f_3(x,y,z) dx dy dz \f]
+       *  The function is evaluated in batches of points using vectorized cubature
+       *  @attention for <code>nthreads!=1</code> the function must be thread-safe!
+       *  @param f3 the function 
+       *  @param xmin lower integration edge in x 
+       *  @param xmax upper integration edge in x 
+       *  @param ymin lower integration edge in y 
+       *  @param ymax upper integration edge in y 
+       *  @param zmin lower integration edge in z 
+       *  @param zmax upper integration edge in z 
+       *  @param nthreads number of threads to evaluate the batch, 0 means "all available cores"
+       *  @return the value of the integral 
+       */
+      double integrate
+      ( function3            f3           , 
+        const double         xmin         , 
+        const double         xmax         ,
+        const double         ymin         , 
+        const double         ymax         ,
+        const double         zmin         , 
+        const double         zmax         , 
+        const unsigned short nthreads = 1 ) const ;
+      // =======================================================================
+      /** calculate the N-dimensional integral 
+       *  \f[ r = \int_{\vec{x}_{min}}^{\vec{x}_{max}} f_N(\vec{x}) d\vec{x} \f]
+       *  The function is evaluated in batches of points using vectorized cubature
+       *  @attention for <code>nthreads!=1</code> the function must be thread-safe!
+       *  @param fN the function 
+       *  @param xmin lower integration edges 
+       *  @param xmax upper integration edges 
+       *  @param nthreads number of threads to evaluate the batch, 0 means "all available cores"
+       *  @return the value of the integral 
+       */
+      double integrateND
+      ( functionN                  fN           , 
+        const std::vector<double>& xmin         , 
+        const std::vector<double>& xmax         , 
+        const unsigned short       nthreads = 1 ) const ;
+      // =======================================================================
+      /** calculate the N-dimensional integral for the batch-capable function
+       *  \f[ r = \int_{\vec{x}_{min}}^{\vec{x}_{max}} f_N(\vec{x}) d\vec{x} \f]
+       *  @param fV the batch function 
+       *  @param xmin lower integration edges 
+       *  @param xmax upper integration edges 
+       *  @return the value of the integral 
+       */
+      double integrateND
+      ( functionV                  fV   , 
+        const std::vector<double>& xmin , 
+        const std::vector<double>& xmax ) const ;
+      // ======================================================================
     public: // integration with cache 
       // ======================================================================      
       /** calculate the integral 
@@ -201,6 +281,104 @@ namespace Ostap
         const double      xmax ,
         const WorkSpace&  ws   ) const ;
       // ======================================================================
+      /** calculate the integral 
+       *  \f[ r = \int_{x_{min}}^{x_{max}}\int_{y_{min}}^{y_{max}}\int_{z_{min}}^{z_{max}}f_3(x,y,z) dx dy dz \f]
+       *  @attention for <code>nthreads!=1</code> the function must be thread-safe!
+       *  @param tag unique tag 
+       *  @param f3 the function 
+       *  @param xmin lower integration edge in x 
+       *  @param xmax upper integration edge in x 
+       *  @param ymin lower integration edge in y 
+       *  @param ymax upper integration edge in y 
+       *  @param zmin lower integration edge in z 
+       *  @param zmax upper integration edge in z 
+       *  @param nthreads number of threads to evaluate the batch, 0 means "all available cores"
+       *  @return the value of the integral 
+       */
+      double integrate_with_cache
+      ( const std::size_t    tag          , 
+        function3            f3           , 
+        const double         xmin         , 
+        const double         xmax         ,
+        const double         ymin         , 
+        const double         ymax         ,
+        const double         zmin         , 
+        const double         zmax         , 
+        const unsigned short nthreads = 1 ) const ;
+      // ======================================================================
+      /** calculate the N-dimensional integral 
+       *  \f[ r = \int_{\vec{x}_{min}}^{\vec{x}_{max}} f_N(\vec{x}) d\vec{x} \f]
+       *  @attention for <code>nthreads!=1</code> the function must be thread-safe!
+       *  @param tag unique tag 
+       *  @param fN the function 
+       *  @param xmin lower integration edges 
+       *  @param xmax upper integration edges 
+       *  @param nthreads number of threads to evaluate the batch, 0 means "all available cores"
+       *  @return the value of the integral 
+       */
+      double integrateND_with_cache
+      ( const std::size_t          tag          , 
+        functionN                  fN           , 
+        const std::vector<double>& xmin         , 
+        const std::vector<double>& xmax         , 
+        const unsigned short       nthreads = 1 ) const ;
+      // ======================================================================
+      /** calculate the N-dimensional integral for the batch-capable function
+       *  \f[ r = \int_{\vec{x}_{min}}^{\vec{x}_{max}} f_N(\vec{x}) d\vec{x} \f]
+       *  @param tag unique tag 
+       *  @param fV the batch function 
+       *  @param xmin lower integration edges 
+       *  @param xmax upper integration edges 
+       *  @return the value of the integral 
+       */
+      double integrateND_with_cache
+      ( const std::size_t          tag  , 
+        functionV                  fV   , 
+        const std::vector<double>& xmin , 
+        const std::vector<double>& xmax ) const ;
+      // ======================================================================
+    public: // reentrant GSL-free integration 
+      // ======================================================================
+      /** calculate the integral using reentrant adaptive Gauss-Kronrod 
+       *  (G10/K21) integration without GSL:
+       *  - no workspace is needed, the scratch area is thread-local
+       *  - no global error handler is installed 
+       *  - the status is reported via the return value 
+       *  (the codes are the same as GSL codes, 0 means success) 
+       *  \f[ r = \int_{x_{min}}^{x_{max}} f_1(x) dx \f]
+       *  @param f1 the function 
+       *  @param xmin lower integration edge 
+       *  @param xmax upper integration edge
+       *  @param aprecision absolute precision 
+       *  @param rprecision relative precision 
+       *  @param limit      maximal number of subintervals 
+       *  @return (status, result, error) 
+       */
+      Result gk_integrate
+      ( function1          f1                 , 
+        const double       xmin               , 
+        const double       xmax               , 
+        const double       aprecision = 1.e-8 , 
+        const double       rprecision = 1.e-8 , 
+        const unsigned int limit      = 1000  ) const ;
+      // ======================================================================
+      /** calculate the batch of independent integrals in parallel using 
+       *  reentrant adaptive Gauss-Kronrod integration
+       *  @attention the functions must be thread-safe 
+       *  @param tasks      the integration tasks 
+       *  @param nthreads   number of threads, 0 means "all available cores" 
+       *  @param aprecision absolute precision 
+       *  @param rprecision relative precision 
+       *  @param limit      maximal number of subintervals 
+       *  @return vector of (status, result, error) for each task 
+       */
+      Results gk_integrate
+      ( const Tasks&         tasks              , 
+        const unsigned short nthreads   = 0     , 
+        const double         aprecision = 1.e-8 , 
+        const double         rprecision = 1.e-8 , 
+        const unsigned int   limit      = 1000  ) const ;
+      // ======================================================================
     };
     // ========================================================================
   } //                                         The end of namespace Ostap::Math
@@ -0,0 +1,415 @@
+// ============================================================================
+#ifndef OSTAP_KINEMATICSBATCH_H
+#define OSTAP_KINEMATICSBATCH_H 1
+// ============================================================================
+/** @file Ostap/KinematicsBatch.h
+ *  "Columnar" (structure-of-arrays) versions of the basic kinematic
+ *  functions from Ostap/Kinematics.h:
+ *  the functions take contiguous columns of (px,py,pz,E) for the whole
+ *  block of candidates and write the results into the output array.
+ *  The loops have no branches and no function calls except <code>sqrt</code>,
+ *  therefore they are vectorized by the compiler.
+ *
+ *  The results are the same as for the corresponding scalar functions,
+ *  including the large negative number for invalid configurations.
+ *
+ *  @code
+ *  const std::vector<double>& px = ... ; // column px for the daughter
+ *  ...
+ *  std::vector<double> cos_theta ( px.size() ) ;
+ *  Ostap::Kinematics::Batch::decayAngle
+ *    ( px.size () ,
+ *      px.data () , py.data () , pz.data () , e.data () ,     // the daughter
+ *      Px.data () , Py.data () , Pz.data () , E.data () ,     // the mother
+ *      cos_theta.data () ) ;
+ *  @endcode
+ *
+ *  The templated versions accept and return the containers,
+ *  e.g. <code>std::vector<double></code> or <code>ROOT::VecOps::RVec<double></code>,
+ *  and can be used directly in <code>DataFrame::Define</code> for
+ *  the per-event arrays of candidates:
+ *  @code
+ *  frame.Define ( "cos_theta" ,
+ *    "Ostap::Kinematics::Batch::decayAngle(px,py,pz,e,Px,Py,Pz,E)" )
+ *  @endcode
+ *
+ *  For the block-wise calculation of new TTree branches
+ *  see <code>Ostap::Trees::add_branch</code> with <code>BlockFunction</code>
+ *
+ *  @attention the output array must not overlap with the input arrays
+ *
+ *  @see Ostap::Kinematics
+ *  @see Ostap::Trees::add_branch
+ *  @author agent agent@local
+ *  @date 2026-10-19
+ */
+// ============================================================================
+namespace Ostap
+{
+  // ==========================================================================
+  namespace Kinematics
+  {
+    // ========================================================================
+    namespace Batch
+    {
+      // ======================================================================
+      /** invariant mass squared for the block of 4-vectors
+       *  @param n      (INPUT)  number of candidates
+       *  @param px     (INPUT)  column of x-momenta
+       *  @param py     (INPUT)  column of y-momenta
+       *  @param pz     (INPUT)  column of z-momenta
+       *  @param e      (INPUT)  column of energies
+       *  @param result (OUTPUT) column of results
+       */
+      void mass2
+      ( const unsigned long n      ,
+        const double*       px     ,
+        const double*       py     ,
+        const double*       pz     ,
+        const double*       e      ,
+        double*             result ) ;
+      // ======================================================================
+      /** invariant mass for the block of 4-vectors:
+       *  the same convention as <code>ROOT::Math::LorentzVector::M</code>,
+       *  negative value for space-like vectors
+       *  @param n      (INPUT)  number of candidates
+       *  @param px     (INPUT)  column of x-momenta
+       *  @param py     (INPUT)  column of y-momenta
+       *  @param pz     (INPUT)  column of z-momenta
+       *  @param e      (INPUT)  column of energies
+       *  @param result (OUTPUT) column of results
+       */
+      void mass
+      ( const unsigned long n      ,
+        const double*       px     ,
+        const double*       py     ,
+        const double*       pz     ,
+        const double*       e      ,
+        double*             result ) ;
+      // ======================================================================
+      /** the ``triangle'' function, aka ``lambda'' or ``Kallen'' function
+       *  @see Ostap::Kinematics::kallen
+       *  @param n      (INPUT)  number of entries
+       *  @param a      (INPUT)  column of parameters a
+       *  @param b      (INPUT)  column of parameters b
+       *  @param c      (INPUT)  column of parameters c
+       *  @param result (OUTPUT) column of results
+       */
+      void kallen
+      ( const unsigned long n      ,
+        const double*       a      ,
+        const double*       b      ,
+        const double*       c      ,
+        double*             result ) ;
+      // ======================================================================
+      /** magnitude of 3-momentum of particle "v" in the rest system of "M"
+       *  @see Ostap::Kinematics::restMomentum
+       *  @param n      (INPUT)  number of candidates
+       *  @param vx,vy,vz,ve (INPUT) columns of 4-momenta for particle v
+       *  @param mx,my,mz,me (INPUT) columns of 4-momenta for particle M
+       *  @param result (OUTPUT) column of results
+       */
+      void restMomentum
+      ( const unsigned long n      ,
+        const double*       vx     ,
+        const double*       vy     ,
+        const double*       vz     ,
+        const double*       ve     ,
+        const double*       mx     ,
+        const double*       my     ,
+        const double*       mz     ,
+        const double*       me     ,
+        double*             result ) ;
+      // ======================================================================
+      /** energy of particle "v" in the rest system of "M"
+       *  @see Ostap::Kinematics::restEnergy
+       *  @param n      (INPUT)  number of candidates
+       *  @param vx,vy,vz,ve (INPUT) columns of 4-momenta for particle v
+       *  @param mx,my,mz,me (INPUT) columns of 4-momenta for particle M
+       *  @param result (OUTPUT) column of results
+       */
+      void restEnergy
+      ( const unsigned long n      ,
+        const double*       vx     ,
+        const double*       vy     ,
+        const double*       vz     ,
+        const double*       ve     ,
+        const double*       mx     ,
+        const double*       my     ,
+        const double*       mz     ,
+        const double*       me     ,
+        double*             result ) ;
+      // ======================================================================
+      /** transverse momentum with respect to a certain 3D-direction
+       *  @see Ostap::Kinematics::transverseMomentumDir
+       *  @param n      (INPUT)  number of candidates
+       *  @param px,py,pz (INPUT) columns of momenta
+       *  @param dx,dy,dz (INPUT) columns of directions
+       *  @param result (OUTPUT) column of results
+       */
+      void transverseMomentumDir
+      ( const unsigned long n      ,
+        const double*       px     ,
+        const double*       py     ,
+        const double*       pz     ,
+        const double*       dx     ,
+        const double*       dy     ,
+        const double*       dz     ,
+        double*             result ) ;
+      // ======================================================================
+      /** cosine of the decay angle of "D" in the rest frame of "Q"
+       *  with respect to the flight direction of "Q" in the rest frame of "P"
+       *  @see Ostap::Kinematics::decayAngle
+       *  @param n      (INPUT)  number of candidates
+       *  @param px,py,pz,pe (INPUT) columns of 4-momenta for "P"
+       *  @param qx,qy,qz,qe (INPUT) columns of 4-momenta for "Q"
+       *  @param dx,dy,dz,de (INPUT) columns of 4-momenta for "D"
+       *  @param result (OUTPUT) column of results
+       */
+      void decayAngle
+      ( const unsigned long n      ,
+        const double*       px     ,
+        const double*       py     ,
+        const double*       pz     ,
+        const double*       pe     ,
+        const double*       qx     ,
+        const double*       qy     ,
+        const double*       qz     ,
+        const double*       qe     ,
+        const double*       dx     ,
+        const double*       dy     ,
+        const double*       dz     ,
+        const double*       de     ,
+        double*             result ) ;
+      // ======================================================================
+      /** cosine of the decay angle of "D" in the rest frame of "M"
+       *  with respect to the boost direction from the laboratory frame
+       *  @see Ostap::Kinematics::decayAngle
+       *  @param n      (INPUT)  number of candidates
+       *  @param dx,dy,dz,de (INPUT) columns of 4-momenta for "D"
+       *  @param mx,my,mz,me (INPUT) columns of 4-momenta for "M"
+       *  @param result (OUTPUT) column of results
+       */
+      void decayAngle
+      ( const unsigned long n      ,
+        const double*       dx     ,
+        const double*       dy     ,
+        const double*       dz     ,
+        const double*       de     ,
+        const double*       mx     ,
+        const double*       my     ,
+        const double*       mz     ,
+        const double*       me     ,
+        double*             result ) ;
+      // ======================================================================
+      /** cosine of the angle between "v1" and "v2" in the rest frame of "M"
+       *  @see Ostap::Kinematics::cosThetaRest
+       *  @param n      (INPUT)  number of candidates
+       *  @param ax,ay,az,ae (INPUT) columns of 4-momenta for "v1"
+       *  @param bx,by,bz,be (INPUT) columns of 4-momenta for "v2"
+       *  @param mx,my,mz,me (INPUT) columns of 4-momenta for "M"
+       *  @param result (OUTPUT) column of results
+       */
+      void cosThetaRest
+      ( const unsigned long n      ,
+        const double*       ax     ,
+        const double*       ay     ,
+        const double*       az     ,
+        const double*       ae     ,
+        const double*       bx     ,
+        const double*       by     ,
+        const double*       bz     ,
+        const double*       be     ,
+        const double*       mx     ,
+        const double*       my     ,
+        const double*       mz     ,
+        const double*       me     ,
+        double*             result ) ;
+      // ======================================================================
+      /** Armenteros-Podolanski variable
+       *  \f$ \alpha = \frac{ \left|\vec{p}_1\right|^2 - \left|\vec{p}_2\right|^2}
+       *                    { \left|\vec{p}_1 + \vec{p}_2\right|^2 } \f$
+       *  @see Ostap::Kinematics::armenterosPodolanskiX
+       *  @param n      (INPUT)  number of candidates
+       *  @param ax,ay,az (INPUT) columns of momenta for the first  daughter
+       *  @param bx,by,bz (INPUT) columns of momenta for the second daughter
+       *  @param result (OUTPUT) column of results
+       */
+      void armenterosPodolanskiX
+      ( const unsigned long n      ,
+        const double*       ax     ,
+        const double*       ay     ,
+        const double*       az     ,
+        const double*       bx     ,
+        const double*       by     ,
+        const double*       bz     ,
+        double*             result ) ;
+      // ======================================================================
+      /** boost the block of 4-vectors into the rest frames of other 4-vectors
+       *  @see Ostap::Kinematics::boost
+       *  @param n      (INPUT)  number of candidates
+       *  @param vx,vy,vz,ve (INPUT)  columns of 4-momenta to be boosted
+       *  @param fx,fy,fz,fe (INPUT)  columns of 4-momenta for the frames
+       *  @param rx,ry,rz,re (OUTPUT) columns of the boosted 4-momenta
+       */
+      void boost
+      ( const unsigned long n      ,
+        const double*       vx     ,
+        const double*       vy     ,
+        const double*       vz     ,
+        const double*       ve     ,
+        const double*       fx     ,
+        const double*       fy     ,
+        const double*       fz     ,
+        const double*       fe     ,
+        double*             rx     ,
+        double*             ry     ,
+        double*             rz     ,
+        double*             re     ) ;
+      // ======================================================================
+      // The versions for containers, e.g. std::vector or ROOT::VecOps::RVec
+      // ======================================================================
+      /// invariant mass squared for the containers
+      template <class VECTOR>
+      inline VECTOR mass2
+      ( const VECTOR& px , const VECTOR& py , const VECTOR& pz , const VECTOR& e )
+      {
+        VECTOR result ( px.size () ) ;
+        mass2 ( px.size () , px.data () , py.data () , pz.data () , e.data () ,
+                result.data () ) ;
+        return result ;
+      }
+      // ======================================================================
+      /// invariant mass for the containers
+      template <class VECTOR>
+      inline VECTOR mass
+      ( const VECTOR& px , const VECTOR& py , const VECTOR& pz , const VECTOR& e )
+      {
+        VECTOR result ( px.size () ) ;
+        mass  ( px.size () , px.data () , py.data () , pz.data () , e.data () ,
+                result.data () ) ;
+        return result ;
+      }
+      // ======================================================================
+      /// ``triangle'' function for the containers
+      template <class VECTOR>
+      inline VECTOR kallen
+      ( const VECTOR& a , const VECTOR& b , const VECTOR& c )
+      {
+        VECTOR result ( a.size () ) ;
+        kallen ( a.size () , a.data () , b.data () , c.data () , result.data () ) ;
+        return result ;
+      }
+      // ======================================================================
+      /// momentum of "v" in the rest frame of "M" for the containers
+      template <class VECTOR>
+      inline VECTOR restMomentum
+      ( const VECTOR& vx , const VECTOR& vy , const VECTOR& vz , const VECTOR& ve ,
+        const VECTOR& mx , const VECTOR& my , const VECTOR& mz , const VECTOR& me )
+      {
+        VECTOR result ( vx.size () ) ;
+        restMomentum ( vx.size () ,
+                       vx.data () , vy.data () , vz.data () , ve.data () ,
+                       mx.data () , my.data () , mz.data () , me.data () ,
+                       result.data () ) ;
+        return result ;
+      }
+      // ======================================================================
+      /// energy of "v" in the rest frame of "M" for the containers
+      template <class VECTOR>
+      inline VECTOR restEnergy
+      ( const VECTOR& vx , const VECTOR& vy , const VECTOR& vz , const VECTOR& ve ,
+        const VECTOR& mx , const VECTOR& my , const VECTOR& mz , const VECTOR& me )
+      {
+        VECTOR result ( vx.size () ) ;
+        restEnergy   ( vx.size () ,
+                       vx.data () , vy.data () , vz.data () , ve.data () ,
+                       mx.data () , my.data () , mz.data () , me.data () ,
+                       result.data () ) ;
+        return result ;
+      }
+      // ======================================================================
+      /// transverse momentum with respect to the direction for the containers
+      template <class VECTOR>
+      inline VECTOR transverseMomentumDir
+      ( const VECTOR& px , const VECTOR& py , const VECTOR& pz ,
+        const VECTOR& dx , const VECTOR& dy , const VECTOR& dz )
+      {
+        VECTOR result ( px.size () ) ;
+        transverseMomentumDir ( px.size () ,
+                                px.data () , py.data () , pz.data () ,
+                                dx.data () , dy.data () , dz.data () ,
+                                result.data () ) ;
+        return result ;
+      }
+      // ======================================================================
+      /// decay angle (3-argument form) for the containers
+      template <class VECTOR>
+      inline VECTOR decayAngle
+      ( const VECTOR& px , const VECTOR& py , const VECTOR& pz , const VECTOR& pe ,
+        const VECTOR& qx , const VECTOR& qy , const VECTOR& qz , const VECTOR& qe ,
+        const VECTOR& dx , const VECTOR& dy , const VECTOR& dz , const VECTOR& de )
+      {
+        VECTOR result ( px.size () ) ;
+        decayAngle ( px.size () ,
+                     px.data () , py.data () , pz.data () , pe.data () ,
+                     qx.data () , qy.data () , qz.data () , qe.data () ,
+                     dx.data () , dy.data () , dz.data () , de.data () ,
+                     result.data () ) ;
+        return result ;
+      }
+      // ======================================================================
+      /// decay angle (2-argument form) for the containers
+      template <class VECTOR>
+      inline VECTOR decayAngle
+      ( const VECTOR& dx , const VECTOR& dy , const VECTOR& dz , const VECTOR& de ,
+        const VECTOR& mx , const VECTOR& my , const VECTOR& mz , const VECTOR& me )
+      {
+        VECTOR result ( dx.size () ) ;
+        decayAngle ( dx.size () ,
+                     dx.data () , dy.data () , dz.data () , de.data () ,
+                     mx.data () , my.data () , mz.data () , me.data () ,
+                     result.data () ) ;
+        return result ;
+      }
+      // ======================================================================
+      /// cosine of the angle between v1 and v2 in the rest frame of M for containers
+      template <class VECTOR>
+      inline VECTOR cosThetaRest
+      ( const VECTOR& ax , const VECTOR& ay , const VECTOR& az , const VECTOR& ae ,
+        const VECTOR& bx , const VECTOR& by , const VECTOR& bz , const VECTOR& be ,
+        const VECTOR& mx , const VECTOR& my , const VECTOR& mz , const VECTOR& me )
+      {
+        VECTOR result ( ax.size () ) ;
+        cosThetaRest ( ax.size () ,
+                       ax.data () , ay.data () , az.data () , ae.data () ,
+                       bx.data () , by.data () , bz.data () , be.data () ,
+                       mx.data () , my.data () , mz.data () , me.data () ,
+                       result.data () ) ;
+        return result ;
+      }
+      // ======================================================================
+      /// Armenteros-Podolanski variable for the containers
+      template <class VECTOR>
+      inline VECTOR armenterosPodolanskiX
+      ( const VECTOR& ax , const VECTOR& ay , const VECTOR& az ,
+        const VECTOR& bx , const VECTOR& by , const VECTOR& bz )
+      {
+        VECTOR result ( ax.size () ) ;
+        armenterosPodolanskiX ( ax.size () ,
+                                ax.data () , ay.data () , az.data () ,
+                                bx.data () , by.data () , bz.data () ,
+                                result.data () ) ;
+        return result ;
+      }
+      // ======================================================================
+    } //                            The end of namespace Ostap::Kinematics::Batch
+    // ========================================================================
+  } //                                   The end of namespace Ostap::Kinematics
+  // ==========================================================================
+} //                                                 The end of namespace Ostap
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_KINEMATICSBATCH_H
+// ============================================================================
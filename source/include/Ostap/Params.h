@@ -15,6 +15,8 @@ class TTree ; //  from ROOT
 // ============================================================================
 namespace Ostap
 {
+  // ==========================================================================
+  class DataSnapshot ;
   // ==========================================================================
   namespace Math 
   {
@@ -259,6 +261,94 @@ namespace Ostap
       const unsigned long        first       =  0 ,
       const unsigned long        last        = std::numeric_limits<unsigned long>::max() ) ;
     // ========================================================================
+  public: // fill from the columnar snapshot of the dataset 
+    // ========================================================================
+    /** fill Legendre sum with data from the columnar snapshot
+     *  @see Ostap::DataSnapshot 
+     *  @see Ostap::Math::LegendreSum::fill
+     *  @param data       (INPUT)  the snapshot 
+     *  @param sum        (UPDATE) the parameterization object 
+     *  @param expression (INPUT)  expression to be parameterized
+     *  @param selection  (INPUT)  selection/weight to be used 
+     *  @return  sum of weigths  used in parameterization
+     *  @code
+     *  const RooAbsData& data = ... ;
+     *  DataSnapshot snap ( data ) ;
+     *  LegendreSum s ( 5 , -1 , 1 ) ;
+     *  DataParam::parameterize ( snap , s , "x"  , "y>10" ) ;
+     *  @endcode
+     *  @author agent agent@local
+     *  @date   2026-10-19
+     */ 
+    static double parameterize 
+    ( Ostap::DataSnapshot&      data            , 
+      Ostap::Math::LegendreSum& sum             , 
+      const std::string&        expression      , 
+      const std::string&        selection  = "" ) ;
+    // ========================================================================
+    /** fill Legendre sum with data from the columnar snapshot
+     *  @see Ostap::DataSnapshot 
+     *  @see Ostap::Math::LegendreSum2::fill
+     *  @param data        (INPUT)  the snapshot 
+     *  @param sum         (UPDATE) the parameterization object 
+     *  @param xexpression (INPUT)  x-expression to be parameterized
+     *  @param yexpression (INPUT)  y-expression to be parameterized
+     *  @param selection   (INPUT)  selection/weight to be used 
+     *  @return  sum of weigths  used in parameterization
+     *  @author agent agent@local
+     *  @date   2026-10-19
+     */ 
+    static double parameterize 
+    ( Ostap::DataSnapshot&       data             , 
+      Ostap::Math::LegendreSum2& sum              , 
+      const std::string&         xexpression      , 
+      const std::string&         yexpression      , 
+      const std::string&         selection   = "" ) ;
+    // ========================================================================
+    /** fill Legendre sum with data from the columnar snapshot
+     *  @see Ostap::DataSnapshot 
+     *  @see Ostap::Math::LegendreSum3::fill
+     *  @param data        (INPUT)  the snapshot 
+     *  @param sum         (UPDATE) the parameterization object 
+     *  @param xexpression (INPUT)  x-expression to be parameterized
+     *  @param yexpression (INPUT)  y-expression to be parameterized
+     *  @param zexpression (INPUT)  z-expression to be parameterized
+     *  @param selection   (INPUT)  selection/weight to be used 
+     *  @return  sum of weigths  used in parameterization
+     *  @author agent agent@local
+     *  @date   2026-10-19
+     */ 
+    static double parameterize 
+    ( Ostap::DataSnapshot&       data             , 
+      Ostap::Math::LegendreSum3& sum              , 
+      const std::string&         xexpression      , 
+      const std::string&         yexpression      , 
+      const std::string&         zexpression      , 
+      const std::string&         selection   = "" ) ;
+    // ========================================================================
+    /** fill Legendre sum with data from the columnar snapshot
+     *  @see Ostap::DataSnapshot 
+     *  @see Ostap::Math::LegendreSum4::fill
+     *  @param data        (INPUT)  the snapshot 
+     *  @param sum         (UPDATE) the parameterization object 
+     *  @param xexpression (INPUT)  x-expression to be parameterized
+     *  @param yexpression (INPUT)  y-expression to be parameterized
+     *  @param zexpression (INPUT)  z-expression to be parameterized
+     *  @param uexpression (INPUT)  u-expression to be parameterized
+     *  @param selection   (INPUT)  selection/weight to be used 
+     *  @return  sum of weigths  used in parameterization
+     *  @author agent agent@local
+     *  @date   2026-10-19
+     */ 
+    static double parameterize 
+    ( Ostap::DataSnapshot&       data             , 
+      Ostap::Math::LegendreSum4& sum              , 
+      const std::string&         xexpression      , 
+      const std::string&         yexpression      , 
+      const std::string&         zexpression      , 
+      const std::string&         uexpression      , 
+      const std::string&         selection   = "" ) ;
+    // ========================================================================
   } ; //                                      The end of class Ostap::DataParam 
   // ==========================================================================
 } //                                                 The end of namespace Ostap
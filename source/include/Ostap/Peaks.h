@@ -87,6 +87,23 @@ namespace Ostap
       /// right sigma 
       bool setSigmaR  ( const double value ) ;
       // ======================================================================
+    public: // parameters & derivatives
+      // ======================================================================
+      /// number of parameters: (peak, sigmaL, sigmaR)
+      static constexpr unsigned short npars () { return 3 ; }
+      /// get the parameter by index
+      double par    ( const unsigned short i ) const ;
+      /// set the parameter by index
+      bool   setPar ( const unsigned short i , const double value ) ;
+      /** evaluate the function and its derivatives with respect to parameters
+       *  @param x    the point
+       *  @param grad (OUTPUT) the derivatives
+       *         \f$ \frac{\partial f}{\partial p_i}\f$,
+       *         <code>grad</code> must have at least <code>npars()</code> elements
+       *  @return the function value
+       */
+      double gradient ( const double x , double* grad ) const ;
+      // ======================================================================
     public: // integrals & CDF
       // ======================================================================
       /// get the integral
@@ -617,6 +634,23 @@ namespace Ostap
       bool setRho_L ( const double value ) { return setRhoL ( value ) ; }
       bool setRho_R ( const double value ) { return setRhoR ( value ) ; }
       // ======================================================================
+    public: // parameters & derivatives
+      // ======================================================================
+      /// number of parameters: (peak, sigma, xi, rhoL, rhoR)
+      static constexpr unsigned short npars () { return 5 ; }
+      /// get the parameter by index
+      double par    ( const unsigned short i ) const ;
+      /// set the parameter by index
+      bool   setPar ( const unsigned short i , const double value ) ;
+      /** evaluate the function and its derivatives with respect to parameters
+       *  @param x    the point
+       *  @param grad (OUTPUT) the derivatives
+       *         \f$ \frac{\partial f}{\partial p_i}\f$,
+       *         <code>grad</code> must have at least <code>npars()</code> elements
+       *  @return the function value
+       */
+      double gradient ( const double x , double* grad ) const ;
+      // ======================================================================
     public:
       // ======================================================================
       /// get the integral
@@ -818,6 +852,23 @@ namespace Ostap
       bool setAlpha ( const double value ) ;
       bool setN     ( const double value ) ;
       // ======================================================================
+    public: // parameters & derivatives
+      // ======================================================================
+      /// number of parameters: (m0, sigma, alpha, n)
+      static constexpr unsigned short npars () { return 4 ; }
+      /// get the parameter by index
+      double par    ( const unsigned short i ) const ;
+      /// set the parameter by index
+      bool   setPar ( const unsigned short i , const double value ) ;
+      /** evaluate the function and its derivatives with respect to parameters
+       *  @param x    the point
+       *  @param grad (OUTPUT) the derivatives
+       *         \f$ \frac{\partial f}{\partial p_i}\f$,
+       *         <code>grad</code> must have at least <code>npars()</code> elements
+       *  @return the function value
+       */
+      double gradient ( const double x , double* grad ) const ;
+      // ======================================================================
     public:
       // ======================================================================
       /// get (possibly truncated, if n==0 or alpha=0) integral
@@ -1183,6 +1234,23 @@ namespace Ostap
       bool setN     ( const double value ) ;
       bool setB     ( const double value ) ;
       // ======================================================================
+    public: // parameters & derivatives
+      // ======================================================================
+      /// number of parameters: (m0, sigma, alpha, n, b)
+      static constexpr unsigned short npars () { return 5 ; }
+      /// get the parameter by index
+      double par    ( const unsigned short i ) const ;
+      /// set the parameter by index
+      bool   setPar ( const unsigned short i , const double value ) ;
+      /** evaluate the function and its derivatives with respect to parameters
+       *  @param x    the point
+       *  @param grad (OUTPUT) the derivatives
+       *         \f$ \frac{\partial f}{\partial p_i}\f$,
+       *         <code>grad</code> must have at least <code>npars()</code> elements
+       *  @return the function value
+       */
+      double gradient ( const double x , double* grad ) const ;
+      // ======================================================================
     public:
       // ======================================================================
       /// get the integral between low and high
@@ -1286,6 +1354,23 @@ namespace Ostap
       bool setSigmaR ( const double value ) ;
       bool setBeta   ( const double value ) ;
       // ======================================================================
+    public: // parameters & derivatives
+      // ======================================================================
+      /// number of parameters: (m0, sigmaL, sigmaR, beta)
+      static constexpr unsigned short npars () { return 4 ; }
+      /// get the parameter by index
+      double par    ( const unsigned short i ) const ;
+      /// set the parameter by index
+      bool   setPar ( const unsigned short i , const double value ) ;
+      /** evaluate the function and its derivatives with respect to parameters
+       *  @param x    the point
+       *  @param grad (OUTPUT) the derivatives
+       *         \f$ \frac{\partial f}{\partial p_i}\f$,
+       *         <code>grad</code> must have at least <code>npars()</code> elements
+       *  @return the function value
+       */
+      double gradient ( const double x , double* grad ) const ;
+      // ======================================================================
     public:
       // ======================================================================
       /// get the integral between low and high
@@ -1382,6 +1467,23 @@ namespace Ostap
       double pdf    ( const double x ) const ;
       double cdf    ( const double x ) const ;
       // ======================================================================
+    public: // parameters & derivatives
+      // ======================================================================
+      /// number of parameters: (M, sigma, N), where \f$ \nu = 1 + \left|N\right| \f$
+      static constexpr unsigned short npars () { return 3 ; }
+      /// get the parameter by index
+      double par    ( const unsigned short i ) const ;
+      /// set the parameter by index
+      bool   setPar ( const unsigned short i , const double value ) ;
+      /** evaluate the function and its derivatives with respect to parameters
+       *  @param x    the point
+       *  @param grad (OUTPUT) the derivatives
+       *         \f$ \frac{\partial f}{\partial p_i}\f$,
+       *         <code>grad</code> must have at least <code>npars()</code> elements
+       *  @return the function value
+       */
+      double gradient ( const double x , double* grad ) const ;
+      // ======================================================================
     public:
       // ======================================================================
       /// get the integral
@@ -0,0 +1,102 @@
+// ============================================================================
+#ifndef OSTAP_RANDOMSTREAM_H
+#define OSTAP_RANDOMSTREAM_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <cstdint>
+// ============================================================================
+namespace Ostap
+{
+  // ==========================================================================
+  namespace Utils
+  {
+    // ========================================================================
+    /** @class RandomStream Ostap/RandomStream.h
+     *  Simple counter-based random number generator:
+     *  the n-th random number of the stream is a pure function of
+     *  the stream key and the counter <code>n</code>,
+     *  \f$ r_n = \mathrm{mix} ( k + n \gamma ) \f$, where
+     *  \f$ \mathrm{mix}\f$ is the SplitMix64 finalizer and
+     *  \f$ \gamma\f$ is the golden-ratio increment.
+     *
+     *  There is no internal state to be updated, therefore
+     *  - any range of the counters can be processed in any thread in any order,
+     *    and the results do not depend on the number of threads;
+     *  - the stream can be split into the independent sub-streams.
+     *
+     *  @code
+     *  const Ostap::Utils::RandomStream rng ( 12345 ) ;
+     *  const double u0 = rng.uniform ( 0 ) ;
+     *  const double u1 = rng.uniform ( 1 ) ;
+     *  const Ostap::Utils::RandomStream sub = rng.split ( 3 ) ;
+     *  @endcode
+     *  @author agent agent@local
+     *  @date   2026-10-19
+     */
+    class RandomStream
+    {
+    public:
+      // ======================================================================
+      /** constructor from the seed and the stream number
+       *  @param seed   the seed
+       *  @param stream the stream number
+       */
+      explicit RandomStream
+      ( const std::uint64_t seed   = 0 ,
+        const std::uint64_t stream = 0 )
+        : m_key ( mix ( mix ( seed ) ^ mix ( stream + s_GAMMA ) ) )
+      {}
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// the n-th 64-bit random number from the stream
+      std::uint64_t raw     ( const std::uint64_t n ) const
+      { return mix ( m_key + ( n + 1 ) * s_GAMMA ) ; }
+      /// the n-th uniform random number from the stream in \f$ [0,1) \f$
+      double        uniform ( const std::uint64_t n ) const
+      { return ( raw ( n ) >> 11 ) * ( 1.0 / 9007199254740992.0 ) ; }
+      /// the n-th uniform random number from the stream in \f$ [a,b) \f$
+      double        uniform ( const std::uint64_t n ,
+                              const double        a ,
+                              const double        b ) const
+      { return a + ( b - a ) * uniform ( n ) ; }
+      // ======================================================================
+      /// get the independent sub-stream
+      RandomStream  split   ( const std::uint64_t stream ) const
+      { return RandomStream ( m_key , stream ) ; }
+      /// the key of the stream
+      std::uint64_t key     () const { return m_key ; }
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// SplitMix64 finalizer
+      static std::uint64_t mix ( std::uint64_t z )
+      {
+        z = ( z ^ ( z >> 30 ) ) * 0xBF58476D1CE4E5B9ULL ;
+        z = ( z ^ ( z >> 27 ) ) * 0x94D049BB133111EBULL ;
+        return z ^ ( z >> 31 ) ;
+      }
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// the golden-ratio increment
+      static constexpr std::uint64_t s_GAMMA = 0x9E3779B97F4A7C15ULL ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// the key of the stream
+      std::uint64_t m_key ; // the key of the stream
+      // ======================================================================
+    } ;
+    // ========================================================================
+  } //                                        The end of namespace Ostap::Utils
+  // ==========================================================================
+} //                                                 The end of namespace Ostap
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_RANDOMSTREAM_H
+// ============================================================================
@@ -4,6 +4,11 @@
 // =============================================================================
 // Include files
 // =============================================================================
+// STD&STL
+// =============================================================================
+#include <string>
+#include <vector>
+// =============================================================================
 // Forward declarations 
 // =============================================================================
 class TTree      ; // ROOT 
@@ -73,6 +78,24 @@ namespace Ostap
     static Ostap::Math::ValueWithError
     sFactor ( TTree* tree ,  const std::string& varname = "S_sw" ) ;
     // ========================================================================
+    /** Get sum and sum of squares for several simple branches in Tree
+     *  in one pass. For the primitive scalar branches only 
+     *  these branches are read, and the sums are accumulated block-by-block
+     *
+     *  @code 
+     *  tree = ...
+     *  sfs  = Ostap.SFactor.sFactor ( tree , [ 'S_sw' , 'B_sw' ] )
+     *  @endcode 
+     *
+     *  @param  tree     (INPUT) the tree 
+     *  @param  varnames (INPUT) names for the simple variables 
+     *  @return s-factors in a form of value +- sqrt(cov2)  
+     *  @author agent agent@local
+     *  @date 2026-10-19
+     */
+    static std::vector<Ostap::Math::ValueWithError>
+    sFactor ( TTree* tree ,  const std::vector<std::string>& varnames ) ;
+    // ========================================================================
     /** Get sum and sum of squares for the weights in sataset, e.g. 
      *  s-factor from usage of s_weight 
      *  The direct summation in python is rather slow, thus C++ routine helps
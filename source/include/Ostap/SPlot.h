@@ -0,0 +1,175 @@
+// ============================================================================
+#ifndef OSTAP_SPLOT_H
+#define OSTAP_SPLOT_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <string>
+#include <vector>
+// ============================================================================
+// ROOT
+// ============================================================================
+#include "TMatrixDSym.h"
+// ============================================================================
+// RooFit
+// ============================================================================
+#include "RooArgList.h"
+#include "RooArgSet.h"
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/StatusCode.h"
+#include "Ostap/ValueWithError.h"
+// ============================================================================
+// Forward declarations
+// ============================================================================
+class TTree      ; // ROOT
+class RooDataSet ; // RooFit
+// ============================================================================
+namespace Ostap
+{
+  // ==========================================================================
+  /** @class SPlot Ostap/SPlot.h
+   *  Native engine for sWeights.
+   *
+   *  For the extended model \f$ \sum_k N_k f_k(x) \f$ with fixed shapes
+   *  it calculates in one pass over the data:
+   *   - the inverse covariance matrix of yields
+   *     \f$ V^{-1}_{ij} = \sum_e \frac{f_i(x_e)f_j(x_e)}{\left(\sum_k N_kf_k(x_e)\right)^2}\f$
+   *   - the per-event sWeights
+   *     \f$ w_n(x_e) = \frac{\sum_j V_{nj}f_j(x_e)}{\sum_k N_kf_k(x_e)}\f$
+   *   - the sFactor statistics for each component:
+   *     \f$ \sum_e w_n(x_e)\f$ and \f$ \sum_e w_n^2(x_e)\f$
+   *     (the same as from Ostap::SFactor::sFactor for the new branch/variable)
+   *  and adds the sWeights as new branches/variables <code>yield_name+suffix</code>
+   *
+   *  The component PDFs are evaluated in <code>nthreads</code> threads:
+   *  each thread uses its own deep copy of the model.
+   *  @attention RooFit is not thread-safe, the multithreaded evaluation
+   *             is valid only for "simple" component PDFs
+   *             without the lazy caches/numerical integrals. The default is 1 thread.
+   *
+   *  @code
+   *  Ostap::SPlot splot ( pdfs , yields , observables ) ;
+   *  splot.addWeights ( tree , "_sw" , 4 ) ;
+   *  const auto& sf = splot.sFactors () ;
+   *  @endcode
+   *
+   *  @see RooStats::SPlot
+   *  @see Ostap::SFactor
+   *  @see M.Pivk, F.R. Le Deberder,
+   *      "SPlot: A Statistical tool to unfold data distributions"
+   *       Published in Nucl.Instrum.Meth. A555 (2005) 356
+   *  @see http://arxiv.org/abs/physics/0402083
+   *  @author agent agent@local
+   *  @date 2026-10-19
+   */
+  class SPlot
+  {
+  public:
+    // ========================================================================
+    /// error codes
+    enum {
+      InvalidModel       = 801 ,
+      InvalidTree              ,
+      InvalidDataSet           ,
+      InvalidObservable        ,
+      InvalidCovariance        ,
+    } ;
+    // ========================================================================
+  public:
+    // ========================================================================
+    /** constructor from the model
+     *  @param pdfs        (INPUT) the component PDFs
+     *  @param yields      (INPUT) the fitted yields
+     *  @param observables (INPUT) the observables
+     */
+    SPlot ( const RooArgList& pdfs        ,
+            const RooArgList& yields      ,
+            const RooArgSet&  observables ) ;
+    // ========================================================================
+  public:
+    // ========================================================================
+    /** calculate sWeights for the tree and add them as new branches
+     *  <code>yield_name+suffix</code>
+     *  @param tree     (UPDATE) the tree
+     *  @param suffix   (INPUT)  the suffix for the new branches
+     *  @param nthreads (INPUT)  number of threads for evaluation of PDFs
+     *  @return status code
+     */
+    Ostap::StatusCode addWeights
+    ( TTree*               tree              ,
+      const std::string&   suffix   = "_sw"  ,
+      const unsigned short nthreads = 1      ) ;
+    // ========================================================================
+    /** calculate sWeights for the dataset and add them as new variables
+     *  <code>yield_name+suffix</code>
+     *  @param data     (UPDATE) the dataset
+     *  @param suffix   (INPUT)  the suffix for the new variables
+     *  @param nthreads (INPUT)  number of threads for evaluation of PDFs
+     *  @return status code
+     */
+    Ostap::StatusCode addWeights
+    ( RooDataSet&          data              ,
+      const std::string&   suffix   = "_sw"  ,
+      const unsigned short nthreads = 1      ) ;
+    // ========================================================================
+  public:
+    // ========================================================================
+    /// the covariance matrix of yields from the last calculation
+    const TMatrixDSym& covariance () const { return m_covariance ; }
+    /** sFactor statistics from the last calculation:
+     *  value is the sum of sWeights, cov2 is the sum of squared sWeights
+     *  @see Ostap::SFactor::sFactor
+     */
+    const std::vector<Ostap::Math::ValueWithError>&
+    sFactors () const { return m_sfactors ; }
+    /// the names of components (yields)
+    const std::vector<std::string>& names () const { return m_names ; }
+    /// number of processed entries in the last calculation
+    unsigned long nEntries () const { return m_entries ; }
+    // ========================================================================
+  public:
+    // ========================================================================
+    /** calculate the sWeights from the observables columns
+     *  @param x        (INPUT)  observables, <code>x[entry*nobs+i]</code>
+     *  @param weights  (INPUT)  event weights, empty for non-weighted data
+     *  @param sweights (OUTPUT) sWeights, <code>sweights[entry*ncmp+k]</code>
+     *  @param nthreads (INPUT)  number of threads for evaluation of PDFs
+     *  @return status code
+     */
+    Ostap::StatusCode calculate
+    ( const std::vector<double>& x                 ,
+      const std::vector<double>& weights           ,
+      std::vector<double>&       sweights          ,
+      const unsigned short       nthreads     = 1  ) ;
+    // ========================================================================
+  private:
+    // ========================================================================
+    /// component PDFs
+    RooArgList                               m_pdfs        {} ;
+    /// observables
+    RooArgSet                                m_observables {} ;
+    /// the names of yields
+    std::vector<std::string>                 m_names       {} ;
+    /// the names of observables
+    std::vector<std::string>                 m_obsnames    {} ;
+    /// the values of yields
+    std::vector<double>                      m_yields      {} ;
+    /// the covariance matrix of yields
+    TMatrixDSym                              m_covariance  {} ;
+    /// sFactors
+    std::vector<Ostap::Math::ValueWithError> m_sfactors    {} ;
+    /// number of processed entries
+    unsigned long                            m_entries     { 0 } ;
+    // ========================================================================
+  } ;
+  // ==========================================================================
+} //                                                     end of namespace Ostap
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_SPLOT_H
+// ============================================================================
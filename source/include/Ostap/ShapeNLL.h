@@ -0,0 +1,285 @@
+// ============================================================================
+#ifndef OSTAP_SHAPENLL_H
+#define OSTAP_SHAPENLL_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <algorithm>
+// ============================================================================
+// ROOT
+// ============================================================================
+#include "Math/IFunction.h"
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/StatusCode.h"
+#include "Ostap/Integrator.h"
+#include "Ostap/Workspace.h"
+// ============================================================================
+namespace Ostap
+{
+  // ==========================================================================
+  namespace Math
+  {
+    // ========================================================================
+    class BifurcatedGauss ;
+    class CrystalBall     ;
+    class StudentT        ;
+    // ========================================================================
+    /** @struct ShapeNLLTraits Ostap/ShapeNLL.h
+     *  Does the shape have the analytic integral?
+     *  If not, the derivatives of the normalization integral are
+     *  calculated as the integrals of the analytic derivatives
+     *  @see Ostap::Math::ShapeNLL
+     */
+    template <class SHAPE>
+    struct ShapeNLLTraits
+    { static constexpr bool analytic_integral = false ; } ;
+    // ========================================================================
+    template <>
+    struct ShapeNLLTraits<BifurcatedGauss>
+    { static constexpr bool analytic_integral = true  ; } ;
+    // ========================================================================
+    template <>
+    struct ShapeNLLTraits<CrystalBall>
+    { static constexpr bool analytic_integral = true  ; } ;
+    // ========================================================================
+    template <>
+    struct ShapeNLLTraits<StudentT>
+    { static constexpr bool analytic_integral = true  ; } ;
+    // ========================================================================
+    /** @class ShapeNLL Ostap/ShapeNLL.h
+     *  Unbinned (weighted) negative log-likelihood for the 1D shape
+     *  with the analytic gradient with respect to the shape parameters
+     *  \f[ -\log L = -\sum_i w_i \log \frac{ f(x_i;\vec{p}) }{ \int_{x_{low}}^{x_{high}} f(x;\vec{p}) dx } \f]
+     *
+     *  The function implements <code>ROOT::Math::IMultiGradFunction</code>,
+     *  therefore it can be directly minimized with gradient-based minimizers,
+     *  e.g. Minuit2, avoiding the numerical differentiation of the likelihood.
+     *
+     *  The shape must provide:
+     *  - <code>static unsigned short npars()</code>
+     *  - <code>bool setPar ( unsigned short i , double value )</code>
+     *  - <code>double gradient ( double x , double* grad ) const</code>
+     *  - <code>double par ( unsigned short i ) const</code>
+     *  - <code>double integral ( double low , double high ) const</code>
+     *
+     *  The per-event derivatives are analytic. The derivatives of the
+     *  normalization integral are obtained
+     *  - for shapes with the analytic integral
+     *    (see Ostap::Math::ShapeNLLTraits) by the symmetric differences
+     *    of the integral, that is cheap and independent on the data size;
+     *  - otherwise as the integrals of the analytic derivatives,
+     *    \f$ \frac{\partial I}{\partial p_k} = \int \frac{\partial f}{\partial p_k} dx \f$,
+     *    avoiding the differences of the numerical integrals.
+     *
+     *  Many shapes use the absolute values of the parameters,
+     *  e.g. <code>sigma</code> or <code>n</code>; for the negative
+     *  values of such parameters the gradient gets the proper sign,
+     *  \f$ \frac{\partial |p|}{\partial p} = \mathrm{sign} p \f$.
+     *
+     *  @code
+     *  Ostap::Math::CrystalBall cb ( 3.1 , 0.01 , 2 , 5 ) ;
+     *  std::vector<double> data = ... ;
+     *  Ostap::Math::ShapeNLL<Ostap::Math::CrystalBall> nll ( cb , data , 3.0 , 3.2 ) ;
+     *  std::unique_ptr<ROOT::Math::Minimizer> m
+     *     { ROOT::Math::Factory::CreateMinimizer ( "Minuit2" , "Migrad" ) } ;
+     *  m -> SetFunction ( nll ) ;
+     *  ...
+     *  @endcode
+     *
+     *  @see Ostap::Math::BifurcatedGauss
+     *  @see Ostap::Math::CrystalBall
+     *  @see Ostap::Math::StudentT
+     *  @author agent agent@local
+     *  @date   2026-10-19
+     */
+    template <class SHAPE>
+    class ShapeNLL : public ROOT::Math::IMultiGradFunction
+    {
+    public:
+      // ======================================================================
+      /** constructor from the shape, data and the range
+       *  @param shape   the shape
+       *  @param data    the data
+       *  @param low     the low  edge of the fit range
+       *  @param high    the high edge of the fit range
+       *  @param weights the weights (empty for non-weighted data)
+       *  @attention data outside the fit range are ignored
+       */
+      ShapeNLL
+      ( const SHAPE&               shape        ,
+        const std::vector<double>& data         ,
+        const double               low          ,
+        const double               high         ,
+        const std::vector<double>& weights = {} )
+        : ROOT::Math::IMultiGradFunction ()
+        , m_shape ( shape )
+        , m_low   ( std::min ( low , high ) )
+        , m_high  ( std::max ( low , high ) )
+      {
+        //
+        const bool weighted = !weights.empty() ;
+        if ( weighted && weights.size() != data.size() )
+        { Ostap::throwException ( "Mismatch of data and weights" ,
+                                  "Ostap::Math::ShapeNLL"        ) ; }
+        //
+        m_data   .reserve ( data.size() ) ;
+        m_weights.reserve ( data.size() ) ;
+        for ( std::size_t i = 0 ; i < data.size() ; ++i )
+        {
+          const double x = data [ i ] ;
+          if ( x < m_low || m_high < x ) { continue ; }
+          const double w = weighted ? weights [ i ] : 1.0 ;
+          m_data   .push_back ( x ) ;
+          m_weights.push_back ( w ) ;
+          m_sumw += w ;
+        }
+      }
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// number of parameters
+      unsigned int NDim  () const override { return SHAPE::npars () ; }
+      /// clone
+      ShapeNLL*    Clone () const override { return new ShapeNLL ( *this ) ; }
+      // ======================================================================
+      /// the full gradient
+      void Gradient ( const double* p , double* g ) const override
+      { double f = 0 ; FdF ( p , f , g ) ; }
+      // ======================================================================
+      /// the function value and the gradient at once
+      void FdF ( const double* p , double& f , double* g ) const override
+      {
+        const unsigned short N = SHAPE::npars () ;
+        setPars ( p ) ;
+        //
+        double grad [ N ] ;
+        std::fill ( g , g + N , 0.0 ) ;
+        //
+        long double nll = 0 ;
+        for ( std::size_t i = 0 ; i < m_data.size() ; ++i )
+        {
+          const double v = std::max ( m_shape.gradient ( m_data [ i ] , grad ) , tiny () ) ;
+          const double w = m_weights [ i ] ;
+          nll -= w * std::log ( v ) ;
+          for ( unsigned short k = 0 ; k < N ; ++k ) { g [ k ] -= w * grad [ k ] / v ; }
+        }
+        //
+        const double norm = std::max ( m_shape.integral ( m_low , m_high ) , tiny () ) ;
+        f = nll + m_sumw * std::log ( norm ) ;
+        //
+        // the derivatives of the normalization integral
+        for ( unsigned short k = 0 ; k < N ; ++k )
+        { g [ k ] += m_sumw * dintegral ( k ) / norm ; }
+        //
+        // the shape uses |p[k]|: d|p|/dp = sign(p)
+        for ( unsigned short k = 0 ; k < N ; ++k )
+        { if ( p [ k ] < 0 && 0 <= m_shape.par ( k ) ) { g [ k ] = -g [ k ] ; } }
+      }
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// the shape
+      const SHAPE&               shape   () const { return m_shape   ; }
+      /// the data (in the fit range)
+      const std::vector<double>& data    () const { return m_data    ; }
+      /// the weights (in the fit range)
+      const std::vector<double>& weights () const { return m_weights ; }
+      /// sum of weights
+      double                     sumw    () const { return m_sumw    ; }
+      /// low edge of the fit range
+      double                     low     () const { return m_low     ; }
+      /// high edge of the fit range
+      double                     high    () const { return m_high    ; }
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// evaluate NLL
+      double DoEval ( const double* p ) const override
+      {
+        setPars ( p ) ;
+        long double nll = 0 ;
+        for ( std::size_t i = 0 ; i < m_data.size() ; ++i )
+        { nll -= m_weights [ i ] * std::log ( std::max ( m_shape ( m_data [ i ] ) , tiny () ) ) ; }
+        const double norm = std::max ( m_shape.integral ( m_low , m_high ) , tiny () ) ;
+        return nll + m_sumw * std::log ( norm ) ;
+      }
+      // ======================================================================
+      /// the partial derivative
+      double DoDerivative ( const double* p , unsigned int k ) const override
+      {
+        double g [ SHAPE::npars () ] ;
+        Gradient ( p , g ) ;
+        return g [ k ] ;
+      }
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// protection against log(0)
+      static double tiny () { return std::numeric_limits<double>::min () ; }
+      /// set the shape parameters
+      void setPars ( const double* p ) const
+      { for ( unsigned short k = 0 ; k < SHAPE::npars () ; ++k ) { m_shape.setPar ( k , p [ k ] ) ; } }
+      // ======================================================================
+      /** the derivative of the normalization integral with respect to
+       *  the k-th (actual) parameter of the shape
+       *  - for the analytic integral: the symmetric difference
+       *  - otherwise: the integral of the analytic derivative
+       */
+      double dintegral ( const unsigned short k ) const
+      {
+        if ( ShapeNLLTraits<SHAPE>::analytic_integral )
+        {
+          const double q = m_shape.par ( k ) ;
+          const double h = 1.e-5 * std::max ( 1.0 , std::abs ( q ) ) ;
+          m_shape.setPar ( k , q + h ) ;
+          const double ip = m_shape.integral ( m_low , m_high ) ;
+          m_shape.setPar ( k , q - h ) ;
+          const double im = m_shape.integral ( m_low , m_high ) ;
+          m_shape.setPar ( k , q     ) ;
+          return ( ip - im ) / ( 2 * h ) ;
+        }
+        //
+        const SHAPE& shape = m_shape ;
+        auto fun = [&shape,k] ( const double x ) -> double
+        {
+          double grad [ SHAPE::npars () ] ;
+          shape.gradient ( x , grad ) ;
+          return grad [ k ] ;
+        } ;
+        return Ostap::Math::Integrator().integrate ( fun , m_low , m_high , m_workspace ) ;
+      }
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// the shape
+      mutable SHAPE       m_shape   ;           // the shape
+      /// low edge
+      double              m_low     ;           // low edge
+      /// high edge
+      double              m_high    ;           // high edge
+      /// the data
+      std::vector<double> m_data    {} ;        // the data
+      /// the weights
+      std::vector<double> m_weights {} ;        // the weights
+      /// sum of weights
+      double              m_sumw    { 0 } ;     // sum of weights
+      /// integration workspace
+      Ostap::Math::WorkSpace m_workspace {} ;   // integration workspace
+      // ======================================================================
+    } ;
+    // ========================================================================
+  } //                                         The end of namespace Ostap::Math
+  // ==========================================================================
+} //                                                 The end of namespace Ostap
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_SHAPENLL_H
+// ============================================================================
@@ -24,6 +24,8 @@ class RooAbsData ; // RooFit
 // ============================================================================
 namespace Ostap
 {
+  // ==========================================================================
+  class DataSnapshot ; // Ostap 
   // ==========================================================================
   /** @class StatVar Ostap/StatVar.h
    *  Helper class to get statistical 
@@ -956,6 +958,74 @@ namespace Ostap
       const std::string&  expr         , 
       const std::string&  cuts  = ""   ) ;
     // ========================================================================    
+  public: // fast scans over the columnar snapshot 
+    // ========================================================================
+    /** build statistic for the <code>expression</code>
+     *  @param data       (INPUT) the columnar snapshot of data 
+     *  @param expression (INPUT) the expression
+     *  @param cuts       (INPUT) the selection/weight 
+     *
+     *  @code
+     *  DataSnapshot snap ( data ) ; 
+     *  stat1 = StatVar::statVar ( snap , 'pt' , 'y>2'   ) ;
+     *  stat2 = StatVar::statVar ( snap , 'm'  , 'y>2'   ) ; // no new scan over data
+     *  @endcode 
+     *  @see Ostap::DataSnapshot
+     *  @author agent agent@local
+     *  @date   2026-10-19
+     */
+    static Statistic statVar 
+    ( DataSnapshot&        data       , 
+      const std::string&   expression , 
+      const std::string&   cuts  = "" ) ;
+    // ========================================================================
+    /** calculate the covariance of two expressions 
+     *  @param data  (INPUT)  the columnar snapshot of data 
+     *  @param exp1  (INPUT)  the first  expresiion
+     *  @param exp2  (INPUT)  the second expresiion
+     *  @param cuts  (INPUT)  the selection/weight 
+     *  @param stat1 (UPDATE) the statistic for the first  expression
+     *  @param stat2 (UPDATE) the statistic for the second expression
+     *  @param cov2  (UPDATE) the covariance matrix 
+     *  @return number of processed events 
+     *  @see Ostap::DataSnapshot
+     */
+    static unsigned long statCov
+    ( DataSnapshot&        data  , 
+      const std::string&   exp1  , 
+      const std::string&   exp2  , 
+      const std::string&   cuts  , 
+      Statistic&           stat1 ,  
+      Statistic&           stat2 ,  
+      Ostap::SymMatrix2x2& cov2  ) ;
+    // ========================================================================
+    /** get the number of equivalent entries 
+     *  \f$ n_{eff} \equiv = \frac{ (\sum w)^2}{ \sum w^2} \f$
+     *  @param data  (INPUT) the columnar snapshot of data 
+     *  @param cuts  (INPUT) the selection/weight 
+     *  @return number of equivalent entries 
+     *  @see Ostap::DataSnapshot
+     */
+    static double nEff 
+    ( DataSnapshot&        data       , 
+      const std::string&   cuts  = "" ) ;
+    // ========================================================================
+    /** calculate the moment of order "order" relative to the center "center"
+     *  @param  data   (INPUT) the columnar snapshot of data 
+     *  @param  order  (INPUT) the order 
+     *  @param  expr   (INPUT) the expression
+     *  @param  center (INPUT) the center 
+     *  @param  cuts   (INPUT) the selection/weight 
+     *  @return the moment 
+     *  @see Ostap::DataSnapshot
+     */
+    static double get_moment 
+    ( DataSnapshot&        data        ,  
+      const unsigned short order       , 
+      const std::string&   expr        , 
+      const double         center = 0  ,
+      const std::string&   cuts   = "" ) ;
+    // ========================================================================    
   } ;
   // ==========================================================================
 } //                                                     end of namespace Ostap
@@ -0,0 +1,199 @@
+// ============================================================================
+#ifndef OSTAP_THREADPOOL_H
+#define OSTAP_THREADPOOL_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include <exception>
+#include <functional>
+// ============================================================================
+namespace Ostap
+{
+  // ==========================================================================
+  namespace Utils
+  {
+    // ========================================================================
+    /** @class ThreadPool Ostap/ThreadPool.h
+     *  Process-wide pool of worker threads with work-stealing.
+     *
+     *  - each worker has its own task queue: the tasks submitted from the
+     *    worker go to its own queue (LIFO), the idle workers steal
+     *    the oldest tasks from the queues of other workers;
+     *  - the threads that wait for the tasks (e.g. in <code>TaskGroup::wait</code>)
+     *    execute the pending tasks themselves, therefore the nested
+     *    parallel loops do not deadlock;
+     *  - the pool is created at the first use with
+     *    <code>concurrency()-1</code> workers: the calling thread is
+     *    the last one;
+     *  - the child process after <code>fork</code> drops the pool
+     *    of the parent (without joining its workers), the new pool
+     *    is created at the first use in the child.
+     *
+     *  Usually one does not need the pool itself, but <code>TaskGroup</code>
+     *  @see Ostap::Utils::TaskGroup
+     *  @author agent agent@local
+     *  @date   2026-10-19
+     */
+    class ThreadPool
+    {
+    public:
+      // ======================================================================
+      /// the task
+      typedef std::function<void()> Task ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// get the process-wide pool
+      static ThreadPool& instance () ;
+      // ======================================================================
+      /// the number of threads (including the calling one) to be used
+      static unsigned int concurrency    () ;
+      /** set the number of threads (including the calling one) to be used
+       *  @param n number of threads, 0 means "all available cores"
+       *  @attention the workers are restarted: no tasks must be running
+       */
+      static void         setConcurrency ( const unsigned int n ) ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// submit the task for the execution
+      void         submit  ( Task task ) ;
+      /// execute one pending task (if any), return true if the task is executed
+      bool         run_one () ;
+      /** execute the pending tasks until <code>done()</code> is true,
+       *  sleeping when there is nothing to execute
+       *  @attention <code>notify</code> must be called when
+       *             <code>done()</code> becomes true
+       */
+      void         wait    ( const std::function<bool()>& done ) ;
+      /// wake up the threads waiting in <code>wait</code>
+      void         notify  () ;
+      /// number of worker threads
+      unsigned int size    () const ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// destructor: stop & join all workers
+      ~ThreadPool () ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// constructor with number of workers
+      ThreadPool ( const unsigned int nworkers ) ;
+      /// no copy
+      ThreadPool ( const ThreadPool& ) = delete ;
+      /// no assignement
+      ThreadPool& operator=( const ThreadPool& ) = delete ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// the actual implementation (opaque)
+      class Impl ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// the actual implementation
+      std::unique_ptr<Impl> m_impl ; // the actual implementation
+      // ======================================================================
+    } ;
+    // ========================================================================
+    /** @class TaskGroup Ostap/ThreadPool.h
+     *  The group of tasks executed by the process-wide
+     *  <code>ThreadPool</code> with cooperative cancellation.
+     *
+     *  - <code>wait</code> waits for all tasks of the group and
+     *    re-throws the first exception from the tasks;
+     *  - the exception from the task cancels the group;
+     *  - the cancelled group does not start the pending tasks,
+     *    while the long running tasks can check <code>cancelled()</code>
+     *
+     *  @code
+     *  Ostap::Utils::TaskGroup group ;
+     *  group.parallel_for ( 0 , tree->GetEntries() , 10000 ,
+     *                      [&] ( const std::size_t begin , const std::size_t end )
+     *                      { ... process entries [begin,end) ... } ) ;
+     *  group.wait () ;
+     *  @endcode
+     *
+     *  @see Ostap::Utils::ThreadPool
+     *  @author agent agent@local
+     *  @date   2026-10-19
+     */
+    class TaskGroup
+    {
+    public:
+      // ======================================================================
+      /// the task
+      typedef ThreadPool::Task                                  Task  ;
+      /// the task for the range <code>[begin,end)</code>
+      typedef std::function<void(std::size_t,std::size_t)>      Range ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// constructor
+      TaskGroup  () ;
+      /// destructor: cancel and wait for the running tasks
+      ~TaskGroup () ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// run the task in the group
+      void run ( Task task ) ;
+      // ======================================================================
+      /** process the range <code>[first,last)</code> by the chunks
+       *  <code>[begin,end)</code> of <code>grain</code> items
+       *  @param first   begin of the range
+       *  @param last    end   of the range
+       *  @param grain   the chunk size (0: automatic)
+       *  @param range   the task <code>void range ( std::size_t begin , std::size_t end )</code>
+       */
+      void parallel_for
+      ( const std::size_t first ,
+        const std::size_t last  ,
+        const std::size_t grain ,
+        Range             range ) ;
+      // ======================================================================
+      /** wait for all tasks of the group
+       *  (the waiting thread executes the pending tasks),
+       *  reset the cancellation flag (the group can be reused)
+       *  and re-throw the first exception from the tasks
+       */
+      void wait      () ;
+      /// cancel the group: the pending tasks are not started
+      void cancel    () { m_cancelled = true ; }
+      /// is the group cancelled?
+      bool cancelled () const { return m_cancelled ; }
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// no copy
+      TaskGroup ( const TaskGroup& ) = delete ;
+      /// no assignement
+      TaskGroup& operator=( const TaskGroup& ) = delete ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// number of unfinished tasks
+      std::atomic<std::size_t> m_pending   { 0     } ; // number of unfinished tasks
+      /// cancellation flag
+      std::atomic<bool>        m_cancelled { false } ; // cancellation flag
+      /// the first exception
+      std::exception_ptr       m_error     {       } ; // the first exception
+      /// the mutex for the exception
+      std::mutex               m_mutex     {       } ; // the mutex
+      // ======================================================================
+    } ;
+    // ========================================================================
+  } //                                        The end of namespace Ostap::Utils
+  // ==========================================================================
+} //                                                 The end of namespace Ostap
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_THREADPOOL_H
+// ============================================================================
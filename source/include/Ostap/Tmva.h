@@ -60,6 +60,8 @@ namespace Ostap
      *  @param suffix       (INPUT) the suffix for added variables 
      *  @param aux          (INPUT) obligatory for the cuts method
      *                              where it represents the efficiency cutoff
+     *  @param nthreads     (INPUT) number of threads for TMVA evaluation 
+     *                              (one TMVA reader per thread, 0: all cores)
      */ 
     Ostap::StatusCode addResponse
     ( RooDataSet&        data          ,
@@ -68,7 +70,8 @@ namespace Ostap
       const std::string& options = ""  ,
       const std::string& prefix  = ""  , 
       const std::string& suffix  = ""  , 
-      const double       aux     = 0.9 ) ;
+      const double       aux     = 0.9 , 
+      const unsigned short nthreads = 1 ) ;
     // ========================================================================
     /** Add TMVA response to TTree
      *  The  function add branches <code>prefix+method+suffix</code> that 
@@ -82,6 +85,8 @@ namespace Ostap
      *  @param suffix       (INPUT) the suffix for added variables 
      *  @param aux          (INPUT) obligatory for the cuts method
      *                              where it represents the efficiency cutoff
+     *  @param nthreads     (INPUT) number of threads for TMVA evaluation 
+     *                              (one TMVA reader per thread, 0: all cores)
      */ 
     Ostap::StatusCode addResponse
     ( TTree*             tree          ,
@@ -90,7 +95,8 @@ namespace Ostap
       const std::string& options = ""  ,
       const std::string& prefix  = ""  , 
       const std::string& suffix  = ""  , 
-      const double       aux     = 0.9 ) ;
+      const double       aux     = 0.9 , 
+      const unsigned short nthreads = 1 ) ;
     // ========================================================================
     // Chopping 
     // ========================================================================
@@ -109,6 +115,8 @@ namespace Ostap
      *  @param suffix       (INPUT) the suffix for added variables 
      *  @param aux          (INPUT) obligatory for the cuts method
      *                              where it represents the efficiency cutoff
+     *  @param nthreads     (INPUT) number of threads for TMVA evaluation 
+     *                              (one TMVA reader per thread, 0: all cores)
      */ 
     Ostap::StatusCode addChoppingResponse 
     ( RooDataSet&          data                   ,
@@ -120,7 +128,8 @@ namespace Ostap
       const std::string&   options  = ""          ,
       const std::string&   prefix   = ""          , 
       const std::string&   suffix   = ""          ,
-      const double         aux      = 0.9         ) ;
+      const double         aux      = 0.9         , 
+      const unsigned short nthreads = 1           ) ;
     // ========================================================================
     /** Add TMVA/Chopping response to TTree
      *  The  function add branches <code>prefix+method+suffix</code> that 
@@ -137,6 +146,8 @@ namespace Ostap
      *  @param suffix       (INPUT) the suffix for added variables 
      *  @param aux          (INPUT) obligatory for the cuts method
      *                              where it represents the efficiency cutoff
+     *  @param nthreads     (INPUT) number of threads for TMVA evaluation 
+     *                              (one TMVA reader per thread, 0: all cores)
      */ 
     Ostap::StatusCode addChoppingResponse 
     ( TTree*               tree                   ,
@@ -148,7 +159,8 @@ namespace Ostap
       const std::string&   options  = ""          ,
       const std::string&   prefix   = ""          , 
       const std::string&   suffix   = ""          ,
-      const double         aux      = 0.9         ) ;
+      const double         aux      = 0.9         , 
+      const unsigned short nthreads = 1           ) ;
     // ========================================================================
   } //                                         The END of namespace Ostap::TMVA 
   // ==========================================================================
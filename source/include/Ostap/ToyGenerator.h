@@ -0,0 +1,339 @@
+// ============================================================================
+#ifndef OSTAP_TOYGENERATOR_H
+#define OSTAP_TOYGENERATOR_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <cstdint>
+#include <vector>
+#include <functional>
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/RandomStream.h"
+// ============================================================================
+namespace Ostap
+{
+  // ==========================================================================
+  namespace Math
+  {
+    // ========================================================================
+    /** @class ToyGenerator Ostap/ToyGenerator.h
+     *  Fast generator of toy events for 1D shapes via
+     *  the tabulated inverse cumulative distribution function.
+     *
+     *  - the range is split into bins and the bin probabilities are
+     *    taken from the (exact) <code>integral</code> of the shape;
+     *  - the bins where the trapezoidal estimate of the integral differs
+     *    from the exact integral by more than the required precision
+     *    are split further;
+     *  - inside the bin the density is approximated by the linear function,
+     *    and the inverse of the quadratic CDF is taken analytically;
+     *  - the bin is located in O(1) by the guide table.
+     *
+     *  Each event takes exactly one random number from the counter-based
+     *  <code>RandomStream</code>, therefore the generation can be split into
+     *  threads without changing the result.
+     *
+     *  @code
+     *  const Ostap::Math::CrystalBall    cb  ( 3.1 , 0.01 , 2 , 5 ) ;
+     *  const Ostap::Math::ToyGenerator   gen ( cb , 3.0 , 3.2 ) ;
+     *  const Ostap::Utils::RandomStream  rng ( 12345 ) ;
+     *  std::vector<double> toy = gen.generate ( 1000000 , rng , 0 , 4 ) ;
+     *  @endcode
+     *
+     *  @attention the shape must be non-negative in the range
+     *  @see Ostap::Utils::RandomStream
+     *  @author agent agent@local
+     *  @date   2026-10-19
+     */
+    class ToyGenerator
+    {
+    public:
+      // ======================================================================
+      /// the density \f$ f(x)\f$
+      typedef std::function<double(double)>        function1 ;
+      /// the integral \f$ \int_a^b f(x) dx \f$
+      typedef std::function<double(double,double)> integral1 ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** constructor from the density and its integral
+       *  @param density   the density
+       *  @param integral  the integral of the density
+       *  @param xmin      low  edge of the range
+       *  @param xmax      high edge of the range
+       *  @param nbins     initial number of bins
+       *  @param precision the required (relative) precision of the bin integrals
+       */
+      ToyGenerator
+      ( const function1&     density            ,
+        const integral1&     integral           ,
+        const double         xmin               ,
+        const double         xmax               ,
+        const unsigned short nbins     = 256    ,
+        const double         precision = 1.e-6  ) ;
+      // ======================================================================
+      /** constructor from the shape
+       *  @param shape     the shape: <code>shape(x)</code> and
+       *                   <code>shape.integral(low,high)</code> must be provided
+       *  @param xmin      low  edge of the range
+       *  @param xmax      high edge of the range
+       *  @param nbins     initial number of bins
+       *  @param precision the required (relative) precision of the bin integrals
+       */
+      template <class SHAPE>
+      ToyGenerator
+      ( const SHAPE&         shape              ,
+        const double         xmin               ,
+        const double         xmax               ,
+        const unsigned short nbins     = 256    ,
+        const double         precision = 1.e-6  )
+        : ToyGenerator
+          ( [&shape] ( const double x ) -> double { return shape ( x ) ; } ,
+            [&shape] ( const double a , const double b ) -> double
+            { return shape.integral ( a , b ) ; } ,
+            xmin , xmax , nbins , precision )
+      {}
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** generate single event
+       *  @param rng   the random stream
+       *  @param index the index of the event in the stream
+       */
+      double generate
+      ( const Ostap::Utils::RandomStream& rng   ,
+        const std::uint64_t               index ) const
+      { return quantile ( rng.uniform ( index ) ) ; }
+      // ======================================================================
+      /** generate <code>n</code> events
+       *  @param n        number of events
+       *  @param x        (OUTPUT) the events
+       *  @param rng      the random stream
+       *  @param first    the index of the first event in the stream
+       *  @param nthreads number of threads (0: all cores)
+       */
+      void generate
+      ( const std::size_t                 n            ,
+        double*                           x            ,
+        const Ostap::Utils::RandomStream& rng          ,
+        const std::uint64_t               first    = 0 ,
+        const unsigned short              nthreads = 1 ) const ;
+      // ======================================================================
+      /** generate <code>n</code> events
+       *  @param n        number of events
+       *  @param rng      the random stream
+       *  @param first    the index of the first event in the stream
+       *  @param nthreads number of threads (0: all cores)
+       *  @return the events
+       */
+      std::vector<double> generate
+      ( const std::size_t                 n            ,
+        const Ostap::Utils::RandomStream& rng          ,
+        const std::uint64_t               first    = 0 ,
+        const unsigned short              nthreads = 1 ) const ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// the (tabulated) quantile function: inverse CDF
+      double quantile ( const double u ) const ;
+      /// the (tabulated) cumulative distribution function
+      double cdf      ( const double x ) const ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// low edge of the range
+      double      xmin     () const { return m_x.front () ; }
+      /// high edge of the range
+      double      xmax     () const { return m_x.back  () ; }
+      /// number of bins
+      std::size_t size     () const { return m_x.size  () - 1 ; }
+      /// the integral of the shape over the range
+      double      integral () const { return m_cdf.back () ; }
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// the bin edges
+      std::vector<double>       m_x     {} ; // the bin edges
+      /// the density at the bin edges
+      std::vector<double>       m_f     {} ; // the density at the bin edges
+      /// the cumulative integrals at the bin edges
+      std::vector<double>       m_cdf   {} ; // the cumulative integrals
+      /// the guide table
+      std::vector<unsigned int> m_guide {} ; // the guide table
+      // ======================================================================
+    } ;
+    // ========================================================================
+    /** @class ToyGenerator2D Ostap/ToyGenerator.h
+     *  Fast generator of toy events for 2D shapes, e.g.
+     *  <code>Ostap::Math::Bernstein2D</code> or <code>Ostap::Math::Positive2D</code>,
+     *  via the tabulated marginal and conditional CDFs.
+     *
+     *  - the cell probabilities are taken from the (exact) 2D
+     *    <code>integral</code> of the shape and are accumulated
+     *    column-by-column, that is the marginal CDF in x and the
+     *    conditional CDFs in y;
+     *  - the grid is refined while the bilinear estimate of the cell
+     *    integrals differs from the exact ones more than the required precision;
+     *  - inside the cell the density is approximated by the bilinear function:
+     *    x is taken from its (linear) marginal and y from the (linear) conditional.
+     *
+     *  Each event takes exactly two random numbers from the counter-based
+     *  <code>RandomStream</code>.
+     *
+     *  @code
+     *  const Ostap::Math::Positive2D     eff ( ... ) ;
+     *  const Ostap::Math::ToyGenerator2D gen ( eff ) ;
+     *  const Ostap::Utils::RandomStream  rng ( 12345 ) ;
+     *  std::vector<double> toy = gen.generate ( 1000000 , rng , 0 , 4 ) ; // (x,y) pairs
+     *  @endcode
+     *
+     *  @attention the shape must be non-negative in the range
+     *  @see Ostap::Math::ToyGenerator
+     *  @author agent agent@local
+     *  @date   2026-10-19
+     */
+    class ToyGenerator2D
+    {
+    public:
+      // ======================================================================
+      /// the density \f$ f(x,y)\f$
+      typedef std::function<double(double,double)>               function2 ;
+      /// the integral \f$ \int_{x_l}^{x_h}\int_{y_l}^{y_h} f(x,y) dx dy \f$
+      typedef std::function<double(double,double,double,double)> integral2 ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** constructor from the density and its integral
+       *  @param density   the density
+       *  @param integral  the integral of the density
+       *  @param xmin      low  edge of the range in x
+       *  @param xmax      high edge of the range in x
+       *  @param ymin      low  edge of the range in y
+       *  @param ymax      high edge of the range in y
+       *  @param nx        initial number of bins in x
+       *  @param ny        initial number of bins in y
+       *  @param precision the required (relative) precision of the cell integrals
+       */
+      ToyGenerator2D
+      ( const function2&     density           ,
+        const integral2&     integral          ,
+        const double         xmin              ,
+        const double         xmax              ,
+        const double         ymin              ,
+        const double         ymax              ,
+        const unsigned short nx        = 64    ,
+        const unsigned short ny        = 64    ,
+        const double         precision = 1.e-5 ) ;
+      // ======================================================================
+      /** constructor from the shape
+       *  @param shape     the shape, <code>shape(x,y)</code>,
+       *                   <code>shape.integral(xlow,xhigh,ylow,yhigh)</code>
+       *                   and <code>xmin/xmax/ymin/ymax</code> must be provided
+       *  @param nx        initial number of bins in x
+       *  @param ny        initial number of bins in y
+       *  @param precision the required (relative) precision of the cell integrals
+       */
+      template <class SHAPE>
+      ToyGenerator2D
+      ( const SHAPE&         shape             ,
+        const unsigned short nx        = 64    ,
+        const unsigned short ny        = 64    ,
+        const double         precision = 1.e-5 )
+        : ToyGenerator2D
+          ( [&shape] ( const double x , const double y ) -> double
+            { return shape ( x , y ) ; } ,
+            [&shape] ( const double xl , const double xh ,
+                       const double yl , const double yh ) -> double
+            { return shape.integral ( xl , xh , yl , yh ) ; } ,
+            shape.xmin () , shape.xmax () ,
+            shape.ymin () , shape.ymax () ,
+            nx , ny , precision )
+      {}
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** generate single event
+       *  @param rng   the random stream
+       *  @param index the index of the event in the stream
+       *  @param x     (OUTPUT) x-value
+       *  @param y     (OUTPUT) y-value
+       */
+      void generate
+      ( const Ostap::Utils::RandomStream& rng   ,
+        const std::uint64_t               index ,
+        double&                           x     ,
+        double&                           y     ) const ;
+      // ======================================================================
+      /** generate <code>n</code> events
+       *  @param n        number of events
+       *  @param xy       (OUTPUT) the events, <code>2*n</code> row-major array
+       *  @param rng      the random stream
+       *  @param first    the index of the first event in the stream
+       *  @param nthreads number of threads (0: all cores)
+       */
+      void generate
+      ( const std::size_t                 n            ,
+        double*                           xy           ,
+        const Ostap::Utils::RandomStream& rng          ,
+        const std::uint64_t               first    = 0 ,
+        const unsigned short              nthreads = 1 ) const ;
+      // ======================================================================
+      /** generate <code>n</code> events
+       *  @param n        number of events
+       *  @param rng      the random stream
+       *  @param first    the index of the first event in the stream
+       *  @param nthreads number of threads (0: all cores)
+       *  @return the events, <code>2*n</code> row-major array
+       */
+      std::vector<double> generate
+      ( const std::size_t                 n            ,
+        const Ostap::Utils::RandomStream& rng          ,
+        const std::uint64_t               first    = 0 ,
+        const unsigned short              nthreads = 1 ) const ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// low  edge in x
+      double         xmin     () const { return m_xmin ; }
+      /// high edge in x
+      double         xmax     () const { return m_xmax ; }
+      /// low  edge in y
+      double         ymin     () const { return m_ymin ; }
+      /// high edge in y
+      double         ymax     () const { return m_ymax ; }
+      /// number of bins in x
+      unsigned short nX       () const { return m_nx   ; }
+      /// number of bins in y
+      unsigned short nY       () const { return m_ny   ; }
+      /// the integral of the shape over the range
+      double         integral () const { return m_cdf.back () ; }
+      // ======================================================================
+    private:
+      // ======================================================================
+      double                    m_xmin  ;      // low  edge in x
+      double                    m_xmax  ;      // high edge in x
+      double                    m_ymin  ;      // low  edge in y
+      double                    m_ymax  ;      // high edge in y
+      unsigned short            m_nx    ;      // number of bins in x
+      unsigned short            m_ny    ;      // number of bins in y
+      /// the density at the grid nodes
+      std::vector<double>       m_f     {} ;   // the density at the nodes
+      /// the cumulative integrals (column-by-column)
+      std::vector<double>       m_cdf   {} ;   // the cumulative integrals
+      /// the guide table
+      std::vector<unsigned int> m_guide {} ;   // the guide table
+      // ======================================================================
+    } ;
+    // ========================================================================
+  } //                                         The end of namespace Ostap::Math
+  // ==========================================================================
+} //                                                 The end of namespace Ostap
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_TOYGENERATOR_H
+// ============================================================================
@@ -2,11 +2,18 @@
 // Include files 
 // ============================================================================
 #include <string>
+#include <memory>
+#include <vector>
+#include <atomic>
+#include <algorithm>
 // ============================================================================
 // ROOT
 // ============================================================================
+#include "TROOT.h"
+#include "TFile.h"
 #include "TTree.h"
 #include "TBranch.h"
+#include "TObjArray.h"
 #include "TH1.h"
 #include "TH2.h"
 #include "TH3.h"
@@ -15,7 +22,14 @@
 // ============================================================================
 #include "Ostap/AddBranch.h"
 #include "Ostap/Funcs.h"
+#include "Ostap/Formula.h"
 #include "Ostap/Notifier.h"
+#include "Ostap/HistoSampler.h"
+// ============================================================================
+// Local
+// ============================================================================
+#include "local_parallel.h"
+#include "Exception.h"
 // ============================================================================
 /** @file
  *  Implementation file for function Ostap::Trees::add_branch 
@@ -24,6 +38,116 @@
  *  @date 2019-05-14
  */
 // ============================================================================
+namespace
+{
+  // ==========================================================================
+  /// number of entries in the block of sampled points 
+  const std::size_t s_SAMPLE_BLOCK = 65536 ;
+  // ==========================================================================
+  typedef std::unique_ptr<Ostap::Formula> UOF  ;
+  typedef std::vector<UOF>                UOFS ;
+  // ==========================================================================
+  /// create the formulas for the input expressions 
+  bool _formulas_ 
+  ( TTree*                          tree     , 
+    const std::vector<std::string>& inputs   , 
+    UOFS&                           formulas ) 
+  {
+    formulas.clear   () ;
+    formulas.reserve ( inputs.size () ) ;
+    for ( const auto& e : inputs ) 
+    {
+      auto p = std::make_unique<Ostap::Formula>( "" , e , tree ) ;
+      if ( !p || !p->ok() ) { return false ; }                        // RETURN 
+      formulas.push_back ( std::move ( p ) ) ;  
+    }
+    return true ;
+  }
+  // ==========================================================================
+  /** remove the (partially filled) new branches from the tree 
+   *  @param tree     (UPDATE) the tree 
+   *  @param branches (INPUT)  the branches to be removed 
+   */
+  void _remove_branches_ 
+  ( TTree*                       tree     , 
+    const std::vector<TBranch*>& branches ) 
+  {
+    TObjArray* lbranches = tree->GetListOfBranches () ;
+    TObjArray* lleaves   = tree->GetListOfLeaves   () ;
+    for ( TBranch* branch : branches ) 
+    {
+      if ( !branch ) { continue ; }                                   // CONTINUE 
+      TObjArray* leaves = branch->GetListOfLeaves () ;
+      for ( int i = 0 ; i < leaves->GetEntriesFast () ; ++i ) 
+      { lleaves->Remove ( leaves->UncheckedAt ( i ) ) ; }
+      lbranches->Remove ( branch ) ;
+      delete branch ;
+    }
+    lbranches -> Compress () ;
+    lleaves   -> Compress () ;
+  }
+  // ==========================================================================
+  /** loop over the tree block-wise: read the columns of input expressions, 
+   *  calculate the block of outputs and invoke 
+   *  <code>fill ( ocolumns , k )</code> for each entry in the block  
+   *  @return false if the tree can't be loaded 
+   */
+  template <class FILLER>
+  bool _blocks_ 
+  ( TTree*                               tree     , 
+    const UOFS&                          formulas , 
+    const Ostap::Trees::BlockFunction&   func     , 
+    const unsigned long                  NO       , 
+    const unsigned long                  bsize    ,
+    FILLER                               fill     )
+  {
+    const unsigned long NI = formulas.size () ;
+    //
+    // the columns for the block 
+    std::vector<std::vector<double> > icolumns ( NI , std::vector<double> ( bsize , 0.0 ) ) ;
+    std::vector<std::vector<double> > ocolumns ( NO , std::vector<double> ( bsize , 0.0 ) ) ;
+    std::vector<const double*>        iptrs    ( NI , nullptr ) ;
+    std::vector<double*>              optrs    ( NO , nullptr ) ;
+    for ( unsigned long i = 0 ; i < NI ; ++i ) { iptrs [ i ] = icolumns [ i ].data () ; }
+    for ( unsigned long j = 0 ; j < NO ; ++j ) { optrs [ j ] = ocolumns [ j ].data () ; }
+    //
+    const unsigned long nentries = tree->GetEntries() ;
+    for ( unsigned long first = 0 ; first < nentries ; first += bsize ) 
+    {
+      const unsigned long last = std::min ( first + bsize , nentries ) ;
+      //
+      // (1) read the block of inputs: only the branches used in expressions
+      unsigned long n = 0 ;
+      for ( unsigned long entry = first ; entry < last ; ++entry , ++n )
+      {
+        if ( tree->LoadTree ( entry ) < 0 ) { return false ; }        // RETURN 
+        for ( unsigned long i = 0 ; i < NI ; ++i ) 
+        { icolumns [ i ][ n ] = formulas [ i ]->evaluate () ; }
+      }
+      //
+      // (2) calculate the block of outputs
+      func ( n , iptrs.data () , optrs.data () ) ;
+      //
+      // (3) fill new branches 
+      for ( unsigned long k = 0 ; k < n ; ++k ) { fill ( ocolumns , k ) ; }
+    }
+    //
+    return true ;
+  }
+  // ==========================================================================
+  /// the trivial block function: copy inputs into outputs 
+  void _copy_ 
+  ( const unsigned long  n       , 
+    const double* const* inputs  , 
+    double* const*       outputs , 
+    const unsigned long  NO      ) 
+  {
+    for ( unsigned long j = 0 ; j < NO ; ++j ) 
+    { std::copy ( inputs [ j ] , inputs [ j ] + n , outputs [ j ] ) ; }
+  }
+  // ==========================================================================
+} //                                                 end of anonymous namespace
+// ============================================================================
 /* add new branch with name <code>name</code> to the tree
  * the value of the branch is taken from  function <code>func</code>
  * @param tree    input tree 
@@ -91,6 +215,7 @@ TBranch* Ostap::Trees::add_branch
  *  @param histo  the historgam to be  sampled
  *  @return new  branch 
  *  @see TH1::GetRandom 
+ *  @see Ostap::Utils::HistoSampler
  */
 // ============================================================================
 TBranch* Ostap::Trees::add_branch 
@@ -100,22 +225,25 @@ TBranch* Ostap::Trees::add_branch
 {
   if ( !tree   ) { return nullptr ; }
   //
-  const TH1* h1 = &histo ;
-  if ( nullptr != dynamic_cast<const TH2*>( h1 ) ) { return nullptr ; }
+  Ostap::Assert ( 1 == histo.GetDimension ()     ,
+                  "Invalid histogram dimension"  ,
+                  "Ostap::Trees::add_branch"     ) ;
   //
   Double_t value    = 0  ;
   TBranch* branch   = tree->Branch( name.c_str() , &value , (name + "/D").c_str() );
   if ( !branch ) { return nullptr ; }
   //
+  // sample the histogram block-wise for all entries 
   const Long64_t nentries = tree->GetEntries(); 
-  for ( Long64_t i = 0 ; i < nentries ; ++i )
-  {
-    if ( tree->GetEntry ( i ) < 0 ) { break ; };
-    //
-    value = histo.GetRandom() ;
-    //
-    branch -> Fill (       ) ;
-  }
+  const Ostap::Utils::HistoSampler sampler { histo } ;
+  sampler.for_each 
+    ( nentries , Ostap::Utils::HistoSampler::random_stream () , 
+      [&value,branch] ( const double* point ) 
+      {
+        value = point [ 0 ] ;
+        //
+        branch -> Fill (       ) ;
+      } , 0 , s_SAMPLE_BLOCK , 0 ) ;
   //
   return branch ; 
 }
@@ -127,6 +255,7 @@ TBranch* Ostap::Trees::add_branch
  *  @param histo  the historgam to be  sampled
  *  @return new  brances 
  *  @see TH2::GetRandom2 
+ *  @see Ostap::Utils::HistoSampler
  */
 // ============================================================================
 TBranch* 
@@ -149,18 +278,19 @@ Ostap::Trees::add_branch
   TBranch* branch_y  = tree->Branch( namey.c_str() , &value_y , (namey + "/D").c_str() );
   if ( !branch_y ) { return nullptr ; }
   //
-  TH2& h = const_cast<TH2&> ( histo ) ;
-  //
+  // sample the histogram block-wise for all entries 
   const Long64_t nentries = tree->GetEntries(); 
-  for ( Long64_t i = 0 ; i < nentries ; ++i )
-  {
-    if ( tree->GetEntry ( i ) < 0 ) { break ; };
-    //
-    h.GetRandom2 ( value_x , value_y ) ;
-    //
-    branch_x -> Fill (       ) ;
-    branch_y -> Fill (       ) ;
-  }
+  const Ostap::Utils::HistoSampler sampler { histo } ;
+  sampler.for_each 
+    ( nentries , Ostap::Utils::HistoSampler::random_stream () , 
+      [&value_x,&value_y,branch_x,branch_y] ( const double* point ) 
+      {
+        value_x = point [ 0 ] ;
+        value_y = point [ 1 ] ;
+        //
+        branch_x -> Fill (       ) ;
+        branch_y -> Fill (       ) ;
+      } , 0 , s_SAMPLE_BLOCK , 0 ) ;
   //
   return branch_y ; 
 }
@@ -173,6 +303,7 @@ Ostap::Trees::add_branch
  *  @param histo  the historgam to be  sampled
  *  @return new  brances 
  *  @see TH2::GetRandom2 
+ *  @see Ostap::Utils::HistoSampler
  */
 // ============================================================================
 TBranch*
@@ -197,21 +328,277 @@ Ostap::Trees::add_branch
   TBranch* branch_z  = tree->Branch( namez.c_str() , &value_z , (namez + "/D").c_str() );
   if ( !branch_z ) { return nullptr ; }
   //
-  TH3& h = const_cast<TH3&> ( histo ) ;
-  //
+  // sample the histogram block-wise for all entries 
   const Long64_t nentries = tree->GetEntries(); 
-  for ( Long64_t i = 0 ; i < nentries ; ++i )
+  const Ostap::Utils::HistoSampler sampler { histo } ;
+  sampler.for_each 
+    ( nentries , Ostap::Utils::HistoSampler::random_stream () , 
+      [&value_x,&value_y,&value_z,branch_x,branch_y,branch_z] ( const double* point ) 
+      {
+        value_x = point [ 0 ] ;
+        value_y = point [ 1 ] ;
+        value_z = point [ 2 ] ;
+        //
+        branch_x -> Fill (       ) ;
+        branch_y -> Fill (       ) ;
+        branch_z -> Fill (       ) ;
+      } , 0 , s_SAMPLE_BLOCK , 0 ) ;
+  //
+  return branch_z ; 
+}
+// ============================================================================
+/*  add new branches to TTree, calculated block-wise from 
+ *  the columns of input expressions.
+ *  @param tree      (UPDATE) input tree 
+ *  @param names     (INPUT)  names of new branches 
+ *  @param inputs    (INPUT)  input expressions 
+ *  @param func      (INPUT)  the function for the block of entries 
+ *  @param blocksize (INPUT)  the size of block 
+ *  @return the last new branch
+ *  @see Ostap::Trees::BlockFunction
+ *  @author agent agent@local
+ *  @date 2026-10-19
+ */
+// ============================================================================
+TBranch* Ostap::Trees::add_branch 
+( TTree*                          tree      , 
+  const std::vector<std::string>& names     ,
+  const std::vector<std::string>& inputs    ,
+  const BlockFunction&            func      , 
+  const unsigned long             blocksize ) 
+{
+  if ( !tree || names.empty() || !func ) { return nullptr ; }
+  //
+  const unsigned long NO    = names .size () ;
+  const unsigned long bsize = std::max ( blocksize , 1UL ) ;
+  //
+  UOFS formulas ;
+  if ( !_formulas_ ( tree , inputs , formulas ) ) { return nullptr ; }  // RETURN 
+  //
+  Ostap::Utils::Notifier notify ( formulas.begin() , formulas.end() , tree ) ;
+  //
+  std::vector<Double_t> values   ( NO , 0.0 ) ;
+  std::vector<TBranch*> branches ( NO , nullptr ) ;
+  for ( unsigned long j = 0 ; j < NO ; ++j ) 
   {
-    if ( tree->GetEntry ( i ) < 0 ) { break ; };
-    //
-    h.GetRandom3 ( value_x , value_y , value_z ) ;
-    //
-    branch_x -> Fill (       ) ;
-    branch_y -> Fill (       ) ;
-    branch_z -> Fill (       ) ;
+    const std::string& name = names [ j ] ;
+    branches [ j ] = tree->Branch( name.c_str() , &values [ j ] , ( name + "/D" ).c_str() );
+    if ( !branches [ j ] ) { break ; }                                // BREAK
   }
   //
-  return branch_z ; 
+  const bool ok = 
+    nullptr != branches.back () && 
+    _blocks_ ( tree , formulas , func , NO , bsize , 
+               [&values,&branches,NO] ( const std::vector<std::vector<double> >& o , 
+                                        const unsigned long                      k ) 
+               {
+                 for ( unsigned long j = 0 ; j < NO ; ++j ) 
+                 {
+                   values   [ j ] = o [ j ][ k ] ;
+                   branches [ j ] -> Fill () ;
+                 }
+               } ) ;
+  //
+  // failure: the partially filled branches refer to the local buffer 
+  if ( !ok ) 
+  {
+    _remove_branches_ ( tree , branches ) ;
+    return nullptr ;                                                  // RETURN 
+  }
+  //
+  return branches.back () ;
+}
+// ============================================================================
+/*  calculate new branches for the tree and write them into the separate
+ *  compact tree <code>friend_name</code> in the file <code>friend_file</code>,
+ *  aligned entry-by-entry with the input tree, to be used as a friend.
+ *  @param tree        (INPUT) input tree 
+ *  @param friend_file (INPUT) the output file (recreated)
+ *  @param friend_name (INPUT) the name of the friend tree 
+ *  @param names       (INPUT) names of new branches 
+ *  @param inputs      (INPUT) input expressions 
+ *  @param func        (INPUT) the function for the block of entries 
+ *  @param blocksize   (INPUT) the size of block 
+ *  @return status code 
+ *  @author agent agent@local
+ *  @date 2026-10-19
+ */
+// ============================================================================
+Ostap::StatusCode Ostap::Trees::add_friend_branch 
+( TTree*                          tree        , 
+  const std::string&              friend_file , 
+  const std::string&              friend_name , 
+  const std::vector<std::string>& names       ,
+  const std::vector<std::string>& inputs      ,
+  const BlockFunction&            func        , 
+  const unsigned long             blocksize   ) 
+{
+  if ( !tree || names.empty() || !func ) { return Ostap::StatusCode ( 930 ) ; }
+  //
+  const unsigned long NO    = names .size () ;
+  const unsigned long bsize = std::max ( blocksize , 1UL ) ;
+  //
+  UOFS formulas ;
+  if ( !_formulas_ ( tree , inputs , formulas ) ) { return Ostap::StatusCode ( 931 ) ; }
+  //
+  Ostap::Utils::Notifier notify ( formulas.begin() , formulas.end() , tree ) ;
+  //
+  // keep the current directory 
+  TDirectory::TContext context {} ;
+  //
+  std::unique_ptr<TFile> file { TFile::Open ( friend_file.c_str() , "RECREATE" ) } ;
+  if ( !file || !file->IsOpen() ) { return Ostap::StatusCode ( 932 ) ; }
+  file->cd () ;
+  //
+  // the friend tree is owned by the file 
+  TTree* friend_tree = new TTree ( friend_name.c_str() , tree->GetTitle () ) ;
+  //
+  std::vector<Double_t> values ( NO , 0.0 ) ;
+  for ( unsigned long j = 0 ; j < NO ; ++j ) 
+  {
+    const std::string& name = names [ j ] ;
+    if ( !friend_tree->Branch( name.c_str() , &values [ j ] , ( name + "/D" ).c_str() ) ) 
+    { return Ostap::StatusCode ( 933 ) ; }                            // RETURN
+  }
+  //
+  const bool ok = 
+    _blocks_ ( tree , formulas , func , NO , bsize , 
+               [&values,friend_tree,NO] ( const std::vector<std::vector<double> >& o , 
+                                          const unsigned long                      k ) 
+               {
+                 for ( unsigned long j = 0 ; j < NO ; ++j ) { values [ j ] = o [ j ][ k ] ; }
+                 friend_tree -> Fill () ;
+               } ) ;
+  if ( !ok ) { return Ostap::StatusCode ( 934 ) ; }                   // RETURN 
+  //
+  file->Write () ;
+  file->Close () ;
+  //
+  return Ostap::StatusCode::SUCCESS ;
+}
+// ============================================================================
+/*  calculate new branches for the tree from the expressions 
+ *  and write them into the separate compact friend tree 
+ *  @param tree        (INPUT) input tree 
+ *  @param friend_file (INPUT) the output file (recreated)
+ *  @param friend_name (INPUT) the name of the friend tree 
+ *  @param names       (INPUT) names of new branches 
+ *  @param formulas    (INPUT) the expressions for new branches  
+ *  @return status code 
+ *  @author agent agent@local
+ *  @date 2026-10-19
+ */
+// ============================================================================
+Ostap::StatusCode Ostap::Trees::add_friend_branch 
+( TTree*                          tree        , 
+  const std::string&              friend_file , 
+  const std::string&              friend_name , 
+  const std::vector<std::string>& names       ,
+  const std::vector<std::string>& formulas    ) 
+{
+  if ( names.size () != formulas.size () ) { return Ostap::StatusCode ( 935 ) ; }
+  //
+  const unsigned long NO = names.size () ;
+  return add_friend_branch 
+    ( tree , friend_file , friend_name , names , formulas , 
+      [NO] ( const unsigned long n , const double* const* i , double* const* o ) 
+      { _copy_ ( n , i , o , NO ) ; } ) ;
+}
+// ============================================================================
+/*  calculate new branches for the tree <code>tree_name</code> 
+ *  for each input file, and write them into the friend tree 
+ *  <code>friend_name</code> in the corresponding output file.
+ *  @param input_files  (INPUT) the input files 
+ *  @param tree_name    (INPUT) the name of the input tree
+ *  @param friend_files (INPUT) the output files, one per input file
+ *  @param friend_name  (INPUT) the name of the friend trees 
+ *  @param names        (INPUT) names of new branches 
+ *  @param inputs       (INPUT) input expressions 
+ *  @param func         (INPUT) the function for the block of entries 
+ *  @param blocksize    (INPUT) the size of block 
+ *  @param nthreads     (INPUT) number of concurrent jobs (0: all threads)
+ *  @return status code 
+ *  @author agent agent@local
+ *  @date 2026-10-19
+ */
+// ============================================================================
+Ostap::StatusCode Ostap::Trees::add_friend_branch 
+( const std::vector<std::string>& input_files  , 
+  const std::string&              tree_name    , 
+  const std::vector<std::string>& friend_files , 
+  const std::string&              friend_name  , 
+  const std::vector<std::string>& names        ,
+  const std::vector<std::string>& inputs       ,
+  const BlockFunction&            func         , 
+  const unsigned long             blocksize    , 
+  const unsigned short            nthreads     ) 
+{
+  if ( input_files.size () != friend_files.size () ) { return Ostap::StatusCode ( 936 ) ; }
+  //
+  const std::size_t  N = input_files.size () ;
+  const unsigned int n = n_threads ( nthreads , N ) ;
+  //
+  // several files are opened concurrently 
+  if ( 1 < n ) { ROOT::EnableThreadSafety () ; }
+  //
+  std::vector<Ostap::StatusCode> results ( N , Ostap::StatusCode::SUCCESS ) ;
+  auto _job_ = [&] ( const std::size_t i ) -> Ostap::StatusCode 
+    {
+      std::unique_ptr<TFile> file { TFile::Open ( input_files [ i ].c_str() , "READ" ) } ;
+      if ( !file || !file->IsOpen() ) { return Ostap::StatusCode ( 937 ) ; }
+      TTree* tree = nullptr ;
+      file->GetObject ( tree_name.c_str() , tree ) ;
+      if ( !tree ) { return Ostap::StatusCode ( 938 ) ; }
+      return add_friend_branch ( tree , friend_files [ i ] , friend_name , 
+                                 names , inputs , func , blocksize ) ;
+    } ;
+  //
+  // the files are taken one-by-one by the concurrent jobs 
+  std::atomic<std::size_t> next { 0 } ;
+  parallel_for ( n , 0 , n , 
+                 [&next,&results,&_job_,N] ( const unsigned int /* thread */ , 
+                                             const std::size_t  /* begin  */ , 
+                                             const std::size_t  /* end    */ ) 
+                 {
+                   for ( std::size_t i = next++ ; i < N ; i = next++ ) 
+                   { results [ i ] = _job_ ( i ) ; }
+                 } ) ;
+  //
+  for ( const auto& sc : results ) { if ( sc.isFailure () ) { return sc ; } }
+  return Ostap::StatusCode::SUCCESS ;
+}
+// ============================================================================
+/*  calculate new branches from the expressions for the tree 
+ *  <code>tree_name</code> for each input file, and write them into
+ *  the friend tree <code>friend_name</code> in the corresponding output file.
+ *  @param input_files  (INPUT) the input files 
+ *  @param tree_name    (INPUT) the name of the input tree
+ *  @param friend_files (INPUT) the output files, one per input file
+ *  @param friend_name  (INPUT) the name of the friend trees 
+ *  @param names        (INPUT) names of new branches 
+ *  @param formulas     (INPUT) the expressions for new branches  
+ *  @param nthreads     (INPUT) number of concurrent jobs (0: all threads)
+ *  @return status code 
+ *  @author agent agent@local
+ *  @date 2026-10-19
+ */
+// ============================================================================
+Ostap::StatusCode Ostap::Trees::add_friend_branch 
+( const std::vector<std::string>& input_files  , 
+  const std::string&              tree_name    , 
+  const std::vector<std::string>& friend_files , 
+  const std::string&              friend_name  , 
+  const std::vector<std::string>& names        ,
+  const std::vector<std::string>& formulas     , 
+  const unsigned short            nthreads     ) 
+{
+  if ( names.size () != formulas.size () ) { return Ostap::StatusCode ( 935 ) ; }
+  //
+  const unsigned long NO = names.size () ;
+  return add_friend_branch 
+    ( input_files , tree_name , friend_files , friend_name , names , formulas , 
+      [NO] ( const unsigned long n , const double* const* i , double* const* o ) 
+      { _copy_ ( n , i , o , NO ) ; } , 1024 , nthreads ) ;
 }
 // ============================================================================
 //                                                                      The END 
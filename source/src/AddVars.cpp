@@ -3,6 +3,8 @@
 // ============================================================================
 // STD&STL
 // ============================================================================
+#include <cmath>
+#include <functional>
 // ============================================================================
 // ROOT&RooFit 
 // ============================================================================
@@ -11,20 +13,160 @@
 #include "TH3.h"
 #include "RooAbsArg.h"
 #include "RooRealVar.h"
+#include "RooCategory.h"
 #include "RooArgSet.h"
+#include "RooArgList.h"
 #include "RooDataSet.h"
 #include "RooFormulaVar.h"
+#include "RooVectorDataStore.h"
 // ============================================================================
 // Ostap
 // ============================================================================
 #include "Ostap/IFuncs.h"
 #include "Ostap/AddVars.h"
+#include "Ostap/HistoSampler.h"
 // ============================================================================
 /** @file
  *  Implementation fiel for functions from file Ostap/AddVars.h
  *  @author Vanya BELYAEV Ivan.Belyaev@itep.ru
  *  @date 2019-06-22
  */
+namespace 
+{
+  // ==========================================================================
+  /// get the (just added) variable from the dataset 
+  const RooAbsReal* _added_var_
+  ( const RooDataSet&  dataset , 
+    const std::string& name    ) 
+  {
+    const RooArgSet*  vars = dataset.get ( 0 ) ;
+    if ( nullptr == vars ) { return nullptr ; }
+    //
+    const RooAbsArg*  nvar = vars->find ( name.c_str() );
+    if  ( nullptr == nvar ) { return nullptr ; }
+    //
+    return dynamic_cast<const RooAbsReal*> ( nvar ) ;   
+  }
+  // ==========================================================================
+  /// number of entries in the block of sampled points 
+  const std::size_t s_SAMPLE_BLOCK = 65536 ;
+  // ==========================================================================
+  /** add new columns to the dataset, filled row-by-row 
+   *  @param  dataset (UPDATE) the dataset
+   *  @param  vars    (INPUT)  the variables (RooRealVar or RooCategory) to be added
+   *  @param  loop    (INPUT)  <code>loop ( row )</code> invokes 
+   *          <code>row ( values )</code> for each entry in order,
+   *          where <code>values</code> is <code>const double*</code> with 
+   *          the values of all variables for the entry 
+   *  @see Ostap::Functions::add_columns 
+   */
+  template <class LOOP>
+  Ostap::StatusCode _add_columns_
+  ( RooDataSet&       dataset , 
+    const RooArgList& vars    , 
+    LOOP              loop    ) 
+  {
+    const unsigned long nvars = vars.getSize() ;
+    //
+    for ( unsigned long i = 0 ; i < nvars ; ++i )
+    {
+      const RooAbsArg* a = vars.at ( i ) ;
+      if ( nullptr == dynamic_cast<const RooRealVar*>  ( a ) && 
+           nullptr == dynamic_cast<const RooCategory*> ( a ) ) { return Ostap::StatusCode ( 911 ) ; }
+    }
+    //
+    RooVectorDataStore* store = dynamic_cast<RooVectorDataStore*> ( dataset.store() ) ;
+    //
+    // (1) generic case: create the dataset with new columns and merge it
+    if ( nullptr == store )
+    {
+      RooArgSet varset { vars } ;
+      RooDataSet tmp_ds ( "" , "" , varset ) ;
+      loop ( [&vars,&varset,&tmp_ds,nvars] ( const double* values ) 
+             {
+               for ( unsigned long i = 0 ; i < nvars ; ++i )
+               {
+                 RooAbsArg*   a = vars.at ( i ) ;
+                 if ( RooRealVar* r = dynamic_cast<RooRealVar*> ( a ) ) { r->setVal ( values [ i ] ) ; }
+                 else { static_cast<RooCategory*> ( a )->setIndex ( std::lround ( values [ i ] ) ) ; }
+               }
+               tmp_ds.add ( varset ) ;
+             } ) ;
+      dataset.merge ( &tmp_ds ) ;
+      return Ostap::StatusCode::SUCCESS ;
+    }
+    //
+    // (2) vector store: add (constant) columns and overwrite their content in place
+    std::vector<RooRealVar*>                      reals   ( nvars , nullptr ) ;
+    std::vector<RooCategory*>                     cats    ( nvars , nullptr ) ;
+    std::vector<RooVectorDataStore::RealVector*>  rcolumn ( nvars , nullptr ) ;
+    std::vector<RooVectorDataStore::CatVector*>   ccolumn ( nvars , nullptr ) ;
+    for ( unsigned long i = 0 ; i < nvars ; ++i )
+    {
+      RooAbsArg* h = dataset.addColumn ( *vars.at ( i ) , false ) ; // the value holder
+      if ( nullptr == h ) { return Ostap::StatusCode ( 911 ) ; }
+      reals [ i ] = dynamic_cast<RooRealVar*>  ( h ) ;
+      cats  [ i ] = dynamic_cast<RooCategory*> ( h ) ;
+    }
+    for ( unsigned long i = 0 ; i < nvars ; ++i )
+    {
+      if      ( reals [ i ] )
+      {
+        for ( auto* rv : store->realStoreList() )
+        { if ( rv->bufArg() == reals [ i ] ) { rcolumn [ i ] = rv ; break ; } }
+        if ( nullptr == rcolumn [ i ] ) { return Ostap::StatusCode ( 911 ) ; }
+      }
+      else if ( cats  [ i ] )
+      {
+        for ( auto* cv : store->catStoreList() )
+        { if ( cv->bufArg() == cats  [ i ] ) { ccolumn [ i ] = cv ; break ; } }
+        if ( nullptr == ccolumn [ i ] ) { return Ostap::StatusCode ( 911 ) ; }
+      }
+      else { return Ostap::StatusCode ( 911 ) ; }
+    }
+    //
+    unsigned long long entry = 0 ;
+    loop ( [&reals,&cats,&rcolumn,&ccolumn,&entry,nvars] ( const double* values ) 
+           {
+             for ( unsigned long i = 0 ; i < nvars ; ++i )
+             {
+               if ( reals [ i ] ) 
+               {
+                 reals   [ i ]->setVal   ( values [ i ] ) ;
+                 rcolumn [ i ]->write    ( entry ) ;
+               }
+               else 
+               {
+                 cats    [ i ]->setIndex ( std::lround ( values [ i ] ) ) ;
+                 ccolumn [ i ]->write    ( entry ) ;
+               }
+             }
+             ++entry ;
+           } ) ;
+    //
+    return Ostap::StatusCode::SUCCESS ;
+  }
+  // ==========================================================================
+  /** add new columns to the dataset, sampled block-wise from the histogram 
+   *  @see Ostap::Utils::HistoSampler::for_each
+   */
+  Ostap::StatusCode _add_sampled_
+  ( RooDataSet&        dataset , 
+    const RooArgList&  vars    , 
+    const TH1&         histo   ) 
+  {
+    const unsigned long nEntries = dataset.numEntries() ;
+    if ( 0 == vars.getSize() || 0 == nEntries ) { return Ostap::StatusCode::SUCCESS ; }
+    //
+    const Ostap::Utils::HistoSampler sampler { histo } ;
+    const Ostap::Utils::RandomStream rng = Ostap::Utils::HistoSampler::random_stream () ;
+    return _add_columns_ 
+      ( dataset , vars , 
+        [&sampler,&rng,nEntries] ( const std::function<void(const double*)>& row ) 
+        { sampler.for_each ( nEntries , rng , row , 0 , s_SAMPLE_BLOCK , 0 ) ; } ) ;
+  }
+  // ==========================================================================
+} //                                                 end of anonymous namespace
 // ============================================================================
 /*  add new variable to dataset
  *  @param  dataset input    dataset
@@ -40,35 +182,22 @@ Ostap::Functions::add_var
   const Ostap::IFuncData& func    ) 
 {  
   //
-  RooRealVar var         { name.c_str() , ""        , 0.0 } ;
-  RooArgSet  varset      { var          ,"one var" } ;
-  RooDataSet new_dataset { "" , ""      , varset   } ;
-  //
-  // loop over events in the input data set 
+  // loop over events in the input data set and calculate the function 
   const unsigned long nEntries = dataset.numEntries() ;
+  std::vector<double> values ;
+  values.reserve ( nEntries ) ;
   for ( unsigned long entry = 0 ; entry < nEntries ; ++entry )   
   {
     //
     if ( 0 == dataset.get( entry)  ) { break ; }                    // BREAK
     //
-    // calculate the function 
-    const double value = func ( &dataset ) ;
-    // 
-    var.setVal ( value ) ;
-    //
-    new_dataset.add ( varset ) ;
+    values.push_back ( func ( &dataset ) ) ;
   }
-  // 
-  // merge  two  datasets 
-  dataset.merge ( &new_dataset ) ;
   //
-  const RooArgSet*  vars = dataset.get(0) ;
-  if ( nullptr == vars ) { return nullptr ; }
+  RooRealVar var { name.c_str() , "" , 0.0 } ;
+  if ( add_columns ( dataset , RooArgList ( var ) , values ).isFailure() ) { return nullptr ; }
   //
-  const RooAbsArg*  nvar = vars->find ( name.c_str() );
-  if  ( nullptr == nvar ) { return nullptr ; }
-  //
-  return dynamic_cast<const RooAbsReal*> ( nvar ) ;   
+  return _added_var_ ( dataset , name ) ;
 }
 // ============================================================================
 /*  add new variable to dataset
@@ -110,6 +239,7 @@ Ostap::Functions::add_var
  *  @param  histo   histogram to be sampled 
  *  @return the added variable 
  *  @see TH1::GetRandom 
+ *  @see Ostap::Utils::HistoSampler
  */
 // ============================================================================
 const RooAbsReal* 
@@ -122,36 +252,11 @@ Ostap::Functions::add_var
   const TH1* h1 = &histo ;
   if ( nullptr != dynamic_cast<const TH2*> ( h1 ) ) { return nullptr ; }
   //
+  // sample the histogram block-wise for all events in the input data set 
+  RooRealVar var { name.c_str() , "" , 0.0 } ;
+  if ( _add_sampled_ ( dataset , RooArgList ( var ) , histo ).isFailure() ) { return nullptr ; }
   //
-  RooRealVar var         { name.c_str() , ""        , 0.0 } ;
-  RooArgSet  varset      { var          ,"one var" } ;
-  RooDataSet new_dataset { "" , ""      , varset   } ;
-  //
-  // loop over events in the input data set 
-  const unsigned long nEntries = dataset.numEntries() ;
-  for ( unsigned long entry = 0 ; entry < nEntries ; ++entry )   
-  {
-    //
-    if ( 0 == dataset.get( entry)  ) { break ; }                    // BREAK
-    //
-    // calculate the function 
-    const double value = histo.GetRandom() ;
-    // 
-    var.setVal ( value ) ;
-    //
-    new_dataset.add ( varset ) ;
-  }
-  // 
-  // merge  two  datasets 
-  dataset.merge ( &new_dataset ) ;
-  //
-  const RooArgSet*  vars = dataset.get( 0 ) ;
-  if ( nullptr == vars ) { return nullptr ; }
-  //
-  const RooAbsArg*  nvar = vars->find ( name.c_str() );
-  if  ( nullptr == nvar ) { return nullptr ; }
-  //
-  return dynamic_cast<const RooAbsReal*> ( nvar ) ;   
+  return _added_var_ ( dataset , name ) ;
 }
 // ============================================================================
 /*  add new variables to dataset, sampled from 2D-histogram
@@ -161,6 +266,7 @@ Ostap::Functions::add_var
  *  @param  histo   histogram to be sampled 
  *  @return the added variable 
  *  @see TH2::GetRandom2
+ *  @see Ostap::Utils::HistoSampler
  */
 // ============================================================================
 const RooAbsReal* 
@@ -174,43 +280,12 @@ Ostap::Functions::add_var
   const TH2* h = &histo ;
   if ( nullptr != dynamic_cast<const TH3*> ( h ) ) { return nullptr ; }
   //
-  RooRealVar varx        { namex.c_str() , "" , 0.0 } ;
-  RooRealVar vary        { namey.c_str() , "" , 0.0 } ;
-  
-  RooArgSet  varset      { varx, vary    ,"one var" } ;
-  RooDataSet new_dataset { "" , ""       , varset   } ;
+  // sample the histogram block-wise for all events in the input data set 
+  RooRealVar varx { namex.c_str() , "" , 0.0 } ;
+  RooRealVar vary { namey.c_str() , "" , 0.0 } ;
+  if ( _add_sampled_ ( dataset , RooArgList ( varx , vary ) , histo ).isFailure() ) { return nullptr ; }
   //
-  double value_x = 0 ;
-  double value_y = 0 ;
-  //
-  TH2* h2 = const_cast<TH2*> ( h ) ;
-  //
-  // loop over events in the input data set 
-  const unsigned long nEntries = dataset.numEntries() ;
-  for ( unsigned long entry = 0 ; entry < nEntries ; ++entry )   
-  {
-    //
-    if ( 0 == dataset.get( entry)  ) { break ; }                    // BREAK
-    //
-    // calculate the function 
-    h2->GetRandom2 ( value_x , value_y ) ;
-    // 
-    varx.setVal ( value_x ) ;
-    vary.setVal ( value_y ) ;
-    //
-    new_dataset.add ( varset ) ;
-  }
-  // 
-  // merge  two  datasets 
-  dataset.merge ( &new_dataset ) ;
-  //
-  const RooArgSet*  vars = dataset.get( 0 ) ;
-  if ( nullptr == vars ) { return nullptr ; }
-  //
-  const RooAbsArg*  nvar = vars->find ( namey.c_str() );
-  if  ( nullptr == nvar ) { return nullptr ; }
-  //
-  return dynamic_cast<const RooAbsReal*> ( nvar ) ;   
+  return _added_var_ ( dataset , namey ) ;
 }
 // ============================================================================
 /*  add new variables to dataset, sampled from 2D-histogram
@@ -221,6 +296,7 @@ Ostap::Functions::add_var
  *  @param  histo   histogram to be sampled 
  *  @return the added variable 
  *  @see TH2::GetRandom2
+ *  @see Ostap::Utils::HistoSampler
  */
 // ============================================================================
 const RooAbsReal* 
@@ -232,46 +308,43 @@ Ostap::Functions::add_var
   const TH3&              histo   ) 
 {
   //
-  RooRealVar varx        { namex.c_str() , "" , 0.0 } ;
-  RooRealVar vary        { namey.c_str() , "" , 0.0 } ;
-  RooRealVar varz        { namez.c_str() , "" , 0.0 } ;
-  //
-  RooArgSet  varset      { varx, vary , varz ,"one var" } ;
-  RooDataSet new_dataset { "" , ""       , varset   } ;
-  //
-  double value_x = 0 ;
-  double value_y = 0 ;
-  double value_z = 0 ;
-  //
-  TH3* h3 = const_cast<TH3*> ( &histo) ;
+  // sample the histogram block-wise for all events in the input data set 
+  RooRealVar varx { namex.c_str() , "" , 0.0 } ;
+  RooRealVar vary { namey.c_str() , "" , 0.0 } ;
+  RooRealVar varz { namez.c_str() , "" , 0.0 } ;
+  if ( _add_sampled_ ( dataset , RooArgList ( varx , vary , varz ) , histo ).isFailure() ) { return nullptr ; }
   //
-  // loop over events in the input data set 
-  const unsigned long nEntries = dataset.numEntries() ;
-  for ( unsigned long entry = 0 ; entry < nEntries ; ++entry )   
-  {
-    //
-    if ( 0 == dataset.get( entry)  ) { break ; }                    // BREAK
-    //
-    // calculate the function 
-    h3->GetRandom3 ( value_x , value_y , value_z ) ;
-    // 
-    varx.setVal ( value_x ) ;
-    vary.setVal ( value_y ) ;
-    varz.setVal ( value_z ) ;
-    //
-    new_dataset.add ( varset ) ;
-  }
-  // 
-  // merge  two  datasets 
-  dataset.merge ( &new_dataset ) ;
-  //
-  const RooArgSet*  vars = dataset.get( 0 ) ;
-  if ( nullptr == vars ) { return nullptr ; }
-  //
-  const RooAbsArg*  nvar = vars->find ( namez.c_str() );
-  if  ( nullptr == nvar ) { return nullptr ; }
-  //
-  return dynamic_cast<const RooAbsReal*> ( nvar ) ;   
+  return _added_var_ ( dataset , namez ) ;
+}
+// ============================================================================
+/*  add new columns to the dataset, filled from the array of values
+ *  - for the vector-store datasets the columns are appended 
+ *    and filled in place: no intermediate dataset is created, 
+ *    and the memory grows only by the size of new columns 
+ *  - for other storage types the columns are merged to the dataset
+ *  @param  dataset (UPDATE) the dataset
+ *  @param  vars    (INPUT)  the variables (RooRealVar or RooCategory) to be added
+ *  @param  values  (INPUT)  the values, row-major: <code>values[entry*nvars+ivar]</code>
+ *  @return status code 
+ */
+// ============================================================================
+Ostap::StatusCode Ostap::Functions::add_columns 
+( RooDataSet&                dataset , 
+  const RooArgList&          vars    , 
+  const std::vector<double>& values  ) 
+{
+  const unsigned long      nvars    = vars.getSize()      ;
+  const unsigned long long nEntries = dataset.numEntries() ;
+  if ( 0 == nvars || 0 == nEntries           ) { return Ostap::StatusCode::SUCCESS ; }
+  if ( values.size() != nEntries * nvars     ) { return Ostap::StatusCode ( 910 )  ; }
+  //
+  return _add_columns_ 
+    ( dataset , vars , 
+      [&values,nvars,nEntries] ( const std::function<void(const double*)>& row ) 
+      {
+        for ( unsigned long long entry = 0 ; entry < nEntries ; ++entry ) 
+        { row ( values.data() + entry * nvars ) ; }
+      } ) ;
 }
 // ============================================================================
 //                                                                      The END 
@@ -7,12 +7,15 @@
 #include <cmath>
 #include <limits>
 #include <sstream>
+#include <vector>
+#include <algorithm>
 // =============================================================================
 // GSL
 // =============================================================================
 #include "gsl/gsl_errno.h"
 #include "gsl/gsl_vector.h"
 #include "gsl/gsl_multimin.h"
+#include "gsl/gsl_linalg.h"
 // =============================================================================
 // Ostap
 // =============================================================================
@@ -159,7 +162,7 @@ namespace
   inline Chi2::VE term_chi2 
   ( Chi2::VE             res   ,    
     const Chi2::CMPS&    cmps  , 
-    const unsigned short index , 
+    const std::size_t    index , 
     const gsl_vector*    x     ) 
   {
     //
@@ -181,7 +184,7 @@ namespace
   void term_grad 
   ( const Chi2::VE&      res   , 
     const Chi2::CMPS&    cmps  , 
-    const unsigned short index , 
+    const std::size_t    index , 
     const gsl_vector*    x     ,
     gsl_vector*          g     )
   {
@@ -220,7 +223,7 @@ namespace
   void term_hesse
   ( const Chi2::VE&      res   , 
     const Chi2::CMPS&    cmps  , 
-    const unsigned short index , 
+    const std::size_t    index , 
     const gsl_vector*    x     ,
     gsl_matrix*          h     )
   {
@@ -540,6 +543,417 @@ namespace
     return sc ;
   }
   // ==========================================================================
+  /** @class LinearChi2
+   *  Direct solution of the chi2-fit:
+   *  chi2 is quadratic in parameters if the uncertainties of components 
+   *  are neglected, therefore the fit is reduced to the weighted linear 
+   *  least squares problem, solved via the normal equations and 
+   *  Cholesky decomposition. The uncertainties of components are taken 
+   *  into account via the iterative reweighting: the weights are 
+   *  recalculated using the current solution and the problem is solved again.
+   *  - optionally the non-negative solution is found using Lawson-Hanson 
+   *    active-set algorithm  
+   */
+  class LinearChi2 
+  {
+  public:
+    // ========================================================================
+    typedef Ostap::Math::Chi2Fit::VE    VE   ;
+    typedef Ostap::Math::Chi2Fit::DATA  DATA ;
+    typedef Ostap::Math::Chi2Fit::CMPS  CMPS ;
+    // ========================================================================
+  public:
+    // ========================================================================
+    LinearChi2 ( const Ostap::Math::Chi2Fit& fit ) 
+      : m_fit        ( &fit  ) 
+      , m_solution   ( 0     ) 
+      , m_covariance ( 0     ) 
+      , m_chi2       ( s_Inf ) 
+      , m_calls      ( 0     ) 
+      , m_iter       ( 0     ) 
+      , m_points     ( 0     )
+    {}
+    // ========================================================================
+    ~LinearChi2 () 
+    {
+      if ( 0 != m_solution   ) 
+      { gsl_vector_free ( m_solution   ) ; m_solution   = 0 ; }
+      if ( 0 != m_covariance ) 
+      { gsl_matrix_free ( m_covariance ) ; m_covariance = 0 ; }
+    }
+    // ========================================================================
+    LinearChi2 ( const LinearChi2& ) = delete ;
+    LinearChi2& operator=( const LinearChi2& ) = delete ;
+    // ========================================================================
+  public:
+    // ========================================================================
+    /** perform the fit 
+     *  @param nonnegative use non-negative least squares 
+     */
+    Ostap::StatusCode fit ( const bool nonnegative ) ;
+    // ========================================================================
+  public:
+    // ========================================================================
+    const gsl_vector* solution   () const { return m_solution   ; }
+    const gsl_matrix* covariance () const { return m_covariance ; }    
+    double            chi2       () const { return m_chi2       ; }
+    /// number of linear solutions (Cholesky decompositions)
+    std::size_t       calls      () const { return m_calls      ; }
+    std::size_t       iters      () const { return m_iter       ; }
+    std::size_t       points     () const { return m_points     ; }
+    // ========================================================================
+  private:
+    // ========================================================================
+    /** build the normal equations  \f$ G x = b \f$ 
+     *  using the weights, calculated at the point x
+     */
+    void normal 
+    ( const gsl_vector*    x , 
+      std::vector<double>& G , 
+      std::vector<double>& b ) ;
+    /// calculate chi2 at point x 
+    double chi2 ( const gsl_vector* x ) ;
+    /** solve the (sub)system of the normal equations using 
+     *  Cholesky decomposition, optionally calculate the inverse 
+     *  @param G     (INPUT)  the full matrix 
+     *  @param b     (INPUT)  the full right-hand side 
+     *  @param index (INPUT)  the indices of subsystem 
+     *  @param z     (OUTPUT) the solution of subsystem (full size)
+     *  @param cov   (OUTPUT) the inverse of the matrix of subsystem (full size) 
+     */
+    Ostap::StatusCode solve 
+    ( const std::vector<double>&       G     , 
+      const std::vector<double>&       b     , 
+      const std::vector<unsigned int>& index , 
+      std::vector<double>&             z     , 
+      gsl_matrix*                      cov   = 0 ) ;
+    /// non-negative least squares: Lawson-Hanson algorithm 
+    Ostap::StatusCode nnls
+    ( const std::vector<double>&       G     , 
+      const std::vector<double>&       b     , 
+      std::vector<double>&             x     , 
+      std::vector<unsigned int>&       index ) ;
+    // ========================================================================
+  private:
+    // ========================================================================
+    const Ostap::Math::Chi2Fit* m_fit        ;
+    /// the solution 
+    gsl_vector*                 m_solution   ;
+    /// the covariance 
+    gsl_matrix*                 m_covariance ;
+    //
+    double      m_chi2   ;
+    std::size_t m_calls  ;
+    std::size_t m_iter   ;
+    std::size_t m_points ;
+    // ========================================================================
+  } ;
+  // ==========================================================================
+  // build the normal equations using the weights, calculated at the point x
+  // ==========================================================================
+  void LinearChi2::normal 
+  ( const gsl_vector*    x , 
+    std::vector<double>& G , 
+    std::vector<double>& b ) 
+  {
+    const DATA& data = m_fit -> data () ;
+    const CMPS& cmps = m_fit -> cmps () ;
+    const std::size_t M = cmps.size () ;
+    //
+    G.assign ( M * M , 0.0 ) ;
+    b.assign ( M     , 0.0 ) ;
+    //
+    // non-zero elements of the row 
+    std::vector<unsigned int> nz  ; nz .reserve ( M ) ;
+    std::vector<double>       row ; row.reserve ( M ) ;
+    //
+    for ( std::size_t i = 0 ; i < data.size() ; ++i ) 
+    {
+      const VE res = term_chi2 ( data [ i ] , cmps , i , x ) ;
+      if ( 0 >= res.cov2 () ) { continue ; }                       // CONTINUE
+      const double w  = 1.0 / res.cov2 () ;
+      const double wy = w * data [ i ].value () ;
+      //
+      nz .clear () ;
+      row.clear () ;
+      for ( unsigned int j = 0 ; j < M ; ++j ) 
+      {
+        const double c = cmps [ j ][ i ].value () ;
+        if ( 0 == c ) { continue ; }
+        nz .push_back ( j ) ;
+        row.push_back ( c ) ;
+      }
+      //
+      // update the upper triangle and the right-hand side 
+      const std::size_t n = nz.size () ;
+      for ( std::size_t p = 0 ; p < n ; ++p ) 
+      {
+        const double wcp = w * row [ p ] ;
+        b [ nz [ p ] ] += wy * row [ p ] ;
+        double* Gp = &G [ nz [ p ] * M ] ;
+        for ( std::size_t q = p ; q < n ; ++q ) { Gp [ nz [ q ] ] += wcp * row [ q ] ; }
+      }
+    }
+    //
+    // symmetrize
+    for ( std::size_t j = 0 ; j < M ; ++j ) 
+    { for ( std::size_t k = j + 1 ; k < M ; ++k ) { G [ k * M + j ] = G [ j * M + k ] ; } }
+  }
+  // ==========================================================================
+  // calculate chi2 at point x 
+  // ==========================================================================
+  double LinearChi2::chi2 ( const gsl_vector* x ) 
+  {
+    const DATA& data = m_fit -> data () ;
+    const CMPS& cmps = m_fit -> cmps () ;
+    //
+    m_points    = 0 ;
+    double chi2 = 0 ;
+    for ( std::size_t i = 0 ; i < data.size() ; ++ i ) 
+    {
+      const VE res = term_chi2 ( data [ i ] , cmps , i , x ) ;
+      if ( 0 >= res.cov2() ) { continue ; }                        // CONTINUE 
+      chi2 += res.value() * res.value() / res.cov2() ; 
+      ++m_points ;
+    }
+    return chi2 ;
+  }
+  // ==========================================================================
+  // solve the (sub)system of the normal equations
+  // ==========================================================================
+  Ostap::StatusCode LinearChi2::solve 
+  ( const std::vector<double>&       G     , 
+    const std::vector<double>&       b     , 
+    const std::vector<unsigned int>& index , 
+    std::vector<double>&             z     , 
+    gsl_matrix*                      cov   ) 
+  {
+    //
+    ++m_calls ;
+    //
+    const std::size_t M = b.size     () ;
+    const std::size_t n = index.size () ;
+    //
+    z.assign ( M , 0.0 ) ;
+    if ( 0 != cov ) { gsl_matrix_set_zero ( cov ) ; }
+    if ( 0 == n   ) { return Ostap::StatusCode::SUCCESS ; }
+    //
+    gsl_matrix* A = gsl_matrix_alloc ( n , n ) ;
+    gsl_vector* r = gsl_vector_alloc ( n ) ;
+    gsl_vector* s = gsl_vector_alloc ( n ) ;
+    //
+    for ( std::size_t p = 0 ; p < n ; ++p ) 
+    {
+      gsl_vector_set ( r , p , b [ index [ p ] ] ) ;
+      for ( std::size_t q = 0 ; q < n ; ++q ) 
+      { gsl_matrix_set ( A , p , q , G [ index [ p ] * M + index [ q ] ] ) ; }
+    }
+    //
+    Ostap::StatusCode sc = Ostap::StatusCode::SUCCESS ;
+    //
+    int ierror = gsl_linalg_cholesky_decomp ( A ) ;
+    if ( ierror ) 
+    { 
+      gsl_error ( "Chi2Fit: error from Cholesky decomposition" , 
+                  __FILE__ , __LINE__ , ierror ) ;
+      sc = 400 + ierror ; 
+    }
+    //
+    if ( sc.isSuccess() ) 
+    {
+      ierror = gsl_linalg_cholesky_solve ( A , r , s ) ;
+      if ( ierror ) 
+      {
+        gsl_error ( "Chi2Fit: error from Cholesky solve" , 
+                    __FILE__ , __LINE__ , ierror ) ;
+        sc = 500 + ierror ; 
+      }
+      else 
+      { for ( std::size_t p = 0 ; p < n ; ++p ) { z [ index [ p ] ] = gsl_vector_get ( s , p ) ; } }
+    }
+    //
+    if ( sc.isSuccess() && 0 != cov ) 
+    {
+      ierror = gsl_linalg_cholesky_invert ( A ) ;
+      if ( ierror ) 
+      {
+        gsl_error ( "Chi2Fit: error from Cholesky invert" , 
+                    __FILE__ , __LINE__ , ierror ) ;
+        sc = 600 + ierror ; 
+      }
+      else 
+      {
+        for ( std::size_t p = 0 ; p < n ; ++p ) 
+        { for ( std::size_t q = 0 ; q < n ; ++q ) 
+          { gsl_matrix_set ( cov , index [ p ] , index [ q ] , gsl_matrix_get ( A , p , q ) ) ; } }
+      }
+    }
+    //
+    gsl_vector_free ( s ) ;
+    gsl_vector_free ( r ) ;
+    gsl_matrix_free ( A ) ;
+    //
+    return sc ;
+  }
+  // ==========================================================================
+  // non-negative least squares: Lawson-Hanson algorithm 
+  // ==========================================================================
+  Ostap::StatusCode LinearChi2::nnls
+  ( const std::vector<double>&       G     , 
+    const std::vector<double>&       b     , 
+    std::vector<double>&             x     , 
+    std::vector<unsigned int>&       index ) 
+  {
+    const std::size_t M = b.size () ;
+    //
+    x.assign ( M , 0.0 ) ;
+    index.clear () ;
+    //
+    double bmax = 0 ;
+    for ( const double v : b ) { bmax = std::max ( bmax , std::abs ( v ) ) ; }
+    const double tolerance = 1.e-10 * std::max ( bmax , 1.0 ) ;
+    //
+    std::vector<bool>   passive ( M , false ) ;
+    std::vector<bool>   blocked ( M , false ) ;
+    std::vector<double> w       ( M ) ;
+    std::vector<double> z       ( M ) ;
+    //
+    const unsigned int maxiter = 3 * M + 10 ;
+    unsigned int       iter    = 0 ;
+    while ( iter < maxiter ) 
+    {
+      // the gradient: w = b - G x 
+      for ( std::size_t j = 0 ; j < M ; ++j ) 
+      {
+        double v = b [ j ] ;
+        for ( std::size_t k = 0 ; k < M ; ++k ) { v -= G [ j * M + k ] * x [ k ] ; }
+        w [ j ] = v ;
+      }
+      // find the most promising parameter at the bound 
+      std::size_t t    = M ;
+      double      wmax = tolerance ;
+      for ( std::size_t j = 0 ; j < M ; ++j ) 
+      { if ( !passive [ j ] && !blocked [ j ] && wmax < w [ j ] ) { wmax = w [ j ] ; t = j ; } }
+      if ( M == t ) { break ; }                                        // BREAK
+      //
+      passive [ t ] = true ;
+      index.push_back ( t ) ;
+      //
+      // inner loop: keep the solution feasible 
+      bool first = true ;
+      while ( iter++ < maxiter ) 
+      {
+        Ostap::StatusCode sc = solve ( G , b , index , z ) ;
+        if ( sc.isFailure() ) { return sc ; }                          // RETURN
+        //
+        // the new parameter does not improve: block it till the next move 
+        if ( first && z [ t ] <= tolerance ) 
+        {
+          passive [ t ] = false ;
+          blocked [ t ] = true  ;
+          index.pop_back () ;
+          break ;                                                      // BREAK
+        }
+        first = false ;
+        std::fill ( blocked.begin () , blocked.end () , false ) ;
+        //
+        double alpha = 2 ;
+        for ( const unsigned int j : index ) 
+        {
+          if ( 0 < z [ j ] ) { continue ; }
+          const double d = x [ j ] - z [ j ] ;
+          const double a = 0 < d ? x [ j ] / d : 0.0 ;
+          alpha = std::min ( alpha , a ) ;
+        }
+        //
+        if ( 1 < alpha ) { x = z ; break ; }                           // BREAK
+        //
+        // move towards z and release the parameters that hit the bound
+        for ( const unsigned int j : index ) 
+        { x [ j ] += alpha * ( z [ j ] - x [ j ] ) ; }
+        std::vector<unsigned int> keep ;
+        for ( const unsigned int j : index ) 
+        {
+          if ( tolerance < x [ j ] ) { keep.push_back ( j ) ; }
+          else { x [ j ] = 0 ; passive [ j ] = false ; }
+        }
+        index.swap ( keep ) ;
+      }
+    }
+    //
+    if ( maxiter <= iter ) 
+    {
+      gsl_error ( "Chi2Fit: too many NNLS iterations" , 
+                  __FILE__ , __LINE__ , GSL_EMAXITER ) ;
+      return 300 + GSL_EMAXITER ;
+    }
+    //
+    std::sort ( index.begin () , index.end () ) ;
+    return Ostap::StatusCode::SUCCESS ;
+  }
+  // ==========================================================================
+  // perform the fit 
+  // ==========================================================================
+  Ostap::StatusCode LinearChi2::fit ( const bool nonnegative ) 
+  {
+    //
+    Ostap::Math::GSL::GSL_Error_Handler sentry ;
+    //
+    const std::size_t M = m_fit->cmps().size() ;
+    if ( 0 == M ) { return 700 ; }
+    //
+    // are there uncertainties in the components ? 
+    bool errors = false ;
+    for ( const DATA& c : m_fit->cmps() ) 
+    { for ( const VE& v : c ) { if ( 0 < v.cov2() ) { errors = true ; break ; } } 
+      if ( errors ) { break ; } }
+    //
+    std::vector<double>       G , b , x ;
+    std::vector<unsigned int> index ;
+    //
+    // start with the weights defined by the data uncertainties only 
+    m_solution   = gsl_vector_calloc ( M     ) ;
+    m_covariance = gsl_matrix_calloc ( M , M ) ;
+    //
+    Ostap::StatusCode sc = Ostap::StatusCode::SUCCESS ;
+    double chi2_old = s_Inf ;
+    //
+    // iterative reweighting, single iteration if components have no uncertainties 
+    const std::size_t maxiter = errors ? 50 : 1 ;
+    for ( m_iter = 1 ; m_iter <= maxiter ; ++m_iter ) 
+    {
+      //
+      normal ( m_solution , G , b ) ;
+      //
+      if ( nonnegative ) 
+      { 
+        // find the active set and get the covariance for the free parameters 
+        sc = nnls ( G , b , x , index ) ;
+        if ( sc.isSuccess() ) { sc = solve ( G , b , index , x , m_covariance ) ; }
+      }
+      else 
+      {
+        // parameters and covariance from the single decomposition
+        index.resize ( M ) ;
+        for ( unsigned int j = 0 ; j < M ; ++j ) { index [ j ] = j ; }
+        sc = solve ( G , b , index , x , m_covariance ) ;
+      }
+      if ( sc.isFailure() ) { break ; }                                // BREAK
+      //
+      for ( unsigned int j = 0 ; j < M ; ++j ) { gsl_vector_set ( m_solution , j , x [ j ] ) ; }
+      //
+      m_chi2 = chi2 ( m_solution ) ;
+      const bool converged = 
+        std::abs ( m_chi2 - chi2_old ) <= 1.e-8 * std::max ( 1.0 , m_chi2 ) ;
+      chi2_old = m_chi2 ;
+      if ( converged ) { break ; }                                     // BREAK 
+    }
+    //
+    m_iter = std::min ( m_iter , maxiter ) ;
+    //
+    return sc ;
+  }
+  // ==========================================================================
 } //                                                  end of anonymous namespace 
 // ============================================================================
 // constructor 
@@ -598,63 +1012,30 @@ namespace
 Ostap::Math::Chi2Fit::Chi2Fit 
 ( const Ostap::Math::Chi2Fit::DATA& data , 
   const Ostap::Math::Chi2Fit::DATA& cmps )
-//
-  : m_data (     data )
-  , m_cmps ( 1 , cmps ) 
-  , m_init () 
-//
-  , m_code ( Ostap::StatusCode::SUCCESS ) 
-  , m_solu ( 0 ) 
-  , m_cov2 ( 0 ) 
-//
-  , m_chi2   ( s_Inf )
-  , m_calls  ( 0 )
-  , m_iters  ( 0 )
-  , m_points ( 0 )
-{
-  //
-  // adjust the components and get the init values  
-  for ( CMPS::iterator icmp = m_cmps.begin() ; m_cmps.end () != icmp ; ++icmp ) 
-  { m_init.push_back ( _adjust_ ( m_data , *icmp , m_cmps.size() ) ) ; }
-  //  
-  Chi2 c2 ( *this ) ;
-  //
-  m_code = c2.fit () ;
-  //
-  if ( m_code.isSuccess() ) 
-  {
-    m_chi2   = c2.chi2    () ;
-    m_calls  =
-      c2.calls_f      () + 
-      c2.calls_df     () + 
-      c2.calls_fdf    () +
-      c2.calls_fdfddf () ;
-    m_iters  = c2.iters   () ;
-    m_points = c2.points  () ;
-    //
-    if ( 0 != c2.covariance () )
-    {
-      gsl_matrix* cov2 = gsl_matrix_alloc ( size() , size() ) ;
-      gsl_matrix_memcpy ( cov2 , c2.covariance () ) ;
-      m_cov2 = cov2 ;
-    }
-    //
-    if ( 0 != c2.solution() ) 
-    {
-      gsl_vector* solu  = gsl_vector_alloc ( size() ) ;
-      gsl_vector_memcpy ( solu , c2.solution () ) ;      
-      m_solu = solu ;
-    }
-    //
-  }  
-}
+  : Chi2Fit ( data , CMPS ( 1 , cmps ) , Minimize ) 
+{}
 // ============================================================================
 Ostap::Math::Chi2Fit::Chi2Fit 
 ( const Ostap::Math::Chi2Fit::DATA& data , 
   const Ostap::Math::Chi2Fit::CMPS& cmps )
-  : m_data ( data )
-  , m_cmps ( cmps ) 
-  , m_init () 
+  : Chi2Fit ( data , cmps , Minimize ) 
+{}
+// ============================================================================
+Ostap::Math::Chi2Fit::Chi2Fit 
+( const Ostap::Math::Chi2Fit::DATA&   data   , 
+  const Ostap::Math::Chi2Fit::DATA&   cmps   , 
+  const Ostap::Math::Chi2Fit::Method  method )
+  : Chi2Fit ( data , CMPS ( 1 , cmps ) , method ) 
+{}
+// ============================================================================
+Ostap::Math::Chi2Fit::Chi2Fit 
+( const Ostap::Math::Chi2Fit::DATA&   data   , 
+  const Ostap::Math::Chi2Fit::CMPS&   cmps   , 
+  const Ostap::Math::Chi2Fit::Method  method )
+  : m_data   ( data   )
+  , m_cmps   ( cmps   ) 
+  , m_init   () 
+  , m_method ( method ) 
 //
   , m_code ( Ostap::StatusCode::SUCCESS ) 
   , m_solu ( 0 ) 
@@ -671,28 +1052,57 @@ Ostap::Math::Chi2Fit::Chi2Fit
   for ( CMPS::iterator icmp = m_cmps.begin() ; m_cmps.end () != icmp ; ++icmp ) 
   { m_init.push_back ( _adjust_ ( m_data , *icmp , m_cmps.size () ) ) ; }
   //
-  Chi2 c2 ( *this ) ;
+  const gsl_vector* solution   = 0 ;
+  const gsl_matrix* covariance = 0 ;
+  //
+  Chi2       c2 ( *this ) ;
+  LinearChi2 lc ( *this ) ;
   //
-  m_code  = c2.fit   () ;
+  if ( Minimize == m_method ) 
+  {
+    m_code = c2.fit   () ;
+    if ( m_code.isSuccess() ) 
+    {
+      m_chi2     = c2.chi2    () ;
+      m_calls    = 
+        c2.calls_f      () + 
+        c2.calls_df     () + 
+        c2.calls_fdf    () +
+        c2.calls_fdfddf () ;
+      m_iters    = c2.iters   () ;
+      m_points   = c2.points  () ;
+      solution   = c2.solution   () ;
+      covariance = c2.covariance () ;
+    }
+  }
+  else 
+  {
+    m_code = lc.fit ( NonNegative == m_method ) ;
+    if ( m_code.isSuccess() ) 
+    {
+      m_chi2     = lc.chi2    () ;
+      m_calls    = lc.calls   () ;
+      m_iters    = lc.iters   () ;
+      m_points   = lc.points  () ;
+      solution   = lc.solution   () ;
+      covariance = lc.covariance () ;
+    }
+  }
   //
   if ( m_code.isSuccess() ) 
   {
-    m_chi2   = c2.chi2    () ;
-    m_calls  = c2.calls_f () + c2.calls_df () + c2.calls_fdf () ;
-    m_iters  = c2.iters   () ;
-    m_points = c2.points  () ;
     //
-    if ( 0 != c2.covariance () )
+    if ( 0 != covariance )
     {
       gsl_matrix* cov2 = gsl_matrix_alloc ( size() , size() ) ;
-      gsl_matrix_memcpy ( cov2 , c2.covariance () ) ;
+      gsl_matrix_memcpy ( cov2 , covariance ) ;
       m_cov2 = cov2 ;
     }
     //
-    if ( 0 != c2.solution() ) 
+    if ( 0 != solution ) 
     {
       gsl_vector* solu  = gsl_vector_alloc ( size() ) ;
-      gsl_vector_memcpy ( solu , c2.solution () ) ;      
+      gsl_vector_memcpy ( solu , solution ) ;      
       m_solu = solu ;
     }
     //
@@ -799,7 +1209,10 @@ Ostap::Math::Chi2Fit::fillStream ( std::ostream& s ) const
     << "  #iters    : " << niters ()          << std::endl
     << "  #points   : " << points ()          << std::endl
     << "  #size     : " << size   ()          << std::endl
-    << "  #dof      : " << points () - size() << std::endl ;
+    << "  #dof      : " << points () - size() << std::endl 
+    << "  Method    : " << ( Minimize    == m_method ? "Minimize"    :
+                             Linear      == m_method ? "Linear"      : 
+                             NonNegative == m_method ? "NonNegative" : "Unknown" ) << std::endl ;
   
   if ( m_code.isSuccess () && 
        0 !=  m_solu        && 
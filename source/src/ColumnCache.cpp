@@ -0,0 +1,455 @@
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <map>
+#include <set>
+#include <mutex>
+#include <atomic>
+#include <cstring>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <algorithm>
+#include <tuple>
+// ============================================================================
+// POSIX
+// ============================================================================
+#include <fcntl.h>
+#include <utime.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+// ============================================================================
+// ROOT
+// ============================================================================
+#include "TTree.h"
+#include "TString.h"
+#include "TSystem.h"
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/ColumnCache.h"
+// ============================================================================
+// Local
+// ============================================================================
+#include "syncedcache.h"
+#include "local_cache.h"
+#include "local_tree.h"
+// ============================================================================
+/** @file
+ *  Implementation file for class Ostap::Trees::ColumnCache
+ *  @see Ostap::Trees::ColumnCache
+ *  @author agent agent@local
+ *  @date   2026-10-19
+ */
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  typedef Ostap::Trees::ColumnCache::Column   Column  ;
+  typedef Ostap::Trees::ColumnCache::COLUMN   COLUMN  ;
+  typedef Ostap::Trees::ColumnCache::COLUMNS  COLUMNS ;
+  typedef std::map<std::string,COLUMN>        CMAP    ;
+  typedef SyncedCache<CMAP>                   CCACHE  ;
+  // ==========================================================================
+  /// the in-memory cache of columns
+  CCACHE            s_columns   {}        ;
+  /// the maximal size of in-memory cache
+  const std::size_t s_CACHESIZE = 1000    ;
+  /// is the cache enabled?
+  std::atomic<bool> s_enabled   { false } ;
+  /// the cache directory (empty: not yet defined)
+  std::string       s_directory {}        ;
+  /// the mutex for the cache directory
+  std::mutex        s_dirmutex  {}        ;
+  /// the maximal size of the persistent cache (bytes)
+  std::atomic<unsigned long long> s_maxsize { 4ULL << 30 } ;
+  /// the maximal size is taken from the environment?
+  std::once_flag    s_sizeflag  {}        ;
+  /// the extension of the persistent columns
+  const std::string s_EXT       = ".col"  ;
+  /// the signature of the persistent column (16 bytes)
+  const char        s_MAGIC [ 16 ] = "OSTAP-COLUMN-1\n" ;
+  /// the alignment of the data
+  const std::size_t s_ALIGN     = 64      ;
+  // ==========================================================================
+  /** the length of the header:
+   *  signature, number of entries, length of the key, the key
+   *  and the padding for the proper alignment of data
+   */
+  inline std::size_t _header_length_ ( const std::size_t keylen )
+  {
+    const std::size_t n = sizeof ( s_MAGIC ) + 2 * sizeof ( std::uint64_t ) + keylen ;
+    return ( ( n + s_ALIGN - 1 ) / s_ALIGN ) * s_ALIGN ;
+  }
+  // ==========================================================================
+  /// the header of the persistent column
+  std::string _header_
+  ( const std::string&  key     ,
+    const unsigned long entries )
+  {
+    std::string header ( _header_length_ ( key.size () ) , '\0' ) ;
+    const std::uint64_t n = entries      ;
+    const std::uint64_t k = key.size ()  ;
+    char* p = &header [ 0 ] ;
+    std::memcpy ( p , s_MAGIC , sizeof ( s_MAGIC ) ) ; p += sizeof ( s_MAGIC ) ;
+    std::memcpy ( p , &n      , sizeof ( n       ) ) ; p += sizeof ( n       ) ;
+    std::memcpy ( p , &k      , sizeof ( k       ) ) ; p += sizeof ( k       ) ;
+    std::memcpy ( p , key.data () , key.size ()  ) ;
+    return header ;
+  }
+  // ==========================================================================
+  /** the default cache directory, the first writable from
+   *  - <code>$OSTAP_COLUMN_CACHE</code>
+   *  - <code>$OSTAP_DIR/cache/columns</code> (or <code>$HOME/.ostap/cache/columns</code>)
+   *  - <code>$TMPDIR/ostap_columns_$UID</code>
+   *  @return the directory, empty string if none is writable
+   */
+  std::string _default_directory_ ()
+  {
+    std::vector<std::string> dirs {} ;
+    const char* env = gSystem->Getenv ( "OSTAP_COLUMN_CACHE" ) ;
+    if ( env && *env ) { dirs.push_back ( env ) ; }
+    const char* odir = gSystem->Getenv ( "OSTAP_DIR" ) ;
+    if ( !odir || !*odir ) { odir = gSystem->Getenv ( "OSTAPDIR" ) ; }
+    if (  odir &&  *odir ) { dirs.push_back ( std::string ( odir ) + "/cache/columns" ) ; }
+    else { dirs.push_back ( std::string ( gSystem->HomeDirectory () ) + "/.ostap/cache/columns" ) ; }
+    dirs.push_back ( std::string ( gSystem->TempDirectory () ) + "/ostap_columns_" +
+                     std::to_string ( gSystem->GetUid () ) ) ;
+    //
+    for ( const std::string& d : dirs )
+    {
+      TString dir ( d.c_str () ) ;
+      gSystem->ExpandPathName ( dir ) ;
+      if ( cache_directory ( dir.Data () ) ) { return dir.Data () ; } // RETURN
+    }
+    return "" ;
+  }
+  // ==========================================================================
+  /** make room in the cache directory for the new columns:
+   *  the least recently used columns are removed until the total
+   *  size of the cache with the new columns does not exceed the limit
+   *  @param dir   the cache directory
+   *  @param size  the size of the new columns
+   *  @param keep  the columns that are not removed
+   *  @return true if the new columns fit into the cache
+   */
+  bool _shrink_
+  ( const std::string&           dir  ,
+    const unsigned long long     size ,
+    const std::set<std::string>& keep )
+  {
+    const unsigned long long maxsize = Ostap::Trees::ColumnCache::maxSize () ;
+    if ( maxsize < size ) { return false ; }                         // RETURN
+    //
+    DIR* d = ::opendir ( dir.c_str () ) ;
+    if ( !d ) { return false ; }                                     // RETURN
+    // ( modification time , size , path )
+    std::vector<std::tuple<long,unsigned long long,std::string>> files {} ;
+    unsigned long long total = 0 ;
+    while ( const struct dirent* e = ::readdir ( d ) )
+    {
+      const std::string name ( e->d_name ) ;
+      if ( name.size () <= s_EXT.size () ||
+           0 != name.compare ( name.size () - s_EXT.size () , s_EXT.size () , s_EXT ) ) { continue ; }
+      const std::string path = dir + "/" + name ;
+      struct stat st ;
+      if ( 0 != ::stat ( path.c_str () , &st ) ) { continue ; }      // CONTINUE
+      total += st.st_size ;
+      if ( keep.end () == keep.find ( path ) )
+      { files.emplace_back ( st.st_mtime , st.st_size , path ) ; }
+    }
+    ::closedir ( d ) ;
+    //
+    std::sort ( files.begin () , files.end () ) ;
+    for ( const auto& f : files )
+    {
+      if ( total + size <= maxsize ) { break ; }                     // BREAK
+      if ( 0 == ::unlink ( std::get<2> ( f ).c_str () ) ) { total -= std::get<1> ( f ) ; }
+    }
+    return total + size <= maxsize ;
+  }
+  // ==========================================================================
+  /// put the column into the in-memory cache
+  void _put_ ( const std::string& key , const COLUMN& column )
+  {
+    CCACHE::Lock lock { s_columns.mutex () } ;
+    if ( s_CACHESIZE < s_columns->size () ) { s_columns->clear () ; }
+    s_columns->operator[] ( key ) = column ;
+  }
+  // ==========================================================================
+  /** build the missing columns in one pass over the tree
+   *  @param tree    the tree
+   *  @param names   the branch names
+   *  @param keys    the keys of columns
+   *  @param dir     the cache directory
+   *  @param keep    the cached columns that are not removed
+   *  @return the columns, empty vector in case of failure,
+   *          if the cache directory is not writable
+   *          or the columns do not fit into the cache
+   */
+  COLUMNS _build_
+  ( TTree*                          tree  ,
+    const std::vector<std::string>& names ,
+    const std::vector<std::string>& keys  ,
+    const std::string&              dir   ,
+    const std::set<std::string>&    keep  )
+  {
+    // no in-memory copies of the full columns: nothing to cache
+    if ( dir.empty () || !cache_directory ( dir ) ) { return COLUMNS () ; }
+    //
+    const unsigned long N       = names.size ()       ;
+    const unsigned long entries = tree->GetEntries () ;
+    //
+    unsigned long long size = 0 ;
+    for ( unsigned long i = 0 ; i < N ; ++i )
+    { size += _header_length_ ( keys [ i ].size () ) + entries * sizeof ( double ) ; }
+    if ( !_shrink_ ( dir , size , keep ) ) { return COLUMNS () ; }   // RETURN
+    //
+    std::vector<std::string>                    paths   ( N ) ;
+    std::vector<std::string>                    tmps    ( N ) ;
+    std::vector<std::unique_ptr<std::ofstream>> outputs ( N ) ;
+    //
+    for ( unsigned long i = 0 ; i < N ; ++i )
+    {
+      paths   [ i ] = cache_path     ( dir , keys [ i ] , s_EXT ) ;
+      tmps    [ i ] = temporary_path ( paths [ i ] ) ;
+      outputs [ i ].reset ( new std::ofstream ( tmps [ i ] , std::ios::binary ) ) ;
+      *outputs [ i ] << _header_ ( keys [ i ] , entries ) ;
+    }
+    //
+    // read all columns in one pass
+    Columns       columns ( tree , names , 16 * Columns::BlockSize , false ) ;
+    unsigned long entry = 0 ;
+    while ( entry < entries )
+    {
+      const unsigned long n = columns.read ( entry , entries ) ;
+      if ( 0 == n ) { break ; }                                      // BREAK
+      for ( unsigned long i = 0 ; i < N ; ++i )
+      {
+        const double* c = columns.column ( i ) ;
+        outputs [ i ]->write ( reinterpret_cast<const char*> ( c ) , n * sizeof ( double ) ) ;
+      }
+      entry += n ;
+    }
+    //
+    bool ok = entries == entry ;
+    COLUMNS result ( N ) ;
+    for ( unsigned long i = 0 ; i < N ; ++i )
+    {
+      outputs [ i ]->close () ;
+      ok = ok && !outputs [ i ]->fail () && 0 == gSystem->Rename ( tmps [ i ].c_str () , paths [ i ].c_str () ) ;
+      if ( !ok ) { gSystem->Unlink ( tmps [ i ].c_str () ) ; continue ; }
+      result [ i ] = std::make_shared<const Column> ( paths [ i ] , keys [ i ] ) ;
+      ok = result [ i ]->ok () ;
+    }
+    //
+    return ok ? result : COLUMNS () ;
+  }
+  // ==========================================================================
+} //                                                 end of anonymous namespace
+// ============================================================================
+/*  map the column from the file
+ *  @param path the file name
+ *  @param key  the expected key of the column
+ */
+// ============================================================================
+Ostap::Trees::ColumnCache::Column::Column
+( const std::string& path ,
+  const std::string& key  )
+{
+  const int fd = ::open ( path.c_str () , O_RDONLY ) ;
+  if ( fd < 0 ) { return ; }                                          // RETURN
+  //
+  struct stat st ;
+  const std::size_t hlen = _header_length_ ( key.size () ) ;
+  if ( 0 != ::fstat ( fd , &st ) || st.st_size < (off_t) hlen ) { ::close ( fd ) ; return ; }
+  //
+  void* map = ::mmap ( nullptr , st.st_size , PROT_READ , MAP_SHARED , fd , 0 ) ;
+  ::close ( fd ) ;
+  if ( MAP_FAILED == map ) { return ; }                               // RETURN
+  //
+  m_map    = map         ;
+  m_length = st.st_size  ;
+  //
+  // check the header
+  const char*   p = static_cast<const char*> ( map ) ;
+  std::uint64_t n = 0 ;
+  std::uint64_t k = 0 ;
+  std::memcpy ( &n , p + sizeof ( s_MAGIC )                     , sizeof ( n ) ) ;
+  std::memcpy ( &k , p + sizeof ( s_MAGIC ) + sizeof ( n )      , sizeof ( k ) ) ;
+  if ( 0 != std::memcmp ( p , s_MAGIC , sizeof ( s_MAGIC ) )        ) { return ; }
+  if ( key.size () != k                                              ) { return ; }
+  if ( 0 != key.compare ( 0 , k , p + sizeof ( s_MAGIC ) + 2 * sizeof ( n ) , k ) ) { return ; }
+  if ( m_length != hlen + n * sizeof ( double )                      ) { return ; }
+  //
+  ::madvise ( map , m_length , MADV_SEQUENTIAL ) ;
+  //
+  m_data = reinterpret_cast<const double*> ( p + hlen ) ;
+  m_size = n ;
+}
+// ============================================================================
+// destructor: unmap the file
+// ============================================================================
+Ostap::Trees::ColumnCache::Column::~Column ()
+{ if ( m_map ) { ::munmap ( m_map , m_length ) ; } }
+// ============================================================================
+/*  get the cached columns for the primitive scalar branches
+ *  (the missing columns are built in one pass over the tree)
+ *  @param tree  the tree
+ *  @param names the branch names
+ *  @return the columns (one per name), empty vector if the cache
+ *          is disabled, some branches are not primitive scalars,
+ *          the tree has the entry list or no input files,
+ *          the cache directory is not writable
+ *          or the columns do not fit into the cache
+ */
+// ============================================================================
+Ostap::Trees::ColumnCache::COLUMNS
+Ostap::Trees::ColumnCache::get
+( TTree*                          tree  ,
+  const std::vector<std::string>& names )
+{
+  if ( !s_enabled || !tree || names.empty () ) { return COLUMNS () ; }
+  if ( tree->GetEntryList ()                 ) { return COLUMNS () ; }
+  if ( !primitive_leaves ( tree , names )    ) { return COLUMNS () ; }
+  //
+  std::string       data  {} ;
+  const std::string input = tree_identity ( tree , data ) ;
+  if ( input.empty ()                        ) { return COLUMNS () ; }
+  const std::string dir   = directory () ;
+  if ( dir.empty ()                          ) { return COLUMNS () ; }
+  //
+  const unsigned long entries = tree->GetEntries () ;
+  const unsigned long N       = names.size ()       ;
+  //
+  std::vector<std::string> keys ( N ) ;
+  for ( unsigned long i = 0 ; i < N ; ++i ) { keys [ i ] = input + '|' + names [ i ] ; }
+  //
+  COLUMNS result ( N ) ;
+  // (1) in-memory cache
+  {
+    CCACHE::Lock lock { s_columns.mutex () } ;
+    for ( unsigned long i = 0 ; i < N ; ++i )
+    {
+      auto it = s_columns->find ( keys [ i ] ) ;
+      if ( s_columns->end () != it ) { result [ i ] = it->second ; }
+    }
+  }
+  //
+  // (2) persistent storage
+  std::vector<std::string>   missing     {} ;
+  std::vector<std::string>   missingkeys {} ;
+  std::vector<unsigned long> index       {} ;
+  std::set<std::string>      keep        {} ;
+  for ( unsigned long i = 0 ; i < N ; ++i )
+  {
+    const std::string path = cache_path ( dir , keys [ i ] , s_EXT ) ;
+    keep.insert ( path ) ;
+    if ( result [ i ] ) { continue ; }                                // CONTINUE
+    COLUMN c = std::make_shared<const Column> ( path , keys [ i ] ) ;
+    if ( c->ok () && entries == c->size () )
+    {
+      // the modification time marks the recently used columns
+      ::utime ( path.c_str () , nullptr ) ;
+      _put_ ( keys [ i ] , c ) ;
+      result [ i ] = c ;
+      continue ;                                                     // CONTINUE
+    }
+    missing    .push_back ( names [ i ] ) ;
+    missingkeys.push_back ( keys  [ i ] ) ;
+    index      .push_back ( i           ) ;
+  }
+  if ( missing.empty () ) { return result ; }                        // RETURN
+  //
+  // (3) build the missing columns
+  COLUMNS built = _build_ ( tree , missing , missingkeys , dir , keep ) ;
+  if ( built.empty () ) { return COLUMNS () ; }                      // RETURN
+  for ( unsigned long j = 0 ; j < built.size () ; ++j )
+  {
+    _put_ ( missingkeys [ j ] , built [ j ] ) ;
+    result [ index [ j ] ] = built [ j ] ;
+  }
+  //
+  return result ;
+}
+// ============================================================================
+/*  get the cached column for the primitive scalar branch
+ *  @param tree the tree
+ *  @param name the branch name
+ *  @return the column or <code>nullptr</code>
+ */
+// ============================================================================
+Ostap::Trees::ColumnCache::COLUMN
+Ostap::Trees::ColumnCache::get
+( TTree*             tree ,
+  const std::string& name )
+{
+  const COLUMNS columns = get ( tree , std::vector<std::string> ( 1 , name ) ) ;
+  return columns.empty () ? COLUMN () : columns.front () ;
+}
+// ============================================================================
+// enable/disable the cache
+// ============================================================================
+void Ostap::Trees::ColumnCache::enable ( const bool value ) { s_enabled = value ; }
+// ============================================================================
+// is the cache enabled?
+// ============================================================================
+bool Ostap::Trees::ColumnCache::enabled () { return s_enabled ; }
+// ============================================================================
+/*  set the directory for the persistent columns
+ *  @param dir the directory (empty: the default directory)
+ */
+// ============================================================================
+void Ostap::Trees::ColumnCache::setDirectory ( const std::string& dir )
+{
+  TString d ( dir.c_str () ) ;
+  gSystem->ExpandPathName ( d ) ;
+  std::lock_guard<std::mutex> lock ( s_dirmutex ) ;
+  s_directory = dir.empty () ? _default_directory_ () : std::string ( d.Data () ) ;
+}
+// ============================================================================
+// the directory for the persistent columns
+// ============================================================================
+std::string Ostap::Trees::ColumnCache::directory ()
+{
+  std::lock_guard<std::mutex> lock ( s_dirmutex ) ;
+  if ( s_directory.empty () ) { s_directory = _default_directory_ () ; }
+  return s_directory ;
+}
+// ============================================================================
+/*  set the maximal size of the persistent cache
+ *  @param size the maximal size in bytes
+ */
+// ============================================================================
+void Ostap::Trees::ColumnCache::setMaxSize ( const unsigned long long size )
+{
+  std::call_once ( s_sizeflag , [] () {} ) ;
+  s_maxsize = size ;
+}
+// ============================================================================
+// the maximal size of the persistent cache (bytes)
+// ============================================================================
+unsigned long long Ostap::Trees::ColumnCache::maxSize ()
+{
+  std::call_once ( s_sizeflag , [] ()
+                   {
+                     const char* env = gSystem->Getenv ( "OSTAP_COLUMN_CACHE_SIZE" ) ;
+                     if ( env && *env ) { s_maxsize = std::strtoull ( env , nullptr , 10 ) << 20 ; }
+                   } ) ;
+  return s_maxsize ;
+}
+// ============================================================================
+// clear the in-memory cache (unmap all columns)
+// ============================================================================
+void Ostap::Trees::ColumnCache::clear ()
+{
+  CCACHE::Lock lock { s_columns.mutex () } ;
+  s_columns->clear () ;
+}
+// ============================================================================
+//                                                                      The END
+// ============================================================================
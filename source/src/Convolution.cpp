@@ -0,0 +1,304 @@
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <cmath>
+#include <map>
+#include <algorithm>
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/Convolution.h"
+// ============================================================================
+// Local
+// ============================================================================
+#include "Exception.h"
+#include "syncedcache.h"
+// ============================================================================
+/** @file
+ *  Implementation file for class Ostap::Math::Convolution
+ *  @see Ostap::Math::Convolution
+ *  @author agent agent@local
+ *  @date   2026-10-19
+ */
+// ============================================================================
+/** @class Ostap::Math::Convolution::Plan
+ *  The plan for the radix-2 complex FFT of the given size:
+ *  the bit-reversal permutation and the twiddle factors
+ */
+// ============================================================================
+class Ostap::Math::Convolution::Plan
+{
+public:
+  // ==========================================================================
+  /// constructor for the given size (must be the power of 2)
+  Plan ( const unsigned int n )
+    : m_n       ( n     )
+    , m_reverse ( n     )
+    , m_twiddle ( n / 2 )
+  {
+    unsigned int bits = 0 ;
+    while ( ( 1u << bits ) < n ) { ++bits ; }
+    for ( unsigned int i = 0 ; i < n ; ++i )
+    {
+      unsigned int r = 0 ;
+      for ( unsigned int b = 0 ; b < bits ; ++b ) { if ( i & ( 1u << b ) ) { r |= 1u << ( bits - 1 - b ) ; } }
+      m_reverse [ i ] = r ;
+    }
+    for ( unsigned int k = 0 ; k < n / 2 ; ++k )
+    { m_twiddle [ k ] = std::polar ( 1.0 , -2 * M_PI * k / n ) ; }
+  }
+  // ==========================================================================
+  /// the forward transform (in place)
+  void forward ( std::vector<std::complex<double> >& data ) const
+  { transform ( data , false ) ; }
+  // ==========================================================================
+  /// the inverse transform (in place), including the normalization
+  void inverse ( std::vector<std::complex<double> >& data ) const
+  {
+    transform ( data , true ) ;
+    const double scale = 1.0 / m_n ;
+    for ( std::complex<double>& c : data ) { c *= scale ; }
+  }
+  // ==========================================================================
+private:
+  // ==========================================================================
+  /// the iterative radix-2 transform
+  void transform ( std::vector<std::complex<double> >& data    ,
+                   const bool                          inverse ) const
+  {
+    for ( unsigned int i = 0 ; i < m_n ; ++i )
+    { if ( i < m_reverse [ i ] ) { std::swap ( data [ i ] , data [ m_reverse [ i ] ] ) ; } }
+    //
+    for ( unsigned int len = 2 ; len <= m_n ; len *= 2 )
+    {
+      const unsigned int half   = len / 2    ;
+      const unsigned int stride = m_n / len  ;
+      for ( unsigned int i = 0 ; i < m_n ; i += len )
+      {
+        for ( unsigned int j = 0 ; j < half ; ++j )
+        {
+          const std::complex<double>& w0 = m_twiddle [ j * stride ] ;
+          const std::complex<double>  w  = inverse ? std::conj ( w0 ) : w0 ;
+          const std::complex<double>  a  = data [ i + j        ] ;
+          const std::complex<double>  b  = data [ i + j + half ] * w ;
+          data [ i + j        ] = a + b ;
+          data [ i + j + half ] = a - b ;
+        }
+      }
+    }
+  }
+  // ==========================================================================
+private:
+  // ==========================================================================
+  /// the size
+  unsigned int                       m_n       ; // the size
+  /// the bit-reversal permutation
+  std::vector<unsigned int>          m_reverse ; // the bit-reversal permutation
+  /// the twiddle factors
+  std::vector<std::complex<double> > m_twiddle ; // the twiddle factors
+  // ==========================================================================
+} ;
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  /// the maximal FFT size
+  const unsigned int s_MAXSIZE = 1u << 24 ;
+  // ==========================================================================
+  typedef std::shared_ptr<const Ostap::Math::Convolution::Plan> PLAN   ;
+  typedef std::map<unsigned int,PLAN>                           PLANS  ;
+  typedef SyncedCache<PLANS>                                    PCACHE ;
+  // ==========================================================================
+  /// the cache of FFT plans
+  PCACHE s_plans {} ;
+  // ==========================================================================
+  /// get the (cached) FFT plan for the given size
+  PLAN _plan_ ( const unsigned int n )
+  {
+    PCACHE::Lock lock { s_plans.mutex () } ;
+    auto it = s_plans->find ( n ) ;
+    if ( s_plans->end () != it ) { return it->second ; }              // RETURN
+    PLAN plan = std::make_shared<const Ostap::Math::Convolution::Plan> ( n ) ;
+    s_plans->insert ( std::make_pair ( n , plan ) ) ;
+    return plan ;
+  }
+  // ==========================================================================
+  /** sample the function at the grid points
+   *  @return true if the samples have been changed
+   */
+  bool _sample_
+  ( const Ostap::Math::Convolution::function1& fun     ,
+    const double                               x0      ,
+    const double                               h       ,
+    const unsigned int                         n       ,
+    std::vector<double>&                       samples )
+  {
+    bool changed = samples.size () != n ;
+    samples.resize ( n ) ;
+    for ( unsigned int i = 0 ; i < n ; ++i )
+    {
+      const double v = fun ( x0 + i * h ) ;
+      if ( v != samples [ i ] ) { samples [ i ] = v ; changed = true ; }
+    }
+    return changed ;
+  }
+  // ==========================================================================
+} //                                                 end of anonymous namespace
+// ============================================================================
+// constructor from the signal and the resolution
+// ============================================================================
+Ostap::Math::Convolution::Convolution
+( const Ostap::Math::Convolution::function1& signal     ,
+  const Ostap::Math::Convolution::function1& resolution ,
+  const double                               xmin       ,
+  const double                               xmax       ,
+  const double                               tmin       ,
+  const double                               tmax       ,
+  const unsigned int                         nbins      )
+  : m_signal     ( signal     )
+  , m_resolution ( resolution )
+  , m_xmin       ( xmin       )
+  , m_tmin       ( tmin       )
+  , m_h          ( ( xmax - xmin ) / std::max ( nbins , 1u ) )
+  , m_nf         ( nbins      )
+  , m_nr         ( 0          )
+  , m_size       ( 1          )
+  , m_plan       ()
+  , m_fs         ()
+  , m_rs         ()
+  , m_fspec      ()
+  , m_rspec      ()
+  , m_result     ()
+  , m_x0         ( xmin + 0.5 * m_h + tmin )
+{
+  Ostap::Assert ( xmin < xmax && tmin < tmax && 1 <= nbins ,
+                  "Invalid range, window or number of bins"  ,
+                  "Ostap::Math::Convolution"                 ) ;
+  //
+  m_nr = static_cast<unsigned int> ( std::ceil ( ( tmax - tmin ) / m_h - 1.e-9 ) ) + 1 ;
+  while ( m_size < m_nf + m_nr - 1 && m_size < s_MAXSIZE ) { m_size *= 2 ; }
+  //
+  Ostap::Assert ( m_nf + m_nr - 1 <= m_size                  ,
+                  "FFT size is too large"                    ,
+                  "Ostap::Math::Convolution"                 ) ;
+  //
+  m_plan = _plan_ ( m_size ) ;
+  //
+  _sample_signal_     () ;
+  _sample_resolution_ () ;
+  _convolve_          () ;
+}
+// ============================================================================
+// sample the signal, return true if it has been changed
+// ============================================================================
+bool Ostap::Math::Convolution::_sample_signal_ ()
+{
+  // the signal at the bin centers
+  if ( !_sample_ ( m_signal , m_xmin + 0.5 * m_h , m_h , m_nf , m_fs ) ) { return false ; }
+  //
+  m_fspec.assign ( m_size , 0.0 ) ;
+  std::copy ( m_fs.begin () , m_fs.end () , m_fspec.begin () ) ;
+  m_plan->forward ( m_fspec ) ;
+  return true ;
+}
+// ============================================================================
+// sample the resolution, return true if it has been changed
+// ============================================================================
+bool Ostap::Math::Convolution::_sample_resolution_ ()
+{
+  if ( !_sample_ ( m_resolution , m_tmin , m_h , m_nr , m_rs ) ) { return false ; }
+  //
+  // the trapezoidal weights for the resolution window
+  m_rspec.assign ( m_size , 0.0 ) ;
+  std::copy ( m_rs.begin () , m_rs.end () , m_rspec.begin () ) ;
+  m_rspec [ 0 ]        *= 0.5 ;
+  m_rspec [ m_nr - 1 ] *= 0.5 ;
+  m_plan->forward ( m_rspec ) ;
+  return true ;
+}
+// ============================================================================
+// calculate the result from two spectra
+// ============================================================================
+void Ostap::Math::Convolution::_convolve_ ()
+{
+  std::vector<std::complex<double> > product ( m_size ) ;
+  for ( unsigned int i = 0 ; i < m_size ; ++i ) { product [ i ] = m_fspec [ i ] * m_rspec [ i ] ; }
+  m_plan->inverse ( product ) ;
+  //
+  m_result.resize ( m_nf + m_nr - 1 ) ;
+  for ( unsigned int k = 0 ; k < m_result.size () ; ++k )
+  { m_result [ k ] = m_h * product [ k ].real () ; }
+}
+// ============================================================================
+/*  update the convolution:
+ *  re-sample both functions and recalculate the spectrum
+ *  only for the function(s) that have changed
+ *  @return true if the convolution has been changed
+ */
+// ============================================================================
+bool Ostap::Math::Convolution::update ()
+{
+  const bool fchanged = _sample_signal_     () ;
+  const bool rchanged = _sample_resolution_ () ;
+  if ( fchanged || rchanged ) { _convolve_ () ; }
+  return fchanged || rchanged ;
+}
+// ============================================================================
+// set the new signal
+// ============================================================================
+void Ostap::Math::Convolution::setSignal
+( const Ostap::Math::Convolution::function1& signal )
+{
+  m_signal = signal ;
+  if ( _sample_signal_ () ) { _convolve_ () ; }
+}
+// ============================================================================
+// set the new resolution function
+// ============================================================================
+void Ostap::Math::Convolution::setResolution
+( const Ostap::Math::Convolution::function1& resolution )
+{
+  m_resolution = resolution ;
+  if ( _sample_resolution_ () ) { _convolve_ () ; }
+}
+// ============================================================================
+// evaluate the convolution
+// ============================================================================
+double Ostap::Math::Convolution::operator() ( const double x ) const
+{
+  const double u = ( x - m_x0 ) / m_h ;
+  if ( u < 0 || m_result.size () - 1 < u ) { return 0 ; }
+  //
+  const std::size_t i = std::min ( static_cast<std::size_t> ( u ) , m_result.size () - 2 ) ;
+  const double      t = u - i ;
+  return ( 1 - t ) * m_result [ i ] + t * m_result [ i + 1 ] ;
+}
+// ============================================================================
+/*  evaluate the convolution for many points
+ *  @param n      number of points
+ *  @param x      the points
+ *  @param result (OUTPUT) the values
+ */
+// ============================================================================
+void Ostap::Math::Convolution::evaluate
+( const std::size_t n      ,
+  const double*     x      ,
+  double*           result ) const
+{
+  for ( std::size_t i = 0 ; i < n ; ++i ) { result [ i ] = (*this) ( x [ i ] ) ; }
+}
+// ============================================================================
+// evaluate the convolution for many points
+// ============================================================================
+std::vector<double> Ostap::Math::Convolution::evaluate
+( const std::vector<double>& x ) const
+{
+  std::vector<double> result ( x.size () ) ;
+  evaluate ( x.size () , x.data () , result.data () ) ;
+  return result ;
+}
+// ============================================================================
+//                                                                      The END
+// ============================================================================
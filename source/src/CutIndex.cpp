@@ -0,0 +1,303 @@
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <map>
+#include <atomic>
+#include <cctype>
+#include <fstream>
+#include <algorithm>
+// ============================================================================
+// ROOT
+// ============================================================================
+#include "TTree.h"
+#include "TSystem.h"
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/CutIndex.h"
+#include "Ostap/Formula.h"
+#include "Ostap/Notifier.h"
+// ============================================================================
+// Local
+// ============================================================================
+#include "syncedcache.h"
+#include "local_cache.h"
+// ============================================================================
+/** @file
+ *  Implementation file for class Ostap::Trees::CutIndex
+ *  @see Ostap::Trees::CutIndex
+ *  @author agent agent@local
+ *  @date   2026-10-19
+ */
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  typedef std::shared_ptr<const Ostap::Trees::CutIndex> INDEX   ;
+  typedef std::map<std::string,INDEX>                   INDICES ;
+  typedef SyncedCache<INDICES>                          ICACHE  ;
+  // ==========================================================================
+  /// the in-memory cache of indices
+  ICACHE            s_indices   {}        ;
+  /// the maximal size of in-memory cache
+  const std::size_t s_CACHESIZE = 1000    ;
+  /// is the cache enabled?
+  std::atomic<bool> s_enabled   { false } ;
+  /// the subdirectory for the persistent indices
+  const std::string s_SUBDIR    = ".ostap_cutindex" ;
+  /// the signature of the persistent index
+  const std::string s_MAGIC     = "OSTAP-CUTINDEX-1" ;
+  // ==========================================================================
+  /// read the persistent index
+  INDEX _read_
+  ( const std::string& path ,
+    const std::string& key  )
+  {
+    std::ifstream in ( path , std::ios::binary ) ;
+    if ( !in ) { return INDEX () ; }                                 // RETURN
+    //
+    std::string magic , stored ;
+    if ( !std::getline ( in , magic  ) || s_MAGIC != magic ) { return INDEX () ; }
+    if ( !std::getline ( in , stored ) || key     != stored ) { return INDEX () ; }
+    //
+    unsigned long entries = 0 , n = 0 ;
+    in.read ( reinterpret_cast<char*> ( &entries ) , sizeof ( entries ) ) ;
+    in.read ( reinterpret_cast<char*> ( &n       ) , sizeof ( n       ) ) ;
+    if ( !in ) { return INDEX () ; }                                 // RETURN
+    //
+    Ostap::Trees::CutIndex::Ranges ranges ( n ) ;
+    if ( 0 < n )
+    { in.read ( reinterpret_cast<char*> ( ranges.data () ) , n * sizeof ( Ostap::Trees::CutIndex::Range ) ) ; }
+    if ( !in ) { return INDEX () ; }                                 // RETURN
+    //
+    return std::make_shared<const Ostap::Trees::CutIndex> ( ranges , entries ) ;
+  }
+  // ==========================================================================
+  /// write the persistent index (silently ignore failures)
+  void _write_
+  ( const std::string&              dir   ,
+    const std::string&              path  ,
+    const std::string&              key   ,
+    const Ostap::Trees::CutIndex&   index )
+  {
+    if ( !cache_directory ( dir ) ) { return ; }                     // RETURN
+    //
+    const std::string tmp = temporary_path ( path ) ;
+    {
+      std::ofstream out ( tmp , std::ios::binary ) ;
+      if ( !out ) { return ; }                                       // RETURN
+      out << s_MAGIC << '\n' << key << '\n' ;
+      const unsigned long entries = index.entries ()        ;
+      const unsigned long n       = index.ranges  ().size () ;
+      out.write ( reinterpret_cast<const char*> ( &entries ) , sizeof ( entries ) ) ;
+      out.write ( reinterpret_cast<const char*> ( &n       ) , sizeof ( n       ) ) ;
+      if ( 0 < n )
+      { out.write ( reinterpret_cast<const char*> ( index.ranges ().data () ) ,
+                    n * sizeof ( Ostap::Trees::CutIndex::Range ) ) ; }
+      if ( !out ) { gSystem->Unlink ( tmp.c_str () ) ; return ; }    // RETURN
+    }
+    if ( 0 != gSystem->Rename ( tmp.c_str () , path.c_str () ) ) { gSystem->Unlink ( tmp.c_str () ) ; }
+  }
+  // ==========================================================================
+  /// put the index into the in-memory cache
+  void _put_ ( const std::string& key , const INDEX& index )
+  {
+    ICACHE::Lock lock { s_indices.mutex () } ;
+    if ( s_CACHESIZE < s_indices->size () ) { s_indices->clear () ; }
+    s_indices->operator[] ( key ) = index ;
+  }
+  // ==========================================================================
+} //                                                 end of anonymous namespace
+// ============================================================================
+/*  build the index: evaluate cuts for all entries of the tree
+ *  @param tree the tree
+ *  @param cuts the selection criteria
+ */
+// ============================================================================
+Ostap::Trees::CutIndex::CutIndex
+( TTree*             tree ,
+  const std::string& cuts )
+{
+  if ( !tree ) { return ; }                                          // RETURN
+  //
+  Ostap::Formula selection ( "" , cuts , tree ) ;
+  if ( !selection.ok () ) { return ; }                               // RETURN
+  //
+  Ostap::Utils::Notifier notify ( tree , &selection ) ;
+  //
+  m_entries = tree->GetEntries () ;
+  for ( unsigned long entry = 0 ; entry < m_entries ; ++entry )
+  {
+    if ( tree->LoadTree ( entry ) < 0 ) { return ; }                 // RETURN
+    const double w = selection.evaluate () ;
+    if      ( 0 == w ) { continue ; }                                // CONTINUE
+    else if ( 1 != w ) { m_boolean = false ; break ; }               // BREAK
+    add ( entry ) ;
+  }
+  //
+  m_ok = true ;
+}
+// ============================================================================
+/*  constructor from the ranges
+ *  @param ranges  the sorted list of ranges of passing entries
+ *  @param entries total number of entries in the tree
+ */
+// ============================================================================
+Ostap::Trees::CutIndex::CutIndex
+( const Ostap::Trees::CutIndex::Ranges& ranges  ,
+  const unsigned long                   entries )
+  : m_ranges  ( ranges  )
+  , m_size    ( 0       )
+  , m_entries ( entries )
+  , m_boolean ( true    )
+  , m_ok      ( true    )
+{
+  for ( const Range& r : m_ranges ) { m_size += r.second - r.first ; }
+}
+// ============================================================================
+// add the entry (entries must be added in increasing order)
+// ============================================================================
+void Ostap::Trees::CutIndex::add ( const unsigned long entry )
+{
+  if ( !m_ranges.empty () && m_ranges.back ().second == entry ) { ++m_ranges.back ().second ; }
+  else { m_ranges.emplace_back ( entry , entry + 1 ) ; }
+  ++m_size ;
+}
+// ============================================================================
+/*  get the index from the cache (memory, then persistent storage),
+ *  or build it and put into the cache
+ *  @param tree the tree
+ *  @param cuts the selection criteria
+ *  @return the index, nullptr if the cache is disabled,
+ *          the cut is not boolean or the tree has the entry list
+ */
+// ============================================================================
+std::shared_ptr<const Ostap::Trees::CutIndex>
+Ostap::Trees::CutIndex::get
+( TTree*             tree ,
+  const std::string& cuts )
+{
+  if ( !s_enabled || !tree || cuts.empty () ) { return INDEX () ; }  // RETURN
+  if ( tree->GetEntryList () )                { return INDEX () ; }  // RETURN
+  //
+  std::string       dir   {} ;
+  const std::string input = tree_identity ( tree , dir ) ;
+  if ( input.empty () )                       { return INDEX () ; }  // RETURN
+  //
+  const std::string key   = input + '|' + normalize ( cuts ) ;
+  dir += "/" + s_SUBDIR ;
+  //
+  // (1) in-memory cache
+  {
+    ICACHE::Lock lock { s_indices.mutex () } ;
+    auto it = s_indices->find ( key ) ;
+    if ( s_indices->end () != it )
+    { return it->second && it->second->boolean () ? it->second : INDEX () ; }
+  }
+  //
+  // (2) persistent storage
+  const std::string path  = cache_path ( dir , key , ".idx" ) ;
+  INDEX             index = _read_ ( path , key ) ;
+  if ( index && index->entries () == (unsigned long) tree->GetEntries () )
+  {
+    _put_ ( key , index ) ;
+    return index ;                                                  // RETURN
+  }
+  //
+  // (3) build it
+  index = std::make_shared<const CutIndex> ( tree , cuts ) ;
+  if ( !index->ok () ) { return INDEX () ; }                         // RETURN
+  //
+  _put_ ( key , index ) ;
+  if ( !index->boolean () ) { return INDEX () ; }                    // RETURN
+  //
+  _write_ ( dir , path , key , *index ) ;
+  return index ;
+}
+// ============================================================================
+// enable/disable the cache
+// ============================================================================
+void Ostap::Trees::CutIndex::enable ( const bool value ) { s_enabled = value ; }
+// ============================================================================
+// is the cache enabled?
+// ============================================================================
+bool Ostap::Trees::CutIndex::enabled () { return s_enabled ; }
+// ============================================================================
+// clear the in-memory cache
+// ============================================================================
+void Ostap::Trees::CutIndex::clear ()
+{
+  ICACHE::Lock lock { s_indices.mutex () } ;
+  s_indices->clear () ;
+}
+// ============================================================================
+/*  normalize the cut expression: remove the blanks and sort the
+ *  (unique) top-level conjuncts. The expressions with top-level
+ *  <code>||</code> or <code>?:</code> are kept verbatim, since
+ *  <code>&&</code> binds tighter than both of them.
+ *  The quoted string literals are kept untouched.
+ */
+// ============================================================================
+std::string Ostap::Trees::CutIndex::normalize ( const std::string& cuts )
+{
+  // the mask of characters inside the string literals (including quotes)
+  std::string       s      ;
+  std::vector<bool> quoted ;
+  s     .reserve ( cuts.size () ) ;
+  quoted.reserve ( cuts.size () ) ;
+  char quote = 0 ;
+  for ( std::size_t i = 0 ; i < cuts.size () ; ++i )
+  {
+    const char c = cuts [ i ] ;
+    if ( quote )
+    {
+      s += c ; quoted.push_back ( true ) ;
+      if      ( '\\' == c && i + 1 < cuts.size () )
+      { s += cuts [ ++i ] ; quoted.push_back ( true ) ; }
+      else if ( quote == c ) { quote = 0 ; }
+    }
+    else if ( '"' == c || '\'' == c )
+    { quote = c ; s += c ; quoted.push_back ( true ) ; }
+    else if ( !std::isspace ( static_cast<unsigned char> ( c ) ) )
+    { s += c ; quoted.push_back ( false ) ; }
+  }
+  //
+  // split into the top-level conjuncts
+  std::vector<std::string> conjuncts ;
+  int         depth = 0 ;
+  std::size_t begin = 0 ;
+  for ( std::size_t i = 0 ; i < s.size () ; ++i )
+  {
+    const char c = s [ i ] ;
+    if      ( quoted [ i ] )         { continue ; }                 // CONTINUE
+    else if ( '(' == c || '[' == c ) { ++depth ; }
+    else if ( ')' == c || ']' == c ) { --depth ; }
+    else if ( 0 == depth && '?' == c ) { return s ; }                // RETURN
+    else if ( 0 == depth && '|' == c && i + 1 < s.size () && '|' == s [ i + 1 ] )
+    { return s ; }                                                     // RETURN
+    else if ( 0 == depth && '&' == c && i + 1 < s.size () && '&' == s [ i + 1 ] )
+    {
+      conjuncts.push_back ( s.substr ( begin , i - begin ) ) ;
+      begin = i + 2 ;
+      ++i ;
+    }
+  }
+  conjuncts.push_back ( s.substr ( begin ) ) ;
+  //
+  std::sort ( conjuncts.begin () , conjuncts.end () ) ;
+  conjuncts.erase ( std::unique ( conjuncts.begin () , conjuncts.end () ) , conjuncts.end () ) ;
+  //
+  std::string result ;
+  for ( const std::string& c : conjuncts )
+  {
+    if ( c.empty () ) { continue ; }
+    if ( !result.empty () ) { result += "&&" ; }
+    result += c ;
+  }
+  return result ;
+}
+// ============================================================================
+//                                                                      The END
+// ============================================================================
@@ -0,0 +1,240 @@
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <cmath>
+#include <map>
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/Polynomials.h"
+#include "Ostap/DalitzIntegrator.h"
+// ============================================================================
+// Local
+// ============================================================================
+#include "Exception.h"
+#include "local_hash.h"
+#include "local_parallel.h"
+#include "syncedcache.h"
+// ============================================================================
+/** @file
+ *  Implementation file for class Ostap::Math::DalitzIntegrator
+ *  @see Ostap::Math::DalitzIntegrator
+ *  @author agent agent@local
+ *  @date   2026-10-19
+ */
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  typedef Ostap::Math::DalitzIntegrator::Grid         Grid  ;
+  typedef std::shared_ptr<const Grid>                 GRID  ;
+  typedef std::map<std::size_t,GRID>                  MAP   ;
+  typedef SyncedCache<MAP>                            CACHE ;
+  /// the cache of grids
+  CACHE                 s_grids     {} ;
+  /// the maximal size of the cache
+  const  unsigned short s_CACHESIZE = 100 ;
+  // ==========================================================================
+  /** Gauss-Legendre nodes and weights at [-1,1]
+   *  @param n number of nodes
+   *  @param x (OUTPUT) the nodes
+   *  @param w (OUTPUT) the weights
+   */
+  void gauss_legendre
+  ( const unsigned short n ,
+    std::vector<double>& x ,
+    std::vector<double>& w )
+  {
+    const Ostap::Math::Legendre lp ( n ) ;
+    x = lp.roots () ;
+    w.resize ( n ) ;
+    for ( unsigned short i = 0 ; i < n ; ++i )
+    {
+      const double xi = x [ i ] ;
+      const double dp = lp.derivative ( xi ) ;
+      w [ i ] = 2.0 / ( ( 1 - xi ) * ( 1 + xi ) * dp * dp ) ;
+    }
+  }
+  // ==========================================================================
+  /// build the grid for the Dalitz plot
+  GRID make_grid
+  ( const Ostap::Kinematics::Dalitz& dalitz ,
+    const unsigned short             n1     ,
+    const unsigned short             n2     )
+  {
+    std::vector<double> x1 , w1 , x2 , w2 ;
+    gauss_legendre ( n1 , x1 , w1 ) ;
+    gauss_legendre ( n2 , x2 , w2 ) ;
+    //
+    auto grid = std::make_shared<Grid> () ;
+    grid->s1.reserve ( n1 * n2 ) ;
+    grid->s2.reserve ( n1 * n2 ) ;
+    grid->w .reserve ( n1 * n2 ) ;
+    //
+    const double a = dalitz.s1_min () ;
+    const double b = dalitz.s1_max () ;
+    const double h = 0.5 * ( b - a ) ;
+    //
+    for ( unsigned short i = 0 ; i < n1 ; ++i )
+    {
+      // s1 = a + h * ( 1 - cos ( theta ) ) ,  theta in [0,pi]
+      const double theta = 0.5 * M_PI * ( 1 + x1 [ i ] ) ;
+      const double s1    = a + h * ( 1 - std::cos ( theta ) ) ;
+      const double j1    = 0.5 * M_PI * w1 [ i ] * h * std::sin ( theta ) ;
+      //
+      const std::pair<double,double> r2 = dalitz.s2_minmax_for_s1 ( s1 ) ;
+      if ( !( r2.first < r2.second ) ) { continue ; }                 // CONTINUE
+      //
+      const double c2 = 0.5 * ( r2.second + r2.first ) ;
+      const double h2 = 0.5 * ( r2.second - r2.first ) ;
+      for ( unsigned short k = 0 ; k < n2 ; ++k )
+      {
+        grid->s1.push_back ( s1 ) ;
+        grid->s2.push_back ( c2 + h2 * x2 [ k ] ) ;
+        grid->w .push_back ( j1 * h2 * w2 [ k ] ) ;
+      }
+    }
+    //
+    return grid ;
+  }
+  // ==========================================================================
+  /// get the grid from the cache or build it
+  GRID get_grid
+  ( const Ostap::Kinematics::Dalitz& dalitz ,
+    const unsigned short             n1     ,
+    const unsigned short             n2     )
+  {
+    const std::size_t key = std::hash_combine
+      ( dalitz.M () , dalitz.m1 () , dalitz.m2 () , dalitz.m3 () , n1 , n2 ) ;
+    { // look into the cache ==================================================
+      CACHE::Lock lock { s_grids.mutex() } ;
+      auto it = s_grids->find ( key ) ;
+      if ( s_grids->end() != it ) { return it->second ; }             // RETURN
+    } // ======================================================================
+    //
+    GRID grid = make_grid ( dalitz , n1 , n2 ) ;
+    //
+    { // update the cache =====================================================
+      CACHE::Lock lock { s_grids.mutex() } ;
+      if ( s_CACHESIZE < s_grids->size() ) { s_grids->clear() ; }
+      s_grids->insert ( std::make_pair ( key , grid ) ) ;
+    } // ======================================================================
+    //
+    return grid ;
+  }
+  // ==========================================================================
+  /** sum over the grid  \f$ \sum_i w_i f_i v_i \f$ in several threads
+   *  the partial sums are combined in the fixed order
+   */
+  template <class TERM>
+  double grid_sum
+  ( const std::size_t    N        ,
+    const unsigned short nthreads ,
+    TERM                 term     )
+  {
+    const unsigned int n = n_threads ( nthreads , N ) ;
+    std::vector<long double> sums ( n , 0.0L ) ;
+    parallel_for ( n , 0 , N ,
+                   [&sums,&term] ( const unsigned int thread ,
+                                   const std::size_t  b      ,
+                                   const std::size_t  e      )
+                   {
+                     long double s = 0 ;
+                     for ( std::size_t i = b ; i < e ; ++i ) { s += term ( i ) ; }
+                     sums [ thread ] = s ;
+                   } ) ;
+    long double result = 0 ;
+    for ( const long double s : sums ) { result += s ; }
+    return result ;
+  }
+  // ==========================================================================
+} //                                                 end of anonymous namespace
+// ============================================================================
+// constructor from the Dalitz plot and the grid size
+// ============================================================================
+Ostap::Math::DalitzIntegrator::DalitzIntegrator
+( const Ostap::Kinematics::Dalitz& dalitz ,
+  const unsigned short             n1     ,
+  const unsigned short             n2     )
+  : m_dalitz  ( dalitz  )
+  , m_grid    ( nullptr )
+  , m_area    ( 0       )
+  , m_density ( 0.25 * M_PI * M_PI / dalitz.s () )
+{
+  Ostap::Assert ( 2 <= n1 && 2 <= n2                     ,
+                  "Invalid grid size"                    ,
+                  "Ostap::Math::DalitzIntegrator"        ) ;
+  //
+  m_grid = get_grid ( m_dalitz , n1 , n2 ) ;
+  //
+  long double area = 0 ;
+  for ( const double w : m_grid->w ) { area += w ; }
+  m_area = area ;
+}
+// ============================================================================
+/*  integrate the function over the Dalitz plot
+ *  \f$ I = \int\int_{\mathcal{D}} f(s_1,s_2) \mathrm{d}s_1 \mathrm{d}s_2 \f$
+ *  @param f        the function
+ *  @param nthreads number of threads
+ *  @return the integral
+ */
+// ============================================================================
+double Ostap::Math::DalitzIntegrator::integrate
+( const Ostap::Math::DalitzIntegrator::function2& f        ,
+  const unsigned short                            nthreads ) const
+{
+  const Grid& g = *m_grid ;
+  return grid_sum ( g.w.size () , nthreads ,
+                    [&g,&f] ( const std::size_t i ) -> long double
+                    { return g.w [ i ] * f ( g.s1 [ i ] , g.s2 [ i ] ) ; } ) ;
+}
+// ============================================================================
+/*  evaluate the function at all grid points
+ *  @param f        the function
+ *  @param values   (OUTPUT) the function values
+ *  @param nthreads number of threads
+ */
+// ============================================================================
+void Ostap::Math::DalitzIntegrator::evaluate
+( const Ostap::Math::DalitzIntegrator::function2& f        ,
+  std::vector<double>&                            values   ,
+  const unsigned short                            nthreads ) const
+{
+  const Grid& g = *m_grid ;
+  values.resize ( g.w.size () ) ;
+  parallel_for ( nthreads , 0 , g.w.size () ,
+                 [&g,&f,&values] ( const unsigned int /* thread */ ,
+                                   const std::size_t  b            ,
+                                   const std::size_t  e            )
+                 {
+                   for ( std::size_t i = b ; i < e ; ++i )
+                   { values [ i ] = f ( g.s1 [ i ] , g.s2 [ i ] ) ; }
+                 } ) ;
+}
+// ============================================================================
+/*  integrate the product of the function and the tabulated values
+ *  \f$ I = \sum_i w_i f(s_{1,i},s_{2,i}) v_i \f$
+ *  @param f        the function
+ *  @param values   the tabulated values, e.g. from <code>evaluate</code>
+ *  @param nthreads number of threads
+ *  @return the integral
+ */
+// ============================================================================
+double Ostap::Math::DalitzIntegrator::integrate
+( const Ostap::Math::DalitzIntegrator::function2& f        ,
+  const std::vector<double>&                      values   ,
+  const unsigned short                            nthreads ) const
+{
+  const Grid& g = *m_grid ;
+  Ostap::Assert ( values.size () == g.w.size ()                  ,
+                  "Mismatch of the tabulated values and the grid" ,
+                  "Ostap::Math::DalitzIntegrator"                 ) ;
+  return grid_sum ( g.w.size () , nthreads ,
+                    [&g,&f,&values] ( const std::size_t i ) -> long double
+                    { return g.w [ i ] * f ( g.s1 [ i ] , g.s2 [ i ] ) * values [ i ] ; } ) ;
+}
+// ============================================================================
+//                                                                      The END
+// ============================================================================
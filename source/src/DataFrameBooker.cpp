@@ -0,0 +1,209 @@
+// ============================================================================
+// Include files
+// ============================================================================
+// STD & STL
+// ============================================================================
+#include <array>
+// ============================================================================
+// ROOT
+// ============================================================================
+#include "TH1.h"
+#include "TH2.h"
+#include "TH3.h"
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/DataFrameBooker.h"
+// ============================================================================
+// Local
+// ============================================================================
+#include "OstapDataFrame.h"
+// ============================================================================
+/** @file
+ *  Implementation file for class Ostap::DataFrameBooker
+ *  @see Ostap::DataFrameBooker
+ *  @author agent agent@local
+ *  @date   2026-10-19
+ */
+// ============================================================================
+// constructor from the frame
+// ============================================================================
+Ostap::DataFrameBooker::DataFrameBooker
+( Ostap::DataFrame frame )
+  : m_frame   ( new Ostap::DataFrame ( frame ) )
+  , m_actions ()
+{}
+// ============================================================================
+// destructor
+// ============================================================================
+Ostap::DataFrameBooker::~DataFrameBooker(){}
+// ============================================================================
+/*  book the projection of DataFrame into the histogram
+ *  @param histo      (UPDATE) histogram
+ *  @param expression (INPUT)  expression
+ *  @param selection  (INPUT)  selection criteria/weight
+ */
+// ============================================================================
+Ostap::StatusCode Ostap::DataFrameBooker::project
+( TH1*                histo      ,
+  const std::string&  expression ,
+  const std::string&  selection  )
+{
+  //
+  if ( 0 == histo ) { return Ostap::StatusCode ( 301 ) ; }
+  else { histo->Reset() ; } // reset the histogram
+  //
+  TH1D model {} ; histo->Copy ( model ) ;
+  //
+  const bool no_cuts = trivial ( selection ) ;
+  //
+  const std::string xvar   = Ostap::tmp_name ( "vx_" , expression ) ;
+  const std::string weight = Ostap::tmp_name ( "w_"  , selection  ) ;
+  //
+  auto h = ( *m_frame )
+    .Define  ( xvar   ,                   "1.0*(" + expression + ")" )
+    .Define  ( weight , no_cuts ? "1.0" : "1.0*(" + selection  + ")" )
+    .Histo1D ( model  , xvar , weight ) ;                         // LAZY
+  //
+  m_actions.push_back ( [h,histo] () mutable { h->Copy ( *histo ) ; } ) ;
+  //
+  return Ostap::StatusCode::SUCCESS ;
+}
+// ============================================================================
+/*  book the projection of DataFrame into the histogram
+ *  @param histo       (UPDATE) histogram
+ *  @param xexpression (INPUT)  expression for x-axis
+ *  @param yexpression (INPUT)  expression for y-axis
+ *  @param selection   (INPUT)  selection criteria/weight
+ */
+// ============================================================================
+Ostap::StatusCode Ostap::DataFrameBooker::project2
+( TH2*                histo       ,
+  const std::string&  xexpression ,
+  const std::string&  yexpression ,
+  const std::string&  selection   )
+{
+  //
+  if ( 0 == histo ) { return Ostap::StatusCode ( 301 ) ; }
+  else { histo->Reset() ; } // reset the histogram
+  //
+  TH2D model {} ; histo->Copy ( model ) ;
+  //
+  const bool no_cuts = trivial ( selection ) ;
+  //
+  const std::string xvar   = Ostap::tmp_name ( "vx_" , xexpression ) ;
+  const std::string yvar   = Ostap::tmp_name ( "vy_" , yexpression ) ;
+  const std::string weight = Ostap::tmp_name ( "w_"  , selection   ) ;
+  //
+  auto h = ( *m_frame )
+    .Define  ( xvar   ,                   "1.0*(" + xexpression + ")" )
+    .Define  ( yvar   ,                   "1.0*(" + yexpression + ")" )
+    .Define  ( weight , no_cuts ? "1.0" : "1.0*(" + selection   + ")" )
+    .Histo2D ( model  , xvar , yvar , weight ) ;                  // LAZY
+  //
+  m_actions.push_back ( [h,histo] () mutable { h->Copy ( *histo ) ; } ) ;
+  //
+  return Ostap::StatusCode::SUCCESS ;
+}
+// ============================================================================
+/*  book the projection of DataFrame into the histogram
+ *  @param histo       (UPDATE) histogram
+ *  @param xexpression (INPUT)  expression for x-axis
+ *  @param yexpression (INPUT)  expression for y-axis
+ *  @param zexpression (INPUT)  expression for z-axis
+ *  @param selection   (INPUT)  selection criteria/weight
+ */
+// ============================================================================
+Ostap::StatusCode Ostap::DataFrameBooker::project3
+( TH3*                histo       ,
+  const std::string&  xexpression ,
+  const std::string&  yexpression ,
+  const std::string&  zexpression ,
+  const std::string&  selection   )
+{
+  //
+  if ( 0 == histo ) { return Ostap::StatusCode ( 301 ) ; }
+  else { histo->Reset() ; } // reset the histogram
+  //
+  TH3D model {} ; histo->Copy ( model ) ;
+  //
+  const bool no_cuts = trivial ( selection ) ;
+  //
+  const std::string xvar   = Ostap::tmp_name ( "vx_" , xexpression ) ;
+  const std::string yvar   = Ostap::tmp_name ( "vy_" , yexpression ) ;
+  const std::string zvar   = Ostap::tmp_name ( "vz_" , zexpression ) ;
+  const std::string weight = Ostap::tmp_name ( "w_"  , selection   ) ;
+  //
+  auto h = ( *m_frame )
+    .Define  ( xvar   ,                   "1.0*(" + xexpression + ")" )
+    .Define  ( yvar   ,                   "1.0*(" + yexpression + ")" )
+    .Define  ( zvar   ,                   "1.0*(" + zexpression + ")" )
+    .Define  ( weight , no_cuts ? "1.0" : "1.0*(" + selection   + ")" )
+    .Histo3D ( model  , xvar , yvar , zvar , weight ) ;           // LAZY
+  //
+  m_actions.push_back ( [h,histo] () mutable { h->Copy ( *histo ) ; } ) ;
+  //
+  return Ostap::StatusCode::SUCCESS ;
+}
+// ============================================================================
+/*  book the statistic for the <code>expression</code>
+ *  @param stat       (UPDATE) the counter
+ *  @param expression (INPUT)  the expression
+ *  @param cuts       (INPUT)  the selection
+ *  @see Ostap::StatVar::statVar
+ */
+// ============================================================================
+Ostap::StatusCode Ostap::DataFrameBooker::statVar
+( Ostap::WStatEntity& stat       ,
+  const std::string&  expression ,
+  const std::string&  cuts       )
+{
+  //
+  stat.reset() ;
+  //
+  const bool no_cuts = trivial ( cuts ) ;
+  //
+  /// define the temporary columns
+  const std::string var    = Ostap::tmp_name ( "v_"  , expression ) ;
+  const std::string weight = Ostap::tmp_name ( "w_"  , cuts       ) ;
+  const std::string bcut   = Ostap::tmp_name ( "b_"  , cuts       ) ;
+  const std::string pair   = Ostap::tmp_name ( "vw_" , expression ) ;
+  //
+  typedef std::array<double,2> VW ;
+  //
+  auto t = ( *m_frame )
+    .Define ( bcut   , no_cuts ? "true" : "(bool)   ( " + cuts + " ) ;" )
+    .Filter ( bcut   )
+    .Define ( var    ,  "1.0*(" + expression + ")"   )
+    .Define ( weight , no_cuts ? "1.0"  : "1.0*(" + cuts + ")" )
+    .Define ( pair   , [] ( double v , double w ) -> VW { return VW { { v , w } } ; } ,
+              { var , weight } ) ;
+  //
+  auto s = t.Aggregate
+    ( [] ( Ostap::WStatEntity& r , const VW& vw ) { r.add ( vw [ 0 ] , vw [ 1 ] ) ; } ,
+      [] ( std::vector<Ostap::WStatEntity>& v )
+      { for ( std::size_t i = 1 ; i < v.size() ; ++i ) { v [ 0 ] += v [ i ] ; } } ,
+      pair , Ostap::WStatEntity () ) ;                           // LAZY
+  //
+  Ostap::WStatEntity* counter = &stat ;
+  m_actions.push_back ( [s,counter] () mutable { *counter = *s ; } ) ;
+  //
+  return Ostap::StatusCode::SUCCESS ;
+}
+// ============================================================================
+/*  run the single event loop for all booked actions and
+ *  deliver the results into the booked histograms/counters
+ *  @return number of delivered results
+ */
+// ============================================================================
+unsigned long Ostap::DataFrameBooker::run ()
+{
+  // the first access to any booked result triggers the event loop for all
+  const unsigned long n = m_actions.size() ;
+  for ( auto& a : m_actions ) { a () ; }
+  m_actions.clear() ;
+  return n ;
+}
+// ============================================================================
+//                                                                      The END
+// ============================================================================
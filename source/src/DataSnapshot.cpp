@@ -0,0 +1,272 @@
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <memory>
+#include <algorithm>
+// ============================================================================
+// RooFit
+// ============================================================================
+#include "RooAbsData.h"
+#include "RooAbsReal.h"
+#include "RooAbsCategory.h"
+#include "RooArgSet.h"
+#include "RooArgList.h"
+#include "RooFormulaVar.h"
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/Iterator.h"
+#include "Ostap/DataSnapshot.h"
+// ============================================================================
+// Local
+// ============================================================================
+#include "Exception.h"
+// ============================================================================
+/** @file
+ *  Implementation file for class Ostap::DataSnapshot
+ *  @see Ostap::DataSnapshot
+ *  @author agent agent@local
+ *  @date   2026-10-19
+ */
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  /// get the value of the fundamental variable
+  inline double _value_ ( const RooAbsArg* arg )
+  {
+    const RooAbsReal*     r = dynamic_cast<const RooAbsReal*>     ( arg ) ;
+    if ( nullptr != r ) { return r->getVal   () ; }
+    const RooAbsCategory* c = dynamic_cast<const RooAbsCategory*> ( arg ) ;
+    if ( nullptr != c ) { return c->getIndex () ; }
+    return 0 ;
+  }
+  // ==========================================================================
+}
+// ============================================================================
+/*  create the snapshot for all variables in dataset
+ *  @param data      (INPUT) the dataset
+ *  @param cut_range (INPUT) the cut-range
+ *  @param first     (INPUT) the first entry to be used
+ *  @param last      (INPUT) the last entry to be used (not included)
+ */
+// ============================================================================
+Ostap::DataSnapshot::DataSnapshot
+( const RooAbsData&   data      ,
+  const std::string&  cut_range ,
+  const unsigned long first     ,
+  const unsigned long last      )
+  : m_data      ( &data     )
+  , m_cut_range ( cut_range )
+  , m_first     ( first     )
+  , m_last      ( std::min ( last , (unsigned long) data.numEntries() ) )
+  , m_weighted  ( data.isWeighted() )
+{
+  Names names ;
+  const RooArgSet* aset = data.get() ;
+  Ostap::Assert ( nullptr != aset                  ,
+                  "Invalid varset"                 ,
+                  "Ostap::DataSnapshot"            ) ;
+  Ostap::Utils::Iterator iter ( *aset ) ;
+  while ( RooAbsArg* a = iter.static_next<RooAbsArg>() )
+  {
+    if ( nullptr != dynamic_cast<RooAbsReal*>     ( a ) ||
+         nullptr != dynamic_cast<RooAbsCategory*> ( a ) )
+    { names.push_back ( a->GetName () ) ; }
+  }
+  //
+  build ( names ) ;
+}
+// ============================================================================
+/*  create the snapshot for selected variables/expressions
+ *  @param data      (INPUT) the dataset
+ *  @param variables (INPUT) variables/expressions to be stored
+ *  @param cut_range (INPUT) the cut-range
+ *  @param first     (INPUT) the first entry to be used
+ *  @param last      (INPUT) the last entry to be used (not included)
+ */
+// ============================================================================
+Ostap::DataSnapshot::DataSnapshot
+( const RooAbsData&   data      ,
+  const Names&        variables ,
+  const std::string&  cut_range ,
+  const unsigned long first     ,
+  const unsigned long last      )
+  : m_data      ( &data     )
+  , m_cut_range ( cut_range )
+  , m_first     ( first     )
+  , m_last      ( std::min ( last , (unsigned long) data.numEntries() ) )
+  , m_weighted  ( data.isWeighted() )
+{
+  build ( variables ) ;
+}
+// ============================================================================
+// build the snapshot: single loop over the dataset
+// ============================================================================
+void Ostap::DataSnapshot::build ( const Names& variables )
+{
+  //
+  const RooArgSet* aset = m_data->get() ;
+  Ostap::Assert ( nullptr != aset                  ,
+                  "Invalid varset"                 ,
+                  "Ostap::DataSnapshot"            ) ;
+  //
+  RooArgList alst ;
+  Ostap::Utils::Iterator iter ( *aset ) ;
+  while ( RooAbsArg* a = iter.static_next<RooAbsArg>() ) { alst.add ( *a ) ; }
+  //
+  // prepare accessors: either fundamental variables or formulas
+  std::vector<const RooAbsArg*>                 accessors ;
+  std::vector<std::unique_ptr<RooFormulaVar> >  formulas  ;
+  std::vector<Column*>                          columns   ;
+  for ( const auto& v : variables )
+  {
+    if ( has ( v ) ) { continue ; }
+    const RooAbsArg* a = aset->find ( v.c_str() ) ;
+    if ( nullptr == a )
+    {
+      formulas.push_back ( std::make_unique<RooFormulaVar> ( "" , v.c_str() , alst ) ) ;
+      Ostap::Assert ( formulas.back()->ok ()                  ,
+                      "Invalid expression:\"" + v + "\""      ,
+                      "Ostap::DataSnapshot"                   ) ;
+      a = formulas.back().get() ;
+    }
+    accessors.push_back ( a ) ;
+    columns  .push_back ( &m_columns [ v ] ) ;
+  }
+  //
+  const char*         cutrange = m_cut_range.empty() ? nullptr : m_cut_range.c_str() ;
+  const unsigned long nmax     = m_first < m_last ? m_last - m_first : 0 ;
+  //
+  m_weights.reserve ( nmax ) ;
+  for ( auto* c : columns ) { c->reserve ( nmax ) ; }
+  //
+  long double sumw  = 0 ;
+  long double sumw2 = 0 ;
+  for ( unsigned long entry = m_first ; entry < m_last ; ++entry )
+  {
+    const RooArgSet* vars = m_data->get ( entry ) ;
+    if ( nullptr == vars ) { break ; }                                // BREAK
+    if ( cutrange && !vars->allInRange ( cutrange ) ) { continue ; }  // CONTINUE
+    //
+    if ( cutrange ) { m_entries.push_back ( entry ) ; }
+    //
+    const double w = m_weighted ? m_data->weight() : 1.0 ;
+    m_weights.push_back ( w ) ;
+    sumw  += w     ;
+    sumw2 += w * w ;
+    //
+    for ( unsigned short i = 0 ; i < accessors.size() ; ++i )
+    { columns[i]->push_back ( _value_ ( accessors[i] ) ) ; }
+  }
+  //
+  m_sumw  = sumw  ;
+  m_sumw2 = sumw2 ;
+}
+// ============================================================================
+// calculate the column from the dataset
+// ============================================================================
+void Ostap::DataSnapshot::calculate
+( const std::string& expression ,
+  Column&            column     ) const
+{
+  Ostap::Assert ( nullptr != m_data                 ,
+                  "Invalid dataset"                 ,
+                  "Ostap::DataSnapshot"             ) ;
+  //
+  const RooArgSet* aset = m_data->get() ;
+  Ostap::Assert ( nullptr != aset                  ,
+                  "Invalid varset"                 ,
+                  "Ostap::DataSnapshot"            ) ;
+  //
+  RooArgList alst ;
+  Ostap::Utils::Iterator iter ( *aset ) ;
+  while ( RooAbsArg* a = iter.static_next<RooAbsArg>() ) { alst.add ( *a ) ; }
+  //
+  RooFormulaVar formula ( "" , expression.c_str() , alst ) ;
+  Ostap::Assert ( formula.ok ()                               ,
+                  "Invalid expression:\"" + expression + "\"" ,
+                  "Ostap::DataSnapshot"                       ) ;
+  //
+  const unsigned long N = size () ;
+  column.resize ( N ) ;
+  for ( unsigned long i = 0 ; i < N ; ++i )
+  {
+    const unsigned long entry = m_entries.empty() ? m_first + i : m_entries [ i ] ;
+    m_data->get ( entry ) ;
+    column [ i ] = formula.getVal () ;
+  }
+}
+// ============================================================================
+// all known columns
+// ============================================================================
+Ostap::DataSnapshot::Names
+Ostap::DataSnapshot::names () const
+{
+  Names result ; result.reserve ( m_columns.size() ) ;
+  for ( const auto& c : m_columns ) { result.push_back ( c.first ) ; }
+  return result ;
+}
+// ============================================================================
+/*  get the column for the variable or expression
+ *  - if the column is not in snapshot, it is calculated
+ *    from the original dataset and stored
+ *  @param expression the name of variable or expression
+ *  @return the column
+ */
+// ============================================================================
+const Ostap::DataSnapshot::Column&
+Ostap::DataSnapshot::column ( const std::string& expression )
+{
+  auto found = m_columns.find ( expression ) ;
+  if ( m_columns.end() != found ) { return found->second ; }
+  return add ( expression , expression ) ;
+}
+// ============================================================================
+/*  add the named column, calculated  from the expression
+ *  @param name       the name of the new column
+ *  @param expression the expression
+ *  @return the column
+ */
+// ============================================================================
+const Ostap::DataSnapshot::Column&
+Ostap::DataSnapshot::add
+( const std::string& name       ,
+  const std::string& expression )
+{
+  Column c ;
+  calculate ( expression , c ) ;
+  Column& result = m_columns [ name ] ;
+  result.swap ( c ) ;
+  return result ;
+}
+// ============================================================================
+/*  get the column of weights, combined with selection
+ *  - if the selection is empty, the snapshot weights are returned
+ *  @param selection the selection/weight expression
+ *  @param result    (OUTPUT) the combined weights
+ *  @return reference to combined weights
+ */
+// ============================================================================
+const Ostap::DataSnapshot::Column&
+Ostap::DataSnapshot::weights
+( const std::string& selection ,
+  Column&            result    )
+{
+  if ( selection.empty() ) { return m_weights ; }
+  //
+  const Column& cuts = column ( selection ) ;
+  const unsigned long N = size () ;
+  result.resize ( N ) ;
+  const double* c = cuts     .data () ;
+  const double* w = m_weights.data () ;
+  double*       r = result   .data () ;
+  for ( unsigned long i = 0 ; i < N ; ++i ) { r [ i ] = c [ i ] * w [ i ] ; }
+  //
+  return result ;
+}
+// ============================================================================
+//                                                                      The END
+// ============================================================================
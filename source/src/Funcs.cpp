@@ -378,8 +378,14 @@ double Ostap::Functions::FuncTH1::operator() ( const TTree* tree ) const
   //
   const double xvar = m_xvar->evaluate() ;
   //
-  return Ostap::Math::HistoInterpolation::interpolate_1D
-    ( m_h1  , xvar , m_tx , m_edges , m_extrapolate , m_density ).value() ;
+  // prepare the interpolator 
+  if ( !m_interpolator ) 
+  { 
+    m_interpolator = std::make_unique<Ostap::Math::HistoInterpolator1D>
+      ( m_h1  , m_tx , m_edges , m_extrapolate , m_density ) ; 
+  }
+  //
+  return m_interpolator->value ( xvar ) ;
 }
 // ===========================================================================
 /*  (protected) constructor without histogram 
@@ -555,8 +561,14 @@ double Ostap::Functions::FuncTH2::operator() ( const TTree* tree ) const
   const double xvar = m_xvar->evaluate() ;
   const double yvar = m_yvar->evaluate() ;
   //
-  return Ostap::Math::HistoInterpolation::interpolate_2D
-    ( m_h2  , xvar , yvar , m_tx , m_ty , m_edges , m_extrapolate , m_density ).value() ;
+  // prepare the interpolator 
+  if ( !m_interpolator ) 
+  { 
+    m_interpolator = std::make_unique<Ostap::Math::HistoInterpolator2D>
+      ( m_h2  , m_tx , m_ty , m_edges , m_extrapolate , m_density ) ; 
+  }
+  //
+  return m_interpolator->value ( xvar , yvar ) ;
 }
 // ===========================================================================
 /*  (protected) constructor without histogram 
@@ -767,12 +779,16 @@ double Ostap::Functions::FuncTH3::operator() ( const TTree* tree ) const
   //
   const double xvar = m_xvar->evaluate() ;
   const double yvar = m_yvar->evaluate() ;
-  const double zvar = m_yvar->evaluate() ;
+  const double zvar = m_zvar->evaluate() ;
+  //
+  // prepare the interpolator 
+  if ( !m_interpolator ) 
+  { 
+    m_interpolator = std::make_unique<Ostap::Math::HistoInterpolator3D>
+      ( m_h3 , m_tx , m_ty , m_tz , m_edges , m_extrapolate , m_density ) ; 
+  }
   //
-  return Ostap::Math::HistoInterpolation::interpolate_3D
-    ( m_h3 , 
-      xvar , yvar , zvar , 
-      m_tx , m_ty , m_tz , m_edges , m_extrapolate , m_density ).value() ;
+  return m_interpolator->value ( xvar , yvar , zvar ) ;
 }
 // ============================================================================
 // The END 
@@ -4,9 +4,14 @@
 // ============================================================================
 // STD & STL 
 // ============================================================================
+#include <cstdio>
+#include <cstdlib>
 #include <iostream>
 #include <sstream>
-#include <sstream>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <algorithm>
 // ============================================================================
 // Ostap 
 // ============================================================================
@@ -71,15 +76,71 @@ namespace
                             tag                   , 
                             Ostap::StatusCode ( 20000 + gsl_errno ) ) ;
   }
+  // ==========================================================================
+  /// the policy: the scope and its handler 
+  typedef std::pair<const Ostap::Utils::GslError*,gsl_error_handler_t*> Policy   ;
+  typedef std::vector<Policy>                                            Policies ;
+  // ==========================================================================
+  /// the thread-local stack of policies 
+  Policies& policies () 
+  {
+    static thread_local Policies s_policies {} ;
+    return s_policies ;
+  }
+  // ==========================================================================
+  /// the replica of GSL default handler: print the error and abort
+  void GSL_default_error
+  ( const char * reason    ,
+    const char * file      ,
+    int          line      ,
+    int          /* gsl_errno */ ) 
+  {
+    gsl_stream_printf ( "ERROR" , file , line , reason ) ;
+    std::fflush  ( stdout ) ;
+    std::fprintf ( stderr , "Default GSL error handler invoked.\n" ) ;
+    std::fflush  ( stderr ) ;
+    std::abort   () ;
+  }
+  // ==========================================================================
+  /// the handler that was active before the installation of dispatcher 
+  std::atomic<gsl_error_handler_t*> s_previous { nullptr } ;
+  // ==========================================================================
+  /** the global handler: dispatch the error to the thread-local policy,
+   *  outside of any scope use the previously installed handler 
+   */
+  void GSL_dispatch_error
+  ( const char * reason    ,
+    const char * file      ,
+    int          line      ,
+    int          gsl_errno ) 
+  {
+    const Policies& p = policies () ;
+    gsl_error_handler_t* h = !p.empty () ? p.back().second : s_previous.load () ;
+    if ( nullptr == h ) { h = &GSL_default_error ; }
+    (*h) ( reason , file , line , gsl_errno ) ;
+  }
+  // ==========================================================================
+  /** install the global dispatcher once per process: 
+   *  the GSL handler is a global variable, it is not modified afterwards,
+   *  the scopes only change their thread-local policies 
+   */
+  void install () 
+  {
+    static std::once_flag s_once ;
+    std::call_once ( s_once , [] ()
+                     { s_previous.store ( gsl_set_error_handler ( &GSL_dispatch_error ) ) ; } ) ;
+  }
+  // ==========================================================================
 }
 // ============================================================================
 // constructor: make use of Gsl Error Handler: print error to stderr 
 // ============================================================================
 Ostap::Utils::GslError::GslError ( Ostap::Utils::GslError::handler* h )
-  : m_previous ( gsl_set_error_handler ( h ) ) 
 { 
   static_assert( std::is_same<handler,gsl_error_handler_t>::value  ,
                  "``handler'' type is not ``gsl_error_handler_t''" ) ;
+  install () ;
+  policies ().emplace_back ( this , h ) ;
 }
 // ============================================================================
 // constructor: make use of Gsl Error Handler: print error to stderr 
@@ -88,7 +149,14 @@ Ostap::Utils::GslError::GslError () : GslError ( &GSL_local_error ) {}
 // ============================================================================
 // destructor: stop using the error  handler 
 // ============================================================================
-Ostap::Utils::GslError::~GslError() { gsl_set_error_handler ( m_previous ) ; }
+Ostap::Utils::GslError::~GslError() 
+{ 
+  // the scopes are not necessarily destroyed in LIFO order (e.g. from python)
+  Policies& p = policies () ;
+  auto it = std::find_if ( p.rbegin () , p.rend () , 
+                           [this] ( const Policy& q ) { return this == q.first ; } ) ;
+  if ( p.rend () != it ) { p.erase ( std::next ( it ).base () ) ; }
+}
 // ============================================================================
 // constructor: make use of Gsl Error Handler: print error to stderr 
 // ============================================================================
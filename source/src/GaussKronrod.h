@@ -0,0 +1,316 @@
+// ============================================================================
+#ifndef OSTAP_GAUSSKRONROD_H
+#define OSTAP_GAUSSKRONROD_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <cmath>
+#include <limits>
+#include <tuple>
+#include <vector>
+#include <algorithm>
+#include <deque>
+// ============================================================================
+/** @file GaussKronrod.h
+ *  Reentrant adaptive Gauss-Kronrod integration (G10/K21 rule)
+ *  - no GSL: no global error handler, no shared workspace
+ *  - the scratch area is thread-local, nested integrations are allowed
+ *  - errors are reported via the return values
+ *  @see Ostap::Math::Integrator
+ *  @author agent agent@local
+ *  @date 2026-10-19
+ */
+// ============================================================================
+namespace Ostap
+{
+  // ==========================================================================
+  namespace Math
+  {
+    // ========================================================================
+    namespace GaussKronrod
+    {
+      // ======================================================================
+      /** @typedef    Result
+       *  the  type for  result of numerical integration routines:
+       *  (status, result, error)
+       */
+      typedef std::tuple<int,double,double> Result ;
+      // ======================================================================
+      /** status codes, numerically the same as the corresponding GSL codes
+       *  to keep the interpretation of <code>Result</code> uniform
+       */
+      enum Status
+        {
+          Success       =  0 , // GSL_SUCCESS
+          InvalidArg    =  4 , // GSL_EINVAL
+          BadFunction   =  9 , // GSL_EBADFUNC
+          MaxIterations = 11 , // GSL_EMAXITER
+          RoundOff      = 18 , // GSL_EROUND
+          Singular      = 21   // GSL_ESING
+        } ;
+      // ======================================================================
+      /// the integration segment
+      struct Segment
+      {
+        double a      ;
+        double b      ;
+        double result ;
+        double error  ;
+      } ;
+      // ======================================================================
+      /// comparison of segments: the segment with largest error at the top
+      inline bool operator< ( const Segment& s1 , const Segment& s2 )
+      { return s1.error < s2.error ; }
+      // ======================================================================
+      /// the abscissas of the 21-point Kronrod rule
+      static const double s_xgk [ 11 ] =
+        {
+          0.995657163025808080735527280689003 ,
+          0.973906528517171720077964012084452 ,
+          0.930157491355708226001207180059508 ,
+          0.865063366688984510732096688423493 ,
+          0.780817726586416897063717578345042 ,
+          0.679409568299024406234327365114874 ,
+          0.562757134668604683339000099272694 ,
+          0.433395394129247190799265943165784 ,
+          0.294392862701460198131126603103866 ,
+          0.148874338981631210884826001129720 ,
+          0.000000000000000000000000000000000
+        } ;
+      /// the weights of the 21-point Kronrod rule
+      static const double s_wgk [ 11 ] =
+        {
+          0.011694638867371874278064396062192 ,
+          0.032558162307964727478818972459390 ,
+          0.054755896574351996031381300244580 ,
+          0.075039674810919952767043140916190 ,
+          0.093125454583697605535065465083366 ,
+          0.109387158802297641899210590325805 ,
+          0.123491976262065851077208245815236 ,
+          0.134709217311473325928054001771707 ,
+          0.142775938577060080797094273138717 ,
+          0.147739104901338491374841515972068 ,
+          0.149445554002916905664936468389821
+        } ;
+      /// the weights of the 10-point Gauss rule (for abscissas s_xgk[1,3,5,7,9])
+      static const double s_wg  [ 5 ] =
+        {
+          0.066671344308688137593568809893332 ,
+          0.149451349150580593145776339657697 ,
+          0.219086362515982043995534934228163 ,
+          0.269266719309996355091226921569469 ,
+          0.295524224714752870173892994651338
+        } ;
+      // ======================================================================
+      /** apply G10/K21 rule to the interval [a,b]
+       *  the error estimate follows QUADPACK
+       *  @return false for non-finite function values
+       */
+      template <class FUNCTION>
+      inline bool rule21
+      ( const FUNCTION& f      ,
+        const double    a      ,
+        const double    b      ,
+        double&         result ,
+        double&         error  )
+      {
+        const double center   = 0.5 * ( a + b ) ;
+        const double half     = 0.5 * ( b - a ) ;
+        const double abs_half = std::abs ( half ) ;
+        //
+        double fv1 [ 10 ] ;
+        double fv2 [ 10 ] ;
+        //
+        const double fc     = f ( center ) ;
+        double result_gauss = 0 ;
+        double result_kr    = fc * s_wgk [ 10 ] ;
+        double result_abs   = std::abs ( result_kr ) ;
+        //
+        for ( unsigned short j = 0 ; j < 10 ; ++j )
+        {
+          const double dx = half * s_xgk [ j ] ;
+          const double f1 = f ( center - dx ) ;
+          const double f2 = f ( center + dx ) ;
+          fv1 [ j ] = f1 ;
+          fv2 [ j ] = f2 ;
+          const double fs = f1 + f2 ;
+          if ( 1 == j % 2 ) { result_gauss += s_wg [ j / 2 ] * fs ; }
+          result_kr  += s_wgk [ j ] * fs ;
+          result_abs += s_wgk [ j ] * ( std::abs ( f1 ) + std::abs ( f2 ) ) ;
+        }
+        //
+        const double mean  = 0.5 * result_kr ;
+        double result_asc  = s_wgk [ 10 ] * std::abs ( fc - mean ) ;
+        for ( unsigned short j = 0 ; j < 10 ; ++j )
+        { result_asc += s_wgk [ j ] * ( std::abs ( fv1 [ j ] - mean ) + std::abs ( fv2 [ j ] - mean ) ) ; }
+        //
+        result      = result_kr * half ;
+        result_abs *= abs_half ;
+        result_asc *= abs_half ;
+        //
+        double err  = std::abs ( ( result_kr - result_gauss ) * half ) ;
+        if ( 0 != result_asc && 0 != err )
+        { err = result_asc * std::min ( 1.0 , std::pow ( 200 * err / result_asc , 1.5 ) ) ; }
+        //
+        static const double s_eps  = std::numeric_limits<double>::epsilon () ;
+        static const double s_tiny = std::numeric_limits<double>::min     () ;
+        if ( result_abs > s_tiny / ( 50 * s_eps ) )
+        { err = std::max ( 50 * s_eps * result_abs , err ) ; }
+        //
+        error = err ;
+        //
+        return std::isfinite ( result ) && std::isfinite ( error ) ;
+      }
+      // ======================================================================
+      /** @class Scratch
+       *  thread-local scratch area for adaptive integration.
+       *  Each nesting level gets its own heap of segments,
+       *  therefore the integrand itself can call the integrator
+       */
+      class Scratch
+      {
+      public:
+        // ====================================================================
+        typedef std::vector<Segment> Segments ;
+        // ====================================================================
+        Scratch  () : m_segments ( acquire () ) { m_segments.clear () ; }
+        ~Scratch () { --depth () ; }
+        // ====================================================================
+        Scratch ( const Scratch& ) = delete ;
+        Scratch& operator=( const Scratch& ) = delete ;
+        // ====================================================================
+        Segments& segments () { return m_segments ; }
+        // ====================================================================
+      private:
+        // ====================================================================
+        static unsigned int& depth ()
+        {
+          static thread_local unsigned int s_depth = 0 ;
+          return s_depth ;
+        }
+        // ====================================================================
+        static Segments& acquire ()
+        {
+          static thread_local std::deque<Segments> s_stack {} ; // stable references
+          const unsigned int level = depth () ++ ;
+          if ( s_stack.size () <= level ) { s_stack.resize ( level + 1 ) ; }
+          return s_stack [ level ] ;
+        }
+        // ====================================================================
+      private:
+        // ====================================================================
+        Segments& m_segments ;
+        // ====================================================================
+      } ;
+      // ======================================================================
+      /** adaptive Gauss-Kronrod integration of the function over [xmin,xmax]
+       *  - reentrant and thread-safe (if the function itself is thread-safe)
+       *  - no global state, errors are reported via the status code
+       *  @param f          the function
+       *  @param xmin       low  integration edge
+       *  @param xmax       high integration edge
+       *  @param aprecision absolute precision
+       *  @param rprecision relative precision
+       *  @param limit      maximal number of subintervals
+       *  @return (status, result, error)
+       */
+      template <class FUNCTION>
+      inline Result integrate
+      ( const FUNCTION&    f                   ,
+        const double       xmin                ,
+        const double       xmax                ,
+        const double       aprecision = 1.e-8  ,
+        const double       rprecision = 1.e-8  ,
+        const unsigned int limit      = 1000   )
+      {
+        //
+        if ( !std::isfinite ( xmin ) || !std::isfinite ( xmax ) )
+        { return Result ( InvalidArg , 0.0 , 0.0 ) ; }                // RETURN
+        if ( xmin == xmax ) { return Result ( Success , 0.0 , 0.0 ) ; } // RETURN
+        if ( aprecision <= 0 && rprecision < 50 * std::numeric_limits<double>::epsilon () )
+        { return Result ( InvalidArg , 0.0 , 0.0 ) ; }                // RETURN
+        //
+        double result = 0 ;
+        double error  = 0 ;
+        if ( !rule21 ( f , xmin , xmax , result , error ) )
+        { return Result ( BadFunction , result , error ) ; }          // RETURN
+        //
+        double tolerance = std::max ( aprecision , rprecision * std::abs ( result ) ) ;
+        if ( error <= tolerance ) { return Result ( Success , result , error ) ; }
+        if ( limit <= 1         ) { return Result ( MaxIterations , result , error ) ; }
+        //
+        Scratch scratch ;
+        Scratch::Segments& heap = scratch.segments () ;
+        heap.reserve ( limit ) ;
+        heap.push_back ( Segment { xmin , xmax , result , error } ) ;
+        //
+        static const double s_eps = std::numeric_limits<double>::epsilon () ;
+        //
+        int status = Success ;
+        while ( tolerance < error )
+        {
+          if ( limit <= heap.size () ) { status = MaxIterations ; break ; }
+          //
+          // the segment with the largest error
+          std::pop_heap ( heap.begin () , heap.end () ) ;
+          const Segment s = heap.back () ;
+          heap.pop_back () ;
+          //
+          const double a  = s.a ;
+          const double b  = s.b ;
+          const double c  = 0.5 * ( a + b ) ;
+          //
+          // the segment is too small to be bisected
+          if ( std::abs ( b - a ) <= 100 * s_eps * ( std::abs ( a ) + std::abs ( b ) ) )
+          {
+            heap.push_back ( s ) ;
+            std::push_heap ( heap.begin () , heap.end () ) ;
+            status = Singular ;
+            break ;
+          }
+          //
+          double r1 , e1 , r2 , e2 ;
+          if ( !rule21 ( f , a , c , r1 , e1 ) || !rule21 ( f , c , b , r2 , e2 ) )
+          { status = BadFunction ; break ; }
+          //
+          result += ( r1 + r2 ) - s.result ;
+          error  += ( e1 + e2 ) - s.error  ;
+          //
+          // no improvement: the roundoff dominates
+          if ( s.error <= e1 + e2 && e1 + e2 <= 50 * s_eps * std::abs ( r1 + r2 ) )
+          { status = RoundOff ; }
+          //
+          heap.push_back ( Segment { a , c , r1 , e1 } ) ;
+          std::push_heap ( heap.begin () , heap.end () ) ;
+          heap.push_back ( Segment { c , b , r2 , e2 } ) ;
+          std::push_heap ( heap.begin () , heap.end () ) ;
+          //
+          tolerance = std::max ( aprecision , rprecision * std::abs ( result ) ) ;
+          if ( RoundOff == status ) { break ; }
+        }
+        //
+        // recalculate sums to suppress accumulated rounding errors
+        long double sr = 0 ;
+        long double se = 0 ;
+        for ( const Segment& s : heap ) { sr += s.result ; se += s.error ; }
+        result = sr ;
+        error  = se ;
+        //
+        if ( error <= std::max ( aprecision , rprecision * std::abs ( result ) ) )
+        { status = Success ; }
+        //
+        return Result ( status , result , error ) ;
+      }
+      // ======================================================================
+    } //                         The end of namespace Ostap::Math::GaussKronrod
+    // ========================================================================
+  } //                                         The end of namespace Ostap::Math
+  // ==========================================================================
+} //                                                 The end of namespace Ostap
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_GAUSSKRONROD_H
+// ============================================================================
@@ -5,6 +5,9 @@
 // STD& STL
 // ============================================================================
 #include <cmath>
+#include <atomic>
+#include <vector>
+#include <utility>
 // ============================================================================
 // GSL 
 // ============================================================================
@@ -20,6 +23,8 @@
 // Local
 // ============================================================================
 #include "GSL_sentry.h"
+#include "Exception.h"
+#include "local_parallel.h"
 // ============================================================================
 namespace 
 {
@@ -28,6 +33,40 @@ namespace
   // ==========================================================================
   typedef Ostap::Math::GSL::Hesse::function function ;
   // ==========================================================================
+  /** @class Eval 
+   *  helper class to evaluate the function:
+   *  - the value at the central point is known and shared between all stencils
+   *  - the number of calls is counted 
+   */
+  class Eval 
+  {
+  public:
+    // ========================================================================
+    Eval ( function                    f      , 
+           void*                       params , 
+           const double                f0     , 
+           std::atomic<unsigned long>& calls  ) 
+      : m_f      ( f      ) 
+      , m_params ( params ) 
+      , m_f0     ( f0     ) 
+      , m_calls  ( calls  ) 
+    {}
+    // ========================================================================
+    /// evaluate the function 
+    double operator() ( const gsl_vector* x ) const 
+    { ++m_calls ; return (*m_f) ( x , m_params ) ; }
+    /// the value at the central point 
+    double f0 () const { return m_f0 ; }
+    // ========================================================================
+  private:
+    // ========================================================================
+    function                    m_f      ;
+    void*                       m_params ;
+    double                      m_f0     ;
+    std::atomic<unsigned long>& m_calls  ;
+    // ========================================================================
+  } ;
+  // ==========================================================================
   /// 1/sqrt(2) 
   const double s_SQRT2i = 1.0 / std::sqrt ( 2.0 ) ;                // 1/sqrt(2) 
   // ==========================================================================
@@ -138,7 +177,7 @@ namespace
   // get the second derivative along the direction d
   // ==========================================================================
   double deriv2_8
-  ( const gsl_multimin_function* f  , 
+  ( const Eval&                  f  , 
     const gsl_vector*            x  ,
     const gsl_vector*            d  ,
     double                       h  ,
@@ -153,9 +192,11 @@ namespace
     
     for ( std::size_t j = 0 ; j < 9 ; ++j ) 
     {
+      // the central point is shared between all stencils 
+      if ( 4 == j ) { values [ j ] = f.f0 () ; continue ; }
       const double s = ( j - 4.0 )  * h0 ;      
       _update_ ( x , d , s , a ) ;
-      values [ j ] = GSL_MULTIMIN_FN_EVAL_F( f , a  ) ;
+      values [ j ] = f ( a ) ;
     }
     //
     double xx = 0 ;
@@ -177,7 +218,7 @@ namespace
   // get the second derivative along the direction d
   // ==========================================================================
   double deriv2
-  ( const gsl_multimin_function* f , 
+  ( const Eval&                  f , 
     const gsl_vector*            x ,
     const gsl_vector*            d ,
     double                       h ,
@@ -228,7 +269,7 @@ namespace
   // get the second derivative along pseudo-axis 
   // ==========================================================================
   double deriv2 
-  ( const gsl_multimin_function* f , 
+  ( const Eval&                  f , 
     const gsl_vector*            x ,
     const unsigned short         i , 
     const unsigned short         j ,
@@ -255,6 +296,49 @@ namespace
     // ========================================================================
   }
   // ==========================================================================
+  /** @class Worker 
+   *  the private resources of the thread for hessian calculation:
+   *  helper vectors and (possibly cloned) parameters of the function 
+   */
+  class Worker 
+  {
+  public:
+    // ========================================================================
+    Worker ( const std::size_t                         n       , 
+             void*                                     params  , 
+             Ostap::Math::GSL::Hesse::clone_params     clone   , 
+             Ostap::Math::GSL::Hesse::delete_params    destroy ) 
+      : m_a       ( gsl_vector_calloc ( n ) ) 
+      , m_b       ( gsl_vector_calloc ( n ) ) 
+      , m_params  ( nullptr != clone ? clone ( params ) : params ) 
+      , m_destroy ( nullptr != clone ? destroy          : nullptr )
+    {}
+    // ========================================================================
+    ~Worker () 
+    {
+      if ( nullptr != m_destroy ) { m_destroy       ( m_params ) ; }
+      if ( nullptr != m_a       ) { gsl_vector_free ( m_a      ) ; }
+      if ( nullptr != m_b       ) { gsl_vector_free ( m_b      ) ; }
+    }
+    // ========================================================================
+    Worker ( const Worker& ) = delete ;
+    Worker& operator=( const Worker& ) = delete ;
+    // ========================================================================
+  public:
+    // ========================================================================
+    gsl_vector* a      () const { return m_a      ; }
+    gsl_vector* b      () const { return m_b      ; }
+    void*       params () const { return m_params ; }
+    // ========================================================================
+  private:
+    // ========================================================================
+    gsl_vector*                            m_a       ;
+    gsl_vector*                            m_b       ;
+    void*                                  m_params  ;
+    Ostap::Math::GSL::Hesse::delete_params m_destroy ;
+    // ========================================================================
+  } ;
+  // ==========================================================================
 } // end of namespace 
 // ============================================================================
 // HESSE 
@@ -267,16 +351,21 @@ namespace
  */
 // ============================================================================
 Ostap::Math::GSL::Hesse::Hesse
-( function          f      ,
-  const gsl_vector* x      ,
-  void*             params , 
-  const double      h      ) 
+( function          f       ,
+  const gsl_vector* x       ,
+  void*             params  , 
+  const double      h       , 
+  clone_params      clone   , 
+  delete_params     destroy ) 
 //
-  : m_func   ( f      ) 
-  , m_x      ( x      ) 
-  , m_params ( params ) 
+  : m_func    ( f       ) 
+  , m_x       ( x       ) 
+  , m_params  ( params  ) 
+  , m_clone   ( clone   ) 
+  , m_destroy ( destroy ) 
 //
-  , m_h      ( std::abs ( h ) )
+  , m_h       ( std::abs ( h ) )
+  , m_ncalls  ( 0       ) 
 //
   , m_hesse  ( 0      )
   , m_aux    ( 0      )
@@ -285,6 +374,10 @@ Ostap::Math::GSL::Hesse::Hesse
   , m_a      ( 0 ) 
   , m_b      ( 0 )
 {
+  Ostap::Assert ( ( nullptr == clone ) == ( nullptr == destroy )             , 
+                  "Both clone and delete functions must be specified"        , 
+                  "Ostap::Math::GSL::Hesse"                                  ) ;
+  //
   m_a     = gsl_vector_calloc ( x -> size ) ;
   m_b     = gsl_vector_calloc ( x -> size ) ;
   //
@@ -303,48 +396,82 @@ Ostap::Math::GSL::Hesse::~Hesse ()
   if ( 0 != m_b     ) { gsl_vector_free ( m_b     ) ; m_b     = 0 ; }
 }
 // ============================================================================
-Ostap::StatusCode Ostap::Math::GSL::Hesse::calcHesse ()
+Ostap::StatusCode Ostap::Math::GSL::Hesse::calcHesse () 
+{ return calcHesse ( 1 ) ; }
+// ============================================================================
+/*  calculate the hessian, distributing the independent directions 
+ *  between several threads 
+ *  @param nthreads number of threads, 0 means "all available cores"
+ */
+// ============================================================================
+Ostap::StatusCode Ostap::Math::GSL::Hesse::calcHesse 
+( const unsigned short nthreads )
 {
   //
   // if ( 0 == m_x    ) { return InvalidPoint    ; }
   // if ( 0 == m_func ) { return InvalidFunction ; }
   //
   if ( 0 != m_hesse ) { gsl_matrix_free ( m_hesse ) ; m_hesse = 0 ; }
-  if ( 0 != m_aux   ) { gsl_matrix_free ( m_aux   ) ; m_cov2  = 0 ; }
+  if ( 0 != m_aux   ) { gsl_matrix_free ( m_aux   ) ; m_aux   = 0 ; }
   //
   // allocate new matrix 
   //
   m_hesse = gsl_matrix_calloc ( size () , size () )  ;
   m_aux   = gsl_matrix_calloc ( size () , size () )  ;
   //
-  double error = 0 ;
-  //
-  gsl_multimin_function F ;
-  F.f      = m_func      ;
-  F.params = m_params    ;
-  F.n      = m_x -> size ;
-  //
-  // fill auxillary Hesse matrix 
-  for ( std::size_t i = 0 ; i < m_aux->size1 ; ++i ) 
-  {
-    //
-    for ( std::size_t j = 0 ; j < m_aux->size2 ; ++j )
-    {
-      //
-      const double hij = deriv2  ( &F       , 
-                                   m_x      , 
-                                   i        , 
-                                   j        , 
-                                   m_h      , 
-                                   &error   , 
-                                   m_a      ,  
-                                   m_b      ) ;
-      //
-      gsl_matrix_set ( m_aux , i , j , hij ) ;
-      //
-    }
-    //
-  }
+  std::atomic<unsigned long> ncalls { 1 } ;
+  //
+  // the central point is shared between all stencils 
+  const double f0 = (*m_func) ( m_x , m_params ) ;
+  //
+  // the independent directions: (i,j) and (j,i) are the same 
+  typedef std::pair<unsigned short,unsigned short> Direction ;
+  std::vector<Direction> directions ;
+  directions.reserve ( size () * ( size () + 1 ) / 2 ) ;
+  for ( std::size_t i = 0 ; i < size () ; ++i ) 
+  { for ( std::size_t j = i ; j < size () ; ++j ) 
+    { directions.emplace_back ( i , j ) ; } }
+  //
+  // the directions are picked up dynamically: the cost of each direction differs 
+  std::atomic<std::size_t> next { 0 } ;
+  const unsigned int nt = n_threads ( nthreads , directions.size () ) ;
+  //
+  parallel_for 
+    ( nt , 0 , nt , 
+      [this,nt,f0,&ncalls,&next,&directions] 
+      ( const unsigned int thread , 
+        const std::size_t  /* begin */ , 
+        const std::size_t  /* end   */ ) 
+      {
+        // the calling thread uses the original parameters 
+        const bool own = 1 < nt && 0 != thread ;
+        Worker worker ( size ()                            , 
+                        m_params                           , 
+                        own ? m_clone   : nullptr          , 
+                        own ? m_destroy : nullptr          ) ;
+        const Eval F ( m_func , worker.params () , f0 , ncalls ) ;
+        //
+        double error = 0 ;
+        for ( std::size_t k = next++ ; k < directions.size () ; k = next++ ) 
+        {
+          const unsigned short i = directions [ k ].first  ;
+          const unsigned short j = directions [ k ].second ;
+          //
+          const double hij = deriv2  ( F            , 
+                                       m_x          , 
+                                       i            , 
+                                       j            , 
+                                       m_h          , 
+                                       &error       , 
+                                       worker.a ()  ,  
+                                       worker.b ()  ) ;
+          //
+          gsl_matrix_set ( m_aux , i , j , hij ) ;
+          gsl_matrix_set ( m_aux , j , i , hij ) ;
+        }
+      } ) ;
+  //
+  m_ncalls = ncalls ;
   //
   // adjust hesse matrix 
   for ( std::size_t i = 0 ; i < m_hesse->size1 ; ++i ) 
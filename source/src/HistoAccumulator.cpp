@@ -0,0 +1,190 @@
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <algorithm>
+// ============================================================================
+// ROOT
+// ============================================================================
+#include "TH1.h"
+#include "TAxis.h"
+#include "TArrayD.h"
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/HistoAccumulator.h"
+// ============================================================================
+// Local
+// ============================================================================
+#include "Exception.h"
+// ============================================================================
+/** @file
+ *  Implementation file for class Ostap::Utils::HistoAccumulator
+ *  @see Ostap::Utils::HistoAccumulator
+ *  @author agent agent@local
+ *  @date   2026-10-19
+ */
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  /// the stripe index for the current thread
+  inline std::size_t _stripe_ ()
+  {
+    static std::atomic<std::size_t> s_threads { 0 } ;
+    static thread_local const std::size_t t_stripe = s_threads++ ;
+    return t_stripe ;
+  }
+  // ==========================================================================
+  /// atomic addition for doubles
+  inline void _add_ ( std::atomic<double>& a , const double v )
+  {
+    double old = a.load ( std::memory_order_relaxed ) ;
+    while ( !a.compare_exchange_weak ( old , old + v , std::memory_order_relaxed ) ) {}
+  }
+  // ==========================================================================
+} //                                                 end of anonymous namespace
+// ============================================================================
+// constructor from ROOT axis
+// ============================================================================
+Ostap::Utils::HistoAccumulator::Axis::Axis ( const TAxis& axis )
+  : m_nbins ( axis.GetNbins () )
+  , m_xmin  ( axis.GetXmin  () )
+  , m_xmax  ( axis.GetXmax  () )
+{
+  const TArrayD* bins = axis.GetXbins () ;
+  if ( bins && 0 < bins->GetSize () )
+  { m_edges.assign ( bins->GetArray () , bins->GetArray () + bins->GetSize () ) ; }
+}
+// ============================================================================
+// find the bin for the variable binning (as TMath::BinarySearch)
+// ============================================================================
+std::size_t Ostap::Utils::HistoAccumulator::Axis::_bin_ ( const double x ) const
+{ return std::upper_bound ( m_edges.begin () , m_edges.end () , x ) - m_edges.begin () ; }
+// ============================================================================
+// constructor from the histogram (only the binning is used)
+// ============================================================================
+Ostap::Utils::HistoAccumulator::HistoAccumulator
+( const TH1& histo )
+  : m_dim ( histo.GetDimension () )
+{
+  Ostap::Assert ( 1 <= m_dim && m_dim <= 3          ,
+                  "Invalid histogram dimension"     ,
+                  "Ostap::Utils::HistoAccumulator"  ) ;
+  //
+  if ( 1 <= m_dim ) { m_axes [ 0 ] = Axis ( *histo.GetXaxis () ) ; }
+  if ( 2 <= m_dim ) { m_axes [ 1 ] = Axis ( *histo.GetYaxis () ) ; }
+  if ( 3 <= m_dim ) { m_axes [ 2 ] = Axis ( *histo.GetZaxis () ) ; }
+  //
+  m_nx   = m_axes [ 0 ].m_nbins + 2 ;
+  m_ny   = 2 <= m_dim ? m_axes [ 1 ].m_nbins + 2 : 1 ;
+  m_size = m_nx * m_ny * ( 3 <= m_dim ? m_axes [ 2 ].m_nbins + 2 : 1 ) ;
+  //
+  Ostap::Assert ( (int) m_size == histo.GetNcells ()    ,
+                  "Inconsistent number of bins"         ,
+                  "Ostap::Utils::HistoAccumulator"      ) ;
+  //
+  m_bins   .reset ( new std::atomic<double> [ 2 * m_size ] ) ;
+  m_stripes.reset ( new Stripe              [ NStripes   ] ) ;
+  reset () ;
+}
+// ============================================================================
+/*  fill the global bin and (optionally) the moments 
+ *  @param bin   the global bin 
+ *  @param w     the weight 
+ *  @param x,y,z the values 
+ *  @param stats update the moments? (not for underflow/overflow bins)
+ */
+// ============================================================================
+void Ostap::Utils::HistoAccumulator::_fill_
+( const std::size_t bin   ,
+  const double      w     , 
+  const double      x     , 
+  const double      y     , 
+  const double      z     , 
+  const bool        stats )
+{
+  _add_ ( m_bins [ 2 * bin     ] , w     ) ;
+  _add_ ( m_bins [ 2 * bin + 1 ] , w * w ) ;
+  Stripe& stripe = m_stripes [ _stripe_ () % NStripes ] ;
+  stripe.m_n.fetch_add ( 1 , std::memory_order_relaxed ) ;
+  if ( !stats ) { return ; }                                      // RETURN
+  //
+  std::atomic<double>* s = stripe.m_stats ;
+  _add_ ( s [ 0 ] , w         ) ;
+  _add_ ( s [ 1 ] , w * w     ) ;
+  _add_ ( s [ 2 ] , w * x     ) ;
+  _add_ ( s [ 3 ] , w * x * x ) ;
+  if ( m_dim < 2 ) { return ; }                                   // RETURN
+  _add_ ( s [ 4 ] , w * y     ) ;
+  _add_ ( s [ 5 ] , w * y * y ) ;
+  _add_ ( s [ 6 ] , w * x * y ) ;
+  if ( m_dim < 3 ) { return ; }                                   // RETURN
+  _add_ ( s [ 7 ] , w * z     ) ;
+  _add_ ( s [ 8 ] , w * z * z ) ;
+  _add_ ( s [ 9 ] , w * x * z ) ;
+  _add_ ( s [10 ] , w * y * z ) ;
+}
+// ============================================================================
+// reset the content
+// ============================================================================
+void Ostap::Utils::HistoAccumulator::reset ()
+{
+  for ( std::size_t i = 0 ; i < 2 * m_size ; ++i )
+  { m_bins [ i ].store ( 0 , std::memory_order_relaxed ) ; }
+  for ( unsigned short i = 0 ; i < NStripes ; ++i )
+  {
+    m_stripes [ i ].m_n.store ( 0 , std::memory_order_relaxed ) ;
+    for ( unsigned short k = 0 ; k < NStats ; ++k ) 
+    { m_stripes [ i ].m_stats [ k ].store ( 0 , std::memory_order_relaxed ) ; }
+  }
+}
+// ============================================================================
+// number of entries
+// ============================================================================
+unsigned long Ostap::Utils::HistoAccumulator::entries () const
+{
+  unsigned long n = 0 ;
+  for ( unsigned short i = 0 ; i < NStripes ; ++i )
+  { n += m_stripes [ i ].m_n.load ( std::memory_order_relaxed ) ; }
+  return n ;
+}
+// ============================================================================
+/*  copy the content into the histogram
+ *  (the histogram must have the same number of bins)
+ */
+// ============================================================================
+void Ostap::Utils::HistoAccumulator::update ( TH1& histo ) const
+{
+  Ostap::Assert ( (int) m_size == histo.GetNcells () &&
+                  m_dim        == histo.GetDimension ()  ,
+                  "Inconsistent histogram binning"       ,
+                  "Ostap::Utils::HistoAccumulator"       ) ;
+  //
+  histo.Reset () ;
+  if ( 0 == histo.GetSumw2N () ) { histo.Sumw2 () ; }
+  TArrayD* sumw2 = histo.GetSumw2 () ;
+  //
+  for ( std::size_t bin = 0 ; bin < m_size ; ++bin )
+  {
+    histo.SetBinContent ( bin , content ( bin ) ) ;
+    sumw2->SetAt ( error2 ( bin ) , bin ) ;
+  }
+  //
+  // the exact moments, as accumulated by TH1::Fill 
+  double stats [ 13 ] = { 0 } ;
+  for ( unsigned short i = 0 ; i < NStripes ; ++i )
+  {
+    for ( unsigned short k = 0 ; k < NStats ; ++k ) 
+    { stats [ k ] += m_stripes [ i ].m_stats [ k ].load ( std::memory_order_relaxed ) ; }
+  }
+  //
+  // only the global bins were filled: use the bin centers 
+  if ( 0 == stats [ 0 ] && 0 == stats [ 1 ] ) { histo.ResetStats () ; }
+  else                                        { histo.PutStats ( stats ) ; }
+  histo.SetEntries ( entries () ) ;
+}
+// ============================================================================
+//                                                                      The END
+// ============================================================================
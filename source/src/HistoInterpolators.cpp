@@ -0,0 +1,634 @@
+// ============================================================================
+// Include files
+// ============================================================================
+// STD & STL
+// ============================================================================
+#include <cmath>
+#include <algorithm>
+// ============================================================================
+// ROOT
+// ============================================================================
+#include "TH1.h"
+#include "TH2.h"
+#include "TH3.h"
+#include "TAxis.h"
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/Math.h"
+#include "Ostap/HistoInterpolators.h"
+// ============================================================================
+// Local
+// ============================================================================
+#include "Exception.h"
+// ============================================================================
+/** @file
+ *  Implementation file for prepared histogram interpolators
+ *  @see Ostap::Math::HistoInterpolator1D
+ *  @see Ostap::Math::HistoInterpolator2D
+ *  @see Ostap::Math::HistoInterpolator3D
+ *  @author agent agent@local
+ *  @date   2026-10-19
+ */
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  typedef Ostap::Math::HistoInterpolation HI ;
+  /// equality criteria for doubles
+  const Ostap::Math::Equal_To<double> s_equal{} ; // equality criteria for doubles
+  /// zero for doubles
+  const Ostap::Math::Zero<double>     s_zero{}  ; // zero for doubles
+  // ==========================================================================
+  /// adjust the interpolation type to the number of bins
+  inline HI::Type _adjust_ ( const HI::Type t , const unsigned int nbins )
+  {
+    return
+      ( t <= HI::Nearest                      ) ? HI::Nearest    :
+      ( 1 >= nbins                            ) ? HI::Nearest    :
+      ( 2 == nbins  && t >= HI::Linear        ) ? HI::Linear     :
+      ( 3 == nbins  && t >= HI::Quadratic     ) ? HI::Quadratic  :
+      ( 4 == nbins  && t >= HI::Cubic         ) ? HI::Cubic      :
+      (                t >= HI::Cubic         ) ? HI::Cubic      : t ;
+  }
+  // ==========================================================================
+  /// quadratic coefficients: y = c0*v0 + c1*v1 + c2*v2
+  inline void _quadratic_
+  ( const double x  ,
+    const double x0 ,
+    const double x1 ,
+    const double x2 ,
+    double*      c  )
+  {
+    const double dx0  = x  - x0 ;
+    const double dx1  = x  - x1 ;
+    const double dx2  = x  - x2 ;
+    const double dx01 = x0 - x1 ;
+    const double dx02 = x0 - x2 ;
+    const double dx12 = x1 - x2 ;
+    c [ 0 ] =   dx1 * dx2 / ( dx01 * dx02 ) ;
+    c [ 1 ] = - dx0 * dx2 / ( dx01 * dx12 ) ;
+    c [ 2 ] =   dx0 * dx1 / ( dx02 * dx12 ) ;
+  }
+  // ==========================================================================
+  /// the type of the stencil: indices and coefficients
+  struct Stencil
+  {
+    unsigned short n ;
+    unsigned int   index [ Ostap::Math::HistoAxis::MaxSize ] ;
+    double         cv    [ Ostap::Math::HistoAxis::MaxSize ] ;
+    double         ce    [ Ostap::Math::HistoAxis::MaxSize ] ;
+  } ;
+  // ==========================================================================
+  inline bool _stencil_ ( const Ostap::Math::HistoAxis& a , const double x , Stencil& s )
+  {
+    s.n = a.stencil ( x , s.index , s.cv , s.ce ) ;
+    return 0 < s.n ;
+  }
+  // ==========================================================================
+  /// the squared error: suppress the numerical noise as HistoInterpolation does
+  inline double _e2_ ( const long double e2 )
+  { return ( 0 >= e2 || s_zero ( double ( e2 ) ) ) ? 0.0 : double ( e2 ) ; }
+  // ==========================================================================
+  /// get the bin content and squared error (with possible density scaling)
+  inline void _content_
+  ( const TH1&   h   ,
+    const int    bin ,
+    const double vol ,
+    const bool   density ,
+    double&      v   ,
+    double&      e2  )
+  {
+    v = h.GetBinContent ( bin ) ;
+    double e = h.GetBinError ( bin ) ;
+    if ( density ) { v /= vol ; e /= vol ; }
+    e2 = e * e ;
+  }
+  // ==========================================================================
+}
+// ============================================================================
+/*  constructor from the axis
+ *  @param axis        (INPUT) the axis
+ *  @param t           (INPUT) interpolation type
+ *  @param edges       (INPUT) use the special treatment of edges ?
+ *  @param extrapolate (INPUT) use extrapolation ?
+ */
+// ============================================================================
+Ostap::Math::HistoAxis::HistoAxis
+( const TAxis&                          axis        ,
+  const HistoInterpolation::Type        t           ,
+  const bool                            edges       ,
+  const bool                            extrapolate )
+  : m_edges       ()
+  , m_centres     ()
+  , m_xmin        ( axis.GetXmin () )
+  , m_xmax        ( axis.GetXmax () )
+  , m_uniform     ( 0 == axis.GetXbins()->GetSize() )
+  , m_scale       ( 1 )
+  , m_type        ( _adjust_ ( t , axis.GetNbins () ) )
+  , m_edges_      ( edges       )
+  , m_extrapolate ( extrapolate )
+{
+  const unsigned int nbins = axis.GetNbins () ;
+  Ostap::Assert ( 0 < nbins                       ,
+                  "Invalid number of bins"        ,
+                  "Ostap::Math::HistoAxis"        ) ;
+  //
+  m_edges  .resize ( nbins + 1 ) ;
+  m_centres.resize ( nbins     ) ;
+  for ( unsigned int i = 0 ; i < nbins ; ++i )
+  {
+    m_edges   [ i ] = axis.GetBinLowEdge ( i + 1 ) ;
+    m_centres [ i ] = axis.GetBinCenter  ( i + 1 ) ;
+  }
+  m_edges [ nbins ] = axis.GetBinUpEdge ( nbins ) ;
+  //
+  m_scale = nbins / ( m_xmax - m_xmin ) ;
+}
+// ============================================================================
+// find the bin: the same convention as TAxis::FindFixBin
+// ============================================================================
+unsigned int Ostap::Math::HistoAxis::find ( const double x ) const
+{
+  const unsigned int nbins = m_centres.size () ;
+  if      ( x <  m_xmin    ) { return 0         ; }
+  else if ( !( x < m_xmax ) ) { return nbins + 1 ; }
+  //
+  if ( m_uniform )
+  {
+    const unsigned int ib = 1 + static_cast<unsigned int> ( ( x - m_xmin ) * m_scale ) ;
+    return std::min ( ib , nbins ) ;
+  }
+  //
+  return std::upper_bound ( m_edges.begin () , m_edges.end () , x ) - m_edges.begin () ;
+}
+// ============================================================================
+/*  get the interpolation stencil for the given point
+ *  @param x     (INPUT)  the point
+ *  @param index (OUTPUT) 0-based bin indices
+ *  @param cv    (OUTPUT) coefficients for the bin values
+ *  @param ce    (OUTPUT) coefficients for the squared bin errors
+ *  @return number of points in stencil, 0 for the point outside the axis
+ */
+// ============================================================================
+unsigned short Ostap::Math::HistoAxis::stencil
+( const double  x     ,
+  unsigned int* index ,
+  double*       cv    ,
+  double*       ce    ) const
+{
+  //
+  if ( !m_extrapolate && ( x < m_xmin || m_xmax < x ) ) { return 0 ; }
+  //
+  const unsigned int nb = m_centres.size () ;
+  unsigned int       ib = find ( x ) ;
+  //
+  if      ( 0      == ib && s_equal ( x , m_xmin ) ) { ib += 1 ; }
+  else if ( nb + 1 == ib && s_equal ( x , m_xmax ) ) { ib -= 1 ; }
+  //
+  if      ( m_extrapolate &&      0 == ib ) { ib =  1 ; }
+  else if ( m_extrapolate && nb + 1 == ib ) { ib = nb ; }
+  //
+  if ( 0 == ib || nb < ib ) { return 0 ; }
+  //
+  HistoInterpolation::Type t = m_type ;
+  if ( HistoInterpolation::Nearest != t )
+  {
+    const double xc = m_centres [ ib - 1 ] ;
+    // special treatment of edges
+    if ( m_edges_ && !m_extrapolate &&
+         ( ( 1 == ib && x <= xc ) || ( nb == ib && xc <= x ) ) ) { t = HistoInterpolation::Nearest ; }
+    // we are at the bin centre
+    if ( HistoInterpolation::Nearest != t && s_equal ( xc , x ) ) { t = HistoInterpolation::Nearest ; }
+  }
+  //
+  if ( HistoInterpolation::Nearest == t )
+  {
+    index [ 0 ] = ib - 1 ;
+    cv    [ 0 ] = 1 ;
+    ce    [ 0 ] = 1 ;
+    return 1 ;
+  }
+  //
+  const double xc = m_centres [ ib - 1 ] ;
+  // bin centre, 1-based access 
+  auto c = [this] ( const unsigned int i ) { return m_centres [ i - 1 ] ; } ;
+  //
+  if ( HistoInterpolation::Linear == t )
+  {
+    const unsigned int i0 =
+      1  >= ib ? 1      :
+      nb <= ib ? nb - 1 :
+      x  <  xc ? ib - 1 : ib ;
+    const double x0 = c ( i0     ) ;
+    const double x1 = c ( i0 + 1 ) ;
+    const double dx = 1 / ( x0 - x1 ) ;
+    index [ 0 ] = i0 - 1 ; cv [ 0 ] = ( x  - x1 ) * dx ;
+    index [ 1 ] = i0     ; cv [ 1 ] = ( x0 - x  ) * dx ;
+    ce    [ 0 ] = cv [ 0 ] * cv [ 0 ] ;
+    ce    [ 1 ] = cv [ 1 ] * cv [ 1 ] ;
+    return 2 ;
+  }
+  //
+  if ( HistoInterpolation::Quadratic == t && 3 == nb )
+  {
+    _quadratic_ ( x , c ( 1 ) , c ( 2 ) , c ( 3 ) , cv ) ;
+    for ( unsigned short i = 0 ; i < 3 ; ++i )
+    { index [ i ] = i ; ce [ i ] = cv [ i ] * cv [ i ] ; }
+    return 3 ;
+  }
+  //
+  // four points: bi-quadratic or cubic
+  const unsigned int i0 =
+    2  >= ib     ? 1      :
+    nb <= ib + 1 ? nb - 3 :
+    x < xc       ? ib - 2 : ib - 1 ;
+  //
+  const double x0 = c ( i0     ) ;
+  const double x1 = c ( i0 + 1 ) ;
+  const double x2 = c ( i0 + 2 ) ;
+  const double x3 = c ( i0 + 3 ) ;
+  for ( unsigned short i = 0 ; i < 4 ; ++i ) { index [ i ] = i0 - 1 + i ; }
+  //
+  if ( HistoInterpolation::Quadratic == t )
+  {
+    double q1 [ 3 ] ;
+    double q2 [ 3 ] ;
+    if      ( x < x1 )
+    {
+      _quadratic_ ( x , x0 , x1 , x2 , q1 ) ;
+      cv [ 0 ] = q1 [ 0 ] ; cv [ 1 ] = q1 [ 1 ] ; cv [ 2 ] = q1 [ 2 ] ; cv [ 3 ] = 0 ;
+      for ( unsigned short i = 0 ; i < 4 ; ++i ) { ce [ i ] = cv [ i ] * cv [ i ] ; }
+    }
+    else if ( x > x2 )
+    {
+      _quadratic_ ( x , x1 , x2 , x3 , q2 ) ;
+      cv [ 0 ] = 0 ; cv [ 1 ] = q2 [ 0 ] ; cv [ 2 ] = q2 [ 1 ] ; cv [ 3 ] = q2 [ 2 ] ;
+      for ( unsigned short i = 0 ; i < 4 ; ++i ) { ce [ i ] = cv [ i ] * cv [ i ] ; }
+    }
+    else
+    {
+      // the average of two parabolas, treated as independent estimates
+      _quadratic_ ( x , x0 , x1 , x2 , q1 ) ;
+      _quadratic_ ( x , x1 , x2 , x3 , q2 ) ;
+      cv [ 0 ] = 0.5 *   q1 [ 0 ] ;
+      cv [ 1 ] = 0.5 * ( q1 [ 1 ] + q2 [ 0 ] ) ;
+      cv [ 2 ] = 0.5 * ( q1 [ 2 ] + q2 [ 1 ] ) ;
+      cv [ 3 ] = 0.5 *              q2 [ 2 ]   ;
+      ce [ 0 ] = 0.25 *   q1 [ 0 ] * q1 [ 0 ] ;
+      ce [ 1 ] = 0.25 * ( q1 [ 1 ] * q1 [ 1 ] + q2 [ 0 ] * q2 [ 0 ] ) ;
+      ce [ 2 ] = 0.25 * ( q1 [ 2 ] * q1 [ 2 ] + q2 [ 1 ] * q2 [ 1 ] ) ;
+      ce [ 3 ] = 0.25 *                         q2 [ 2 ] * q2 [ 2 ]   ;
+    }
+    return 4 ;
+  }
+  //
+  // cubic
+  const double dx0  = x  - x0 ;
+  const double dx1  = x  - x1 ;
+  const double dx2  = x  - x2 ;
+  const double dx3  = x  - x3 ;
+  const double dx01 = x0 - x1 ;
+  const double dx02 = x0 - x2 ;
+  const double dx03 = x0 - x3 ;
+  const double dx12 = x1 - x2 ;
+  const double dx13 = x1 - x3 ;
+  const double dx23 = x2 - x3 ;
+  //
+  cv [ 0 ] =         dx1 * dx2 * dx3 / ( dx01 * dx02 * dx03 ) ;
+  cv [ 1 ] = - dx0 *       dx2 * dx3 / ( dx01 * dx12 * dx13 ) ;
+  cv [ 2 ] =   dx0 * dx1 *       dx3 / ( dx02 * dx12 * dx23 ) ;
+  cv [ 3 ] = - dx0 * dx1 * dx2       / ( dx03 * dx13 * dx23 ) ;
+  for ( unsigned short i = 0 ; i < 4 ; ++i ) { ce [ i ] = cv [ i ] * cv [ i ] ; }
+  //
+  return 4 ;
+}
+// ============================================================================
+// 1D
+// ============================================================================
+/*  constructor from the histogram
+ *  @param h1          (INPUT) input histogram
+ *  @param t           (INPUT) interpolation type
+ *  @param edges       (INPUT) use the special treatment of edges ?
+ *  @param extrapolate (INPUT) use extrapolation ?
+ *  @param density     (INPUT) rescale to density?
+ */
+// ============================================================================
+Ostap::Math::HistoInterpolator1D::HistoInterpolator1D
+( const TH1&                     h1          ,
+  const HistoInterpolation::Type t           ,
+  const bool                     edges       ,
+  const bool                     extrapolate ,
+  const bool                     density     )
+  : m_x       ( *h1.GetXaxis () , t , edges , extrapolate )
+  , m_values  ()
+  , m_errors2 ()
+{
+  const unsigned int nx = m_x.nbins () ;
+  m_values .resize ( nx ) ;
+  m_errors2.resize ( nx ) ;
+  for ( unsigned int ix = 0 ; ix < nx ; ++ix )
+  {
+    _content_ ( h1 , ix + 1 , m_x.width ( ix ) , density ,
+                m_values [ ix ] , m_errors2 [ ix ] ) ;
+  }
+}
+// ============================================================================
+// get the interpolated value with error
+// ============================================================================
+Ostap::Math::ValueWithError
+Ostap::Math::HistoInterpolator1D::operator() ( const double x ) const
+{
+  Stencil sx ;
+  if ( !_stencil_ ( m_x , x , sx ) ) { return ValueWithError () ; }
+  //
+  long double v  = 0 ;
+  long double e2 = 0 ;
+  for ( unsigned short i = 0 ; i < sx.n ; ++i )
+  {
+    const unsigned int k = sx.index [ i ] ;
+    v  += sx.cv [ i ] * m_values  [ k ] ;
+    e2 += sx.ce [ i ] * m_errors2 [ k ] ;
+  }
+  return ValueWithError ( v , _e2_ ( e2 ) ) ;
+}
+// ============================================================================
+// get the interpolated value only
+// ============================================================================
+double Ostap::Math::HistoInterpolator1D::value ( const double x ) const
+{
+  Stencil sx ;
+  if ( !_stencil_ ( m_x , x , sx ) ) { return 0 ; }
+  //
+  double v = 0 ;
+  for ( unsigned short i = 0 ; i < sx.n ; ++i )
+  { v += sx.cv [ i ] * m_values [ sx.index [ i ] ] ; }
+  return v ;
+}
+// ============================================================================
+// batch evaluation: interpolated values only
+// ============================================================================
+void Ostap::Math::HistoInterpolator1D::evaluate
+( const unsigned long n      ,
+  const double*       x      ,
+  double*             result ) const
+{ for ( unsigned long i = 0 ; i < n ; ++i ) { result [ i ] = value ( x [ i ] ) ; } }
+// ============================================================================
+// batch evaluation: interpolated values only
+// ============================================================================
+std::vector<double>
+Ostap::Math::HistoInterpolator1D::evaluate ( const std::vector<double>& x ) const
+{
+  std::vector<double> result ( x.size () ) ;
+  evaluate ( x.size () , x.data () , result.data () ) ;
+  return result ;
+}
+// ============================================================================
+// 2D
+// ============================================================================
+/*  constructor from the histogram
+ *  @param h2          (INPUT) input histogram
+ *  @param tx          (INPUT) interpolation type in x-direction
+ *  @param ty          (INPUT) interpolation type in y-direction
+ *  @param edges       (INPUT) use the special treatment of edges ?
+ *  @param extrapolate (INPUT) use extrapolation ?
+ *  @param density     (INPUT) rescale to density?
+ */
+// ============================================================================
+Ostap::Math::HistoInterpolator2D::HistoInterpolator2D
+( const TH2&                     h2          ,
+  const HistoInterpolation::Type tx          ,
+  const HistoInterpolation::Type ty          ,
+  const bool                     edges       ,
+  const bool                     extrapolate ,
+  const bool                     density     )
+  : m_x       ( *h2.GetXaxis () , tx , edges , extrapolate )
+  , m_y       ( *h2.GetYaxis () , ty , edges , extrapolate )
+  , m_values  ()
+  , m_errors2 ()
+{
+  const unsigned int nx = m_x.nbins () ;
+  const unsigned int ny = m_y.nbins () ;
+  m_values .resize ( nx * ny ) ;
+  m_errors2.resize ( nx * ny ) ;
+  for ( unsigned int iy = 0 ; iy < ny ; ++iy )
+  {
+    for ( unsigned int ix = 0 ; ix < nx ; ++ix )
+    {
+      const unsigned int k = ix + nx * iy ;
+      _content_ ( h2 , h2.GetBin ( ix + 1 , iy + 1 ) ,
+                  m_x.width ( ix ) * m_y.width ( iy ) , density ,
+                  m_values [ k ] , m_errors2 [ k ] ) ;
+    }
+  }
+}
+// ============================================================================
+// get the interpolated value with error
+// ============================================================================
+Ostap::Math::ValueWithError
+Ostap::Math::HistoInterpolator2D::operator()
+  ( const double x , const double y ) const
+{
+  Stencil sx , sy ;
+  if ( !_stencil_ ( m_x , x , sx ) ) { return ValueWithError () ; }
+  if ( !_stencil_ ( m_y , y , sy ) ) { return ValueWithError () ; }
+  //
+  const unsigned int nx = m_x.nbins () ;
+  long double v  = 0 ;
+  long double e2 = 0 ;
+  for ( unsigned short j = 0 ; j < sy.n ; ++j )
+  {
+    const unsigned int ky = nx * sy.index [ j ] ;
+    for ( unsigned short i = 0 ; i < sx.n ; ++i )
+    {
+      const unsigned int k = sx.index [ i ] + ky ;
+      v  += sx.cv [ i ] * sy.cv [ j ] * m_values  [ k ] ;
+      e2 += sx.ce [ i ] * sy.ce [ j ] * m_errors2 [ k ] ;
+    }
+  }
+  return ValueWithError ( v , _e2_ ( e2 ) ) ;
+}
+// ============================================================================
+// get the interpolated value only
+// ============================================================================
+double Ostap::Math::HistoInterpolator2D::value
+( const double x , const double y ) const
+{
+  Stencil sx , sy ;
+  if ( !_stencil_ ( m_x , x , sx ) ) { return 0 ; }
+  if ( !_stencil_ ( m_y , y , sy ) ) { return 0 ; }
+  //
+  const unsigned int nx = m_x.nbins () ;
+  double v  = 0 ;
+  for ( unsigned short j = 0 ; j < sy.n ; ++j )
+  {
+    const unsigned int ky = nx * sy.index [ j ] ;
+    double vx = 0 ;
+    for ( unsigned short i = 0 ; i < sx.n ; ++i )
+    { vx += sx.cv [ i ] * m_values [ sx.index [ i ] + ky ] ; }
+    v += sy.cv [ j ] * vx ;
+  }
+  return v ;
+}
+// ============================================================================
+// batch evaluation: interpolated values only
+// ============================================================================
+void Ostap::Math::HistoInterpolator2D::evaluate
+( const unsigned long n      ,
+  const double*       x      ,
+  const double*       y      ,
+  double*             result ) const
+{ for ( unsigned long i = 0 ; i < n ; ++i ) { result [ i ] = value ( x [ i ] , y [ i ] ) ; } }
+// ============================================================================
+// batch evaluation: interpolated values only
+// ============================================================================
+std::vector<double>
+Ostap::Math::HistoInterpolator2D::evaluate
+( const std::vector<double>& x ,
+  const std::vector<double>& y ) const
+{
+  Ostap::Assert ( x.size () == y.size ()          ,
+                  "Mismatch in array sizes"       ,
+                  "Ostap::Math::HistoInterpolator2D" ) ;
+  std::vector<double> result ( x.size () ) ;
+  evaluate ( x.size () , x.data () , y.data () , result.data () ) ;
+  return result ;
+}
+// ============================================================================
+// 3D
+// ============================================================================
+/*  constructor from the histogram
+ *  @param h3          (INPUT) input histogram
+ *  @param tx          (INPUT) interpolation type in x-direction
+ *  @param ty          (INPUT) interpolation type in y-direction
+ *  @param tz          (INPUT) interpolation type in z-direction
+ *  @param edges       (INPUT) use the special treatment of edges ?
+ *  @param extrapolate (INPUT) use extrapolation ?
+ *  @param density     (INPUT) rescale to density?
+ */
+// ============================================================================
+Ostap::Math::HistoInterpolator3D::HistoInterpolator3D
+( const TH3&                     h3          ,
+  const HistoInterpolation::Type tx          ,
+  const HistoInterpolation::Type ty          ,
+  const HistoInterpolation::Type tz          ,
+  const bool                     edges       ,
+  const bool                     extrapolate ,
+  const bool                     density     )
+  : m_x       ( *h3.GetXaxis () , tx , edges , extrapolate )
+  , m_y       ( *h3.GetYaxis () , ty , edges , extrapolate )
+  , m_z       ( *h3.GetZaxis () , tz , edges , extrapolate )
+  , m_values  ()
+  , m_errors2 ()
+{
+  const unsigned int nx = m_x.nbins () ;
+  const unsigned int ny = m_y.nbins () ;
+  const unsigned int nz = m_z.nbins () ;
+  m_values .resize ( nx * ny * nz ) ;
+  m_errors2.resize ( nx * ny * nz ) ;
+  for ( unsigned int iz = 0 ; iz < nz ; ++iz )
+  {
+    for ( unsigned int iy = 0 ; iy < ny ; ++iy )
+    {
+      for ( unsigned int ix = 0 ; ix < nx ; ++ix )
+      {
+        const unsigned int k = ix + nx * ( iy + ny * iz ) ;
+        _content_ ( h3 , h3.GetBin ( ix + 1 , iy + 1 , iz + 1 ) ,
+                    m_x.width ( ix ) * m_y.width ( iy ) * m_z.width ( iz ) , density ,
+                    m_values [ k ] , m_errors2 [ k ] ) ;
+      }
+    }
+  }
+}
+// ============================================================================
+// get the interpolated value with error
+// ============================================================================
+Ostap::Math::ValueWithError
+Ostap::Math::HistoInterpolator3D::operator()
+  ( const double x , const double y , const double z ) const
+{
+  Stencil sx , sy , sz ;
+  if ( !_stencil_ ( m_x , x , sx ) ) { return ValueWithError () ; }
+  if ( !_stencil_ ( m_y , y , sy ) ) { return ValueWithError () ; }
+  if ( !_stencil_ ( m_z , z , sz ) ) { return ValueWithError () ; }
+  //
+  const unsigned int nx = m_x.nbins () ;
+  const unsigned int ny = m_y.nbins () ;
+  long double v  = 0 ;
+  long double e2 = 0 ;
+  for ( unsigned short l = 0 ; l < sz.n ; ++l )
+  {
+    for ( unsigned short j = 0 ; j < sy.n ; ++j )
+    {
+      const unsigned int kyz = nx * ( sy.index [ j ] + ny * sz.index [ l ] ) ;
+      const double       cyz = sy.cv [ j ] * sz.cv [ l ] ;
+      const double       eyz = sy.ce [ j ] * sz.ce [ l ] ;
+      for ( unsigned short i = 0 ; i < sx.n ; ++i )
+      {
+        const unsigned int k = sx.index [ i ] + kyz ;
+        v  += sx.cv [ i ] * cyz * m_values  [ k ] ;
+        e2 += sx.ce [ i ] * eyz * m_errors2 [ k ] ;
+      }
+    }
+  }
+  return ValueWithError ( v , _e2_ ( e2 ) ) ;
+}
+// ============================================================================
+// get the interpolated value only
+// ============================================================================
+double Ostap::Math::HistoInterpolator3D::value
+( const double x , const double y , const double z ) const
+{
+  Stencil sx , sy , sz ;
+  if ( !_stencil_ ( m_x , x , sx ) ) { return 0 ; }
+  if ( !_stencil_ ( m_y , y , sy ) ) { return 0 ; }
+  if ( !_stencil_ ( m_z , z , sz ) ) { return 0 ; }
+  //
+  const unsigned int nx = m_x.nbins () ;
+  const unsigned int ny = m_y.nbins () ;
+  double v = 0 ;
+  for ( unsigned short l = 0 ; l < sz.n ; ++l )
+  {
+    for ( unsigned short j = 0 ; j < sy.n ; ++j )
+    {
+      const unsigned int kyz = nx * ( sy.index [ j ] + ny * sz.index [ l ] ) ;
+      double vx = 0 ;
+      for ( unsigned short i = 0 ; i < sx.n ; ++i )
+      { vx += sx.cv [ i ] * m_values [ sx.index [ i ] + kyz ] ; }
+      v += sy.cv [ j ] * sz.cv [ l ] * vx ;
+    }
+  }
+  return v ;
+}
+// ============================================================================
+// batch evaluation: interpolated values only
+// ============================================================================
+void Ostap::Math::HistoInterpolator3D::evaluate
+( const unsigned long n      ,
+  const double*       x      ,
+  const double*       y      ,
+  const double*       z      ,
+  double*             result ) const
+{
+  for ( unsigned long i = 0 ; i < n ; ++i )
+  { result [ i ] = value ( x [ i ] , y [ i ] , z [ i ] ) ; }
+}
+// ============================================================================
+// batch evaluation: interpolated values only
+// ============================================================================
+std::vector<double>
+Ostap::Math::HistoInterpolator3D::evaluate
+( const std::vector<double>& x ,
+  const std::vector<double>& y ,
+  const std::vector<double>& z ) const
+{
+  Ostap::Assert ( x.size () == y.size () && x.size () == z.size () ,
+                  "Mismatch in array sizes"                        ,
+                  "Ostap::Math::HistoInterpolator3D"               ) ;
+  std::vector<double> result ( x.size () ) ;
+  evaluate ( x.size () , x.data () , y.data () , z.data () , result.data () ) ;
+  return result ;
+}
+// ============================================================================
+//                                                                      The END
+// ============================================================================
@@ -0,0 +1,297 @@
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <algorithm>
+// ============================================================================
+// ROOT
+// ============================================================================
+#include "TH1.h"
+#include "TAxis.h"
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/HistoParam.h"
+#include "Ostap/Chi2Fit.h"
+#include "Ostap/Bernstein.h"
+#include "Ostap/Polynomials.h"
+#include "Ostap/BSpline.h"
+// ============================================================================
+// Local
+// ============================================================================
+#include "Exception.h"
+// ============================================================================
+/** @file
+ *  Implementation file for class Ostap::Utils::HistoParam
+ *  @see Ostap::Utils::HistoParam
+ *  @author agent agent@local
+ *  @date   2026-10-19
+ */
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  /** get the averages of the basic functions over the bins:
+   *  \f$ F_{ik} = \frac{1}{h_i-l_i} \int_{l_i}^{h_i} f_k(x) dx \f$
+   *  @return matrix F (row-major, row per bin)
+   */
+  template <class FUNCTION>
+  std::vector<double> _averages_
+  ( const FUNCTION&            func ,
+    const std::vector<double>& low  ,
+    const std::vector<double>& high )
+  {
+    const std::size_t N = low.size    () ;
+    const std::size_t M = func.npars  () ;
+    std::vector<double> F ( N * M , 0.0 ) ;
+    //
+    FUNCTION f { func } ;
+    for ( unsigned short k = 0 ; k < M ; ++k ) { f.setPar ( k , 0.0 ) ; }
+    //
+    for ( unsigned short k = 0 ; k < M ; ++k )
+    {
+      f.setPar ( k , 1.0 ) ;
+      for ( std::size_t i = 0 ; i < N ; ++i )
+      { F [ i * M + k ] = f.integral ( low [ i ] , high [ i ] ) / ( high [ i ] - low [ i ] ) ; }
+      f.setPar ( k , 0.0 ) ;
+    }
+    return F ;
+  }
+  // ==========================================================================
+  /** the transformation from the non-negative parameters to
+   *  the coefficients of Bernstein polynomial of degree n: c = T u, u >= 0.
+   *  The columns of T are the generators of the cone of the coefficients,
+   *  that satisfy the (sufficient) shape constraints.
+   *  @return matrix T (row-major), empty for the unconstrained case
+   */
+  std::vector<double> _transform_
+  ( const Ostap::Utils::HistoParam::Shape shape ,
+    const unsigned short                  n     )
+  {
+    typedef Ostap::Utils::HistoParam HP ;
+    const unsigned short M = n + 1 ;
+    std::vector<double> T ;
+    if ( HP::Unconstrained == shape ) { return T ; }
+    //
+    T.assign ( M * M , 0.0 ) ;
+    //
+    for ( unsigned short k = 0 ; k < M ; ++k )
+    {
+      // mirror the row for the decreasing shapes
+      const bool decreasing =
+        HP::Decreasing        == shape ||
+        HP::ConvexDecreasing  == shape ||
+        HP::ConcaveDecreasing == shape ;
+      const unsigned short r = decreasing ? n - k : k ;
+      //
+      for ( unsigned short j = 0 ; j < M ; ++j )
+      {
+        double t = 0 ;
+        switch ( shape )
+        {
+        case HP::Positive :
+          t = j == r ? 1 : 0 ; break ;
+        case HP::Increasing :
+        case HP::Decreasing :
+          // the differences are non-negative
+          t = j <= r ? 1 : 0 ; break ;
+        case HP::ConvexIncreasing  :
+        case HP::ConvexDecreasing  :
+          // the differences are non-negative and non-decreasing
+          t = 0 == j ? 1 : j <= r ? r - j + 1 : 0 ; break ;
+        case HP::ConcaveIncreasing :
+        case HP::ConcaveDecreasing :
+          // the differences are non-negative and non-increasing
+          t = 0 == j ? 1 : std::min ( j , r ) ; break ;
+        default : break ;
+        }
+        T [ k * M + j ] = t ;
+      }
+    }
+    return T ;
+  }
+  // ==========================================================================
+} //                                                 end of anonymous namespace
+// ============================================================================
+// constructor from the histogram
+// ============================================================================
+Ostap::Utils::HistoParam::HistoParam
+( const TH1&   histo ,
+  const double xmin  ,
+  const double xmax  )
+{
+  Ostap::Assert ( 1 == histo.GetDimension ()      ,
+                  "Invalid histogram dimension"   ,
+                  "Ostap::Utils::HistoParam"      ) ;
+  //
+  const TAxis* axis  = histo.GetXaxis () ;
+  const int    nbins = axis->GetNbins () ;
+  m_low    .reserve ( nbins ) ;
+  m_high   .reserve ( nbins ) ;
+  m_content.reserve ( nbins ) ;
+  //
+  for ( int i = 1 ; i <= nbins ; ++i )
+  {
+    const double xc = axis->GetBinCenter ( i ) ;
+    if ( xc < xmin || xmax < xc ) { continue ; }
+    //
+    const double e  = histo.GetBinError  ( i ) ;
+    if ( !( 0 < e ) ) { continue ; }                 // skip the bins without errors
+    //
+    m_low    .push_back ( axis->GetBinLowEdge ( i ) ) ;
+    m_high   .push_back ( axis->GetBinUpEdge  ( i ) ) ;
+    m_content.emplace_back ( histo.GetBinContent ( i ) , e * e ) ;
+  }
+}
+// ============================================================================
+/*  solve the weighted least squares problem for the bin averages
+ *  @param F    the averages of basic functions over the bins
+ *  @param T    the transformation to non-negative parameters (or empty)
+ *  @param pars (output) the parameters
+ */
+// ============================================================================
+Ostap::Utils::HistoParam::Result
+Ostap::Utils::HistoParam::_solve_
+( const std::vector<double>& F    ,
+  const std::vector<double>& T    ,
+  std::vector<double>&       pars ) const
+{
+  Result result ;
+  //
+  const std::size_t N = m_content.size () ;
+  const std::size_t M = N ? F.size () / N : 0 ;
+  result.m_npars = M ;
+  //
+  if ( 0 == M || N < M ) { result.m_status = Ostap::StatusCode ( 810 ) ; return result ; }
+  //
+  // the components: the basic functions or the generators of the cone
+  typedef Ostap::Math::Chi2Fit::DATA DATA ;
+  Ostap::Math::Chi2Fit::CMPS cmps ( M , DATA ( N ) ) ;
+  for ( std::size_t i = 0 ; i < N ; ++i )
+  {
+    for ( std::size_t j = 0 ; j < M ; ++j )
+    {
+      double g = 0 ;
+      if ( T.empty () ) { g = F [ i * M + j ] ; }
+      else { for ( std::size_t k = 0 ; k < M ; ++k ) { g += F [ i * M + k ] * T [ k * M + j ] ; } }
+      cmps [ j ][ i ] = g ;
+    }
+  }
+  //
+  const Ostap::Math::Chi2Fit fit
+    ( m_content , cmps ,
+      T.empty () ? Ostap::Math::Chi2Fit::Linear : Ostap::Math::Chi2Fit::NonNegative ) ;
+  //
+  result.m_status = fit.status () ;
+  if ( result.m_status.isFailure () ) { return result ; }
+  //
+  result.m_chi2   = fit.chi2   () ;
+  result.m_points = fit.points () ;
+  result.m_cov2.assign ( M * M , 0.0 ) ;
+  pars         .assign ( M     , 0.0 ) ;
+  //
+  if ( T.empty () )
+  {
+    for ( std::size_t i = 0 ; i < M ; ++i )
+    {
+      pars [ i ] = fit.param ( i ).value () ;
+      for ( std::size_t j = 0 ; j < M ; ++j )
+      { result.m_cov2 [ i * M + j ] = fit.cov2 ( i , j ) ; }
+    }
+    return result ;
+  }
+  //
+  // c = T u , C(c) = T C(u) T^T
+  std::vector<double> TC ( M * M , 0.0 ) ;
+  for ( std::size_t i = 0 ; i < M ; ++i )
+  {
+    for ( std::size_t j = 0 ; j < M ; ++j )
+    {
+      pars [ i ] += T [ i * M + j ] * fit.param ( j ).value () ;
+      for ( std::size_t k = 0 ; k < M ; ++k )
+      { TC [ i * M + j ] += T [ i * M + k ] * fit.cov2 ( k , j ) ; }
+    }
+  }
+  for ( std::size_t i = 0 ; i < M ; ++i )
+  {
+    for ( std::size_t j = 0 ; j < M ; ++j )
+    {
+      double c = 0 ;
+      for ( std::size_t k = 0 ; k < M ; ++k ) { c += TC [ i * M + k ] * T [ j * M + k ] ; }
+      result.m_cov2 [ i * M + j ] = c ;
+    }
+  }
+  return result ;
+}
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  /// set the parameters of the function
+  template <class FUNCTION>
+  void _set_ ( FUNCTION& func , const std::vector<double>& pars )
+  { for ( unsigned short k = 0 ; k < pars.size () ; ++k ) { func.setPar ( k , pars [ k ] ) ; } }
+  // ==========================================================================
+} //                                                 end of anonymous namespace
+// ============================================================================
+// parameterize the histogram with Bernstein polynomial
+// ============================================================================
+Ostap::Utils::HistoParam::Result
+Ostap::Utils::HistoParam::fit
+( Ostap::Math::Bernstein& func  ,
+  const Shape             shape ) const
+{
+  std::vector<double> pars ;
+  const Result r = _solve_ ( _averages_  ( func  , m_low , m_high ) ,
+                             _transform_ ( shape , func.degree () ) , pars ) ;
+  if ( r.status ().isSuccess () ) { _set_ ( func , pars ) ; }
+  return r ;
+}
+// ============================================================================
+// parameterize the histogram with Chebyshev sum
+// ============================================================================
+Ostap::Utils::HistoParam::Result
+Ostap::Utils::HistoParam::fit ( Ostap::Math::ChebyshevSum& func ) const
+{
+  std::vector<double> pars ;
+  const Result r = _solve_ ( _averages_ ( func , m_low , m_high ) , {} , pars ) ;
+  if ( r.status ().isSuccess () ) { _set_ ( func , pars ) ; }
+  return r ;
+}
+// ============================================================================
+// parameterize the histogram with Legendre sum
+// ============================================================================
+Ostap::Utils::HistoParam::Result
+Ostap::Utils::HistoParam::fit ( Ostap::Math::LegendreSum& func ) const
+{
+  std::vector<double> pars ;
+  const Result r = _solve_ ( _averages_ ( func , m_low , m_high ) , {} , pars ) ;
+  if ( r.status ().isSuccess () ) { _set_ ( func , pars ) ; }
+  return r ;
+}
+// ============================================================================
+// parameterize the histogram with polynomial
+// ============================================================================
+Ostap::Utils::HistoParam::Result
+Ostap::Utils::HistoParam::fit ( Ostap::Math::Polynomial& func ) const
+{
+  std::vector<double> pars ;
+  const Result r = _solve_ ( _averages_ ( func , m_low , m_high ) , {} , pars ) ;
+  if ( r.status ().isSuccess () ) { _set_ ( func , pars ) ; }
+  return r ;
+}
+// ============================================================================
+// parameterize the histogram with B-spline
+// ============================================================================
+Ostap::Utils::HistoParam::Result
+Ostap::Utils::HistoParam::fit ( Ostap::Math::BSpline& func ) const
+{
+  std::vector<double> pars ;
+  const Result r = _solve_ ( _averages_ ( func , m_low , m_high ) , {} , pars ) ;
+  if ( r.status ().isSuccess () ) { _set_ ( func , pars ) ; }
+  return r ;
+}
+// ============================================================================
+//                                                                      The END
+// ============================================================================
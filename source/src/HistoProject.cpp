@@ -14,7 +14,10 @@
 #include "Ostap/StatVar.h"
 #include "Ostap/Formula.h"
 #include "Ostap/HistoProject.h"
+#include "Ostap/DataSnapshot.h"
 #include "Ostap/Iterator.h"
+#include "Ostap/HistoAccumulator.h"
+#include "Ostap/ThreadPool.h"
 // ============================================================================
 #include "OstapDataFrame.h"
 // ============================================================================
@@ -30,6 +33,9 @@ namespace
   // ==========================================================================
   static_assert (std::numeric_limits<unsigned long>::is_specialized   , 
                  "Numeric_limist<unsigned long> are not specialized!" ) ;
+  // ==========================================================================
+  /// chunk size for the parallel filling
+  const std::size_t s_CHUNK = 10000 ;
   // ========================================================================== 
   /// get variable by name from RooArgSet
   RooAbsReal* get_var ( const RooArgSet&   aset , 
@@ -39,6 +45,28 @@ namespace
     return 0 != arg ? dynamic_cast<RooAbsReal*> ( arg ) : nullptr ;
   }
   // ==========================================================================
+  /** fill the accumulator from the columnar snapshot in parallel,
+   *  <code>fill(i)</code> is invoked for each row with non-null weight
+   *  @param N    number of rows
+   *  @param w    the weights
+   *  @param fill the action
+   */
+  template <class FILL>
+  void _fill_
+  ( const unsigned long                 N    ,
+    const Ostap::DataSnapshot::Column&  w    ,
+    FILL                                fill )
+  {
+    Ostap::Utils::TaskGroup group ;
+    group.parallel_for ( 0 , N , s_CHUNK , 
+                         [&w,&fill] ( const std::size_t begin , const std::size_t end ) 
+                         { 
+                           for ( std::size_t i = begin ; i < end ; ++i ) 
+                           { if ( w [ i ] ) { fill ( i ) ; } } // skip null weights 
+                         } ) ;
+    group.wait () ;
+  }
+  // ==========================================================================
 }
 // ============================================================================
 /** make a projection of RooDataSet into the histogram 
@@ -426,19 +454,19 @@ Ostap::StatusCode Ostap::HistoProject::project
   if ( 0 == histo ) { return Ostap::StatusCode ( 301 ) ; }
   else { histo->Reset() ; } // reset the histogram 
   //
-  TH1D model {} ; histo->Copy ( model ) ;
-  //
   const bool no_cuts = trivial ( selection ) ;
   //
   const std::string xvar   = Ostap::tmp_name ( "vx_" , expression ) ;
   const std::string weight = Ostap::tmp_name ( "w_"  , selection  ) ;
   //
-  auto h = data
+  // all slots fill the same accumulator: no per-slot histograms 
+  Ostap::Utils::HistoAccumulator acc { *histo } ;
+  data
     .Define  ( xvar   ,                   "1.0*(" + expression + ")" )
     .Define  ( weight , no_cuts ? "1.0" : "1.0*(" + selection  + ")" ) 
-    .Histo1D ( model  , xvar , weight ) ;
+    .Foreach ( [&acc] ( double x , double w ) { acc.fill ( x , w ) ; } , { xvar , weight } ) ;
   //
-  h->Copy ( *histo ) ;
+  acc.update ( *histo ) ;
   //
   return Ostap::StatusCode::SUCCESS ;
 }
@@ -468,15 +496,16 @@ Ostap::StatusCode Ostap::HistoProject::project2
   const std::string yvar   = Ostap::tmp_name ( "vy_" , yexpression ) ;
   const std::string weight = Ostap::tmp_name ( "w_"  , selection   ) ;
   //
-  TH2D model {} ; histo->Copy ( model ) ;
-  //
-  auto h = data
+  // all slots fill the same accumulator: no per-slot histograms 
+  Ostap::Utils::HistoAccumulator acc { *histo } ;
+  data
     .Define  ( xvar   ,                   "1.0*(" + xexpression + ")" )
     .Define  ( yvar   ,                   "1.0*(" + yexpression + ")" )
     .Define  ( weight , no_cuts ? "1.0" : "1.0*(" + selection   + ")" ) 
-    .Histo2D ( model  , xvar , yvar , weight ) ;
+    .Foreach ( [&acc] ( double x , double y , double w ) { acc.fill ( x , y , w ) ; } ,
+               { xvar , yvar , weight } ) ;
   //
-  h->Copy ( *histo ) ;
+  acc.update ( *histo ) ;
   //
   return Ostap::StatusCode::SUCCESS ;
 }
@@ -509,20 +538,116 @@ Ostap::StatusCode Ostap::HistoProject::project3
   const std::string zvar   = Ostap::tmp_name ( "vz_" , yexpression ) ;
   const std::string weight = Ostap::tmp_name ( "w_"  , selection   ) ;
   //
-  //
-  TH3D model {} ; histo->Copy ( model ) ;
-  //
-  auto h = data
+  // all slots fill the same accumulator: no per-slot histograms 
+  Ostap::Utils::HistoAccumulator acc { *histo } ;
+  data
     .Define  ( xvar   ,                   "1.0*(" + xexpression + ")" )
     .Define  ( yvar   ,                   "1.0*(" + yexpression + ")" )
     .Define  ( zvar   ,                   "1.0*(" + zexpression + ")" )
     .Define  ( weight , no_cuts ? "1.0" : "1.0*(" + selection   + ")" ) 
-    .Histo3D ( model  , xvar , yvar , zvar ,  weight ) ;
+    .Foreach ( [&acc] ( double x , double y , double z , double w ) { acc.fill ( x , y , z , w ) ; } ,
+               { xvar , yvar , zvar , weight } ) ;
   //
-  h->Copy ( *histo ) ;
+  acc.update ( *histo ) ;
   //
   return Ostap::StatusCode::SUCCESS ;
 }
 // ============================================================================
+/*  make a projection of the columnar snapshot into the histogram 
+ *  @param data       (INPUT)  the columnar snapshot of data 
+ *  @param histo      (UPDATE) histogram 
+ *  @param expression (INPUT)  expression
+ *  @param selection  (INPUT)  selection criteria/weight 
+ */
+// ============================================================================
+Ostap::StatusCode Ostap::HistoProject::project
+( Ostap::DataSnapshot& data       , 
+  TH1*                 histo      ,
+  const std::string&   expression ,
+  const std::string&   selection  ) 
+{
+  //
+  if ( 0 == histo ) { return Ostap::StatusCode ( 301 ) ; }
+  else { histo->Reset() ; } // reset the histogram 
+  if ( data.empty() ) { return Ostap::StatusCode::SUCCESS ; }
+  //
+  Ostap::DataSnapshot::Column _w ;
+  const Ostap::DataSnapshot::Column& x = data.column  ( expression ) ;
+  const Ostap::DataSnapshot::Column& w = data.weights ( selection , _w ) ;
+  //
+  Ostap::Utils::HistoAccumulator acc { *histo } ;
+  _fill_ ( data.size () , w , [&] ( const std::size_t i ) { acc.fill ( x [ i ] , w [ i ] ) ; } ) ;
+  acc.update ( *histo ) ;
+  //
+  return StatusCode::SUCCESS ;  
+}
+// ============================================================================
+/*  make a projection of the columnar snapshot into the histogram 
+ *  @param data        (INPUT)  the columnar snapshot of data 
+ *  @param histo       (UPDATE) histogram 
+ *  @param xexpression (INPUT)  expression for x-axis 
+ *  @param yexpression (INPUT)  expression for y-axis 
+ *  @param selection   (INPUT)  selection criteria/weight 
+ */
+// ============================================================================
+Ostap::StatusCode Ostap::HistoProject::project2
+( Ostap::DataSnapshot& data        , 
+  TH2*                 histo       ,
+  const std::string&   xexpression ,
+  const std::string&   yexpression ,
+  const std::string&   selection   ) 
+{
+  //
+  if ( 0 == histo ) { return Ostap::StatusCode ( 301 ) ; }
+  else { histo->Reset() ; } // reset the histogram 
+  if ( data.empty() ) { return Ostap::StatusCode::SUCCESS ; }
+  //
+  Ostap::DataSnapshot::Column _w ;
+  const Ostap::DataSnapshot::Column& x = data.column  ( xexpression ) ;
+  const Ostap::DataSnapshot::Column& y = data.column  ( yexpression ) ;
+  const Ostap::DataSnapshot::Column& w = data.weights ( selection , _w ) ;
+  //
+  Ostap::Utils::HistoAccumulator acc { *histo } ;
+  _fill_ ( data.size () , w , [&] ( const std::size_t i ) { acc.fill ( x [ i ] , y [ i ] , w [ i ] ) ; } ) ;
+  acc.update ( *histo ) ;
+  //
+  return StatusCode::SUCCESS ;  
+}
+// ============================================================================
+/*  make a projection of the columnar snapshot into the histogram 
+ *  @param data        (INPUT)  the columnar snapshot of data 
+ *  @param histo       (UPDATE) histogram 
+ *  @param xexpression (INPUT)  expression for x-axis 
+ *  @param yexpression (INPUT)  expression for y-axis 
+ *  @param zexpression (INPUT)  expression for z-axis 
+ *  @param selection   (INPUT)  selection criteria/weight 
+ */
+// ============================================================================
+Ostap::StatusCode Ostap::HistoProject::project3
+( Ostap::DataSnapshot& data        , 
+  TH3*                 histo       ,
+  const std::string&   xexpression ,
+  const std::string&   yexpression ,
+  const std::string&   zexpression ,
+  const std::string&   selection   ) 
+{
+  //
+  if ( 0 == histo ) { return Ostap::StatusCode ( 301 ) ; }
+  else { histo->Reset() ; } // reset the histogram 
+  if ( data.empty() ) { return Ostap::StatusCode::SUCCESS ; }
+  //
+  Ostap::DataSnapshot::Column _w ;
+  const Ostap::DataSnapshot::Column& x = data.column  ( xexpression ) ;
+  const Ostap::DataSnapshot::Column& y = data.column  ( yexpression ) ;
+  const Ostap::DataSnapshot::Column& z = data.column  ( zexpression ) ;
+  const Ostap::DataSnapshot::Column& w = data.weights ( selection , _w ) ;
+  //
+  Ostap::Utils::HistoAccumulator acc { *histo } ;
+  _fill_ ( data.size () , w , [&] ( const std::size_t i ) { acc.fill ( x [ i ] , y [ i ] , z [ i ] , w [ i ] ) ; } ) ;
+  acc.update ( *histo ) ;
+  //
+  return StatusCode::SUCCESS ;  
+}
+// ============================================================================
 // The END 
 // ============================================================================
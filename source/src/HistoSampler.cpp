@@ -0,0 +1,207 @@
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <algorithm>
+// ============================================================================
+// ROOT
+// ============================================================================
+#include "TH1.h"
+#include "TAxis.h"
+#include "TRandom.h"
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/HistoSampler.h"
+// ============================================================================
+// Local
+// ============================================================================
+#include "Exception.h"
+#include "local_parallel.h"
+// ============================================================================
+/** @file
+ *  Implementation file for class Ostap::Utils::HistoSampler
+ *  @see Ostap::Utils::HistoSampler
+ *  @author agent agent@local
+ *  @date   2026-10-19
+ */
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  /// the minimal number of points per thread
+  const std::size_t s_CHUNK = 16384 ;
+  // ==========================================================================
+  /// get the bin edges for the axis
+  std::vector<double> _edges_ ( const TAxis* axis )
+  {
+    const int n = axis->GetNbins () ;
+    std::vector<double> edges ( n + 1 ) ;
+    for ( int i = 1 ; i <= n + 1 ; ++i ) { edges [ i - 1 ] = axis->GetBinLowEdge ( i ) ; }
+    return edges ;
+  }
+  // ==========================================================================
+} //                                                 end of anonymous namespace
+// ============================================================================
+// constructor from the histogram
+// ============================================================================
+Ostap::Utils::HistoSampler::HistoSampler
+( const TH1& histo )
+  : m_dim ( histo.GetDimension () )
+{
+  Ostap::Assert ( 1 <= m_dim && m_dim <= 3          ,
+                  "Invalid histogram dimension"     ,
+                  "Ostap::Utils::HistoSampler"      ) ;
+  //
+  m_edges [ 0 ] = _edges_ ( histo.GetXaxis () ) ;
+  m_edges [ 1 ] = _edges_ ( histo.GetYaxis () ) ;
+  m_edges [ 2 ] = _edges_ ( histo.GetZaxis () ) ;
+  //
+  const unsigned int nx = 1 <= m_dim ? histo.GetNbinsX () : 1 ;
+  const unsigned int ny = 2 <= m_dim ? histo.GetNbinsY () : 1 ;
+  const unsigned int nz = 3 <= m_dim ? histo.GetNbinsZ () : 1 ;
+  //
+  // collect the positive bins
+  std::vector<long double> weights {} ;
+  long double sum = 0 ;
+  for ( unsigned int iz = 1 ; iz <= nz ; ++iz )
+  {
+    for ( unsigned int iy = 1 ; iy <= ny ; ++iy )
+    {
+      for ( unsigned int ix = 1 ; ix <= nx ; ++ix )
+      {
+        const double c = histo.GetBinContent ( ix , iy , iz ) ;
+        if ( !( 0 < c ) ) { continue ; }                              // CONTINUE
+        weights.push_back ( c ) ;
+        m_index [ 0 ].push_back ( ix - 1 ) ;
+        m_index [ 1 ].push_back ( iy - 1 ) ;
+        m_index [ 2 ].push_back ( iz - 1 ) ;
+        sum += c ;
+      }
+    }
+  }
+  //
+  m_integral = sum ;
+  if ( weights.empty () ) { return ; }                                // RETURN
+  //
+  // build the alias table (Vose's algorithm)
+  const std::size_t N = weights.size () ;
+  m_prob .resize ( N , 1.0 ) ;
+  m_alias.resize ( N , 0   ) ;
+  //
+  std::vector<long double> scaled ( N ) ;
+  std::vector<unsigned int> small , large ;
+  small.reserve ( N ) ;
+  large.reserve ( N ) ;
+  for ( std::size_t i = 0 ; i < N ; ++i )
+  {
+    scaled [ i ] = weights [ i ] * N / sum ;
+    m_alias [ i ] = i ;
+    if ( scaled [ i ] < 1 ) { small.push_back ( i ) ; }
+    else                    { large.push_back ( i ) ; }
+  }
+  //
+  while ( !small.empty () && !large.empty () )
+  {
+    const unsigned int s = small.back () ; small.pop_back () ;
+    const unsigned int l = large.back () ; large.pop_back () ;
+    m_prob  [ s ] = scaled [ s ] ;
+    m_alias [ s ] = l ;
+    scaled  [ l ] = ( scaled [ l ] + scaled [ s ] ) - 1 ;
+    if ( scaled [ l ] < 1 ) { small.push_back ( l ) ; }
+    else                    { large.push_back ( l ) ; }
+  }
+  // the rest is (up to rounding) exactly one
+  for ( const unsigned int l : large ) { m_prob [ l ] = 1 ; }
+  for ( const unsigned int s : small ) { m_prob [ s ] = 1 ; }
+}
+// ============================================================================
+/*  sample the single point
+ *  @param rng   the random stream
+ *  @param index the index of the point in the stream
+ *  @param point (OUTPUT) the point, <code>dimension()</code> coordinates
+ */
+// ============================================================================
+void Ostap::Utils::HistoSampler::sample
+( const Ostap::Utils::RandomStream& rng   ,
+  const std::uint64_t               index ,
+  double*                           point ) const
+{
+  if ( m_prob.empty () )
+  { std::fill ( point , point + m_dim , 0.0 ) ; return ; }           // RETURN
+  //
+  // four random numbers per point: bin choice & position inside the bin
+  const std::uint64_t counter = 4 * index ;
+  //
+  // the column of the alias table from the high bits,
+  // the acceptance from the low bits
+  const std::uint64_t r = rng.raw ( counter ) ;
+  const std::size_t   k = ( ( r >> 32 ) * m_prob.size () ) >> 32 ;
+  const double        u = ( r & 0xFFFFFFFFULL ) * ( 1.0 / 4294967296.0 ) ;
+  const std::size_t   b = u < m_prob [ k ] ? k : m_alias [ k ] ;
+  //
+  for ( unsigned short d = 0 ; d < m_dim ; ++d )
+  {
+    const std::vector<double>& edges = m_edges [ d ] ;
+    const unsigned int         i     = m_index [ d ][ b ] ;
+    point [ d ] = rng.uniform ( counter + 1 + d , edges [ i ] , edges [ i + 1 ] ) ;
+  }
+}
+// ============================================================================
+/*  sample <code>n</code> points
+ *  @param n        number of points
+ *  @param points   (OUTPUT) the points, <code>n*dimension()</code> row-major array
+ *  @param rng      the random stream
+ *  @param first    the index of the first point in the stream
+ *  @param nthreads number of threads (0: all cores)
+ */
+// ============================================================================
+void Ostap::Utils::HistoSampler::sample
+( const std::size_t                 n        ,
+  double*                           points   ,
+  const Ostap::Utils::RandomStream& rng      ,
+  const std::uint64_t               first    ,
+  const unsigned short              nthreads ) const
+{
+  const unsigned int nt = n_threads ( nthreads , n / s_CHUNK ) ;
+  parallel_for ( nt , 0 , n ,
+                 [this,points,&rng,first] ( const unsigned int /* thread */ ,
+                                            const std::size_t  b            ,
+                                            const std::size_t  e            )
+                 {
+                   for ( std::size_t i = b ; i < e ; ++i )
+                   { sample ( rng , first + i , points + i * m_dim ) ; }
+                 } ) ;
+}
+// ============================================================================
+/*  sample <code>n</code> points
+ *  @param n        number of points
+ *  @param rng      the random stream
+ *  @param first    the index of the first point in the stream
+ *  @param nthreads number of threads (0: all cores)
+ *  @return the points, <code>n*dimension()</code> row-major array
+ */
+// ============================================================================
+std::vector<double> Ostap::Utils::HistoSampler::sample
+( const std::size_t                 n        ,
+  const Ostap::Utils::RandomStream& rng      ,
+  const std::uint64_t               first    ,
+  const unsigned short              nthreads ) const
+{
+  std::vector<double> points ( n * m_dim ) ;
+  sample ( n , points.data () , rng , first , nthreads ) ;
+  return points ;
+}
+// ============================================================================
+// get the new random stream, seeded from gRandom
+// ============================================================================
+Ostap::Utils::RandomStream Ostap::Utils::HistoSampler::random_stream ()
+{
+  const std::uint64_t s1 = gRandom->Integer ( 0xFFFFFFFF ) ;
+  const std::uint64_t s2 = gRandom->Integer ( 0xFFFFFFFF ) ;
+  return Ostap::Utils::RandomStream ( ( s1 << 32 ) | s2 ) ;
+}
+// ============================================================================
+//                                                                      The END
+// ============================================================================
@@ -15,7 +15,11 @@
 // =============================================================================
 #include "Integrator1D.h"
 #include "Integrator2D.h"
+#include "IntegratorND.h"
+#include "GaussKronrod.h"
 #include "local_hash.h"
+#include "local_parallel.h"
+#include "Exception.h"
 // =============================================================================
 /** @file 
  *  Implementation file for class Ostap::Math::Integrator
@@ -23,6 +27,82 @@
  *  @author Vanya BELYAEV Ivan.Belyaev@itep.ru
  */
 // =============================================================================
+namespace 
+{
+  // ===========================================================================
+  /// minimal number of points per thread for the batch evaluation 
+  const std::size_t s_MINBATCH = 16 ;
+  // ===========================================================================
+  /** @class Batch
+   *  evaluate the function for the batch of points, 
+   *  (optionally) splitting the batch between several threads
+   *  @see Ostap::Math::GSL::IntegratorND 
+   */
+  template <class FUNCTION>
+  class Batch 
+  {
+  public:
+    // =========================================================================
+    Batch ( const FUNCTION&      f        , 
+            const unsigned int   ndim     , 
+            const unsigned short nthreads ) 
+      : m_f        ( f        ) 
+      , m_ndim     ( ndim     ) 
+      , m_nthreads ( nthreads ) 
+    {}
+    // =========================================================================
+    void operator() ( const std::size_t n      , 
+                      const double*     x      , 
+                      double*           result ) const 
+    {
+      const unsigned int nt = 
+        1 == m_nthreads ? 1u : n_threads ( m_nthreads , n / s_MINBATCH ) ;
+      const FUNCTION&    f    = m_f    ;
+      const unsigned int ndim = m_ndim ;
+      parallel_for 
+        ( nt , 0 , n , 
+          [&f,ndim,x,result] ( const unsigned int /* thread */ , 
+                               const std::size_t  begin        , 
+                               const std::size_t  end          ) 
+          {
+            for ( std::size_t i = begin ; i < end ; ++i ) 
+            { result [ i ] = evaluate ( f , x + i * ndim ) ; }
+          } ) ;
+    }
+    // =========================================================================
+  private:
+    // =========================================================================
+    static double evaluate 
+    ( const Ostap::Math::Integrator::function3& f , const double* x ) 
+    { return f ( x [ 0 ] , x [ 1 ] , x [ 2 ] ) ; }
+    static double evaluate 
+    ( const Ostap::Math::Integrator::functionN& f , const double* x ) 
+    { return f ( x ) ; }
+    // =========================================================================
+  private:
+    // =========================================================================
+    const FUNCTION&      m_f        ;
+    const unsigned int   m_ndim     ;
+    const unsigned short m_nthreads ;
+    // =========================================================================
+  } ;
+  // ===========================================================================
+  typedef Batch<Ostap::Math::Integrator::function3> Batch3 ;
+  typedef Batch<Ostap::Math::Integrator::functionN> BatchN ;
+  typedef Ostap::Math::Integrator::functionV        BatchV ;
+  // ===========================================================================
+  /// check the integration limits for N-dimensional integration
+  inline void check_limits 
+  ( const std::vector<double>& xmin , 
+    const std::vector<double>& xmax ) 
+  {
+    Ostap::Assert ( !xmin.empty() && xmin.size() == xmax.size()     , 
+                    "Invalid integration limits"                    , 
+                    "Ostap::Math::Integrator::integrateND"          ) ;
+  }
+  // ===========================================================================
+}
+// =============================================================================
 /*  calculate the integral 
  *  \f[ r = \int_{x_{min}}^{x_{max}} f_1(x) dx \f]
  *  @param f1 the function 
@@ -165,6 +245,124 @@ double Ostap::Math::Integrator::integrate
   return result ;
 }
 // =============================================================================
+/*  calculate the integral 
+ *  \f[ r = \int_{x_{min}}^{x_{max}}\int_{y_{min}}^{y_{max}}\int_{z_{min}}^{z_{max}}f_3(x,y,z) dx dy dz \f]
+ *  The function is evaluated in batches of points using vectorized cubature
+ *  @param f3 the function 
+ *  @param xmin lower integration edge in x 
+ *  @param xmax upper integration edge in x 
+ *  @param ymin lower integration edge in y 
+ *  @param ymax upper integration edge in y 
+ *  @param zmin lower integration edge in z 
+ *  @param zmax upper integration edge in z 
+ *  @param nthreads number of threads to evaluate the batch
+ *  @return the value of the integral 
+ */
+// =============================================================================
+double Ostap::Math::Integrator::integrate
+( Ostap::Math::Integrator::function3 f3       , 
+  const double                       xmin     , 
+  const double                       xmax     ,
+  const double                       ymin     , 
+  const double                       ymax     ,
+  const double                       zmin     , 
+  const double                       zmax     ,
+  const unsigned short               nthreads ) const 
+{ 
+  //
+  static const Ostap::Math::GSL::IntegratorND<Batch3> s_cubature{} ;
+  static const char s_message[] = "Ostap::Math::Integrator/integrate(3D)" ;
+  const Batch3 batch { f3 , 3 , nthreads } ;
+  const double mins [] = { xmin , ymin , zmin } ;
+  const double maxs [] = { xmax , ymax , zmax } ;
+  const auto F = s_cubature.make_function ( &batch , 3 , mins , maxs ) ;
+  int     ierror =  0 ;
+  double  result =  1 ;
+  double  error  = -1 ;
+  std::tie ( ierror , result , error ) = s_cubature.cubature 
+    ( &F          ,   // the function  
+      1000000     ,   // limits  
+      s_PRECISION ,   // absolute precision 
+      s_PRECISION ,   // relative precision 
+      s_message   ,   // message 
+      __FILE__    ,   // the file name 
+      __LINE__    ) ; // the line number 
+  //
+  return result ;
+}
+// =============================================================================
+/*  calculate the N-dimensional integral 
+ *  \f[ r = \int_{\vec{x}_{min}}^{\vec{x}_{max}} f_N(\vec{x}) d\vec{x} \f]
+ *  The function is evaluated in batches of points using vectorized cubature
+ *  @param fN the function 
+ *  @param xmin lower integration edges 
+ *  @param xmax upper integration edges 
+ *  @param nthreads number of threads to evaluate the batch
+ *  @return the value of the integral 
+ */
+// =============================================================================
+double Ostap::Math::Integrator::integrateND
+( Ostap::Math::Integrator::functionN fN       , 
+  const std::vector<double>&         xmin     , 
+  const std::vector<double>&         xmax     , 
+  const unsigned short               nthreads ) const 
+{
+  check_limits ( xmin , xmax ) ;
+  //
+  static const Ostap::Math::GSL::IntegratorND<BatchN> s_cubature{} ;
+  static const char s_message[] = "Ostap::Math::Integrator/integrate(ND)" ;
+  const BatchN batch { fN , (unsigned int) xmin.size() , nthreads } ;
+  const auto F = s_cubature.make_function 
+    ( &batch , xmin.size() , xmin.data() , xmax.data() ) ;
+  int     ierror =  0 ;
+  double  result =  1 ;
+  double  error  = -1 ;
+  std::tie ( ierror , result , error ) = s_cubature.cubature 
+    ( &F          ,   // the function  
+      1000000     ,   // limits  
+      s_PRECISION ,   // absolute precision 
+      s_PRECISION ,   // relative precision 
+      s_message   ,   // message 
+      __FILE__    ,   // the file name 
+      __LINE__    ) ; // the line number 
+  //
+  return result ;
+}
+// =============================================================================
+/*  calculate the N-dimensional integral for the batch-capable function
+ *  \f[ r = \int_{\vec{x}_{min}}^{\vec{x}_{max}} f_N(\vec{x}) d\vec{x} \f]
+ *  @param fV the batch function 
+ *  @param xmin lower integration edges 
+ *  @param xmax upper integration edges 
+ *  @return the value of the integral 
+ */
+// =============================================================================
+double Ostap::Math::Integrator::integrateND
+( Ostap::Math::Integrator::functionV fV   , 
+  const std::vector<double>&         xmin , 
+  const std::vector<double>&         xmax ) const 
+{
+  check_limits ( xmin , xmax ) ;
+  //
+  static const Ostap::Math::GSL::IntegratorND<BatchV> s_cubature{} ;
+  static const char s_message[] = "Ostap::Math::Integrator/integrate(NDv)" ;
+  const auto F = s_cubature.make_function 
+    ( &fV , xmin.size() , xmin.data() , xmax.data() ) ;
+  int     ierror =  0 ;
+  double  result =  1 ;
+  double  error  = -1 ;
+  std::tie ( ierror , result , error ) = s_cubature.cubature 
+    ( &F          ,   // the function  
+      1000000     ,   // limits  
+      s_PRECISION ,   // absolute precision 
+      s_PRECISION ,   // relative precision 
+      s_message   ,   // message 
+      __FILE__    ,   // the file name 
+      __LINE__    ) ; // the line number 
+  //
+  return result ;
+}
+// =============================================================================
 
 
 // =============================================================================
@@ -321,5 +519,193 @@ double Ostap::Math::Integrator::integrate_with_cache
   return result ;
 }
 // =============================================================================
+/*  calculate the integral 
+ *  \f[ r = \int_{x_{min}}^{x_{max}}\int_{y_{min}}^{y_{max}}\int_{z_{min}}^{z_{max}}f_3(x,y,z) dx dy dz \f]
+ *  @param tag unique tag 
+ *  @param f3 the function 
+ *  @param xmin lower integration edge in x 
+ *  @param xmax upper integration edge in x 
+ *  @param ymin lower integration edge in y 
+ *  @param ymax upper integration edge in y 
+ *  @param zmin lower integration edge in z 
+ *  @param zmax upper integration edge in z 
+ *  @param nthreads number of threads to evaluate the batch
+ *  @return the value of the integral 
+ */
+// =============================================================================
+double Ostap::Math::Integrator::integrate_with_cache
+( const std::size_t                  tag      , 
+  Ostap::Math::Integrator::function3 f3       , 
+  const double                       xmin     , 
+  const double                       xmax     ,
+  const double                       ymin     , 
+  const double                       ymax     ,
+  const double                       zmin     , 
+  const double                       zmax     ,
+  const unsigned short               nthreads ) const 
+{ 
+  //
+  static const Ostap::Math::GSL::IntegratorND<Batch3> s_cubature{} ;
+  static const char s_message[] = "Ostap::Math::Integrator/integrate(3Dc)" ;
+  const Batch3 batch { f3 , 3 , nthreads } ;
+  const double mins [] = { xmin , ymin , zmin } ;
+  const double maxs [] = { xmax , ymax , zmax } ;
+  const auto F = s_cubature.make_function ( &batch , 3 , mins , maxs ) ;
+  int     ierror =  0 ;
+  double  result =  1 ;
+  double  error  = -1 ;
+  std::tie ( ierror , result , error ) = s_cubature.cubature_with_cache 
+    ( tag         , 
+      &F          ,   // the function  
+      1000000     ,   // limits  
+      s_PRECISION ,   // absolute precision 
+      s_PRECISION ,   // relative precision 
+      s_message   ,   // message 
+      __FILE__    ,   // the file name 
+      __LINE__    ) ; // the line number 
+  //
+  return result ;
+}
+// =============================================================================
+/*  calculate the N-dimensional integral 
+ *  \f[ r = \int_{\vec{x}_{min}}^{\vec{x}_{max}} f_N(\vec{x}) d\vec{x} \f]
+ *  @param tag unique tag 
+ *  @param fN the function 
+ *  @param xmin lower integration edges 
+ *  @param xmax upper integration edges 
+ *  @param nthreads number of threads to evaluate the batch
+ *  @return the value of the integral 
+ */
+// =============================================================================
+double Ostap::Math::Integrator::integrateND_with_cache
+( const std::size_t                  tag      , 
+  Ostap::Math::Integrator::functionN fN       , 
+  const std::vector<double>&         xmin     , 
+  const std::vector<double>&         xmax     , 
+  const unsigned short               nthreads ) const 
+{
+  check_limits ( xmin , xmax ) ;
+  //
+  static const Ostap::Math::GSL::IntegratorND<BatchN> s_cubature{} ;
+  static const char s_message[] = "Ostap::Math::Integrator/integrate(NDc)" ;
+  const BatchN batch { fN , (unsigned int) xmin.size() , nthreads } ;
+  const auto F = s_cubature.make_function 
+    ( &batch , xmin.size() , xmin.data() , xmax.data() ) ;
+  int     ierror =  0 ;
+  double  result =  1 ;
+  double  error  = -1 ;
+  std::tie ( ierror , result , error ) = s_cubature.cubature_with_cache 
+    ( tag         , 
+      &F          ,   // the function  
+      1000000     ,   // limits  
+      s_PRECISION ,   // absolute precision 
+      s_PRECISION ,   // relative precision 
+      s_message   ,   // message 
+      __FILE__    ,   // the file name 
+      __LINE__    ) ; // the line number 
+  //
+  return result ;
+}
+// =============================================================================
+/*  calculate the N-dimensional integral for the batch-capable function
+ *  \f[ r = \int_{\vec{x}_{min}}^{\vec{x}_{max}} f_N(\vec{x}) d\vec{x} \f]
+ *  @param tag unique tag 
+ *  @param fV the batch function 
+ *  @param xmin lower integration edges 
+ *  @param xmax upper integration edges 
+ *  @return the value of the integral 
+ */
+// =============================================================================
+double Ostap::Math::Integrator::integrateND_with_cache
+( const std::size_t                  tag  , 
+  Ostap::Math::Integrator::functionV fV   , 
+  const std::vector<double>&         xmin , 
+  const std::vector<double>&         xmax ) const 
+{
+  check_limits ( xmin , xmax ) ;
+  //
+  static const Ostap::Math::GSL::IntegratorND<BatchV> s_cubature{} ;
+  static const char s_message[] = "Ostap::Math::Integrator/integrate(NDvc)" ;
+  const auto F = s_cubature.make_function 
+    ( &fV , xmin.size() , xmin.data() , xmax.data() ) ;
+  int     ierror =  0 ;
+  double  result =  1 ;
+  double  error  = -1 ;
+  std::tie ( ierror , result , error ) = s_cubature.cubature_with_cache 
+    ( tag         , 
+      &F          ,   // the function  
+      1000000     ,   // limits  
+      s_PRECISION ,   // absolute precision 
+      s_PRECISION ,   // relative precision 
+      s_message   ,   // message 
+      __FILE__    ,   // the file name 
+      __LINE__    ) ; // the line number 
+  //
+  return result ;
+}
+// =============================================================================
+// reentrant GSL-free integration 
+// =============================================================================
+/*  calculate the integral using reentrant adaptive Gauss-Kronrod 
+ *  (G10/K21) integration without GSL
+ *  \f[ r = \int_{x_{min}}^{x_{max}} f_1(x) dx \f]
+ *  @param f1 the function 
+ *  @param xmin lower integration edge 
+ *  @param xmax upper integration edge
+ *  @param aprecision absolute precision 
+ *  @param rprecision relative precision 
+ *  @param limit      maximal number of subintervals 
+ *  @return (status, result, error) 
+ */
+// =============================================================================
+Ostap::Math::Integrator::Result
+Ostap::Math::Integrator::gk_integrate
+( Ostap::Math::Integrator::function1 f1         , 
+  const double                       xmin       , 
+  const double                       xmax       , 
+  const double                       aprecision , 
+  const double                       rprecision , 
+  const unsigned int                 limit      ) const 
+{
+  return Ostap::Math::GaussKronrod::integrate 
+    ( f1 , xmin , xmax , aprecision , rprecision , limit ) ;
+}
+// =============================================================================
+/*  calculate the batch of independent integrals in parallel using 
+ *  reentrant adaptive Gauss-Kronrod integration
+ *  @param tasks      the integration tasks 
+ *  @param nthreads   number of threads, 0 means "all available cores" 
+ *  @param aprecision absolute precision 
+ *  @param rprecision relative precision 
+ *  @param limit      maximal number of subintervals 
+ *  @return vector of (status, result, error) for each task 
+ */
+// =============================================================================
+Ostap::Math::Integrator::Results
+Ostap::Math::Integrator::gk_integrate
+( const Ostap::Math::Integrator::Tasks& tasks      , 
+  const unsigned short                  nthreads   , 
+  const double                          aprecision , 
+  const double                          rprecision , 
+  const unsigned int                    limit      ) const 
+{
+  Results results ( tasks.size() ) ;
+  parallel_for 
+    ( nthreads , 0 , tasks.size() , 
+      [&tasks,&results,aprecision,rprecision,limit] 
+      ( const unsigned int /* thread */ , 
+        const std::size_t  begin        , 
+        const std::size_t  end          ) 
+      {
+        for ( std::size_t i = begin ; i < end ; ++i ) 
+        {
+          const Task& t = tasks [ i ] ;
+          results [ i ] = Ostap::Math::GaussKronrod::integrate 
+            ( t.func , t.xmin , t.xmax , aprecision , rprecision , limit ) ;
+        }
+      } ) ;
+  return results ;
+}
+// =============================================================================
 //                                                                       The END 
 // =============================================================================
@@ -0,0 +1,187 @@
+// ============================================================================
+#ifndef OSTAP_INTEGRATORND_H
+#define OSTAP_INTEGRATORND_H 1
+// ============================================================================
+// Include  files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <map>
+#include <vector>
+// ============================================================================
+// Local
+// ============================================================================
+#include "Integrator1D.h"     // GSL-integrator
+#include "cubature.h"         // cubature
+#include "syncedcache.h"      // the cache
+#include "local_hash.h"       // hash_combine
+// ============================================================================
+namespace Ostap
+{
+  // ==========================================================================
+  namespace Math
+  {
+    // ========================================================================
+    namespace GSL
+    {
+      // ======================================================================
+      /** @class IntegratorND  IntegratorND.h
+       *  Helper class to simplify the integration of N-dimensional functions
+       *  using the vectorized h-adaptive cubature interface (hcubature_v).
+       *  The function is invoked for the whole batch of points at once:
+       *  \code
+       *  void FUNCTION::operator() ( std::size_t   npoints ,
+       *                              const double* x       ,  // npoints * ndim
+       *                              double*       result  ) const ;
+       *  \endcode
+       *  where the coordinates of i-th point are  <code>x[i*ndim+j]</code>
+       *  @see Ostap::Math::GSL::Integrator2D
+       *  @author agent agent@local
+       *  @date   2026-10-19
+       */
+      template <class FUNCTION>
+      class IntegratorND
+      {
+      public:
+        // ====================================================================
+        struct Fun
+        {
+          integrand_v         fun   ;
+          void*               fdata ;
+          unsigned int        ndim  ;
+          std::vector<double> min   ;
+          std::vector<double> max   ;
+        } ;
+        // ====================================================================
+        Fun make_function ( const FUNCTION*    f    ,
+                            const unsigned int ndim ,
+                            const double*      xmin ,
+                            const double*      xmax ) const
+        {
+          Fun F ;
+          F.fdata = const_cast<FUNCTION*>( f ) ;
+          F.fun   = &adapter ;
+          F.ndim  = ndim ;
+          F.min.assign ( xmin , xmin + ndim ) ;
+          F.max.assign ( xmax , xmax + ndim ) ;
+          return F ;
+        } ;
+        // ====================================================================
+      public:
+        // ====================================================================
+        /// h-adaptive vectorized cubature
+        Result cubature
+        ( const Fun*          fun                  ,
+          const unsigned      maxcalls   = 100000  ,
+          const double        aprecision = 1.e-8   ,
+          const double        rprecision = 1.e-8   ,
+          const char*         reason     = nullptr ,       // message
+          const char*         file       = nullptr ,       // file name
+          const unsigned long line       = 0       ) const // line number
+        {
+          double result =  1 ;
+          double error  = -1 ;
+          const int ierror = hcubature_v
+            ( 1 , fun -> fun        , fun->fdata      , // f-dimension, function  & data
+              fun -> ndim           ,                   // dimension
+              fun -> min.data ()    , fun->max.data() , // integration range
+              maxcalls              ,                   // maximal number of  function calls
+              aprecision            ,                   // absolute precision
+              rprecision            ,                   // relative precision
+              ERROR_INDIVIDUAL      ,                   // error norm
+              &result, &error       ) ;                 // output: result&error
+          //
+          if ( ierror )  { gsl_error( reason , file  , line , ierror ) ; }
+          return Result { ierror , result , error } ;
+        }
+        // ====================================================================
+        /** h-adaptive vectorized cubature with cache
+         *  @attention the function itself does not enter the key,
+         *  it is identified by the tag only
+         */
+        Result cubature_with_cache
+        ( const std::size_t   tag                  ,
+          const Fun*          fun                  ,
+          const unsigned      maxcalls   = 100000  ,
+          const double        aprecision = 1.e-8   ,
+          const double        rprecision = 1.e-8   ,
+          const char*         reason     = nullptr ,       // message
+          const char*         file       = nullptr ,       // file name
+          const unsigned long line       = 0       ) const // line number
+        {
+          //
+          std::size_t key = std::hash_combine
+            ( tag         , fun->ndim   ,
+              maxcalls    , aprecision  , rprecision  ,
+              reason      , file        , line        ) ;
+          for ( unsigned int i = 0 ; i < fun->ndim ; ++i )
+          { std::_hash_combine ( key , fun->min [ i ] , fun->max [ i ] ) ; }
+          // ==================================================================
+          { // look into the cache ============================================
+            typename CACHE::Lock lock { s_cache.mutex() } ;
+            auto it = s_cache->find ( key ) ;
+            if ( s_cache->end() != it ) {  return it->second ; }  // AVOID calculation
+            // ================================================================
+          } // ================================================================
+          // ==================================================================
+          // perform the numerical integration via the cubature method
+          Result result = cubature ( fun      ,
+                                     maxcalls , aprecision , rprecision  ,
+                                     reason   ,  file      , line        ) ;
+          // ==================================================================
+          { // update the cache ===============================================
+            typename CACHE::Lock lock  { s_cache.mutex() } ;
+            // clear the cache if too large
+            if ( s_CACHESIZE < s_cache->size() ) { s_cache->clear() ; }
+            // update the cache
+            s_cache->insert ( std::make_pair ( key , result ) ) ;
+          } // ================================================================
+          // ==================================================================
+          return result ;
+          // ==================================================================
+        }
+        // ====================================================================
+      public:
+        // ====================================================================
+        /// the actual vectorized adapter for cubature
+        static int adapter ( unsigned      ndim  ,
+                             std::size_t   npt   ,
+                             const double* x     ,
+                             void*         fdata ,
+                             unsigned      fdim  ,
+                             double*       fval  )
+        {
+          if ( 1  != fdim || 0 == ndim ||
+               nullptr == x || nullptr == fdata || nullptr == fval ) { return 1 ; }
+          const FUNCTION* f = (FUNCTION*) fdata  ;
+          (*f) ( npt , x , fval ) ;
+          return 0 ;
+        }
+        // ====================================================================
+      private:
+        // ====================================================================
+        typedef std::map<std::size_t,Result>  MAP   ;
+        typedef SyncedCache<MAP>              CACHE ;
+        /// the actual integration cache
+        static CACHE              s_cache     ; // integration cache
+        static const unsigned int s_CACHESIZE ; // cache size
+        // ====================================================================
+      };
+      // ======================================================================
+      template <class FUNCTION>
+      typename IntegratorND<FUNCTION>::CACHE
+      IntegratorND<FUNCTION>::s_cache = IntegratorND<FUNCTION>::CACHE{} ;
+      // ======================================================================
+      template <class FUNCTION>
+      const unsigned int IntegratorND<FUNCTION>::s_CACHESIZE = 1000 ;
+      // ======================================================================
+    } //                                  The end of namespace Ostap::Math::GSL
+    // ========================================================================
+  } //                                         The end of namespace Ostap::Math
+  // ==========================================================================
+} //                                                 The end of namespace Ostap
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_INTEGRATORND_H
+// ============================================================================
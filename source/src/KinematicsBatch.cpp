@@ -0,0 +1,373 @@
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <cmath>
+#include <limits>
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/KinematicsBatch.h"
+// ============================================================================
+/** @file
+ *  Implementation file for functions from the file Ostap/KinematicsBatch.h
+ *  - all loops are written without branches:
+ *    invalid configurations are handled via the selection of the result,
+ *    that allows the compiler to vectorize them
+ *  @see Ostap::Kinematics::Batch
+ *  @author agent agent@local
+ *  @date 2026-10-19
+ */
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  /// large negative number, the same as for Ostap/Kinematics.h
+  constexpr double s_INVALID = -0.9 * std::numeric_limits<float>::max () ;
+  static_assert (  s_INVALID <  0   , "invalid negative number"    ) ;
+  // ==========================================================================
+  /// Minkowski product of two 4-vectors
+  inline double _dot_
+  ( const double ax , const double ay , const double az , const double ae ,
+    const double bx , const double by , const double bz , const double be )
+  { return ae * be - ax * bx - ay * by - az * bz ; }
+  // ==========================================================================
+  /// 3D scalar product
+  inline double _dot3_
+  ( const double ax , const double ay , const double az ,
+    const double bx , const double by , const double bz )
+  { return ax * bx + ay * by + az * bz ; }
+  // ==========================================================================
+  /// cosine of decay angle from the Minkowski products
+  inline double _decay_angle_
+  ( const double pd  ,
+    const double pq  ,
+    const double qd  ,
+    const double mp2 ,
+    const double mq2 ,
+    const double md2 )
+  {
+    const double value  = ( pq * pq - mq2 * mp2 ) * ( qd * qd - mq2 * md2 ) ;
+    const double result = ( pd * mq2 - pq * qd ) / std::sqrt ( std::abs ( value ) ) ;
+    return 0 <= value ? result : s_INVALID ;
+  }
+  // ==========================================================================
+}
+// ============================================================================
+// invariant mass squared for the block of 4-vectors
+// ============================================================================
+void Ostap::Kinematics::Batch::mass2
+( const unsigned long n      ,
+  const double*       px     ,
+  const double*       py     ,
+  const double*       pz     ,
+  const double*       e      ,
+  double* __restrict  result )
+{
+  for ( unsigned long i = 0 ; i < n ; ++i )
+  { result [ i ] = _dot_ ( px [ i ] , py [ i ] , pz [ i ] , e [ i ] ,
+                           px [ i ] , py [ i ] , pz [ i ] , e [ i ] ) ; }
+}
+// ============================================================================
+// invariant mass for the block of 4-vectors
+// ============================================================================
+void Ostap::Kinematics::Batch::mass
+( const unsigned long n      ,
+  const double*       px     ,
+  const double*       py     ,
+  const double*       pz     ,
+  const double*       e      ,
+  double* __restrict  result )
+{
+  for ( unsigned long i = 0 ; i < n ; ++i )
+  {
+    const double m2 = _dot_ ( px [ i ] , py [ i ] , pz [ i ] , e [ i ] ,
+                              px [ i ] , py [ i ] , pz [ i ] , e [ i ] ) ;
+    result [ i ] = std::copysign ( std::sqrt ( std::abs ( m2 ) ) , m2 ) ;
+  }
+}
+// ============================================================================
+// ``triangle'' function
+// ============================================================================
+void Ostap::Kinematics::Batch::kallen
+( const unsigned long n      ,
+  const double*       a      ,
+  const double*       b      ,
+  const double*       c      ,
+  double* __restrict  result )
+{
+  for ( unsigned long i = 0 ; i < n ; ++i )
+  {
+    const double ai = a [ i ] ;
+    const double bi = b [ i ] ;
+    const double ci = c [ i ] ;
+    result [ i ] = ai * ai + bi * bi + ci * ci - 2 * ai * bi - 2 * bi * ci - 2 * ai * ci ;
+  }
+}
+// ============================================================================
+// magnitude of 3-momentum of particle "v" in the rest system of "M"
+// ============================================================================
+void Ostap::Kinematics::Batch::restMomentum
+( const unsigned long n      ,
+  const double*       vx     ,
+  const double*       vy     ,
+  const double*       vz     ,
+  const double*       ve     ,
+  const double*       mx     ,
+  const double*       my     ,
+  const double*       mz     ,
+  const double*       me     ,
+  double* __restrict  result )
+{
+  for ( unsigned long i = 0 ; i < n ; ++i )
+  {
+    const double M2 = _dot_ ( mx [ i ] , my [ i ] , mz [ i ] , me [ i ] ,
+                              mx [ i ] , my [ i ] , mz [ i ] , me [ i ] ) ;
+    const double v2 = _dot_ ( vx [ i ] , vy [ i ] , vz [ i ] , ve [ i ] ,
+                              vx [ i ] , vy [ i ] , vz [ i ] , ve [ i ] ) ;
+    const double vM = _dot_ ( vx [ i ] , vy [ i ] , vz [ i ] , ve [ i ] ,
+                              mx [ i ] , my [ i ] , mz [ i ] , me [ i ] ) ;
+    const bool   ok = 0 < M2 ;
+    const double P2 = vM * vM / ( ok ? M2 : 1.0 ) - v2 ;
+    const double P  = std::sqrt ( std::abs ( P2 ) ) ;
+    result [ i ] = ( ok & ( 0 <= P2 ) ) ? P : s_INVALID ;
+  }
+}
+// ============================================================================
+// energy of particle "v" in the rest system of "M"
+// ============================================================================
+void Ostap::Kinematics::Batch::restEnergy
+( const unsigned long n      ,
+  const double*       vx     ,
+  const double*       vy     ,
+  const double*       vz     ,
+  const double*       ve     ,
+  const double*       mx     ,
+  const double*       my     ,
+  const double*       mz     ,
+  const double*       me     ,
+  double* __restrict  result )
+{
+  for ( unsigned long i = 0 ; i < n ; ++i )
+  {
+    const double M2 = _dot_ ( mx [ i ] , my [ i ] , mz [ i ] , me [ i ] ,
+                              mx [ i ] , my [ i ] , mz [ i ] , me [ i ] ) ;
+    const double vM = _dot_ ( vx [ i ] , vy [ i ] , vz [ i ] , ve [ i ] ,
+                              mx [ i ] , my [ i ] , mz [ i ] , me [ i ] ) ;
+    const bool   ok = 0 < M2 ;
+    const double E  = vM / std::sqrt ( ok ? M2 : 1.0 ) ;
+    result [ i ] = ok ? E : s_INVALID ;
+  }
+}
+// ============================================================================
+// transverse momentum with respect to a certain 3D-direction
+// ============================================================================
+void Ostap::Kinematics::Batch::transverseMomentumDir
+( const unsigned long n      ,
+  const double*       px     ,
+  const double*       py     ,
+  const double*       pz     ,
+  const double*       dx     ,
+  const double*       dy     ,
+  const double*       dz     ,
+  double* __restrict  result )
+{
+  for ( unsigned long i = 0 ; i < n ; ++i )
+  {
+    const double d2 = _dot3_ ( dx [ i ] , dy [ i ] , dz [ i ] ,
+                               dx [ i ] , dy [ i ] , dz [ i ] ) ;
+    const double pd = _dot3_ ( px [ i ] , py [ i ] , pz [ i ] ,
+                               dx [ i ] , dy [ i ] , dz [ i ] ) ;
+    const double s  = 0 == d2 ? 0.0 : pd / ( 0 == d2 ? 1.0 : d2 ) ;
+    const double tx = px [ i ] - s * dx [ i ] ;
+    const double ty = py [ i ] - s * dy [ i ] ;
+    const double tz = pz [ i ] - s * dz [ i ] ;
+    result [ i ] = std::sqrt ( tx * tx + ty * ty + tz * tz ) ;
+  }
+}
+// ============================================================================
+// cosine of the decay angle (3-argument form)
+// ============================================================================
+void Ostap::Kinematics::Batch::decayAngle
+( const unsigned long n      ,
+  const double*       px     ,
+  const double*       py     ,
+  const double*       pz     ,
+  const double*       pe     ,
+  const double*       qx     ,
+  const double*       qy     ,
+  const double*       qz     ,
+  const double*       qe     ,
+  const double*       dx     ,
+  const double*       dy     ,
+  const double*       dz     ,
+  const double*       de     ,
+  double* __restrict  result )
+{
+  for ( unsigned long i = 0 ; i < n ; ++i )
+  {
+    const double pd  = _dot_ ( px [ i ] , py [ i ] , pz [ i ] , pe [ i ] ,
+                               dx [ i ] , dy [ i ] , dz [ i ] , de [ i ] ) ;
+    const double pq  = _dot_ ( px [ i ] , py [ i ] , pz [ i ] , pe [ i ] ,
+                               qx [ i ] , qy [ i ] , qz [ i ] , qe [ i ] ) ;
+    const double qd  = _dot_ ( qx [ i ] , qy [ i ] , qz [ i ] , qe [ i ] ,
+                               dx [ i ] , dy [ i ] , dz [ i ] , de [ i ] ) ;
+    const double mp2 = _dot_ ( px [ i ] , py [ i ] , pz [ i ] , pe [ i ] ,
+                               px [ i ] , py [ i ] , pz [ i ] , pe [ i ] ) ;
+    const double mq2 = _dot_ ( qx [ i ] , qy [ i ] , qz [ i ] , qe [ i ] ,
+                               qx [ i ] , qy [ i ] , qz [ i ] , qe [ i ] ) ;
+    const double md2 = _dot_ ( dx [ i ] , dy [ i ] , dz [ i ] , de [ i ] ,
+                               dx [ i ] , dy [ i ] , dz [ i ] , de [ i ] ) ;
+    result [ i ] = _decay_angle_ ( pd , pq , qd , mp2 , mq2 , md2 ) ;
+  }
+}
+// ============================================================================
+// cosine of the decay angle (2-argument form)
+// the "laboratory" frame is P = (0,0,0,10*E_M), as for the scalar version
+// ============================================================================
+void Ostap::Kinematics::Batch::decayAngle
+( const unsigned long n      ,
+  const double*       dx     ,
+  const double*       dy     ,
+  const double*       dz     ,
+  const double*       de     ,
+  const double*       mx     ,
+  const double*       my     ,
+  const double*       mz     ,
+  const double*       me     ,
+  double* __restrict  result )
+{
+  for ( unsigned long i = 0 ; i < n ; ++i )
+  {
+    const double pe  = 10 * me [ i ] ;
+    const double pd  = pe * de [ i ] ;
+    const double pq  = pe * me [ i ] ;
+    const double mp2 = pe * pe       ;
+    const double qd  = _dot_ ( mx [ i ] , my [ i ] , mz [ i ] , me [ i ] ,
+                               dx [ i ] , dy [ i ] , dz [ i ] , de [ i ] ) ;
+    const double mq2 = _dot_ ( mx [ i ] , my [ i ] , mz [ i ] , me [ i ] ,
+                               mx [ i ] , my [ i ] , mz [ i ] , me [ i ] ) ;
+    const double md2 = _dot_ ( dx [ i ] , dy [ i ] , dz [ i ] , de [ i ] ,
+                               dx [ i ] , dy [ i ] , dz [ i ] , de [ i ] ) ;
+    result [ i ] = _decay_angle_ ( pd , pq , qd , mp2 , mq2 , md2 ) ;
+  }
+}
+// ============================================================================
+// cosine of the angle between v1 and v2 in the rest frame of M
+// ============================================================================
+void Ostap::Kinematics::Batch::cosThetaRest
+( const unsigned long n      ,
+  const double*       ax     ,
+  const double*       ay     ,
+  const double*       az     ,
+  const double*       ae     ,
+  const double*       bx     ,
+  const double*       by     ,
+  const double*       bz     ,
+  const double*       be     ,
+  const double*       mx     ,
+  const double*       my     ,
+  const double*       mz     ,
+  const double*       me     ,
+  double* __restrict  result )
+{
+  for ( unsigned long i = 0 ; i < n ; ++i )
+  {
+    const double M2   = _dot_ ( mx [ i ] , my [ i ] , mz [ i ] , me [ i ] ,
+                                mx [ i ] , my [ i ] , mz [ i ] , me [ i ] ) ;
+    const double v1M  = _dot_ ( ax [ i ] , ay [ i ] , az [ i ] , ae [ i ] ,
+                                mx [ i ] , my [ i ] , mz [ i ] , me [ i ] ) ;
+    const double v2M  = _dot_ ( bx [ i ] , by [ i ] , bz [ i ] , be [ i ] ,
+                                mx [ i ] , my [ i ] , mz [ i ] , me [ i ] ) ;
+    const double m1_2 = _dot_ ( ax [ i ] , ay [ i ] , az [ i ] , ae [ i ] ,
+                                ax [ i ] , ay [ i ] , az [ i ] , ae [ i ] ) ;
+    const double m2_2 = _dot_ ( bx [ i ] , by [ i ] , bz [ i ] , be [ i ] ,
+                                bx [ i ] , by [ i ] , bz [ i ] , be [ i ] ) ;
+    const double v1v2 = _dot_ ( ax [ i ] , ay [ i ] , az [ i ] , ae [ i ] ,
+                                bx [ i ] , by [ i ] , bz [ i ] , be [ i ] ) ;
+    //
+    const bool   ok1   = 0 < M2 ;
+    const double iM2   = 1.0 / ( ok1 ? M2 : 1.0 ) ;
+    const double e1e2  = v1M * v2M * iM2 ;
+    const double p1p2_ = ( v1M * v1M * iM2 - m1_2 ) * ( v2M * v2M * iM2 - m2_2 ) ;
+    const bool   ok2   = 0 < p1p2_ ;
+    const double p1p2  = std::sqrt ( ok2 ? p1p2_ : 1.0 ) ;
+    //
+    // NB: (v1+v2)^2 - v1^2 - v2^2 = 2 (v1*v2)
+    const double cost  = ( e1e2 - v1v2 ) / p1p2 ;
+    result [ i ] = ( ok1 & ok2 ) ? cost : s_INVALID ;
+  }
+}
+// ============================================================================
+// Armenteros-Podolanski variable
+// ============================================================================
+void Ostap::Kinematics::Batch::armenterosPodolanskiX
+( const unsigned long n      ,
+  const double*       ax     ,
+  const double*       ay     ,
+  const double*       az     ,
+  const double*       bx     ,
+  const double*       by     ,
+  const double*       bz     ,
+  double* __restrict  result )
+{
+  for ( unsigned long i = 0 ; i < n ; ++i )
+  {
+    const double a2 = _dot3_ ( ax [ i ] , ay [ i ] , az [ i ] ,
+                               ax [ i ] , ay [ i ] , az [ i ] ) ;
+    const double b2 = _dot3_ ( bx [ i ] , by [ i ] , bz [ i ] ,
+                               bx [ i ] , by [ i ] , bz [ i ] ) ;
+    const double sx = ax [ i ] + bx [ i ] ;
+    const double sy = ay [ i ] + by [ i ] ;
+    const double sz = az [ i ] + bz [ i ] ;
+    result [ i ] = ( a2 - b2 ) / ( sx * sx + sy * sy + sz * sz ) ;
+  }
+}
+// ============================================================================
+// boost the block of 4-vectors into the rest frames of other 4-vectors
+// the same as ROOT::Math::Boost ( frame.BoostToCM() )
+// ============================================================================
+void Ostap::Kinematics::Batch::boost
+( const unsigned long n      ,
+  const double*       vx     ,
+  const double*       vy     ,
+  const double*       vz     ,
+  const double*       ve     ,
+  const double*       fx     ,
+  const double*       fy     ,
+  const double*       fz     ,
+  const double*       fe     ,
+  double* __restrict  rx     ,
+  double* __restrict  ry     ,
+  double* __restrict  rz     ,
+  double* __restrict  re     )
+{
+  for ( unsigned long i = 0 ; i < n ; ++i )
+  {
+    // boost vector to the rest frame
+    const double ie    = 1.0 / fe [ i ] ;
+    const double bx    = -fx [ i ] * ie ;
+    const double by    = -fy [ i ] * ie ;
+    const double bz    = -fz [ i ] * ie ;
+    const double b2    = _dot3_ ( bx , by , bz , bx , by , bz ) ;
+    const double gamma = 1.0 / std::sqrt ( 1.0 - b2 ) ;
+    //
+    const double x     = vx [ i ] ;
+    const double y     = vy [ i ] ;
+    const double z     = vz [ i ] ;
+    const double t     = ve [ i ] ;
+    const double bp    = _dot3_ ( bx , by , bz , x , y , z ) ;
+    // (gamma-1)/beta^2 , well defined for beta -> 0
+    const double g2    = gamma * gamma / ( 1.0 + gamma ) ;
+    const double s     = g2 * bp + gamma * t ;
+    //
+    rx [ i ] = x + s * bx ;
+    ry [ i ] = y + s * by ;
+    rz [ i ] = z + s * bz ;
+    re [ i ] = gamma * ( t + bp ) ;
+  }
+}
+// ============================================================================
+//                                                                      The END
+// ============================================================================
@@ -31,6 +31,8 @@
 #include "Exception.h"
 #include "local_math.h"
 #include "local_hash.h"
+#include "syncedcache.h"
+#include "cubature.h"
 #include "Integrator1D.h"
 #include "Integrator2D.h"
 // ============================================================================
@@ -123,6 +125,271 @@ namespace
     return result ;
   }
   // ==========================================================================
+  // Tables of moments 
+  // ==========================================================================
+  /** The integrals of the phase space factors times the basic Bernstein 
+   *  polynomials do not depend on the fit parameters: 
+   *  they are calculated once per configuration (phase space, degree, 
+   *  integration range) and the integrals of the models become the 
+   *  dot-products of these moments with the actual Bernstein coefficients 
+   */
+  typedef std::vector<double>                     MOMENTS  ;
+  typedef std::shared_ptr<const MOMENTS>          PMOMENTS ;
+  typedef std::map<std::size_t,PMOMENTS>          TABLES   ;
+  typedef SyncedCache<TABLES>                     MCACHE   ;
+  /// the cache of moments 
+  MCACHE s_moments {} ;
+  // ==========================================================================
+  /** get the table of moments from the cache or build it 
+   *  @param key     the unique key for the configuration 
+   *  @param builder the function to build the table 
+   */
+  template <class BUILDER>
+  PMOMENTS _moments_ 
+  ( const std::size_t key     , 
+    BUILDER           builder ) 
+  {
+    { // look into the cache ==================================================
+      MCACHE::Lock lock { s_moments.mutex() } ;
+      auto it = s_moments->find ( key ) ;
+      if ( s_moments->end() != it ) { return it->second ; }             // RETURN 
+    } // ======================================================================
+    //
+    PMOMENTS table = std::make_shared<const MOMENTS> ( builder () ) ;
+    //
+    { // update the cache =====================================================
+      MCACHE::Lock lock { s_moments.mutex() } ;
+      if ( s_CACHESIZE < s_moments->size() ) { s_moments->clear() ; }
+      s_moments->insert ( std::make_pair ( key , table ) ) ;
+    } // ======================================================================
+    //
+    return table ;
+  }
+  // ==========================================================================
+  /** the table of 1D-moments 
+   *  \f$ m_i = \int_{low}^{high} \Phi(x) B^n_i(x) dx \f$
+   *  @param ps    the phase space 
+   *  @param n     the degree of Bernstein polynomial
+   *  @param basic the basic Bernstein polynomials \f$ B_i^n\f$
+   *  @param low   the low  integration edge 
+   *  @param high  the high integration edge 
+   *  @param work  the integration workspace 
+   */
+  template <class BASIC>
+  PMOMENTS _moments_ 
+  ( const Ostap::Math::PhaseSpaceNL&    ps    , 
+    const unsigned short                n     ,
+    BASIC                               basic , 
+    const double                        low   , 
+    const double                        high  ,
+    const Ostap::Math::WorkSpace&       work  ) 
+  {
+    const std::size_t key = std::hash_combine 
+      ( ps.tag () , n , basic ( 0 ).xmin () , basic ( 0 ).xmax () , low , high ) ;
+    return _moments_ 
+      ( key , [&ps,n,&basic,low,high,&work] () -> MOMENTS 
+        {
+          MOMENTS m ( n + 1 , 0.0 ) ;
+          for ( unsigned short i = 0 ; i <= n ; ++i ) 
+          { m [ i ] = _integral_ ( ps , basic ( i ) , low , high , work ) ; }
+          return m ;
+        } ) ;
+  }
+  // ==========================================================================
+  /// adapter for the vector-valued cubature 
+  template <class FUNCTION>
+  int _adapter_moments_ 
+  ( unsigned      ndim  , 
+    const double* x     , 
+    void*         fdata ,
+    unsigned      fdim  , 
+    double*       fval  )
+  {
+    if ( 2 != ndim || 0 == fdim || nullptr == x || nullptr == fdata || nullptr == fval ) { return 1 ; }
+    const FUNCTION* f = (const FUNCTION*) fdata ;
+    (*f) ( x [ 0 ] , x [ 1 ] , fval ) ;
+    return 0 ;
+  }
+  // ==========================================================================
+  /** the table of 2D-moments, calculated in the single pass 
+   *  of the vector-valued cubature 
+   *  @param nfun  the number of moments 
+   *  @param fun   the function <code>fun(x,y,moments)</code> to fill moments at the point
+   */
+  template <class FUNCTION>
+  MOMENTS _moments2D_
+  ( const unsigned int nfun   , 
+    const FUNCTION&    fun    , 
+    const double       xlow   , 
+    const double       xhigh  , 
+    const double       ylow   , 
+    const double       yhigh  , 
+    const char*        reason ) 
+  {
+    const double xmin [2] = { xlow  , ylow  } ;
+    const double xmax [2] = { xhigh , yhigh } ;
+    //
+    MOMENTS result ( nfun ,  0.0 ) ;
+    MOMENTS error  ( nfun , -1.0 ) ;
+    //
+    const int ierror = hcubature 
+      ( nfun , &_adapter_moments_<FUNCTION> , 
+        const_cast<FUNCTION*> ( &fun )      ,  // f-dimension, function & data 
+        2    , xmin , xmax                  ,  // dimension and integration range  
+        20000 * ( 1 + nfun / 4 )            ,  // maximal number of function calls 
+        s_PRECISION                         ,  // absolute precision 
+        s_PRECISION                         ,  // relative precision
+        ERROR_INDIVIDUAL                    ,  // error norm 
+        result.data () , error.data ()      ) ;// output: result&error
+    //
+    if ( ierror ) { gsl_error ( reason , __FILE__ , __LINE__ , ierror ) ; }
+    return result ;
+  }
+  // ==========================================================================
+  /** helper class to evaluate the 2D phase space kernel for PS2DPol2/PS2DPol3 
+   *  \f$ K_x(x,y) = \Phi_x(x) \Phi_y^{aux}(y|m_{max}-x) \f$ and 
+   *  \f$ K_y(x,y) = \Phi_y(y) \Phi_x^{aux}(x|m_{max}-y) \f$ 
+   */
+  class PSKERNEL 
+  {
+  public:
+    // ========================================================================
+    PSKERNEL ( const Ostap::Math::PhaseSpaceNL& psx    , 
+               const Ostap::Math::PhaseSpaceNL& psy    , 
+               const Ostap::Math::PhaseSpaceNL& xaux   , 
+               const Ostap::Math::PhaseSpaceNL& yaux   , 
+               const double                     mmax   ) 
+      : m_psx  ( psx  ) 
+      , m_psy  ( psy  )
+      , m_xaux ( xaux ) 
+      , m_yaux ( yaux ) 
+      , m_mmax ( mmax ) 
+    {}
+    // ========================================================================
+    /// evaluate both kernels, return false outside the kinematic region 
+    bool operator() ( const double x , const double y , double& kx , double& ky ) const 
+    {
+      kx = 0 ;
+      ky = 0 ;
+      if ( x + y > m_mmax ) { return false ; }
+      m_xaux.setThresholds ( m_psx.lowEdge() , m_mmax - y ) ;
+      m_yaux.setThresholds ( m_psy.lowEdge() , m_mmax - x ) ;
+      kx = m_psx ( x ) * m_yaux ( y ) ;
+      ky = m_psy ( y ) * m_xaux ( x ) ;
+      return true ;
+    }
+    // ========================================================================
+    /// the tag 
+    std::size_t tag () const 
+    { return std::hash_combine ( m_psx.tag () , m_psy.tag () , m_mmax ) ; }
+    // ========================================================================
+  private:
+    // ========================================================================
+    const Ostap::Math::PhaseSpaceNL&     m_psx  ; 
+    const Ostap::Math::PhaseSpaceNL&     m_psy  ; 
+    mutable Ostap::Math::PhaseSpaceNL    m_xaux ; 
+    mutable Ostap::Math::PhaseSpaceNL    m_yaux ; 
+    double                               m_mmax ;
+    // ========================================================================
+  } ;
+  // ==========================================================================
+  /// the basic Bernstein polynomials of degree n 
+  std::vector<Ostap::Math::Bernstein> _basic_
+  ( const unsigned short n    , 
+    const double         xmin , 
+    const double         xmax ) 
+  {
+    typedef Ostap::Math::Bernstein::Basic BB ;
+    std::vector<Ostap::Math::Bernstein> result ;
+    result.reserve ( n + 1 ) ;
+    for ( unsigned short i = 0 ; i <= n ; ++i ) 
+    { result.push_back ( Ostap::Math::Bernstein ( BB ( i , n ) , xmin , xmax ) ) ; }
+    return result ;
+  }
+  // ==========================================================================
+  /** the table of 2D-moments for PS2DPol2-family 
+   *  \f$ m_{i(n_y+1)+j} = \int\int \frac{1}{2}(K_x+K_y) B^{n_x}_i(x) B^{n_y}_j(y) dx dy \f$
+   */
+  PMOMENTS _moments_pol2_ 
+  ( const PSKERNEL&      kernel , 
+    const unsigned short nx     , 
+    const double         xmin   , 
+    const double         xmax   , 
+    const unsigned short ny     , 
+    const double         ymin   , 
+    const double         ymax   , 
+    const double         xlow   , 
+    const double         xhigh  , 
+    const double         ylow   , 
+    const double         yhigh  ) 
+  {
+    const std::size_t key = std::hash_combine 
+      ( kernel.tag () , 'P' , 2  , 
+        nx   , xmin  , xmax , ny   , ymin  , ymax  , 
+        xlow , xhigh , ylow , yhigh ) ;
+    //
+    return _moments_ 
+      ( key , [&] () -> MOMENTS 
+        {
+          const std::vector<Ostap::Math::Bernstein> bx = _basic_ ( nx , xmin , xmax ) ;
+          const std::vector<Ostap::Math::Bernstein> by = _basic_ ( ny , ymin , ymax ) ;
+          const unsigned int N = ( nx + 1 ) * ( ny + 1 ) ;
+          auto fun = [&kernel,&bx,&by,N] ( const double x , const double y , double* m ) 
+            {
+              double kx = 0 , ky = 0 ;
+              if ( !kernel ( x , y , kx , ky ) ) { std::fill ( m , m + N , 0.0 ) ; return ; }
+              const double k = 0.5 * ( kx + ky ) ;
+              for ( const Ostap::Math::Bernstein& b : bx ) 
+              {
+                const double fx = k * b ( x ) ;
+                for ( const Ostap::Math::Bernstein& c : by ) { *m = fx * c ( y ) ; ++m ; }
+              }
+            } ;
+          return _moments2D_ ( N , fun , xlow , xhigh , ylow , yhigh , 
+                               "Moments(PS2DPol2)" ) ;
+        } ) ;
+  }
+  // ==========================================================================
+  /** the table of 2D-moments for PS2DPol3-family 
+   *  - \f$ m_{i}       = \int\int \frac{1}{2}K_x B^{n_x}_i(x) dx dy \f$ for \f$ 0\le i \le n_x \f$
+   *  - \f$ m_{n_x+1+j} = \int\int \frac{1}{2}K_y B^{n_y}_j(y) dx dy \f$ for \f$ 0\le j \le n_y \f$
+   */
+  PMOMENTS _moments_pol3_ 
+  ( const PSKERNEL&      kernel , 
+    const unsigned short nx     , 
+    const double         xmin   , 
+    const double         xmax   , 
+    const unsigned short ny     , 
+    const double         ymin   , 
+    const double         ymax   , 
+    const double         xlow   , 
+    const double         xhigh  , 
+    const double         ylow   , 
+    const double         yhigh  ) 
+  {
+    const std::size_t key = std::hash_combine 
+      ( kernel.tag () , 'P' , 3  , 
+        nx   , xmin  , xmax , ny   , ymin  , ymax  , 
+        xlow , xhigh , ylow , yhigh ) ;
+    //
+    return _moments_ 
+      ( key , [&] () -> MOMENTS 
+        {
+          const std::vector<Ostap::Math::Bernstein> bx = _basic_ ( nx , xmin , xmax ) ;
+          const std::vector<Ostap::Math::Bernstein> by = _basic_ ( ny , ymin , ymax ) ;
+          const unsigned int N = nx + ny + 2 ;
+          auto fun = [&kernel,&bx,&by,N] ( const double x , const double y , double* m ) 
+            {
+              double kx = 0 , ky = 0 ;
+              if ( !kernel ( x , y , kx , ky ) ) { std::fill ( m , m + N , 0.0 ) ; return ; }
+              for ( const Ostap::Math::Bernstein& b : bx ) { *m = 0.5 * kx * b ( x ) ; ++m ; }
+              for ( const Ostap::Math::Bernstein& c : by ) { *m = 0.5 * ky * c ( y ) ; ++m ; }
+            } ;
+          return _moments2D_ ( N , fun , xlow , xhigh , ylow , yhigh , 
+                               "Moments(PS2DPol3)" ) ;
+        } ) ;
+  }
+  // ==========================================================================
 }
 // ===========================================================================
 // constructor from the order
@@ -223,13 +490,13 @@ double Ostap::Math::PS2DPol::integral
   //
   const Bernstein2D&   b2d = m_positive.bernstein() ;
   //
-  std::vector<double> fy ( ny + 1 , 0 ) ;
-  for ( unsigned short i = 0 ; i <= ny ; ++i ) 
-  { fy[i] = _integral_ ( m_psy , b2d.basicY ( i ) , y_low , y_high , m_workspace ) ; }
+  const std::vector<double> fy = *_moments_ 
+    ( m_psy , ny , [&b2d] ( const unsigned short i ) -> const Bernstein& { return b2d.basicY ( i ) ; } ,
+      y_low , y_high , m_workspace ) ;
   //
-  std::vector<double> fx ( nx + 1 , 0 ) ;
-  for  ( unsigned short i = 0 ; i <= nx ; ++i ) 
-  { fx[i] = _integral_ ( m_psx , b2d.basicX ( i ) , x_low , x_high , m_workspace ) ; }
+  const std::vector<double> fx = *_moments_ 
+    ( m_psx , nx , [&b2d] ( const unsigned short i ) -> const Bernstein& { return b2d.basicX ( i ) ; } ,
+      x_low , x_high , m_workspace ) ;
   //
   return calculate  ( fx  , fy ) ;
 }
@@ -255,9 +522,9 @@ double Ostap::Math::PS2DPol::integrateY
   //
   const Bernstein2D&   b2d = m_positive.bernstein() ;
   //
-  std::vector<double> fy ( ny + 1 , 0 ) ;
-  for ( unsigned short i = 0 ; i <= ny ; ++i ) 
-  { fy[i] = _integral_ ( m_psy , b2d.basicY ( i ) , y_low , y_high , m_workspace ) ; }
+  const std::vector<double> fy = *_moments_ 
+    ( m_psy , ny , [&b2d] ( const unsigned short i ) -> const Bernstein& { return b2d.basicY ( i ) ; } ,
+      y_low , y_high , m_workspace ) ;
   //
   std::vector<double> fx ( nx + 1 , 0 ) ;
   const double psx = m_psx ( x ) ;
@@ -294,9 +561,9 @@ double Ostap::Math::PS2DPol::integrateX
   for ( unsigned short i = 0 ; i <= ny ; ++i ) 
   { fy[i] = psy * b2d.basicY ( i ) ( y ) ; }
   //
-  std::vector<double> fx ( nx + 1 , 0 ) ;
-  for  ( unsigned short i = 0 ; i <= nx ; ++i ) 
-  { fx[i] = _integral_ ( m_psx , b2d.basicX ( i ) , x_low , x_high , m_workspace ) ; }
+  const std::vector<double> fx = *_moments_ 
+    ( m_psx , nx , [&b2d] ( const unsigned short i ) -> const Bernstein& { return b2d.basicX ( i ) ; } ,
+      x_low , x_high , m_workspace ) ;
   //
   return calculate  ( fx  , fy )  ;
 }
@@ -401,13 +668,13 @@ double Ostap::Math::PS2DPolSym::integral
   //
   const Ostap::Math::Bernstein2DSym& b2d = m_positive.bernstein() ;
   //
-  std::vector<double> fy ( n + 1 , 0 ) ;
-  for ( unsigned short i = 0 ; i <= n ; ++i ) 
-  { fy[i] = _integral_ ( m_ps , b2d.basic( i )  , y_low , y_high , m_workspace ) ; }
+  const std::vector<double> fy = *_moments_ 
+    ( m_ps , n , [&b2d] ( const unsigned short i ) -> const Bernstein& { return b2d.basic ( i ) ; } ,
+      y_low , y_high , m_workspace ) ;
   //
-  std::vector<double> fx ( n + 1 , 0 ) ;
-  for  ( unsigned short i = 0 ; i <= n ; ++i ) 
-  { fx[i] = _integral_ ( m_ps , b2d.basic( i )  , x_low , x_high , m_workspace ) ; }
+  const std::vector<double> fx = *_moments_ 
+    ( m_ps , n , [&b2d] ( const unsigned short i ) -> const Bernstein& { return b2d.basic ( i ) ; } ,
+      x_low , x_high , m_workspace ) ;
   //
   return calculate ( fx  , fy ) ;
 }
@@ -433,9 +700,9 @@ double Ostap::Math::PS2DPolSym::integrateY
   //
   const Ostap::Math::Bernstein2DSym& b2d = m_positive.bernstein() ;
   //
-  std::vector<double> fy ( n + 1 , 0 ) ;
-  for ( unsigned short i = 0 ; i <= n ; ++i ) 
-  { fy[i] = _integral_ ( m_ps , b2d.basic( i )  , y_low , y_high , m_workspace ) ; }
+  const std::vector<double> fy = *_moments_ 
+    ( m_ps , n , [&b2d] ( const unsigned short i ) -> const Bernstein& { return b2d.basic ( i ) ; } ,
+      y_low , y_high , m_workspace ) ;
   //
   std::vector<double> fx ( n + 1 , 0 ) ;
   for  ( unsigned short i = 0 ; i <= n ; ++i ) 
@@ -548,18 +815,29 @@ double Ostap::Math::PS2DPol2::integral
   //
   if ( x_low + y_low >= m_mmax ) { return 0 ; }
   //
-  // use cubature   
-  static const Ostap::Math::GSL::Integrator2D<PS2DPol2> s_cubature{} ;
-  static const char s_message[] = "Integral(PS2DPol2)" ;
-  const auto F = s_cubature.make_function ( this , x_low , x_high , y_low , y_high ) ;
+  // use the precomputed moments of the basic polynomials 
+  const Bernstein2D&   b2d = m_positive.bernstein () ;
+  const unsigned short nx  = b2d.nX () ;
+  const unsigned short ny  = b2d.nY () ;
+  const PSKERNEL kernel ( m_psx , m_psy , m_psx_aux , m_psy_aux , m_mmax ) ;
+  const PMOMENTS moments = _moments_pol2_ 
+    ( kernel , 
+      nx    , b2d.xmin () , b2d.xmax () , 
+      ny    , b2d.ymin () , b2d.ymax () , 
+      x_low , x_high      , y_low       , y_high ) ;
+  //
+  const std::vector<double>& m = *moments ;
+  double result = 0 ;
+  for  ( unsigned short ix = 0 ; ix <= nx ; ++ix )
+  {
+    for  ( unsigned short iy = 0 ; iy <= ny ; ++iy )
+    { result += b2d.par ( ix , iy ) * m [ ix * ( ny + 1 ) + iy ] ; } 
+  }
   //
-  int    ierror  =  0 ;
-  double  result =  1 ;
-  double  error  = -1 ;
-  std::tie ( ierror , result , error ) = s_cubature.cubature_with_cache 
-    ( tag () , &F , 20000 , s_PRECISION , s_PRECISION , s_message , __FILE__ , __LINE__ ) ;
-  // ==========================================================================
-  return result ;
+  const double scalex = ( nx + 1 ) / ( b2d.xmax () - b2d.xmin () ) ;
+  const double scaley = ( ny + 1 ) / ( b2d.ymax () - b2d.ymin () ) ;
+  //
+  return result * scalex * scaley ;
 }
 // ============================================================================
 double Ostap::Math::PS2DPol2::integrateY 
@@ -729,18 +1007,28 @@ double Ostap::Math::PS2DPol2Sym::integral
   //
   if ( x_low + y_low >= m_mmax ) { return 0 ; }
   //
-  // use cubature   
-  static const Ostap::Math::GSL::Integrator2D<PS2DPol2Sym> s_cubature{} ;
-  static const char s_message[] = "Integral(PS2DPol2Sym)" ;
-  const auto F = s_cubature.make_function ( this , x_low , x_high , y_low , y_high ) ;
+  // use the precomputed moments of the basic polynomials 
+  const Bernstein2DSym& b2d = m_positive.bernstein () ;
+  const unsigned short  n   = b2d.n () ;
+  const PSKERNEL kernel ( m_ps , m_ps , m_psx_aux , m_psy_aux , m_mmax ) ;
+  const PMOMENTS moments = _moments_pol2_ 
+    ( kernel , 
+      n     , b2d.xmin () , b2d.xmax () , 
+      n     , b2d.ymin () , b2d.ymax () , 
+      x_low , x_high      , y_low       , y_high ) ;
+  //
+  const std::vector<double>& m = *moments ;
+  double result = 0 ;
+  for  ( unsigned short ix = 0 ; ix <= n ; ++ix )
+  {
+    result   += b2d.par ( ix , ix ) * m [ ix * ( n + 1 ) + ix ] ;
+    for  ( unsigned short iy = 0 ; iy < ix ; ++iy )
+    { result += b2d.par ( ix , iy ) * ( m [ ix * ( n + 1 ) + iy ] + m [ iy * ( n + 1 ) + ix ] ) ; } 
+  }
   //
-  int    ierror  =  0 ;
-  double  result =  1 ;
-  double  error  = -1 ;
-  std::tie ( ierror , result , error ) = s_cubature.cubature_with_cache 
-    ( tag () , &F , 20000 , s_PRECISION , s_PRECISION , s_message , __FILE__ , __LINE__ ) ;
-  // ==========================================================================
-  return  result ;
+  const double scale = ( n + 1 ) / ( b2d.xmax () - b2d.xmin () ) ;
+  //
+  return result * scale * scale ;
 }
 // ============================================================================
 double Ostap::Math::PS2DPol2Sym::integrateY
@@ -914,17 +1202,25 @@ double Ostap::Math::PS2DPol3::integral
   //
   if ( x_low + y_low >= m_mmax ) { return 0 ; }
   //
-  // use cubature   
-  static const Ostap::Math::GSL::Integrator2D<PS2DPol3> s_cubature{} ;
-  static const char s_message[] = "Integral(PS2DPol3)" ;
-  const auto F = s_cubature.make_function ( this , x_low , x_high , y_low , y_high ) ;
+  // use the precomputed moments of the basic polynomials 
+  const unsigned short nx = m_psx.n () ;
+  const unsigned short ny = m_psy.n () ;
+  const PSKERNEL kernel ( m_psx.phasespace () , m_psy.phasespace () , 
+                          m_psx_aux , m_psy_aux , m_mmax ) ;
+  const PMOMENTS moments = _moments_pol3_ 
+    ( kernel , 
+      nx    , m_psx.xmin () , m_psx.xmax () , 
+      ny    , m_psy.xmin () , m_psy.xmax () , 
+      x_low , x_high        , y_low         , y_high ) ;
+  //
+  const std::vector<double>& m  = *moments ;
+  const std::vector<double>& ax = m_psx.positive ().bpars () ;
+  const std::vector<double>& ay = m_psy.positive ().bpars () ;
+  //
+  double result = 0 ;
+  for ( unsigned short i = 0 ; i <= nx ; ++i ) { result += ax [ i ] * m [          i ] ; }
+  for ( unsigned short j = 0 ; j <= ny ; ++j ) { result += ay [ j ] * m [ nx + 1 + j ] ; }
   //
-  int    ierror  =  0 ;
-  double  result =  1 ;
-  double  error  = -1 ;
-  std::tie ( ierror , result , error ) = s_cubature.cubature_with_cache  
-    ( tag () , &F , 20000 , s_PRECISION , s_PRECISION , s_message , __FILE__ , __LINE__ ) ;
-  // ==========================================================================
   return result ;
 }
 // ============================================================================
@@ -1091,18 +1387,24 @@ double Ostap::Math::PS2DPol3Sym::integral
   //
   if ( x_low + y_low >= m_mmax ) { return 0 ; }
   //
-  // use cubature   
-  static const Ostap::Math::GSL::Integrator2D<PS2DPol3Sym> s_cubature{} ;
-  static const char s_message[] = "Integral(PS2DPol3Sym)" ;
-  const auto F = s_cubature.make_function ( this , x_low , x_high , y_low , y_high ) ;
+  // use the precomputed moments of the basic polynomials 
+  const unsigned short n = m_ps.n () ;
+  const PSKERNEL kernel ( m_ps.phasespace () , m_ps.phasespace () , 
+                          m_psx_aux , m_psy_aux , m_mmax ) ;
+  const PMOMENTS moments = _moments_pol3_ 
+    ( kernel , 
+      n     , m_ps.xmin () , m_ps.xmax () , 
+      n     , m_ps.xmin () , m_ps.xmax () , 
+      x_low , x_high       , y_low        , y_high ) ;
   //
-  int    ierror  =  0 ;
-  double  result =  1 ;
-  double  error  = -1 ;
-  std::tie ( ierror , result , error ) = s_cubature.cubature_with_cache 
-    ( tag () , &F , 20000 , s_PRECISION , s_PRECISION , s_message , __FILE__ , __LINE__ ) ;
-  // ==========================================================================
-  return  result ;
+  const std::vector<double>& m = *moments ;
+  const std::vector<double>& a = m_ps.positive ().bpars () ;
+  //
+  double result = 0 ;
+  for ( unsigned short i = 0 ; i <= n ; ++i ) 
+  { result += a [ i ] * ( m [ i ] + m [ n + 1 + i ] ) ; }
+  //
+  return result ;
 }
 // ============================================================================
 double Ostap::Math::PS2DPol3Sym::integrateY
@@ -1272,9 +1574,9 @@ double Ostap::Math::ExpoPS2DPol::integral
   //
   const Bernstein2D&   b2d = m_positive.bernstein() ;
   //
-  std::vector<double> fy ( ny + 1 , 0 ) ;
-  for ( unsigned short i = 0 ; i <= ny ; ++i ) 
-  { fy[i] = _integral_ ( m_psy , b2d.basicY ( i ) , y_low , y_high , m_workspace ) ; }
+  const std::vector<double> fy = *_moments_ 
+    ( m_psy , ny , [&b2d] ( const unsigned short i ) -> const Bernstein& { return b2d.basicY ( i ) ; } ,
+      y_low , y_high , m_workspace ) ;
   //
   std::vector<double> fx ( nx + 1 , 0 ) ;
   for  ( unsigned short i = 0 ; i <= nx ; ++i )
@@ -1305,9 +1607,9 @@ double Ostap::Math::ExpoPS2DPol::integrateY
   //
   const Bernstein2D&   b2d = m_positive.bernstein() ;
   //
-  std::vector<double> fy ( ny + 1 , 0 ) ;
-  for ( unsigned short i = 0 ; i <= ny ; ++i ) 
-  { fy[i] = _integral_ ( m_psy , b2d.basicY ( i ) , y_low , y_high , m_workspace ) ; }
+  const std::vector<double> fy = *_moments_ 
+    ( m_psy , ny , [&b2d] ( const unsigned short i ) -> const Bernstein& { return b2d.basicY ( i ) ; } ,
+      y_low , y_high , m_workspace ) ;
   //
   std::vector<double> fx ( nx + 1 , 0 ) ;
   for  ( unsigned short i = 0 ; i <= nx ; ++i )
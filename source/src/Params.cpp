@@ -4,6 +4,7 @@
 // Ostap
 // ============================================================================
 #include "Ostap/Params.h"
+#include "Ostap/DataSnapshot.h"
 #include "Ostap/Formula.h"
 #include "Ostap/Notifier.h"
 #include "Ostap/Parameterization.h"
@@ -613,6 +614,156 @@ double Ostap::DataParam::parameterize
 
 
 
+// ============================================================================
+/*  fill Legendre sum with data from the columnar snapshot
+ *  @see Ostap::DataSnapshot 
+ *  @see Ostap::Math::LegendreSum::fill
+ *  @param data       (INPUT)  the snapshot 
+ *  @param sum        (UPDATE) the parameterization object 
+ *  @param expression (INPUT)  expression to be parameterized
+ *  @param selection  (INPUT)  selection/weight to be used 
+ *  @return  sum of weigths  used in parameterization
+ */
+// ============================================================================
+double Ostap::DataParam::parameterize 
+( Ostap::DataSnapshot&      data       , 
+  Ostap::Math::LegendreSum& sum        , 
+  const std::string&        expression , 
+  const std::string&        selection  ) 
+{
+  if ( data.empty() ) { return 0 ; }
+  //
+  Ostap::DataSnapshot::Column  _w ;
+  const double* x = data.column  ( expression      ).data () ;
+  const double* w = data.weights ( selection  , _w ).data () ;
+  //
+  const unsigned long N = data.size() ;
+  long double wsum = 0 ;
+  for ( unsigned long i = 0 ; i < N ; ++i ) 
+  {
+    if ( !w [ i ] ) { continue ; }
+    wsum += ( sum.fill ( x [ i ] , w [ i ] ) ? w [ i ] : 0 ) ;
+  }
+  //
+  return wsum ;
+}
+// ============================================================================
+/*  fill Legendre sum with data from the columnar snapshot
+ *  @see Ostap::DataSnapshot 
+ *  @see Ostap::Math::LegendreSum2::fill
+ *  @param data        (INPUT)  the snapshot 
+ *  @param sum         (UPDATE) the parameterization object 
+ *  @param xexpression (INPUT)  x-expression to be parameterized
+ *  @param yexpression (INPUT)  y-expression to be parameterized
+ *  @param selection   (INPUT)  selection/weight to be used 
+ *  @return  sum of weigths  used in parameterization
+ */
+// ============================================================================
+double Ostap::DataParam::parameterize 
+( Ostap::DataSnapshot&       data        , 
+  Ostap::Math::LegendreSum2& sum         , 
+  const std::string&         xexpression , 
+  const std::string&         yexpression , 
+  const std::string&         selection   ) 
+{
+  if ( data.empty() ) { return 0 ; }
+  //
+  Ostap::DataSnapshot::Column  _w ;
+  const double* x = data.column  ( xexpression     ).data () ;
+  const double* y = data.column  ( yexpression     ).data () ;
+  const double* w = data.weights ( selection  , _w ).data () ;
+  //
+  const unsigned long N = data.size() ;
+  long double wsum = 0 ;
+  for ( unsigned long i = 0 ; i < N ; ++i ) 
+  {
+    if ( !w [ i ] ) { continue ; }
+    wsum += ( sum.fill ( x [ i ] , y [ i ] , w [ i ] ) ? w [ i ] : 0 ) ;
+  }
+  //
+  return wsum ;
+}
+// ============================================================================
+/*  fill Legendre sum with data from the columnar snapshot
+ *  @see Ostap::DataSnapshot 
+ *  @see Ostap::Math::LegendreSum3::fill
+ *  @param data        (INPUT)  the snapshot 
+ *  @param sum         (UPDATE) the parameterization object 
+ *  @param xexpression (INPUT)  x-expression to be parameterized
+ *  @param yexpression (INPUT)  y-expression to be parameterized
+ *  @param zexpression (INPUT)  z-expression to be parameterized
+ *  @param selection   (INPUT)  selection/weight to be used 
+ *  @return  sum of weigths  used in parameterization
+ */
+// ============================================================================
+double Ostap::DataParam::parameterize 
+( Ostap::DataSnapshot&       data        , 
+  Ostap::Math::LegendreSum3& sum         , 
+  const std::string&         xexpression , 
+  const std::string&         yexpression , 
+  const std::string&         zexpression , 
+  const std::string&         selection   ) 
+{
+  if ( data.empty() ) { return 0 ; }
+  //
+  Ostap::DataSnapshot::Column  _w ;
+  const double* x = data.column  ( xexpression     ).data () ;
+  const double* y = data.column  ( yexpression     ).data () ;
+  const double* z = data.column  ( zexpression     ).data () ;
+  const double* w = data.weights ( selection  , _w ).data () ;
+  //
+  const unsigned long N = data.size() ;
+  long double wsum = 0 ;
+  for ( unsigned long i = 0 ; i < N ; ++i ) 
+  {
+    if ( !w [ i ] ) { continue ; }
+    wsum += ( sum.fill ( x [ i ] , y [ i ] , z [ i ] , w [ i ] ) ? w [ i ] : 0 ) ;
+  }
+  //
+  return wsum ;
+}
+// ============================================================================
+/*  fill Legendre sum with data from the columnar snapshot
+ *  @see Ostap::DataSnapshot 
+ *  @see Ostap::Math::LegendreSum4::fill
+ *  @param data        (INPUT)  the snapshot 
+ *  @param sum         (UPDATE) the parameterization object 
+ *  @param xexpression (INPUT)  x-expression to be parameterized
+ *  @param yexpression (INPUT)  y-expression to be parameterized
+ *  @param zexpression (INPUT)  z-expression to be parameterized
+ *  @param uexpression (INPUT)  u-expression to be parameterized
+ *  @param selection   (INPUT)  selection/weight to be used 
+ *  @return  sum of weigths  used in parameterization
+ */
+// ============================================================================
+double Ostap::DataParam::parameterize 
+( Ostap::DataSnapshot&       data        , 
+  Ostap::Math::LegendreSum4& sum         , 
+  const std::string&         xexpression , 
+  const std::string&         yexpression , 
+  const std::string&         zexpression , 
+  const std::string&         uexpression , 
+  const std::string&         selection   ) 
+{
+  if ( data.empty() ) { return 0 ; }
+  //
+  Ostap::DataSnapshot::Column  _w ;
+  const double* x = data.column  ( xexpression     ).data () ;
+  const double* y = data.column  ( yexpression     ).data () ;
+  const double* z = data.column  ( zexpression     ).data () ;
+  const double* u = data.column  ( uexpression     ).data () ;
+  const double* w = data.weights ( selection  , _w ).data () ;
+  //
+  const unsigned long N = data.size() ;
+  long double wsum = 0 ;
+  for ( unsigned long i = 0 ; i < N ; ++i ) 
+  {
+    if ( !w [ i ] ) { continue ; }
+    wsum += ( sum.fill ( x [ i ] , y [ i ] , z [ i ] , u [ i ] , w [ i ] ) ? w [ i ] : 0 ) ;
+  }
+  //
+  return wsum ;
+}
 // ============================================================================
 //                                                                      The END 
 // ============================================================================
@@ -4,11 +4,13 @@
 // STD & STL
 // ============================================================================
 #include <cmath>
+#include <algorithm>
 // ============================================================================
 // GSL
 // ============================================================================
 #include "gsl/gsl_sf_exp.h"
 #include "gsl/gsl_sf_gamma.h"
+#include "gsl/gsl_sf_psi.h"
 #include "gsl/gsl_randist.h"
 #include "gsl/gsl_cdf.h"
 // ============================================================================
@@ -22,6 +24,7 @@
 #include "local_math.h"
 #include "local_gsl.h"
 #include "local_hash.h"
+#include "Exception.h"
 #include "gauss.h"      
 #include "Integrator1D.h"      
 // ============================================================================
@@ -53,6 +56,18 @@ namespace
    */
   constexpr double s_ln2 = std::log ( 2.0 ) ;
   // ==========================================================================
+  /** the derivative of the helper function \f$ h(x) = \frac{\log(1+x)}{x} \f$
+   *  \f[ h^\prime(x) = \frac{1}{x^2}\left(\frac{x}{1+x} - \log(1+x)\right) \f]
+   *  @see x_log
+   */
+  inline double x_log_deriv ( const double x )
+  {
+    if ( x <= -1                ) { return 0 ; }                  // RETURN
+    if ( std::abs ( x ) < 1.e-3 )
+    { return -0.5 + x * ( 2.0 / 3 - x * ( 0.75 - 0.8 * x ) ) ; } // RETURN
+    return ( x / ( 1 + x ) - std::log1p ( x ) ) / ( x * x ) ;
+  }
+  // ==========================================================================
   // Novosibirsk & Co
   // ==========================================================================
   /** @var s_Novosibirsk
@@ -276,6 +291,56 @@ double Ostap::Math::BifurcatedGauss::integral ( const double low  ,
 std::size_t Ostap::Math::BifurcatedGauss::tag () const 
 { return std::hash_combine ( m_peak , m_sigmaL , m_sigmaR ) ; }
 // ============================================================================
+// get the parameter by index
+// ============================================================================
+double Ostap::Math::BifurcatedGauss::par ( const unsigned short i ) const 
+{
+  Ostap::Assert ( i < npars ()                      ,
+                  "Invalid parameter index"         ,
+                  "Ostap::Math::BifurcatedGauss"    ) ;
+  return 0 == i ? m_peak : 1 == i ? m_sigmaL : m_sigmaR ;
+}
+// ============================================================================
+// set the parameter by index
+// ============================================================================
+bool Ostap::Math::BifurcatedGauss::setPar 
+( const unsigned short i     , 
+  const double         value ) 
+{
+  Ostap::Assert ( i < npars ()                      ,
+                  "Invalid parameter index"         ,
+                  "Ostap::Math::BifurcatedGauss"    ) ;
+  return 
+    0 == i ? setPeak   ( value ) : 
+    1 == i ? setSigmaL ( value ) : setSigmaR ( value ) ;
+}
+// ============================================================================
+/*  evaluate the function and its derivatives with respect to parameters
+ *  @param x    the point
+ *  @param grad (OUTPUT) the derivatives
+ *  @return the function value
+ */
+// ============================================================================
+double Ostap::Math::BifurcatedGauss::gradient
+( const double x    , 
+  double*      grad ) const 
+{
+  const double dx   = x - m_peak ;
+  const bool   left = dx < 0 ;
+  const double s    = left ? sigmaL () : sigmaR () ;
+  const double f    = evaluate ( x ) ;
+  //
+  // d(log f)/d(sigma) for the "active" half and for the normalization 
+  const double ds   = dx * dx / ( s * s * s ) ;
+  const double dn   = 1.0 / ( sigmaL () + sigmaR () ) ;
+  //
+  grad [ 0 ] = f * dx / ( s * s ) ;
+  grad [ 1 ] = f * ( ( left ? ds : 0.0 ) - dn ) ;
+  grad [ 2 ] = f * ( ( left ? 0.0 : ds ) - dn ) ;
+  //
+  return f ;
+}
+// ============================================================================
 
 // ============================================================================
 bool Ostap::Math::BifurcatedGauss::setSigmaL ( const double value )
@@ -1188,6 +1253,116 @@ double Ostap::Math::Bukin::integral () const
 std::size_t Ostap::Math::Bukin::tag () const 
 { return std::hash_combine ( m_peak , m_sigma , m_xi , m_rho_L , m_rho_R ) ; }
 // ============================================================================
+// get the parameter by index
+// ============================================================================
+double Ostap::Math::Bukin::par ( const unsigned short i ) const 
+{
+  Ostap::Assert ( i < npars ()                      ,
+                  "Invalid parameter index"         ,
+                  "Ostap::Math::Bukin"              ) ;
+  return 
+    0 == i ? m_peak  : 
+    1 == i ? m_sigma : 
+    2 == i ? m_xi    : 
+    3 == i ? m_rho_L : m_rho_R ;
+}
+// ============================================================================
+// set the parameter by index
+// ============================================================================
+bool Ostap::Math::Bukin::setPar 
+( const unsigned short i     , 
+  const double         value ) 
+{
+  Ostap::Assert ( i < npars ()                      ,
+                  "Invalid parameter index"         ,
+                  "Ostap::Math::Bukin"              ) ;
+  return 
+    0 == i ? setPeak  ( value ) : 
+    1 == i ? setSigma ( value ) : 
+    2 == i ? setXi    ( value ) : 
+    3 == i ? setRhoL  ( value ) : setRhoR ( value ) ;
+}
+// ============================================================================
+/*  evaluate the function and its derivatives with respect to parameters
+ *  @param x    the point
+ *  @param grad (OUTPUT) the derivatives
+ *  @return the function value
+ */
+// ============================================================================
+double Ostap::Math::Bukin::gradient
+( const double x    , 
+  double*      grad ) const 
+{
+  const double f  = pdf ( x ) ;
+  std::fill ( grad , grad + npars () , 0.0 ) ;
+  if ( !f ) { return f ; }                                       // RETURN
+  //
+  // the derivatives of the xi-dependent constants
+  const double xi   = m_xi ;
+  const double q    = std::sqrt ( 1 + xi * xi ) ;
+  const double dq   = xi / q ;
+  const double du   = 1 / ( q * q * q ) ;           // d(xi/q)/dxi
+  //
+  // the tails 
+  if      ( m_x1 >= x || m_x2 <= x )
+  {
+    const double delta = xi + q - 1 ;
+    const double dlogT = 
+      dq / q + ( 1 + dq ) / ( 1 + xi + q ) - ( 1 + dq ) / ( xi + q ) 
+      - x_log_deriv ( delta ) * ( 1 + dq ) / x_log ( delta ) ;
+    //
+    const bool   left = m_x1 >= x ;
+    const double xt   = left ? m_x1  : m_x2  ;
+    const double rho  = left ? m_rho_L : m_rho_R ;
+    const double dx   = x      - xt ;
+    const double D    = m_peak - xt ;
+    const double t    = dx / D ;
+    const double r2   = rho * rho ;
+    // d(t)/d(xi)
+    const double dt   = m_sigma * s_Bukin * du * ( t - 1 ) / D ;
+    //
+    if ( left ) 
+    {
+      const double dL = m_L * ( dlogT - 2 * ( dq - 1 ) / ( q - xi ) ) ;
+      grad [ 0 ] = f * ( -m_L / m_sigma + 2 * r2 * t / D ) ;
+      grad [ 1 ] = f * (  m_L * ( D - dx ) / ( m_sigma * m_sigma ) 
+                          - 2 * r2 * t * ( 1 - t ) / m_sigma ) ;
+      grad [ 2 ] = f * (  dL  * dx / m_sigma - m_L * s_Bukin * du - 2 * r2 * t * dt ) ;
+      grad [ 3 ] = f * ( -2 * rho * t * t ) ;
+    }
+    else 
+    {
+      const double dR = m_R * ( dlogT - 2 * ( dq + 1 ) / ( q + xi ) ) ;
+      grad [ 0 ] = f * (  m_R / m_sigma + 2 * r2 * t / D ) ;
+      grad [ 1 ] = f * ( -m_R * ( D - dx ) / ( m_sigma * m_sigma ) 
+                         - 2 * r2 * t * ( 1 - t ) / m_sigma ) ;
+      grad [ 2 ] = f * ( -dR  * dx / m_sigma + m_R * s_Bukin * du - 2 * r2 * t * dt ) ;
+      grad [ 4 ] = f * ( -2 * rho * t * t ) ;
+    }
+    return f ;                                                   // RETURN
+  }
+  //
+  // central region: log(f) = -ln2 * B2 * z^2 , z = log(1+A*d)/A 
+  //
+  const double d     = ( x - m_peak ) / m_sigma ;
+  const double z     = d * x_log ( m_A * d ) ;
+  const double dzdd  = 1 / ( 1 + m_A * d ) ;
+  const double dzdA  = d * d * x_log_deriv ( m_A * d ) ;
+  //
+  const double beta  = 2 * xi * ( xi - q ) ;
+  const double dbeta = 4 * xi - 2 * q - 2 * xi * xi / q ;
+  const double dA    = 2 * ( 1 + 2 * xi * xi ) / ( q * s_Bukin ) ;
+  const double dB2   = 2 * m_B2 * 
+    ( dq / q - ( 1 - dq ) / ( xi - q ) - x_log_deriv ( beta ) * dbeta / x_log ( beta ) ) ;
+  //
+  const double dfdz  = -2 * s_ln2 * m_B2 * z * f ;
+  grad [ 0 ] = -dfdz * dzdd / m_sigma ;
+  grad [ 1 ] = -dfdz * dzdd * d / m_sigma ;
+  grad [ 2 ] =  dfdz * dzdA * dA - s_ln2 * z * z * dB2 * f ;
+  //
+  return f ;
+}
+// ============================================================================
 
 
 
@@ -1588,6 +1763,77 @@ double Ostap::Math::CrystalBall::integral () const
 std::size_t Ostap::Math::CrystalBall::tag () const 
 { return std::hash_combine ( m_m0 , m_sigma , m_alpha , m_n ) ; }
 // ============================================================================
+// get the parameter by index
+// ============================================================================
+double Ostap::Math::CrystalBall::par ( const unsigned short i ) const 
+{
+  Ostap::Assert ( i < npars ()                      ,
+                  "Invalid parameter index"         ,
+                  "Ostap::Math::CrystalBall"        ) ;
+  return 
+    0 == i ? m_m0    : 
+    1 == i ? m_sigma : 
+    2 == i ? m_alpha : m_n ;
+}
+// ============================================================================
+// set the parameter by index
+// ============================================================================
+bool Ostap::Math::CrystalBall::setPar 
+( const unsigned short i     , 
+  const double         value ) 
+{
+  Ostap::Assert ( i < npars ()                      ,
+                  "Invalid parameter index"         ,
+                  "Ostap::Math::CrystalBall"        ) ;
+  return 
+    0 == i ? setM0    ( value ) : 
+    1 == i ? setSigma ( value ) : 
+    2 == i ? setAlpha ( value ) : setN ( value ) ;
+}
+// ============================================================================
+/*  evaluate the function and its derivatives with respect to parameters
+ *  @param x    the point
+ *  @param grad (OUTPUT) the derivatives
+ *  @return the function value
+ */
+// ============================================================================
+double Ostap::Math::CrystalBall::gradient
+( const double x    , 
+  double*      grad ) const 
+{
+  //
+  const double dx = ( x - m_m0 ) / m_sigma ;
+  const double f  = pdf ( x ) ;
+  //
+  // the peak
+  //
+  if  ( !( dx < -m_alpha ) ) 
+  {
+    grad [ 0 ] = f * dx / m_sigma ;
+    grad [ 1 ] = f * ( dx * dx - 1 ) / m_sigma ;
+    grad [ 2 ] = 0 ;
+    grad [ 3 ] = 0 ;
+    return f ;                                                   // RETURN 
+  }
+  //
+  // the tail: log f = N*log(N) - N*log(D) - alpha^2/2 - log(sigma) + const  
+  //           with N = n + 1 and D = N - |alpha| * ( alpha + dx ) 
+  //
+  const double N  = np1 () ;
+  const double a  = aa  () ;
+  const double D  = N - a * ( m_alpha + dx ) ;
+  const double sa = m_alpha < 0 ? -1.0 : 1.0 ;
+  //
+  const double ddx = N * a / D ;  // d(log f)/d(dx)
+  //
+  grad [ 0 ] = - f * ddx / m_sigma ;
+  grad [ 1 ] = - f * ( ddx * dx + 1 ) / m_sigma ;
+  grad [ 2 ] =   f * ( N * ( sa * ( m_alpha + dx ) + a ) / D - m_alpha ) ;
+  grad [ 3 ] =   f * ( std::log ( N / D ) + 1 - N / D ) ;
+  //
+  return f ;
+}
+// ============================================================================
 
 
 // ============================================================================
@@ -2151,6 +2397,83 @@ std::size_t Ostap::Math::Apolonios::tag () const
 { return std::hash_combine ( m_m0      , m_sigma , 
                              m_alpha   , m_n     , m_b ) ; }
 // ============================================================================
+// get the parameter by index
+// ============================================================================
+double Ostap::Math::Apolonios::par ( const unsigned short i ) const 
+{
+  Ostap::Assert ( i < npars ()                      ,
+                  "Invalid parameter index"         ,
+                  "Ostap::Math::Apolonios"          ) ;
+  return 
+    0 == i ? m_m0    : 
+    1 == i ? m_sigma : 
+    2 == i ? m_alpha : 
+    3 == i ? m_n     : m_b ;
+}
+// ============================================================================
+// set the parameter by index
+// ============================================================================
+bool Ostap::Math::Apolonios::setPar 
+( const unsigned short i     , 
+  const double         value ) 
+{
+  Ostap::Assert ( i < npars ()                      ,
+                  "Invalid parameter index"         ,
+                  "Ostap::Math::Apolonios"          ) ;
+  return 
+    0 == i ? setM0    ( value ) : 
+    1 == i ? setSigma ( value ) : 
+    2 == i ? setAlpha ( value ) : 
+    3 == i ? setN     ( value ) : setB ( value ) ;
+}
+// ============================================================================
+/*  evaluate the function and its derivatives with respect to parameters
+ *  @param x    the point
+ *  @param grad (OUTPUT) the derivatives
+ *  @return the function value
+ */
+// ============================================================================
+double Ostap::Math::Apolonios::gradient
+( const double x    , 
+  double*      grad ) const 
+{
+  const double f  = pdf ( x ) ;
+  const double dx = ( x - m_m0 ) / m_sigma ;
+  //
+  // the tail:  f ~ (N/D)^N * exp(-b*a1) , D = N - (alpha+dx)*aa 
+  //
+  if  ( dx < -m_alpha )
+  {
+    const double N    = np1 () ;
+    const double A1   = a1  () ;
+    const double AA   = aa  () ;
+    const double D    = N - ( m_alpha + dx ) * AA ;
+    const double r    = N / D ;
+    //
+    const double daa  = ( m_alpha < 0 ? -1 : 1 ) * m_b / ( A1 * A1 * A1 ) ;
+    const double dDa  = -AA - ( m_alpha + dx ) * daa ;
+    const double dDb  = -( m_alpha + dx ) * std::abs ( m_alpha ) / A1 ;
+    //
+    grad [ 0 ] = -f * r * AA / m_sigma ;
+    grad [ 1 ] = -f * ( r * AA * dx + 1 ) / m_sigma ;
+    grad [ 2 ] =  f * ( -r * dDa - m_b * m_alpha / A1 ) ;
+    grad [ 3 ] =  f * ( std::log ( r ) + 1 - r ) ;
+    grad [ 4 ] =  f * ( -r * dDb - A1 ) ;
+    return f ;                                                   // RETURN
+  }
+  //
+  // the peak: f ~ exp ( -b * sqrt ( 1 + dx^2 ) )
+  //
+  const double r = std::sqrt ( 1 + dx * dx ) ;
+  grad [ 0 ] = f * m_b * dx / ( r * m_sigma ) ;
+  grad [ 1 ] = f * ( m_b * dx * dx / r - 1 ) / m_sigma ;
+  grad [ 2 ] = 0 ;
+  grad [ 3 ] = 0 ;
+  grad [ 4 ] = -f * r ;
+  //
+  return f ;
+}
+// ============================================================================
 
 // ============================================================================
 // apolonios2 
@@ -2293,6 +2616,62 @@ double Ostap::Math::Apolonios2::integral
 std::size_t Ostap::Math::Apolonios2::tag () const 
 { return std::hash_combine ( m_m0 , m_sigmaL , m_sigmaR , m_beta ) ; }
 // ============================================================================
+// get the parameter by index
+// ============================================================================
+double Ostap::Math::Apolonios2::par ( const unsigned short i ) const 
+{
+  Ostap::Assert ( i < npars ()                      ,
+                  "Invalid parameter index"         ,
+                  "Ostap::Math::Apolonios2"         ) ;
+  return 
+    0 == i ? m_m0     : 
+    1 == i ? m_sigmaL : 
+    2 == i ? m_sigmaR : m_beta ;
+}
+// ============================================================================
+// set the parameter by index
+// ============================================================================
+bool Ostap::Math::Apolonios2::setPar 
+( const unsigned short i     , 
+  const double         value ) 
+{
+  Ostap::Assert ( i < npars ()                      ,
+                  "Invalid parameter index"         ,
+                  "Ostap::Math::Apolonios2"         ) ;
+  return 
+    0 == i ? setM0     ( value ) : 
+    1 == i ? setSigmaL ( value ) : 
+    2 == i ? setSigmaR ( value ) : setBeta ( value ) ;
+}
+// ============================================================================
+/*  evaluate the function and its derivatives with respect to parameters
+ *  @param x    the point
+ *  @param grad (OUTPUT) the derivatives
+ *  @return the function value
+ */
+// ============================================================================
+double Ostap::Math::Apolonios2::gradient
+( const double x    , 
+  double*      grad ) const 
+{
+  const double f    = pdf ( x ) ;
+  const bool   left = x < m_m0 ;
+  const double s    = left ? m_sigmaL : m_sigmaR ;
+  const double dx   = ( x - m_m0 ) / s ;
+  const double R    = std::sqrt ( b2 () + dx * dx ) ;
+  //
+  // d(log f)/d(sigma) for the "active" half and for the normalization 
+  const double ds   = m_beta * dx * dx / ( R * s ) ;
+  const double dn   = 0.5 / sigma () ;
+  //
+  grad [ 0 ] = f * m_beta * dx / ( R * s ) ;
+  grad [ 1 ] = f * ( ( left ? ds : 0.0 ) - dn ) ;
+  grad [ 2 ] = f * ( ( left ? 0.0 : ds ) - dn ) ;
+  grad [ 3 ] = f * ( 2 * m_beta - R - b2 () / R ) ;
+  //
+  return f ;
+}
+// ============================================================================
 
 
 // ============================================================================
@@ -2683,6 +3062,59 @@ double Ostap::Math::StudentT::integral
 std::size_t Ostap::Math::StudentT::tag () const 
 { return std::hash_combine ( m_M , m_s , m_n ) ; }
 // ============================================================================
+// get the parameter by index
+// ============================================================================
+double Ostap::Math::StudentT::par ( const unsigned short i ) const 
+{
+  Ostap::Assert ( i < npars ()                      ,
+                  "Invalid parameter index"         ,
+                  "Ostap::Math::StudentT"           ) ;
+  return 
+    0 == i ? m_M : 
+    1 == i ? m_s : m_n - 1 ;
+}
+// ============================================================================
+// set the parameter by index
+// ============================================================================
+bool Ostap::Math::StudentT::setPar 
+( const unsigned short i     , 
+  const double         value ) 
+{
+  Ostap::Assert ( i < npars ()                      ,
+                  "Invalid parameter index"         ,
+                  "Ostap::Math::StudentT"           ) ;
+  return 
+    0 == i ? setM     ( value ) : 
+    1 == i ? setSigma ( value ) : setN ( value ) ;
+}
+// ============================================================================
+/*  evaluate the function and its derivatives with respect to parameters
+ *  @param x    the point
+ *  @param grad (OUTPUT) the derivatives
+ *  @return the function value
+ */
+// ============================================================================
+double Ostap::Math::StudentT::gradient
+( const double x    , 
+  double*      grad ) const 
+{
+  //
+  const double y  = ( x - M () ) / sigma () ;
+  const double v  = nu () ;
+  const double y2 = y * y ;
+  const double f  = pdf ( x ) ;
+  //
+  const double dy = - ( v + 1 ) * y / ( v + y2 ) ;  // d(log f)/dy
+  //
+  grad [ 0 ] = - f * dy / sigma () ;
+  grad [ 1 ] = - f * ( dy * y + 1 ) / sigma () ;
+  grad [ 2 ] =   f * ( 0.5 * ( gsl_sf_psi ( 0.5 * ( v + 1 ) ) - gsl_sf_psi ( 0.5 * v ) - 1 / v )
+                       - 0.5 * std::log1p ( y2 / v ) 
+                       + 0.5 * ( v + 1 ) * y2 / ( v * ( v + y2 ) ) ) ;
+  //
+  return f ;
+}
+// ============================================================================
 
 // ============================================================================
 // Bifurcated Student-T 
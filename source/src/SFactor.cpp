@@ -2,6 +2,11 @@
 // ============================================================================
 // Include files 
 // ============================================================================
+// STD&STL
+// ============================================================================
+#include <vector>
+#include <string>
+// ============================================================================
 // ROOT 
 // ============================================================================
 #include "TTree.h"
@@ -11,6 +16,10 @@
 // ============================================================================
 #include "Ostap/SFactor.h"
 // ============================================================================
+// Local
+// ============================================================================
+#include "local_tree.h"
+// ============================================================================
 /** @file 
  *  Implementation file for class Analysis::SFactor
  *  @see Ostap::SFactor
@@ -58,6 +67,10 @@ Ostap::SFactor::sFactor
   if ( 0 == tree->FindBranch ( varname.c_str() ) ) { return VE ( 0 , -300 ) ; } // non-exiting branch
   if ( 0 == tree->GetBranch  ( varname.c_str() ) ) { return VE ( 0 , -400 ) ; } // non-exiting branch
   //
+  // the fast path for primitive scalar branch: read only this branch
+  if ( primitive_leaf ( tree , varname ) )
+  { return sFactor ( tree , std::vector<std::string> ( 1 , varname ) ) [ 0 ] ; }
+  //
   Double_t   value      ;
   TBranch*   branch = 0 ;
   //
@@ -86,6 +99,69 @@ Ostap::SFactor::sFactor
   return VE ( sumw , sumw2 ) ;
 }
 // ============================================================================
+/*  Get sum and sum of squares for several simple branches in Tree
+ *  in one pass. Only the requested branches are read, block-by-block
+ *
+ *  @code 
+ *  tree = ...
+ *  sfs  = Ostap.SFactor.sFactor ( tree , [ 'S_sw' , 'B_sw' ] )
+ *  @endcode 
+ *
+ *  @param  tree     (INPUT) the tree 
+ *  @param  varnames (INPUT) names of the simple (primitive scalar) variables 
+ *  @return s-factors in a form of value +- sqrt(cov2)  
+ *  @author agent agent@local
+ *  @date 2026-10-19
+ */
+// ============================================================================
+std::vector<Ostap::Math::ValueWithError>
+Ostap::SFactor::sFactor 
+( TTree*                          tree     ,  
+  const std::vector<std::string>& varnames ) 
+{
+  //
+  typedef Ostap::Math::ValueWithError VE ;
+  //
+  const unsigned long N = varnames.size() ;
+  if ( 0 == tree             ) { return std::vector<VE> ( N , VE ( 0 , -100 ) ) ; } 
+  if ( varnames.empty()      ) { return std::vector<VE> () ; }
+  //
+  std::vector<VE> result ; result.reserve ( N ) ;
+  if ( !primitive_leaves ( tree , varnames ) )
+  {
+    // the slow path, variable-by-variable 
+    for ( const auto& v : varnames ) { result.push_back ( sFactor ( tree , v ) ) ; }
+    return result ;
+  }
+  //
+  std::vector<long double> sumw  ( N , 0.0L ) ;
+  std::vector<long double> sumw2 ( N , 0.0L ) ;
+  //
+  Columns columns ( tree , varnames ) ;
+  const unsigned long nEntries = tree->GetEntries() ;
+  //
+  unsigned long entry = 0 ;
+  while ( entry < nEntries )
+  {
+    const unsigned long n = columns.read ( entry , nEntries ) ;
+    if ( 0 == n ) { break ; }                                     // BREAK 
+    for ( unsigned long i = 0 ; i < N ; ++i )
+    {
+      double s1 = 0 ;
+      double s2 = 0 ;
+      block_sums ( n , columns.column ( i ) , s1 , s2 ) ;
+      sumw  [ i ] += s1 ;
+      sumw2 [ i ] += s2 ;
+    }
+    entry += n ;
+  }
+  //
+  for ( unsigned long i = 0 ; i < N ; ++i ) 
+  { result.push_back ( VE ( sumw [ i ] , sumw2 [ i ] ) ) ; }
+  //
+  return result ;
+}
+// ============================================================================
 /*  Get sum and sum of squares for the weights in sataset, e.g. 
  *  s-factor from usage of s_weight 
  *  The direct summation in python is rather slow, thus C++ routine helps
@@ -0,0 +1,409 @@
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <memory>
+#include <algorithm>
+// ============================================================================
+// ROOT
+// ============================================================================
+#include "TTree.h"
+#include "TBranch.h"
+// ============================================================================
+// RooFit
+// ============================================================================
+#include "RooAbsPdf.h"
+#include "RooAbsReal.h"
+#include "RooRealVar.h"
+#include "RooDataSet.h"
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/Iterator.h"
+#include "Ostap/Formula.h"
+#include "Ostap/Notifier.h"
+#include "Ostap/SPlot.h"
+// ============================================================================
+// Local
+// ============================================================================
+#include "Exception.h"
+#include "local_parallel.h"
+// ============================================================================
+/** @file
+ *  Implementation file for class Ostap::SPlot
+ *  @see Ostap::SPlot
+ *  @author agent agent@local
+ *  @date 2026-10-19
+ */
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  /** @class Model
+   *  private deep copy of the component PDFs and observables
+   *  to be used in one thread
+   */
+  class Model
+  {
+  public:
+    // ========================================================================
+    Model ( const RooArgList&               pdfs        ,
+            const std::vector<std::string>& observables )
+    {
+      RooArgSet all { pdfs } ;
+      m_snapshot.reset ( static_cast<RooArgSet*> ( all.snapshot ( true ) ) ) ;
+      Ostap::Assert ( nullptr != m_snapshot                    ,
+                      "Can't copy the model"                   ,
+                      "Ostap::SPlot"                           ) ;
+      //
+      Ostap::Utils::Iterator iter ( pdfs ) ;
+      while ( RooAbsArg* a = iter.static_next<RooAbsArg>() )
+      {
+        RooAbsPdf* p = dynamic_cast<RooAbsPdf*> ( m_snapshot->find ( a->GetName () ) ) ;
+        Ostap::Assert ( nullptr != p                                           ,
+                        std::string ( "Invalid component " ) + a->GetName ()   ,
+                        "Ostap::SPlot"                                         ) ;
+        m_pdfs.push_back ( p ) ;
+      }
+      // observables: the model does not need to depend on all of them
+      for ( const auto& o : observables )
+      {
+        RooRealVar* v = dynamic_cast<RooRealVar*> ( m_snapshot->find ( o.c_str () ) ) ;
+        m_vars.push_back ( v ) ;
+        if ( nullptr != v ) { m_normset.add ( *v ) ; }
+      }
+      // evaluate once: create the normalization caches in this thread
+      for ( RooAbsPdf* p : m_pdfs ) { p->getVal ( &m_normset ) ; }
+    }
+    // ========================================================================
+    /// evaluate the component PDFs at the given point
+    inline void evaluate ( const double* x , double* f )
+    {
+      for ( unsigned int i = 0 ; i < m_vars.size () ; ++i )
+      { if ( nullptr != m_vars [ i ] ) { m_vars [ i ]->setVal ( x [ i ] ) ; } }
+      for ( unsigned int k = 0 ; k < m_pdfs.size () ; ++k )
+      { f [ k ] = m_pdfs [ k ]->getVal ( &m_normset ) ; }
+    }
+    // ========================================================================
+  private:
+    // ========================================================================
+    std::unique_ptr<RooArgSet> m_snapshot {} ;
+    std::vector<RooAbsPdf*>    m_pdfs     {} ;
+    std::vector<RooRealVar*>   m_vars     {} ;
+    RooArgSet                  m_normset  {} ;
+    // ========================================================================
+  } ;
+  // ==========================================================================
+}
+// ============================================================================
+/*  constructor from the model
+ *  @param pdfs        (INPUT) the component PDFs
+ *  @param yields      (INPUT) the fitted yields
+ *  @param observables (INPUT) the observables
+ */
+// ============================================================================
+Ostap::SPlot::SPlot
+( const RooArgList& pdfs        ,
+  const RooArgList& yields      ,
+  const RooArgSet&  observables )
+  : m_pdfs        ( pdfs        )
+  , m_observables ( observables )
+{
+  Ostap::Assert ( 0 < pdfs.getSize () && pdfs.getSize () == yields.getSize () ,
+                  "Invalid components/yields"                                  ,
+                  "Ostap::SPlot"                                               ,
+                  InvalidModel                                                 ) ;
+  //
+  Ostap::Utils::Iterator ip ( pdfs ) ;
+  while ( RooAbsArg* a = ip.static_next<RooAbsArg>() )
+  {
+    Ostap::Assert ( nullptr != dynamic_cast<RooAbsPdf*> ( a )                 ,
+                    std::string ( "Component is not PDF: " ) + a->GetName ()  ,
+                    "Ostap::SPlot"                                            ,
+                    InvalidModel                                              ) ;
+  }
+  //
+  Ostap::Utils::Iterator iy ( yields ) ;
+  while ( RooAbsArg* a = iy.static_next<RooAbsArg>() )
+  {
+    const RooAbsReal* y = dynamic_cast<RooAbsReal*> ( a ) ;
+    Ostap::Assert ( nullptr != y                                              ,
+                    std::string ( "Invalid yield: " ) + a->GetName ()         ,
+                    "Ostap::SPlot"                                            ,
+                    InvalidModel                                              ) ;
+    m_names .push_back ( y->GetName () ) ;
+    m_yields.push_back ( y->getVal  () ) ;
+  }
+  //
+  Ostap::Utils::Iterator io ( observables ) ;
+  while ( RooAbsArg* a = io.static_next<RooAbsArg>() )
+  {
+    Ostap::Assert ( nullptr != dynamic_cast<RooRealVar*> ( a )                ,
+                    std::string ( "Invalid observable: " ) + a->GetName ()    ,
+                    "Ostap::SPlot"                                            ,
+                    InvalidObservable                                         ) ;
+    m_obsnames.push_back ( a->GetName () ) ;
+  }
+}
+// ============================================================================
+/*  calculate the sWeights from the observables columns
+ *  @param x        (INPUT)  observables, <code>x[entry*nobs+i]</code>
+ *  @param weights  (INPUT)  event weights, empty for non-weighted data
+ *  @param sweights (OUTPUT) sWeights, <code>sweights[entry*ncmp+k]</code>
+ *  @param nthreads (INPUT)  number of threads for evaluation of PDFs
+ *  @return status code
+ */
+// ============================================================================
+Ostap::StatusCode Ostap::SPlot::calculate
+( const std::vector<double>& x        ,
+  const std::vector<double>& weights  ,
+  std::vector<double>&       sweights ,
+  const unsigned short       nthreads )
+{
+  const unsigned int  K = m_names   .size () ;
+  const unsigned int  D = m_obsnames.size () ;
+  const unsigned long N = 0 < D ? x.size () / D : 0 ;
+  //
+  m_entries = N ;
+  m_covariance.ResizeTo ( K , K ) ;
+  m_sfactors.assign ( K , Ostap::Math::ValueWithError () ) ;
+  sweights  .assign ( N * K , 0.0 ) ;
+  //
+  if ( 0 == N ) { return Ostap::StatusCode::SUCCESS ; }
+  if ( !weights.empty () && weights.size () != N ) { return InvalidDataSet ; }
+  //
+  const unsigned int nt = n_threads ( nthreads , N ) ;
+  //
+  // (1) private copies of the model, created sequentially
+  std::vector<std::unique_ptr<Model> > models ( nt ) ;
+  for ( auto& m : models ) { m.reset ( new Model ( m_pdfs , m_obsnames ) ) ; }
+  //
+  // (2) evaluate PDFs and the inverse covariance matrix
+  std::vector<double> F    ( N * K , 0.0 ) ;   // PDF values
+  std::vector<double> iD   ( N     , 0.0 ) ;   // 1/sum_k N_k f_k
+  std::vector<std::vector<long double> > icov ( nt , std::vector<long double> ( K * K , 0.0L ) ) ;
+  //
+  const double* yields = m_yields.data () ;
+  parallel_for
+    ( nt , 0 , N ,
+      [&] ( const unsigned int t , const std::size_t b , const std::size_t e )
+      {
+        Model&                    model = *models [ t ] ;
+        std::vector<long double>& ic    = icov    [ t ] ;
+        for ( std::size_t entry = b ; entry < e ; ++entry )
+        {
+          double* f = F.data () + entry * K ;
+          model.evaluate ( x.data () + entry * D , f ) ;
+          //
+          double dn = 0 ;
+          for ( unsigned int k = 0 ; k < K ; ++k ) { dn += yields [ k ] * f [ k ] ; }
+          if ( dn <= 0 ) { continue ; }              // no sWeights for this entry
+          //
+          const double idn = 1.0 / dn ;
+          iD [ entry ] = idn ;
+          const double w   = weights.empty () ? 1.0 : weights [ entry ] ;
+          const double s   = w * idn * idn ;
+          for ( unsigned int i = 0 ; i < K ; ++i )
+          { for ( unsigned int j = i ; j < K ; ++j ) { ic [ i * K + j ] += s * f [ i ] * f [ j ] ; } }
+        }
+      } ) ;
+  //
+  models.clear () ;
+  //
+  TMatrixDSym V ( K ) ;
+  for ( unsigned int i = 0 ; i < K ; ++i )
+  {
+    for ( unsigned int j = i ; j < K ; ++j )
+    {
+      long double v = 0 ;
+      for ( unsigned int t = 0 ; t < nt ; ++t ) { v += icov [ t ][ i * K + j ] ; }
+      V ( i , j ) = v ;
+      V ( j , i ) = v ;
+    }
+  }
+  //
+  double det = 0 ;
+  V.Invert ( &det ) ;
+  if ( 0 == det || !V.IsValid () ) { return InvalidCovariance ; }
+  //
+  m_covariance = V ;
+  //
+  // (3) sWeights and sFactors
+  std::vector<std::vector<long double> > sums ( nt , std::vector<long double> ( 2 * K , 0.0L ) ) ;
+  std::vector<double> cov ( K * K ) ;
+  for ( unsigned int i = 0 ; i < K ; ++i )
+  { for ( unsigned int j = 0 ; j < K ; ++j ) { cov [ i * K + j ] = V ( i , j ) ; } }
+  //
+  parallel_for
+    ( nt , 0 , N ,
+      [&] ( const unsigned int t , const std::size_t b , const std::size_t e )
+      {
+        std::vector<long double>& s = sums [ t ] ;
+        for ( std::size_t entry = b ; entry < e ; ++entry )
+        {
+          const double  idn = iD [ entry ] ;
+          if ( 0 == idn ) { continue ; }
+          const double* f   = F.data ()        + entry * K ;
+          double*       sw  = sweights.data () + entry * K ;
+          const double  w   = weights.empty () ? 1.0 : weights [ entry ] ;
+          for ( unsigned int n = 0 ; n < K ; ++n )
+          {
+            double v = 0 ;
+            for ( unsigned int j = 0 ; j < K ; ++j ) { v += cov [ n * K + j ] * f [ j ] ; }
+            v *= idn ;
+            sw [ n ] = v ;
+            //
+            const double ws = w * v ;
+            s [ n     ] += ws      ;
+            s [ n + K ] += ws * ws ;
+          }
+        }
+      } ) ;
+  //
+  for ( unsigned int n = 0 ; n < K ; ++n )
+  {
+    long double sw  = 0 ;
+    long double sw2 = 0 ;
+    for ( unsigned int t = 0 ; t < nt ; ++t ) { sw += sums [ t ][ n ] ; sw2 += sums [ t ][ n + K ] ; }
+    m_sfactors [ n ] = Ostap::Math::ValueWithError ( sw , sw2 ) ;
+  }
+  //
+  return Ostap::StatusCode::SUCCESS ;
+}
+// ============================================================================
+/*  calculate sWeights for the tree and add them as new branches
+ *  <code>yield_name+suffix</code>
+ *  @param tree     (UPDATE) the tree
+ *  @param suffix   (INPUT)  the suffix for the new branches
+ *  @param nthreads (INPUT)  number of threads for evaluation of PDFs
+ *  @return status code
+ */
+// ============================================================================
+Ostap::StatusCode Ostap::SPlot::addWeights
+( TTree*               tree     ,
+  const std::string&   suffix   ,
+  const unsigned short nthreads )
+{
+  if ( nullptr == tree ) { return InvalidTree ; }
+  //
+  const unsigned int D = m_obsnames.size () ;
+  const unsigned int K = m_names   .size () ;
+  //
+  // (1) read the observables: only the needed branches
+  typedef std::unique_ptr<Ostap::Formula> UOF ;
+  std::vector<UOF> formulas ; formulas.reserve ( D ) ;
+  for ( const auto& o : m_obsnames )
+  {
+    auto p = std::make_unique<Ostap::Formula> ( "" , o , tree ) ;
+    if ( !p || !p->ok () ) { return InvalidObservable ; }
+    formulas.push_back ( std::move ( p ) ) ;
+  }
+  //
+  const unsigned long nentries = tree->GetEntries () ;
+  std::vector<double> x ; x.reserve ( nentries * D ) ;
+  {
+    Ostap::Utils::Notifier notify ( formulas.begin () , formulas.end () , tree ) ;
+    for ( unsigned long entry = 0 ; entry < nentries ; ++entry )
+    {
+      if ( tree->LoadTree ( entry ) < 0 ) { break ; }
+      for ( auto& f : formulas ) { x.push_back ( f->evaluate () ) ; }
+    }
+  }
+  const unsigned long N = 0 < D ? x.size () / D : 0 ;
+  if ( N != nentries ) { return InvalidTree ; }
+  //
+  // (2) calculate sWeights
+  std::vector<double> sweights ;
+  Ostap::StatusCode sc = calculate ( x , {} , sweights , nthreads ) ;
+  if ( sc.isFailure () ) { return sc ; }
+  //
+  // (3) add new branches
+  std::vector<Double_t> values   ( K , 0.0 ) ;
+  std::vector<TBranch*> branches ( K , nullptr ) ;
+  for ( unsigned int k = 0 ; k < K ; ++k )
+  {
+    const std::string name = m_names [ k ] + suffix ;
+    branches [ k ] = tree->Branch ( name.c_str () , &values [ k ] , ( name + "/D" ).c_str () ) ;
+    if ( nullptr == branches [ k ] ) { return InvalidTree ; }
+  }
+  for ( unsigned long entry = 0 ; entry < N ; ++entry )
+  {
+    for ( unsigned int k = 0 ; k < K ; ++k )
+    {
+      values   [ k ] = sweights [ entry * K + k ] ;
+      branches [ k ] -> Fill () ;
+    }
+  }
+  //
+  return Ostap::StatusCode::SUCCESS ;
+}
+// ============================================================================
+/*  calculate sWeights for the dataset and add them as new variables
+ *  <code>yield_name+suffix</code>
+ *  @param data     (UPDATE) the dataset
+ *  @param suffix   (INPUT)  the suffix for the new variables
+ *  @param nthreads (INPUT)  number of threads for evaluation of PDFs
+ *  @return status code
+ */
+// ============================================================================
+Ostap::StatusCode Ostap::SPlot::addWeights
+( RooDataSet&          data     ,
+  const std::string&   suffix   ,
+  const unsigned short nthreads )
+{
+  const RooArgSet* aset = data.get () ;
+  if ( nullptr == aset ) { return InvalidDataSet ; }
+  //
+  const unsigned int D = m_obsnames.size () ;
+  const unsigned int K = m_names   .size () ;
+  //
+  std::vector<const RooAbsReal*> obs ;
+  for ( const auto& o : m_obsnames )
+  {
+    const RooAbsReal* v = dynamic_cast<const RooAbsReal*> ( aset->find ( o.c_str () ) ) ;
+    if ( nullptr == v ) { return InvalidObservable ; }
+    obs.push_back ( v ) ;
+  }
+  //
+  // (1) read the observables and weights
+  const bool          weighted = data.isWeighted () ;
+  const unsigned long nentries = data.numEntries () ;
+  std::vector<double> x ; x.reserve ( nentries * D ) ;
+  std::vector<double> w ; if ( weighted ) { w.reserve ( nentries ) ; }
+  for ( unsigned long entry = 0 ; entry < nentries ; ++entry )
+  {
+    if ( nullptr == data.get ( entry ) ) { return InvalidDataSet ; }
+    for ( const RooAbsReal* v : obs ) { x.push_back ( v->getVal () ) ; }
+    if ( weighted ) { w.push_back ( data.weight () ) ; }
+  }
+  //
+  // (2) calculate sWeights
+  std::vector<double> sweights ;
+  Ostap::StatusCode sc = calculate ( x , w , sweights , nthreads ) ;
+  if ( sc.isFailure () ) { return sc ; }
+  //
+  // (3) add new variables
+  RooArgList vars ;
+  std::vector<std::unique_ptr<RooRealVar> > holders ;
+  for ( unsigned int k = 0 ; k < K ; ++k )
+  {
+    const std::string name = m_names [ k ] + suffix ;
+    holders.emplace_back ( new RooRealVar ( name.c_str () , name.c_str () , 0.0 ) ) ;
+    vars.add ( *holders.back () ) ;
+  }
+  RooArgSet  varset { vars } ;
+  RooDataSet tmp_ds ( "" , "" , varset ) ;
+  for ( unsigned long entry = 0 ; entry < nentries ; ++entry )
+  {
+    for ( unsigned int k = 0 ; k < K ; ++k )
+    { holders [ k ]->setVal ( sweights [ entry * K + k ] ) ; }
+    tmp_ds.add ( varset ) ;
+  }
+  data.merge ( &tmp_ds ) ;
+  //
+  return Ostap::StatusCode::SUCCESS ;
+}
+// ============================================================================
+//                                                                      The END
+// ============================================================================
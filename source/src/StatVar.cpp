@@ -14,8 +14,10 @@
 #include "Ostap/Formula.h"
 #include "Ostap/Iterator.h"
 #include "Ostap/Notifier.h"
+#include "Ostap/CutIndex.h"
 #include "Ostap/MatrixUtils.h"
 #include "Ostap/StatVar.h"
+#include "Ostap/DataSnapshot.h"
 // ============================================================================
 // ROOT
 // ============================================================================
@@ -27,6 +29,7 @@
 // ============================================================================
 #include "OstapDataFrame.h"
 #include "Exception.h"
+#include "local_tree.h"
 // ============================================================================
 /** @file
  *  Implementation file for class Ostap::StatVar
@@ -706,6 +709,111 @@ namespace
     return result ;
   }
   // ==========================================================================
+  /** the fast path for the primitive scalar branches:
+   *  read only the requested branches block-by-block and 
+   *  update the statistics with the block reductions 
+   *  @return number of processed entries 
+   */
+  unsigned long _stat_columns_ 
+  ( TTree*                                  tree   ,
+    std::vector<Ostap::StatVar::Statistic>& result ,
+    const std::vector<std::string>&         names  ,
+    const unsigned long                     first  ,
+    const unsigned long                     last   ) 
+  {
+    const unsigned long N = names.size() ;
+    result.resize ( N ) ;
+    //
+    const unsigned long nEntries =
+      std::min ( last , (unsigned long) tree->GetEntries() ) ;
+    //
+    // the column cache is built over the whole tree: use it only for the full range
+    const bool full = 0 == first && (unsigned long) tree->GetEntries() <= last ;
+    Columns columns ( tree , names , Columns::BlockSize , full ) ;
+    unsigned long entry = first ;
+    while ( entry < nEntries )
+    {
+      const unsigned long n = columns.read ( entry , nEntries ) ;
+      if ( 0 == n ) { break ; }                                   // BREAK 
+      for ( unsigned long i = 0 ; i < N ; ++i ) 
+      { result [ i ] += block_stat ( n , columns.column ( i ) ) ; }
+      entry += n ;
+    }
+    //
+    return first < entry ? entry - first : 0 ;
+  }
+  // ==========================================================================
+  /// all expressions are primitive scalar branches?
+  bool _primitive_ 
+  ( TTree*                          tree        , 
+    const std::vector<std::string>& expressions ) 
+  {
+    for ( const auto& e : expressions ) { if ( !primitive ( e ) ) { return false ; } }
+    return primitive_leaves ( tree , expressions ) ;
+  }
+  // ==========================================================================
+  /** loop over the entries that pass the selection criteria
+   *  and invoke <code>fun(w)</code> for each of them.
+   *  For the full range the cached cut-index is used (if enabled),
+   *  and the evaluation of cuts is skipped
+   *  @see Ostap::Trees::CutIndex
+   *  @param tree      (INPUT) the tree
+   *  @param selection (INPUT) the selection formula
+   *  @param cuts      (INPUT) the selection criteria
+   *  @param first     (INPUT) the first entry to process
+   *  @param last      (INPUT) the last entry to process (not including!)
+   *  @param fun       (INPUT) the action
+   *  @return true if all entries are processed
+   */
+  template <class FUNCTION>
+  bool _loop_
+  ( TTree*              tree      ,
+    Ostap::Formula&     selection ,
+    const std::string&  cuts      ,
+    const unsigned long first     ,
+    const unsigned long last      ,
+    FUNCTION            fun       )
+  {
+    const unsigned long nEntries =
+      std::min ( last , (unsigned long) tree->GetEntries() ) ;
+    //
+    // the full range: try to use the cached index
+    if ( 0 == first && (unsigned long) tree->GetEntries() <= last )
+    {
+      auto index = Ostap::Trees::CutIndex::get ( tree , cuts ) ;
+      if ( index )
+      {
+        for ( const auto& r : index->ranges () )
+        {
+          for ( unsigned long entry = r.first ; entry < r.second ; ++entry )
+          {
+            if ( 0 > tree->LoadTree ( entry ) ) { return false ; } // RETURN
+            fun ( 1.0 ) ;
+          }
+        }
+        return true ;                                             // RETURN
+      }
+    }
+    //
+    for ( unsigned long entry = first ; entry < nEntries ; ++entry )
+    {
+      //
+      long ievent = tree->GetEntryNumber ( entry ) ;
+      if ( 0 > ievent ) { return false ; }                        // RETURN
+      //
+      ievent      = tree->LoadTree ( ievent ) ;
+      if ( 0 > ievent ) { return false ; }                        // RETURN
+      //
+      const double w = selection.evaluate() ;
+      //
+      if  ( !w ) { continue ; }                                   // ATTENTION!
+      //
+      fun ( w ) ;
+    }
+    //
+    return true ;
+  }
+  // ==========================================================================
 } //                                                 end of anonymous namespace
 // ============================================================================
 /*  build statistic for the <code>expression</code>
@@ -730,6 +838,16 @@ Ostap::StatVar::statVar
 {
   Statistic result ;
   if ( 0 == tree || last <= first ) { return result ; }  // RETURN
+  //
+  // the fast path for primitive scalar branch 
+  const std::vector<std::string> names ( 1 , expression ) ;
+  if ( _primitive_ ( tree , names ) )
+  {
+    std::vector<Statistic> results ;
+    _stat_columns_ ( tree , results , names , first , last ) ;
+    return results [ 0 ] ;
+  }
+  //
   Ostap::Formula formula ( "" , expression , tree ) ;
   if ( !formula.GetNdim() )         { return result ; }  // RETURN
   //
@@ -789,27 +907,13 @@ Ostap::StatVar::statVar
   //
   Ostap::Utils::Notifier notify ( tree , &selection,  &formula ) ;
   //
-  const unsigned long nEntries =
-    std::min ( last , (unsigned long) tree->GetEntries() ) ;
-  //
   std::vector<double> results {} ;
-  for ( unsigned long entry = first ; entry < nEntries ; ++entry )
-  {
-    //
-    long ievent = tree->GetEntryNumber ( entry ) ;
-    if ( 0 > ievent ) { return result ; }                // RETURN
-    //
-    ievent      = tree->LoadTree ( ievent ) ;
-    if ( 0 > ievent ) { return result ; }                // RETURN
-    //
-    const double w = selection.evaluate() ;
-    //
-    if  ( !w ) { continue ; }                            // ATTENTION!
-    //
-    formula.evaluate ( results ) ;
-    for  ( const double r : results ) { result.add (  r , w ) ; }
-    //
-  }
+  _loop_ ( tree , selection , cuts , first , last ,
+           [&] ( const double w )
+           {
+             formula.evaluate ( results ) ;
+             for  ( const double r : results ) { result.add (  r , w ) ; }
+           } ) ;
   //
   return result ;
 }
@@ -867,6 +971,10 @@ unsigned long Ostap::StatVar::statVars
   if ( 0 == tree || last <= first ) { return 0 ; }  // RETURN
   if ( expressions.empty()        ) { return 0 ; }  // RETURN  
   //
+  // the fast path for primitive scalar branches 
+  if ( _primitive_ ( tree , expressions ) ) 
+  { return _stat_columns_ ( tree , result , expressions , first , last ) ; }
+  //
   typedef std::unique_ptr<Ostap::Formula> UOF ;
   std::vector<UOF> formulas ; formulas.reserve ( N ) ;
   //
@@ -955,28 +1063,16 @@ unsigned long Ostap::StatVar::statVars
   //
   Ostap::Utils::Notifier notify ( formulas.begin() , formulas.end() , &selection , tree ) ;
   //
-  const unsigned long nEntries =
-    std::min ( last , (unsigned long) tree->GetEntries() ) ;
-  //
   std::vector<double>  results {} ;
-  for ( unsigned long entry = first ; entry < nEntries ; ++entry )
-  {
-    //
-    long ievent = tree->GetEntryNumber ( entry ) ;
-    if ( 0 > ievent ) { return entry - first ; }                // RETURN
-    //
-    ievent      = tree->LoadTree ( ievent ) ;
-    if ( 0 > ievent ) { return entry - first ; }                // RETURN
-    //
-    const double w = selection.evaluate() ;
-    if ( !w ) { continue  ; }
-    //
-    for ( unsigned int i = 0 ; i < N ; ++i ) 
-    {
-      formulas[i]->evaluate ( results ) ;
-      for ( const double r : results ) { result[i].add ( r , w ) ; }
-    }
-  }
+  _loop_ ( tree , selection , cuts , first , last ,
+           [&] ( const double w )
+           {
+             for ( unsigned int i = 0 ; i < N ; ++i ) 
+             {
+               formulas[i]->evaluate ( results ) ;
+               for ( const double r : results ) { result[i].add ( r , w ) ; }
+             }
+           } ) ;
   //
   return results.empty() ? 0 : result[0].nEntries() ;
 }
@@ -1130,43 +1226,30 @@ Ostap::StatVar::statCov
   Ostap::Formula selection ( "" , cuts      , tree ) ;
   if ( !selection.ok () ) { return 0 ; }                        // RETURN
   //
-  Ostap::Utils::Notifier notify ( tree , &formula1 , &formula2 ) ;
-  //
-  const unsigned long nEntries =
-    std::min ( last , (unsigned long) tree->GetEntries() ) ;
+  Ostap::Utils::Notifier notify ( tree , &formula1 , &formula2 , &selection ) ;
   //
   std::vector<double> results1 {} ;
   std::vector<double> results2 {} ;
-  for ( unsigned long entry = first ; entry < nEntries ; ++entry )
-  {
-    //
-    long ievent = tree->GetEntryNumber ( entry ) ;
-    if ( 0 > ievent ) { break ; }                              // RETURN
-    //
-    ievent      = tree->LoadTree ( ievent ) ;
-    if ( 0 > ievent ) { break ; }                              // RETURN
-    //
-    const double w = selection.evaluate() ;
-    //
-    if ( !w ) { continue ; }                                   // ATTENTION
-    //
-    formula1.evaluate ( results1 ) ;
-    formula2.evaluate ( results2 ) ;
-    //
-    for ( const long double v1 : results1 ) 
-    { 
-      for ( const long double v2 : results2 ) 
-      {
-        //
-        stat1.add ( v1 , w ) ;
-        stat2.add ( v2 , w ) ;
-        //
-        cov2 ( 0 , 0 ) += w*v1*v1 ;
-        cov2 ( 0 , 1 ) += w*v1*v2 ;
-        cov2 ( 1 , 1 ) += w*v2*v2 ;
-      }
-    }
-  }
+  _loop_ ( tree , selection , cuts , first , last ,
+           [&] ( const double w )
+           {
+             formula1.evaluate ( results1 ) ;
+             formula2.evaluate ( results2 ) ;
+             //
+             for ( const long double v1 : results1 ) 
+             { 
+               for ( const long double v2 : results2 ) 
+               {
+                 //
+                 stat1.add ( v1 , w ) ;
+                 stat2.add ( v2 , w ) ;
+                 //
+                 cov2 ( 0 , 0 ) += w*v1*v1 ;
+                 cov2 ( 0 , 1 ) += w*v1*v2 ;
+                 cov2 ( 1 , 1 ) += w*v2*v2 ;
+               }
+             }
+           } ) ;
   //
   if ( 0 == stat1.nEntries() || 0 == stat1.nEff () ) { return 0 ; }
   //
@@ -3146,5 +3229,174 @@ Ostap::StatVar::interval
   return std::make_pair( result[0] , result[1] ) ;
 }
 // ============================================================================
+// Fast scans over the columnar snapshot 
+// ============================================================================
+/*  build statistic for the <code>expression</code>
+ *  @param data       (INPUT) the columnar snapshot of data 
+ *  @param expression (INPUT) the expression
+ *  @param cuts       (INPUT) the selection/weight 
+ *  @see Ostap::DataSnapshot
+ */
+// ============================================================================
+Ostap::StatVar::Statistic
+Ostap::StatVar::statVar 
+( Ostap::DataSnapshot& data       , 
+  const std::string&   expression , 
+  const std::string&   cuts       ) 
+{
+  Statistic result ;
+  if ( data.empty() ) { return result ; }                         // RETURN
+  //
+  Ostap::DataSnapshot::Column _w ;
+  const double* v = data.column  ( expression ) . data () ;
+  const double* w = data.weights ( cuts , _w  ) . data () ;
+  //
+  const unsigned long N = data.size() ;
+  for ( unsigned long i = 0 ; i < N ; ++i ) 
+  { if ( w [ i ] ) { result.add ( v [ i ] , w [ i ] ) ; } }
+  //
+  return result ;
+}
+// ============================================================================
+/*  calculate the covariance of two expressions 
+ *  @param data  (INPUT)  the columnar snapshot of data 
+ *  @param exp1  (INPUT)  the first  expresiion
+ *  @param exp2  (INPUT)  the second expresiion
+ *  @param cuts  (INPUT)  the selection/weight 
+ *  @param stat1 (UPDATE) the statistic for the first  expression
+ *  @param stat2 (UPDATE) the statistic for the second expression
+ *  @param cov2  (UPDATE) the covariance matrix 
+ *  @return number of processed events 
+ *  @see Ostap::DataSnapshot
+ */
+// ============================================================================
+unsigned long Ostap::StatVar::statCov
+( Ostap::DataSnapshot&       data  , 
+  const std::string&         exp1  , 
+  const std::string&         exp2  , 
+  const std::string&         cuts  , 
+  Ostap::StatVar::Statistic& stat1 ,  
+  Ostap::StatVar::Statistic& stat2 ,  
+  Ostap::SymMatrix2x2&       cov2  ) 
+{
+  //
+  stat1.reset () ;
+  stat2.reset () ;
+  Ostap::Math::setToScalar ( cov2 , 0.0 ) ;
+  //
+  if ( data.empty() ) { return 0 ; }                              // RETURN
+  //
+  Ostap::DataSnapshot::Column _w ;
+  const double* v1 = data.column  ( exp1 ) . data () ;
+  const double* v2 = data.column  ( exp2 ) . data () ;
+  const double* w  = data.weights ( cuts , _w ) . data () ;
+  //
+  long double c00 = 0 ;
+  long double c01 = 0 ;
+  long double c11 = 0 ;
+  //
+  const unsigned long N = data.size() ;
+  for ( unsigned long i = 0 ; i < N ; ++i ) 
+  {
+    const double wi = w [ i ] ;
+    if ( !wi ) { continue ; }                                     // CONTINUE 
+    //
+    stat1.add ( v1 [ i ] , wi ) ;
+    stat2.add ( v2 [ i ] , wi ) ;
+    //
+    c00 += wi * v1 [ i ] * v1 [ i ] ;
+    c01 += wi * v1 [ i ] * v2 [ i ] ;
+    c11 += wi * v2 [ i ] * v2 [ i ] ;
+  }
+  //
+  if ( 0 == stat1.nEntries() || 0 == stat1.nEff () ) { return 0 ; }
+  //
+  cov2 ( 0 , 0 ) = c00 ;
+  cov2 ( 0 , 1 ) = c01 ;
+  cov2 ( 1 , 1 ) = c11 ;
+  //
+  cov2 /= stat1.weights().sum()  ;
+  //
+  const double v1_mean = stat1.mean() ;
+  const double v2_mean = stat2.mean() ;
+  //
+  cov2 ( 0 , 0 ) -= v1_mean * v1_mean ;
+  cov2 ( 0 , 1 ) -= v1_mean * v2_mean ;
+  cov2 ( 1 , 1 ) -= v2_mean * v2_mean ;
+  //
+  return stat1.nEntries() ;
+}
+// ============================================================================
+/*  get the number of equivalent entries 
+ *  \f$ n_{eff} \equiv = \frac{ (\sum w)^2}{ \sum w^2} \f$
+ *  @param data  (INPUT) the columnar snapshot of data 
+ *  @param cuts  (INPUT) the selection/weight 
+ *  @return number of equivalent entries 
+ *  @see Ostap::DataSnapshot
+ */
+// ============================================================================
+double Ostap::StatVar::nEff 
+( Ostap::DataSnapshot& data , 
+  const std::string&   cuts ) 
+{
+  if ( data.empty() ) { return 0 ; }                              // RETURN 
+  //
+  // the simplest case: use precalculated sums 
+  if ( cuts.empty() ) 
+  { return 0 < data.sumw2 () ? data.sumw () * data.sumw () / data.sumw2 () : 0.0 ; }
+  //
+  Ostap::DataSnapshot::Column _w ;
+  const double* w = data.weights ( cuts , _w ) . data () ;
+  //
+  long double sumw  = 0 ;
+  long double sumw2 = 0 ;
+  const unsigned long N = data.size() ;
+  for ( unsigned long i = 0 ; i < N ; ++i ) 
+  {
+    sumw  += w [ i ]           ;
+    sumw2 += w [ i ] * w [ i ] ;
+  }
+  //
+  return 0 < sumw2 ? sumw * sumw / sumw2 : 0.0 ;
+}
+// ============================================================================
+/*  calculate the moment of order "order" relative to the center "center"
+ *  @param  data   (INPUT) the columnar snapshot of data 
+ *  @param  order  (INPUT) the order 
+ *  @param  expr   (INPUT) the expression
+ *  @param  center (INPUT) the center 
+ *  @param  cuts   (INPUT) the selection/weight 
+ *  @return the moment 
+ *  @see Ostap::DataSnapshot
+ */
+// ============================================================================
+double Ostap::StatVar::get_moment 
+( Ostap::DataSnapshot& data   ,  
+  const unsigned short order  , 
+  const std::string&   expr   , 
+  const double         center ,
+  const std::string&   cuts   ) 
+{
+  if ( 0 == order   ) { return 1 ; }                              // RETURN 
+  if ( data.empty() ) { return 0 ; }                              // RETURN
+  //
+  Ostap::DataSnapshot::Column _w ;
+  const double* v = data.column  ( expr ) . data () ;
+  const double* w = data.weights ( cuts , _w ) . data () ;
+  //
+  long double mom  = 0 ;
+  long double sumw = 0 ;
+  const unsigned long N = data.size() ;
+  for ( unsigned long i = 0 ; i < N ; ++i ) 
+  {
+    const double wi = w [ i ] ;
+    if ( !wi ) { continue ; }                                     // CONTINUE
+    mom  += wi * std::pow ( v [ i ] - center , order ) ;
+    sumw += wi ;
+  }
+  //
+  return sumw ? mom / sumw : 0.0 ;
+}
+// ============================================================================
 // The END
 // ============================================================================
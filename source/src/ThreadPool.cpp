@@ -0,0 +1,392 @@
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <deque>
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <condition_variable>
+// ============================================================================
+// POSIX
+// ============================================================================
+#include <pthread.h>
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/ThreadPool.h"
+// ============================================================================
+/** @file
+ *  Implementation file for classes Ostap::Utils::ThreadPool
+ *  and Ostap::Utils::TaskGroup
+ *  @see Ostap::Utils::ThreadPool
+ *  @see Ostap::Utils::TaskGroup
+ *  @author agent agent@local
+ *  @date   2026-10-19
+ */
+// ============================================================================
+/** @class Ostap::Utils::ThreadPool::Impl
+ *  The actual implementation of the work-stealing pool:
+ *  one queue per worker and one more queue for the external threads
+ */
+// ============================================================================
+class Ostap::Utils::ThreadPool::Impl
+{
+public:
+  // ==========================================================================
+  /// constructor with number of workers
+  Impl ( const unsigned int nworkers ) ;
+  /// destructor: stop & join all workers
+  ~Impl () ;
+  // ==========================================================================
+public:
+  // ==========================================================================
+  /// submit the task for the execution
+  void         submit  ( Task task ) ;
+  /// execute one pending task (if any)
+  bool         run_one () { return run_one ( self () ) ; }
+  /// execute the pending tasks until <code>done()</code>
+  void         wait    ( const std::function<bool()>& done ) ;
+  /// wake up the threads waiting in <code>wait</code>
+  void         notify  () ;
+  /// number of worker threads
+  unsigned int size    () const { return m_workers.size () ; }
+  // ==========================================================================
+private:
+  // ==========================================================================
+  /// the queue of tasks
+  struct Queue
+  {
+    std::mutex       mutex {} ;
+    std::deque<Task> tasks {} ;
+  } ;
+  // ==========================================================================
+private:
+  // ==========================================================================
+  /// the queue index for the current thread
+  std::size_t self    () const ;
+  /// execute one pending task for the given queue
+  bool        run_one ( const std::size_t index ) ;
+  /// the worker loop
+  void        loop    ( const std::size_t index ) ;
+  // ==========================================================================
+private:
+  // ==========================================================================
+  /// the queues: one per worker and the last one for the external threads
+  std::vector<std::unique_ptr<Queue> > m_queues  {}        ;
+  /// the workers
+  std::vector<std::thread>             m_workers {}        ;
+  /// number of pending tasks
+  std::atomic<std::size_t>             m_pending { 0     } ;
+  /// the stop flag
+  std::atomic<bool>                    m_stop    { false } ;
+  /// the mutex & condition to wait for the tasks
+  std::mutex                           m_mutex   {}        ;
+  std::condition_variable              m_cv      {}        ;
+  // ==========================================================================
+} ;
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  /// the pool the current thread works for
+  thread_local const Ostap::Utils::ThreadPool::Impl* t_pool  = nullptr ;
+  /// the queue index of the current worker thread
+  thread_local std::size_t                           t_index = 0       ;
+  // ==========================================================================
+  /// the process-wide pool
+  std::unique_ptr<Ostap::Utils::ThreadPool> s_pool        {}  ;
+  /// the mutex for the process-wide pool
+  std::mutex                                s_pool_mutex  {}  ;
+  /// the configured concurrency (0: all cores)
+  std::atomic<unsigned int>                 s_concurrency { 0 } ;
+  // ==========================================================================
+  /** the fork handlers: the pool mutex is held across <code>fork</code>,
+   *  and the child process drops the pool without joining the workers
+   *  (they do not exist in the child), the new pool is created lazily
+   */
+  void _prepare_fork_ () { s_pool_mutex.lock   () ; }
+  void _parent_fork_  () { s_pool_mutex.unlock () ; }
+  void _child_fork_   ()
+  {
+    s_pool.release () ; // NB: leak, the worker threads can't be joined
+    s_pool_mutex.unlock () ;
+  }
+  /// register the fork handlers only once
+  std::once_flag                            s_atfork      {}  ;
+  // ==========================================================================
+} //                                                 end of anonymous namespace
+// ============================================================================
+// constructor with number of workers
+// ============================================================================
+Ostap::Utils::ThreadPool::Impl::Impl ( const unsigned int nworkers )
+{
+  for ( unsigned int i = 0 ; i <= nworkers ; ++i )
+  { m_queues.emplace_back ( new Queue () ) ; }
+  m_workers.reserve ( nworkers ) ;
+  for ( unsigned int i = 0 ; i < nworkers ; ++i )
+  { m_workers.emplace_back ( &Impl::loop , this , i ) ; }
+}
+// ============================================================================
+// destructor: stop & join all workers
+// ============================================================================
+Ostap::Utils::ThreadPool::Impl::~Impl ()
+{
+  {
+    std::lock_guard<std::mutex> lock { m_mutex } ;
+    m_stop = true ;
+  }
+  m_cv.notify_all () ;
+  for ( std::thread& t : m_workers ) { t.join () ; }
+}
+// ============================================================================
+// the queue index for the current thread
+// ============================================================================
+std::size_t Ostap::Utils::ThreadPool::Impl::self () const
+{ return this == t_pool ? t_index : m_workers.size () ; }
+// ============================================================================
+// submit the task for the execution
+// ============================================================================
+void Ostap::Utils::ThreadPool::Impl::submit ( Task task )
+{
+  Queue& q = *m_queues [ self () ] ;
+  ++m_pending ;
+  {
+    std::lock_guard<std::mutex> lock { q.mutex } ;
+    q.tasks.push_back ( std::move ( task ) ) ;
+  }
+  // take the mutex to avoid the lost wake-up
+  { std::lock_guard<std::mutex> lock { m_mutex } ; }
+  m_cv.notify_one () ;
+}
+// ============================================================================
+// execute one pending task for the given queue:
+// the newest task from the own queue or the oldest task from other queues
+// ============================================================================
+bool Ostap::Utils::ThreadPool::Impl::run_one ( const std::size_t index )
+{
+  if ( 0 == m_pending ) { return false ; }                           // RETURN
+  //
+  const std::size_t N = m_queues.size () ;
+  for ( std::size_t k = 0 ; k < N ; ++k )
+  {
+    const std::size_t i = ( index + k ) % N ;
+    Queue& q = *m_queues [ i ] ;
+    Task task {} ;
+    {
+      std::lock_guard<std::mutex> lock { q.mutex } ;
+      if ( q.tasks.empty () ) { continue ; }                         // CONTINUE
+      if ( 0 == k ) { task = std::move ( q.tasks.back  () ) ; q.tasks.pop_back  () ; }
+      else          { task = std::move ( q.tasks.front () ) ; q.tasks.pop_front () ; }
+    }
+    --m_pending ;
+    // the exceptions must be treated by the task itself
+    try           { task () ; }
+    catch ( ... ) {}
+    return true ;                                                     // RETURN
+  }
+  return false ;
+}
+// ============================================================================
+// execute the pending tasks until done() 
+// and sleep when there is nothing to execute 
+// ============================================================================
+void Ostap::Utils::ThreadPool::Impl::wait ( const std::function<bool()>& done )
+{
+  const std::size_t index = self () ;
+  while ( !done () )
+  {
+    if ( run_one ( index ) ) { continue ; }                          // CONTINUE
+    std::unique_lock<std::mutex> lock { m_mutex } ;
+    m_cv.wait ( lock , [this,&done] { return 0 < m_pending || done () ; } ) ;
+  }
+}
+// ============================================================================
+// wake up the threads waiting in wait
+// ============================================================================
+void Ostap::Utils::ThreadPool::Impl::notify ()
+{
+  // take the mutex to avoid the lost wake-up
+  { std::lock_guard<std::mutex> lock { m_mutex } ; }
+  m_cv.notify_all () ;
+}
+// ============================================================================
+// the worker loop
+// ============================================================================
+void Ostap::Utils::ThreadPool::Impl::loop ( const std::size_t index )
+{
+  t_pool  = this  ;
+  t_index = index ;
+  for ( ;; )
+  {
+    if ( run_one ( index ) ) { continue ; }                          // CONTINUE
+    std::unique_lock<std::mutex> lock { m_mutex } ;
+    m_cv.wait ( lock , [this] { return m_stop || 0 < m_pending ; } ) ;
+    if ( m_stop && 0 == m_pending ) { break ; }                      // BREAK
+  }
+  t_pool = nullptr ;
+}
+// ============================================================================
+// constructor with number of workers
+// ============================================================================
+Ostap::Utils::ThreadPool::ThreadPool ( const unsigned int nworkers )
+  : m_impl ( new Impl ( nworkers ) )
+{}
+// ============================================================================
+// destructor: stop & join all workers
+// ============================================================================
+Ostap::Utils::ThreadPool::~ThreadPool () {}
+// ============================================================================
+// get the process-wide pool
+// ============================================================================
+Ostap::Utils::ThreadPool& Ostap::Utils::ThreadPool::instance ()
+{
+  std::call_once ( s_atfork , [] ()
+                   { pthread_atfork ( &_prepare_fork_ , &_parent_fork_ , &_child_fork_ ) ; } ) ;
+  std::lock_guard<std::mutex> lock { s_pool_mutex } ;
+  if ( !s_pool ) { s_pool.reset ( new ThreadPool ( concurrency () - 1 ) ) ; }
+  return *s_pool ;
+}
+// ============================================================================
+// the number of threads (including the calling one) to be used
+// ============================================================================
+unsigned int Ostap::Utils::ThreadPool::concurrency ()
+{
+  const unsigned int n = s_concurrency ;
+  if ( 0 < n ) { return n ; }
+  return std::max ( 1u , std::thread::hardware_concurrency () ) ;
+}
+// ============================================================================
+/*  set the number of threads (including the calling one) to be used
+ *  @param n number of threads, 0 means "all available cores"
+ *  @attention the workers are restarted: no tasks must be running
+ */
+// ============================================================================
+void Ostap::Utils::ThreadPool::setConcurrency ( const unsigned int n )
+{
+  std::lock_guard<std::mutex> lock { s_pool_mutex } ;
+  s_concurrency = n ;
+  s_pool.reset () ;
+}
+// ============================================================================
+// submit the task for the execution
+// ============================================================================
+void Ostap::Utils::ThreadPool::submit ( Ostap::Utils::ThreadPool::Task task )
+{ m_impl->submit ( std::move ( task ) ) ; }
+// ============================================================================
+// execute one pending task (if any)
+// ============================================================================
+bool Ostap::Utils::ThreadPool::run_one () { return m_impl->run_one () ; }
+// ============================================================================
+// execute the pending tasks until done()
+// ============================================================================
+void Ostap::Utils::ThreadPool::wait ( const std::function<bool()>& done )
+{ m_impl->wait ( done ) ; }
+// ============================================================================
+// wake up the threads waiting in wait
+// ============================================================================
+void Ostap::Utils::ThreadPool::notify () { m_impl->notify () ; }
+// ============================================================================
+// number of worker threads
+// ============================================================================
+unsigned int Ostap::Utils::ThreadPool::size () const { return m_impl->size () ; }
+// ============================================================================
+// constructor
+// ============================================================================
+Ostap::Utils::TaskGroup::TaskGroup () {}
+// ============================================================================
+// destructor: cancel and wait for the running tasks
+// ============================================================================
+Ostap::Utils::TaskGroup::~TaskGroup ()
+{
+  if ( 0 == m_pending ) { return ; }
+  cancel () ;
+  try           { wait () ; }
+  catch ( ... ) {}
+}
+// ============================================================================
+// run the task in the group
+// ============================================================================
+void Ostap::Utils::TaskGroup::run ( Ostap::Utils::TaskGroup::Task task )
+{
+  ++m_pending ;
+  ThreadPool& pool = ThreadPool::instance () ;
+  pool.submit
+    ( [this,task,&pool] ()
+      {
+        if ( !m_cancelled )
+        {
+          try { task () ; }
+          catch ( ... )
+          {
+            std::lock_guard<std::mutex> lock { m_mutex } ;
+            if ( !m_error ) { m_error = std::current_exception () ; }
+            m_cancelled = true ;
+          }
+        }
+        // the group can be destroyed right after this line
+        if ( 1 == m_pending-- ) { pool.notify () ; }
+      } ) ;
+}
+// ============================================================================
+/*  process the range <code>[first,last)</code> by the chunks
+ *  <code>[begin,end)</code> of <code>grain</code> items
+ *  @param first   begin of the range
+ *  @param last    end   of the range
+ *  @param grain   the chunk size (0: automatic)
+ *  @param range   the task
+ */
+// ============================================================================
+void Ostap::Utils::TaskGroup::parallel_for
+( const std::size_t                first ,
+  const std::size_t                last  ,
+  const std::size_t                grain ,
+  Ostap::Utils::TaskGroup::Range   range )
+{
+  if ( last <= first ) { return ; }                                   // RETURN
+  //
+  const std::size_t N     = last - first ;
+  const std::size_t nt    = ThreadPool::concurrency () ;
+  const std::size_t chunk = 0 < grain ? grain : std::max ( std::size_t ( 1 ) , N / ( 8 * nt ) ) ;
+  const std::size_t nrun  = std::min ( nt , ( N + chunk - 1 ) / chunk ) ;
+  //
+  // the runners take the chunks from the common counter
+  std::shared_ptr<std::atomic<std::size_t> > next =
+    std::make_shared<std::atomic<std::size_t> > ( 0 ) ;
+  for ( std::size_t i = 0 ; i < nrun ; ++i )
+  {
+    run ( [this,next,first,N,chunk,range] ()
+          {
+            while ( !m_cancelled )
+            {
+              const std::size_t b = next->fetch_add ( chunk ) ;
+              if ( N <= b ) { break ; }                               // BREAK
+              range ( first + b , first + std::min ( b + chunk , N ) ) ;
+            }
+          } ) ;
+  }
+}
+// ============================================================================
+/*  wait for all tasks of the group
+ *  (the waiting thread executes the pending tasks),
+ *  reset the cancellation flag 
+ *  and re-throw the first exception from the tasks
+ */
+// ============================================================================
+void Ostap::Utils::TaskGroup::wait ()
+{
+  ThreadPool::instance ().wait ( [this] () { return 0 == m_pending ; } ) ;
+  //
+  // all tasks are drained: the group can be reused 
+  std::exception_ptr error {} ;
+  {
+    std::lock_guard<std::mutex> lock { m_mutex } ;
+    std::swap ( error , m_error ) ;
+    m_cancelled = false ;
+  }
+  if ( error ) { std::rethrow_exception ( error ) ; }
+}
+// ============================================================================
+//                                                                      The END
+// ============================================================================
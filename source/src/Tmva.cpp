@@ -6,6 +6,7 @@
 #include <cmath>
 #include <climits>
 #include <tuple>
+#include <memory>
 // ============================================================================
 // Ostap
 // ============================================================================
@@ -14,6 +15,7 @@
 #include "Ostap/Iterator.h"
 #include "Ostap/Formula.h"
 #include "Ostap/Notifier.h"
+#include "Ostap/AddVars.h"
 // ============================================================================
 // TMVA
 // ============================================================================
@@ -32,6 +34,10 @@
 #include "RooArgList.h"
 #include "RooDataSet.h"
 // ============================================================================
+// Local
+// ============================================================================
+#include "local_parallel.h"
+// ============================================================================
 namespace
 {
   // ===========================================================================
@@ -44,6 +50,107 @@ namespace
   static_assert ( s_max > 0 , "std::numeric_limits<float>::max is too small" );
   static_assert ( s_min < 0 , "std::numeric_limits<float>::max is too small" );
   // ==========================================================================
+  /** @var s_CHUNK
+   *  number of entries to be collected for one block of TMVA evaluations
+   */
+  const unsigned long s_CHUNK = 10000 ;
+  // ==========================================================================
+  /// actual type for the reader
+  typedef TMVA::Reader           TMVAReader ;
+  // ==========================================================================
+  /** @class EVALUATOR
+   *  The actual TMVA evaluator: TMVA reader with its own placeholders
+   *  for input variables. Each thread needs its own evaluator.
+   */
+  class EVALUATOR
+  {
+    // ========================================================================
+  public:
+    // ========================================================================
+    EVALUATOR ( const std::vector<std::string>& names        ,
+                const Ostap::TMVA::MAP&         weight_files )
+      : m_names        ( names        )
+      , m_weight_files ( weight_files )
+      , m_vars         ( names.size() , 0.0f )
+    {}
+    // ========================================================================
+    /// create the reader and book all methods
+    Ostap::StatusCode build ( const std::string& options = "" )
+    {
+      // 1) create the actual reader
+      m_reader = std::make_unique<TMVAReader>( options ) ;
+      //
+      // 2) connect the reader with names&placeholders
+      for ( unsigned short i = 0 ; i < m_names.size() ; ++i )
+      { m_reader->AddVariable ( m_names[i] , &m_vars[i] ) ; }
+      //
+      // 3) book   TMVA methods
+      for ( const auto& p : m_weight_files )
+      {
+        auto m = m_reader->BookMVA   ( p.first , p.second ) ;
+        if  ( nullptr == m ) { return Ostap::TMVA::InvalidBookTMVA ; }
+        m_methods.push_back ( p.first ) ;
+      }
+      //
+      return Ostap::StatusCode::SUCCESS ;
+    }
+    // ========================================================================
+    /** evaluate all methods for one entry
+     *  @param inputs  (INPUT)  the input variables
+     *  @param results (OUTPUT) responses of all methods
+     *  @param aux     (INPUT)  efficiency cut-off for the cuts method
+     */
+    inline void evaluate
+    ( const float* inputs  ,
+      double*      results ,
+      const double aux     )
+    {
+      std::copy ( inputs , inputs + m_vars.size() , m_vars.begin() ) ;
+      for ( const auto& m : m_methods )
+      { *results++ = m_reader->EvaluateMVA ( m , aux ) ; } // EVALUATE TMVA!
+    }
+    // ========================================================================
+  public:
+    // ========================================================================
+    const std::vector<std::string>& methods () const { return m_methods      ; }
+    TMVAReader*                     reader  () const { return m_reader.get() ; }
+    // ========================================================================
+  private:
+    // ========================================================================
+    std::vector<std::string>    m_names        {}          ;
+    Ostap::TMVA::MAP            m_weight_files {}          ;
+    std::vector<float>          m_vars         {}          ;
+    std::vector<std::string>    m_methods      {}          ;
+    std::unique_ptr<TMVAReader> m_reader       { nullptr } ;
+    // ========================================================================
+  } ;
+  // ==========================================================================
+  /** @typedef EVALUATORS
+   *  evaluators: one per thread
+   */
+  typedef std::vector<std::unique_ptr<EVALUATOR> > EVALUATORS ;
+  // ==========================================================================
+  /// create&book the evaluators: one per thread
+  inline Ostap::StatusCode make_evaluators
+  ( EVALUATORS&                     evaluators   ,
+    const std::vector<std::string>& names        ,
+    const Ostap::TMVA::MAP&         weight_files ,
+    const std::string&              options      ,
+    const unsigned int              nthreads     )
+  {
+    const unsigned int n = n_threads ( nthreads , s_CHUNK ) ;
+    evaluators.clear () ;
+    for ( unsigned int i = 0 ; i < n ; ++i )
+    {
+      auto e = std::make_unique<EVALUATOR> ( names , weight_files ) ;
+      // TMVA booking is not thread-safe: book all readers here
+      Ostap::StatusCode sc = e->build ( 0 == i ? options : "Silent" ) ;
+      if ( sc.isFailure() ) { return sc ; }
+      evaluators.push_back ( std::move ( e ) ) ;
+    }
+    return Ostap::StatusCode::SUCCESS ;
+  }
+  // ==========================================================================
   /** @typedef VARIABLE 
    *  helper structure to keep "variable":  name, accessor and placeholder
    */
@@ -54,9 +161,6 @@ namespace
    */
   typedef std::vector<VARIABLE>  VARIABLES  ;
   // ==========================================================================
-  /// actual type for the reader 
-  typedef TMVA::Reader           TMVAReader ;
-  // ==========================================================================
   class READER 
   {
     // ========================================================================
@@ -65,12 +169,14 @@ namespace
     READER ( RooDataSet& data                     ,
              const Ostap::TMVA::MAP& inputs       , 
              const Ostap::TMVA::MAP& weight_files )
-      : m_data         ( &data        ) 
-      , m_inputs       ( inputs       )
+      : m_inputs       ( inputs       )
       , m_weight_files ( weight_files )
+      , m_data         ( &data        )
     {}
     // prepare it  for usage 
-    Ostap::StatusCode build ( const std::string& options = "" ) 
+    Ostap::StatusCode build
+    ( const std::string& options  = "" ,
+      const unsigned int nthreads = 1  )
     {
       //
       RooArgList       varlst ;
@@ -81,6 +187,7 @@ namespace
       while ( RooAbsArg* coef = iter.static_next<RooAbsArg>() ) { varlst.add ( *coef ); }
       //
       // 1)  create variables 
+      std::vector<std::string> names ;
       for ( const auto& i : m_inputs ) 
       {
         const std::string& name   = i.first  ;
@@ -101,33 +208,18 @@ namespace
         if ( nullptr == var ) { return Ostap::TMVA::InvalidVariable ; }
         //
         m_variables.push_back ( std::make_tuple ( name , var , 0.0f ) ) ;  
+        names      .push_back ( name ) ;
       }
       //
-      // 2) create the actual reader 
-      m_reader = std::make_unique<TMVAReader>( options ) ;
-      //
-      //
-      // 3) connect the reader with names&placeholders
-      for ( auto& v : m_variables ) 
-      { 
-        m_reader->AddVariable ( std::get<0> ( v ) , &std::get<2>( v ) ) ;
-      }
-      //
-      // 4) book   TMVA methods 
-      for ( const auto& p : m_weight_files ) 
-      { 
-        auto m = m_reader->BookMVA   ( p.first , p.second ) ; 
-        if  ( nullptr == m ) { return Ostap::TMVA::InvalidBookTMVA ; }
-        m_methods.push_back ( p.first ) ;
-      }
-      //
-      return Ostap::StatusCode::SUCCESS ;
+      // 2) create the actual readers (one per thread) and book TMVA methods
+      return make_evaluators ( m_evaluators , names , m_weight_files , options , nthreads ) ;
     }
     // 
   public:
     // ========================================================================
-    const std::vector<std::string> methods      () const { return m_methods      ; }
-    TMVAReader*                    reader       () const { return m_reader.get() ; }
+    const std::vector<std::string>& methods () const
+    { return m_evaluators.front()->methods () ; }
+    EVALUATORS&                    evaluators   ()       { return m_evaluators   ; }
     const Ostap::TMVA::MAP&        inputs       () const { return m_inputs       ; }
     const Ostap::TMVA::MAP&        weight_files () const { return m_weight_files ; }
     VARIABLES&                     variables    ()       { return m_variables    ; }
@@ -136,7 +228,6 @@ namespace
     // ========================================================================     
     Ostap::TMVA::MAP         m_inputs                   ;
     Ostap::TMVA::MAP         m_weight_files             ;
-    std::vector<std::string> m_methods      {}          ;
     const RooAbsData*        m_data         { nullptr } ;
     // ========================================================================    
   private: // cache 
@@ -145,8 +236,8 @@ namespace
     // ========================================================================
   private:  
     // ========================================================================    
-    VARIABLES                   m_variables  {}           ;
-    std::unique_ptr<TMVAReader> m_reader     { nullptr }  ;
+    VARIABLES                m_variables  {} ;
+    EVALUATORS               m_evaluators {} ;
     // ========================================================================
   } ;  
   // ==========================================================================
@@ -161,40 +252,51 @@ namespace
     const unsigned long long nEntries = data.numEntries() ;
     if  ( 0 == nEntries || reader.methods().empty() ) { return Ostap::StatusCode::SUCCESS ; }
     //
-    RooArgSet tmva_vars;
-    std::map<std::string , std::unique_ptr<RooRealVar> > varmap ;
-    for ( const auto& m : reader.methods() )
+    const std::vector<std::string>& methods = reader.methods() ;
+    const unsigned long nmethods = methods .size () ;
+    const unsigned long nvars    = reader.variables().size() ;
+    //
+    RooArgList tmva_vars ;
+    std::vector<std::unique_ptr<RooRealVar> > vars ;
+    for ( const auto& m : methods )
     {
       const std::string vname = prefix + m + suffix ;
       const std::string vdesc = "Response of TMVA/" + m + " method" ;
-      auto v = std::make_unique<RooRealVar> ( vname.c_str() , vdesc.c_str() , 0 , s_min  , s_max ) ;
-      varmap [ m ] = std::move ( v ) ;
-      tmva_vars.add( *varmap[m] ) ;
+      vars.push_back ( std::make_unique<RooRealVar> ( vname.c_str() , vdesc.c_str() , 0 , s_min  , s_max ) ) ;
+      tmva_vars.add  ( *vars.back() ) ;
     }
     //
-    auto tmva_ds = std::make_unique<RooDataSet>( "",  "" , tmva_vars ) ;
+    std::vector<float>  inputs  ( s_CHUNK  * nvars    , 0.0f ) ;
+    std::vector<double> results ( nEntries * nmethods , 0.0  ) ;
+    //
+    EVALUATORS& evaluators = reader.evaluators () ;
     //
-    for ( unsigned long long entry = 0 ; entry < nEntries ; ++entry ) 
+    for ( unsigned long long first = 0 ; first < nEntries ; first += s_CHUNK )
     {
-      if ( 0 == data.get( entry ) ) { return Ostap::TMVA::InvalidEntry ; }
+      const unsigned long long last = std::min ( first + s_CHUNK , nEntries ) ;
       //
-      for ( auto& e : reader.variables() ) 
-      { std::get<2>(e) = std::get<1> ( e )->getVal() ; }
-      // 
-      // call TMVA here ... 
-      for ( auto& e : varmap ) 
+      // (1) collect the input variables for the block of entries (serial)
+      for ( unsigned long long entry = first ; entry < last ; ++entry )
       {
-        const double r = 
-          reader.reader()->EvaluateMVA ( e.first.c_str () , aux ) ; // EVALUATE TMVA! 
-        e.second->setVal ( r )  ;                                         // ATTENTION HERE! 
+        if ( 0 == data.get( entry ) ) { return Ostap::TMVA::InvalidEntry ; }
+        float* row = &inputs [ ( entry - first ) * nvars ] ;
+        for ( auto& e : reader.variables() ) { *row++ = std::get<1> ( e )->getVal() ; }
       }
       //
-      tmva_ds->add ( tmva_vars ) ;
+      // (2) evaluate TMVA for the block of entries (parallel)
+      parallel_for
+        ( evaluators.size() , first , last ,
+          [&] ( const unsigned int thread , const std::size_t begin , const std::size_t end )
+          {
+            EVALUATOR& ev = *evaluators [ thread ] ;
+            for ( std::size_t entry = begin ; entry < end ; ++entry )
+            { ev.evaluate ( &inputs  [ ( entry - first ) * nvars ] ,
+                            &results [   entry           * nmethods ] , aux ) ; }
+          } ) ;
     }
     //
-    if ( 0 < tmva_ds->numEntries() ) { data.merge ( tmva_ds.get () ) ; }
-    //
-    return Ostap::StatusCode::SUCCESS ;
+    // (3) write the columns
+    return Ostap::Functions::add_columns ( data , tmva_vars , results ) ;
   }
   // ==========================================================================
   // Chopping 
@@ -214,52 +316,66 @@ namespace
     const unsigned long long nEntries = data.numEntries() ;
     if  ( 0 == nEntries ) { return Ostap::StatusCode::SUCCESS ; }
     //
-    RooArgSet tmva_vars;
-    std::map<std::string , std::unique_ptr<RooRealVar> > varmap ;
+    const std::vector<std::string>& methods = readers[0].methods() ;
+    const unsigned long nmethods = methods .size () ;
+    const unsigned long nvars    = readers[0].variables().size() ;
+    const unsigned long ncols    = nmethods + 1 ;     // +1 for category
     //
-    for ( const auto& m : readers[0].methods() )
+    RooArgList tmva_vars ;
+    std::vector<std::unique_ptr<RooRealVar> > vars ;
+    for ( const auto& m : methods )
     {
       const std::string vname = prefix + m + suffix ;
       const std::string vdesc = "Response of TMVA/" + m + " method" ;
-      auto v = std::make_unique<RooRealVar> ( vname.c_str() , vdesc.c_str() , 0 , s_min  , s_max ) ;
-      varmap [ m ] = std::move ( v ) ;
-      tmva_vars.add( *varmap[m] ) ;
+      vars.push_back ( std::make_unique<RooRealVar> ( vname.c_str() , vdesc.c_str() , 0 , s_min  , s_max ) ) ;
+      tmva_vars.add  ( *vars.back() ) ;
     }
     //
     tmva_vars.add ( category ) ;
     const unsigned int N = readers.size() ;
     //
-    auto tmva_ds = std::make_unique<RooDataSet>( "",  "" , tmva_vars ) ;
+    std::vector<float>    inputs  ( s_CHUNK  * nvars , 0.0f ) ;
+    std::vector<unsigned> indices ( s_CHUNK          , 0    ) ;
+    std::vector<double>   results ( nEntries * ncols , 0.0  ) ;
     //
-    for ( unsigned long long entry = 0 ; entry < nEntries ; ++entry ) 
+    for ( unsigned long long first = 0 ; first < nEntries ; first += s_CHUNK )
     {
-      if ( nullptr == data.get( entry ) ) { return Ostap::TMVA::InvalidEntry ; }
+      const unsigned long long last = std::min ( first + s_CHUNK , nEntries ) ;
       //
-      const double chopval  = chopping.getVal() ;
-      if ( !Ostap::Math::islong ( chopval ) ) { return Ostap::TMVA::InvalidChoppingCategory ; }
-      const long     choplong = std::lround ( chopval ) ;
-      const unsigned index    = choplong % N ;
-      //
-      category.setIndex ( index ) ;
-      //
-      READER& reader = readers[index] ;
-      for ( auto& e : reader.variables() ) 
-      { std::get<2>(e) = std::get<1> ( e )->getVal() ; }
-      // 
-      // call TMVA here ... 
-      for ( auto& e : varmap ) 
+      // (1) collect the input variables and categories for the block (serial)
+      for ( unsigned long long entry = first ; entry < last ; ++entry )
       {
-        const double r = 
-          reader.reader()->EvaluateMVA ( e.first.c_str () , aux ) ; // EVALUATE TMVA! 
-        e.second->setVal ( r )  ;                                           // ATTENTION HERE! 
+        if ( nullptr == data.get( entry ) ) { return Ostap::TMVA::InvalidEntry ; }
+        //
+        const double chopval  = chopping.getVal() ;
+        if ( !Ostap::Math::islong ( chopval ) ) { return Ostap::TMVA::InvalidChoppingCategory ; }
+        const long     choplong = std::lround ( chopval ) ;
+        const unsigned index    = choplong % N ;
+        //
+        indices [ entry - first ] = index ;
+        results [ entry * ncols + nmethods ] = index ;
+        //
+        // all readers share the same input variables
+        float* row = &inputs [ ( entry - first ) * nvars ] ;
+        for ( auto& e : readers[index].variables() ) { *row++ = std::get<1> ( e )->getVal() ; }
       }
       //
-      tmva_ds->add ( tmva_vars ) ;
+      // (2) evaluate TMVA for the block of entries (parallel)
+      parallel_for
+        ( readers[0].evaluators().size() , first , last ,
+          [&] ( const unsigned int thread , const std::size_t begin , const std::size_t end )
+          {
+            for ( std::size_t entry = begin ; entry < end ; ++entry )
+            {
+              EVALUATOR& ev = *readers [ indices [ entry - first ] ].evaluators() [ thread ] ;
+              ev.evaluate ( &inputs  [ ( entry - first ) * nvars ] ,
+                            &results [   entry           * ncols ] , aux ) ;
+            }
+          } ) ;
     }
     //
-    if ( 0 < tmva_ds->numEntries() ) { data.merge ( tmva_ds.get () ) ; }
-    //
-    return Ostap::StatusCode::SUCCESS ;
+    // (3) write the columns
+    return Ostap::Functions::add_columns ( data , tmva_vars , results ) ;
   }
   // ==========================================================================
   /** @typedef VARIABLE2 
@@ -280,15 +396,18 @@ namespace
     READER2 ( TTree*                  data         ,
               const Ostap::TMVA::MAP& inputs       , 
               const Ostap::TMVA::MAP& weight_files )
-      : m_data         ( data         ) 
-      , m_inputs       ( inputs       )
+      : m_inputs       ( inputs       )
       , m_weight_files ( weight_files )
+      , m_data         ( data         )
     {}
     // prepare it  for usage 
-    Ostap::StatusCode build ( const std::string& options = "" ) 
+    Ostap::StatusCode build
+    ( const std::string& options  = "" ,
+      const unsigned int nthreads = 1  )
     {
       //
       // 1)  create variables 
+      std::vector<std::string> names ;
       for ( const auto& i : m_inputs ) 
       {
         const std::string& name = i.first  ;
@@ -303,33 +422,18 @@ namespace
         if ( nullptr == var ) { return Ostap::TMVA::InvalidVariable ; }
         //
         m_variables.push_back ( std::make_tuple ( name , var , 0.0f ) ) ;  
+        names      .push_back ( name ) ;
       }
       //
-      // 2) create the actual reader 
-      m_reader = std::make_unique<TMVAReader>( options ) ;
-      //
-      //
-      // 3) connect the reader with names&placeholders
-      for ( auto& v : m_variables ) 
-      { 
-        m_reader->AddVariable ( std::get<0> ( v ) , &std::get<2>( v ) ) ;
-      }
-      //
-      // 4) book   TMVA methods 
-      for ( const auto& p : m_weight_files ) 
-      { 
-        auto m = m_reader->BookMVA   ( p.first , p.second ) ; 
-        if  ( nullptr == m ) { return Ostap::TMVA::InvalidBookTMVA ; }
-        m_methods.push_back ( p.first ) ;
-      }
-      //
-      return Ostap::StatusCode::SUCCESS ;
+      // 2) create the actual readers (one per thread) and book TMVA methods
+      return make_evaluators ( m_evaluators , names , m_weight_files , options , nthreads ) ;
     }
     // 
   public:
     // ========================================================================
-    const std::vector<std::string> methods      () const { return m_methods      ; }
-    TMVAReader*                    reader       () const { return m_reader.get() ; }
+    const std::vector<std::string>& methods () const
+    { return m_evaluators.front()->methods () ; }
+    EVALUATORS&                    evaluators   ()       { return m_evaluators   ; }
     const Ostap::TMVA::MAP&        inputs       () const { return m_inputs       ; }
     const Ostap::TMVA::MAP&        weight_files () const { return m_weight_files ; }
     VARIABLES2&                    variables    ()       { return m_variables    ; }
@@ -338,7 +442,6 @@ namespace
     // ========================================================================     
     Ostap::TMVA::MAP         m_inputs                   ;
     Ostap::TMVA::MAP         m_weight_files             ;
-    std::vector<std::string> m_methods      {}          ;
     TTree*                   m_data         { nullptr } ;
     // ========================================================================    
   private:
@@ -347,8 +450,8 @@ namespace
     // ========================================================================
   private:  
     // ========================================================================    
-    VARIABLES2                  m_variables  {}           ;
-    std::unique_ptr<TMVAReader> m_reader     { nullptr }  ;
+    VARIABLES2               m_variables  {} ;
+    EVALUATORS               m_evaluators {} ;
     // ========================================================================
   } ;  
   // ===========================================================================
@@ -385,23 +488,48 @@ namespace
     Ostap::Utils::Notifier  notifier { tree } ;
     for ( auto& e : reader.variables () ) { notifier.add ( std::get<1> ( e ) ) ; }
     //
-    for ( Long64_t entry = 0 ; entry < nEntries ; ++entry ) 
+    const unsigned long nmethods = branches.size () ;
+    const unsigned long nvars    = reader.variables().size() ;
+    //
+    std::vector<float>  inputs  ( s_CHUNK * nvars    , 0.0f ) ;
+    std::vector<double> results ( s_CHUNK * nmethods , 0.0  ) ;
+    //
+    EVALUATORS& evaluators = reader.evaluators () ;
+    //
+    for ( Long64_t first = 0 ; first < nEntries ; first += s_CHUNK )
     {
-      if ( tree->GetEntry ( entry ) < 0 ) { break ; }
-      //
-      // prepare TMVA input 
-      for ( auto& e : reader.variables() ) 
-      { std::get<2>(e) = std::get<1> ( e )->evaluate () ; }
+      Long64_t last = std::min ( first + Long64_t ( s_CHUNK ) , nEntries ) ;
       //
-      // evalaute TMVA and fill braches
-      for ( auto& branch : branches ) 
+      // (1) collect the input variables for the block of entries (serial)
+      for ( Long64_t entry = first ; entry < last ; ++entry )
       {
-        // call TMVA here ... 
-        const double result    = reader.reader()->EvaluateMVA ( std::get<1>( branch ). c_str () , aux ) ;
-        std::get<2> ( branch ) = result ;
-        std::get<0> ( branch ) -> Fill () ;  
+        if ( tree->GetEntry ( entry ) < 0 ) { last = entry ; break ; }
+        float* row = &inputs [ ( entry - first ) * nvars ] ;
+        for ( auto& e : reader.variables() ) { *row++ = std::get<1> ( e )->evaluate () ; }
       }
       // 
+      // (2) evaluate TMVA for the block of entries (parallel)
+      parallel_for
+        ( evaluators.size() , 0 , last - first ,
+          [&] ( const unsigned int thread , const std::size_t begin , const std::size_t end )
+          {
+            EVALUATOR& ev = *evaluators [ thread ] ;
+            for ( std::size_t i = begin ; i < end ; ++i )
+            { ev.evaluate ( &inputs [ i * nvars ] , &results [ i * nmethods ] , aux ) ; }
+          } ) ;
+      //
+      // (3) fill the branches (serial)
+      for ( Long64_t i = 0 ; i < last - first ; ++i )
+      {
+        const double* row = &results [ i * nmethods ] ;
+        for ( auto& branch : branches )
+        {
+          std::get<2> ( branch ) = *row++ ;
+          std::get<0> ( branch ) -> Fill () ;
+        }
+      }
+      //
+      if ( last < std::min ( first + Long64_t ( s_CHUNK ) , nEntries ) ) { break ; }
     }
     //
     return Ostap::StatusCode::SUCCESS ;
@@ -448,7 +576,7 @@ namespace
     Ostap::Utils::Notifier  notifier{ tree , &chopping } ;
     //
     for ( auto&  reader :readers ) 
-    { for ( auto& e : readers[0].variables () ) { notifier.add ( std::get<1> ( e ) ) ; } }
+    { for ( auto& e : reader.variables () ) { notifier.add ( std::get<1> ( e ) ) ; } }
     //
     // category in Tree:
     //
@@ -459,30 +587,60 @@ namespace
     //
     const unsigned int N = readers.size() ;
     //
-    for ( Long64_t entry = 0 ; entry < nEntries ; ++entry ) 
+    const unsigned long nmethods = branches.size () ;
+    const unsigned long nvars    = readers[0].variables().size() ;
+    //
+    std::vector<float>    inputs  ( s_CHUNK * nvars    , 0.0f ) ;
+    std::vector<unsigned> indices ( s_CHUNK            , 0    ) ;
+    std::vector<double>   results ( s_CHUNK * nmethods , 0.0  ) ;
+    //
+    for ( Long64_t first = 0 ; first < nEntries ; first += s_CHUNK )
     {
-      if ( tree->GetEntry ( entry ) < 0 ) { break ; }
+      Long64_t last = std::min ( first + Long64_t ( s_CHUNK ) , nEntries ) ;
       //
-      const double  chopval = chopping.evaluate() ;
-      if ( !Ostap::Math::islong ( chopval ) ) { return Ostap::TMVA::InvalidChoppingCategory ; }
-      const long         choplong = std::lround ( chopval ) ;
-      const unsigned int index    = choplong % N ;
-      i_category =  index  ;
-      bcat       -> Fill() ;
+      // (1) collect the input variables and categories for the block (serial)
+      for ( Long64_t entry = first ; entry < last ; ++entry )
+      {
+        if ( tree->GetEntry ( entry ) < 0 ) { last = entry ; break ; }
+        //
+        const double  chopval = chopping.evaluate() ;
+        if ( !Ostap::Math::islong ( chopval ) ) { return Ostap::TMVA::InvalidChoppingCategory ; }
+        const long         choplong = std::lround ( chopval ) ;
+        const unsigned int index    = choplong % N ;
+        indices [ entry - first ] = index ;
+        //
+        // prepare TMVA input
+        float* row = &inputs [ ( entry - first ) * nvars ] ;
+        for ( auto& e : readers[index].variables() ) { *row++ = std::get<1> ( e )->evaluate () ; }
+      }
       //
-      // prepare TMVA input 
-      READER2& reader = readers[index] ;
-      for ( auto& e : reader.variables() ) 
-      { std::get<2>(e) = std::get<1> ( e )->evaluate () ; }
+      // (2) evaluate TMVA for the block of entries (parallel)
+      parallel_for
+        ( readers[0].evaluators().size() , 0 , last - first ,
+          [&] ( const unsigned int thread , const std::size_t begin , const std::size_t end )
+          {
+            for ( std::size_t i = begin ; i < end ; ++i )
+            {
+              EVALUATOR& ev = *readers [ indices [ i ] ].evaluators() [ thread ] ;
+              ev.evaluate ( &inputs [ i * nvars ] , &results [ i * nmethods ] , aux ) ;
+            }
+          } ) ;
       //
-      // evaluate TMVA and fill braches
-      for ( auto& branch : branches ) 
+      // (3) fill the branches (serial)
+      for ( Long64_t i = 0 ; i < last - first ; ++i )
       {
-        // call TMVA here ... 
-        const double result    = reader.reader()->EvaluateMVA ( std::get<1>( branch ). c_str () , aux ) ;
-        std::get<2> ( branch ) = result ;
-        std::get<0> ( branch ) -> Fill () ;  
+        i_category =  indices [ i ] ;
+        bcat       -> Fill() ;
+        //
+        const double* row = &results [ i * nmethods ] ;
+        for ( auto& branch : branches )
+        {
+          std::get<2> ( branch ) = *row++ ;
+          std::get<0> ( branch ) -> Fill () ;
+        }
       }
+      //
+      if ( last < std::min ( first + Long64_t ( s_CHUNK ) , nEntries ) ) { break ; }
     }
     //
     return Ostap::StatusCode::SUCCESS ;
@@ -499,6 +657,7 @@ namespace
  *  @param weight_files (INPUT) map  { method  : weight_file }  
  *  @param prefix       (INPUT) the prefix for added varibales 
  *  @param suffix       (INPUT) the suffix for added varibales 
+ *  @param nthreads     (INPUT) number of threads for TMVA evaluation
  */ 
 // ============================================================================
 Ostap::StatusCode Ostap::TMVA::addResponse
@@ -508,11 +667,12 @@ Ostap::StatusCode Ostap::TMVA::addResponse
   const std::string&       options      , 
   const std::string&      prefix       , 
   const std::string&      suffix       ,
-  const double            aux          )
+  const double            aux          ,
+  const unsigned short    nthreads     )
 {
   // create the helper structure  
   READER reader  ( data , inputs , weight_files ) ;
-  Ostap::StatusCode sc =  reader.build ( options ) ;
+  Ostap::StatusCode sc =  reader.build ( options , nthreads ) ;
   if ( sc.isFailure() ) { return sc ; }
   //
   return _add_response_ ( data    ,
@@ -534,6 +694,7 @@ Ostap::StatusCode Ostap::TMVA::addResponse
  *  @param suffix       (INPUT) the suffix for added variables 
  *  @param aux          (INPUT) obligatory for the cuts method
  *                              where it represents the efficiency cutoff
+ *  @param nthreads     (INPUT) number of threads for TMVA evaluation
  */ 
 // ============================================================================
 Ostap::StatusCode Ostap::TMVA::addResponse
@@ -543,12 +704,13 @@ Ostap::StatusCode Ostap::TMVA::addResponse
   const std::string&      options       ,
   const std::string&      prefix        , 
   const std::string&      suffix        , 
-  const double            aux           ) 
+  const double            aux           ,
+  const unsigned short    nthreads      )
 {
   if ( nullptr == tree ) { return InvalidTree ; }
   // create the helper structure  
   READER2 reader  ( tree , inputs , weight_files ) ;
-  Ostap::StatusCode sc =  reader.build ( options ) ;
+  Ostap::StatusCode sc =  reader.build ( options , nthreads ) ;
   if ( sc.isFailure() ) { return sc ; }
   //
   return _add_response_ ( tree    ,
@@ -570,7 +732,8 @@ Ostap::StatusCode Ostap::TMVA::addChoppingResponse
   const std::string&       options      , 
   const std::string&       prefix       , 
   const std::string&       suffix       ,
-  const double             aux          )
+  const double             aux          ,
+  const unsigned short     nthreads     )
 {
   // ==========================================================================
   if  ( 0 == N || N != weight_files.size() ) { return InvalidChoppingWeightFiles ; }
@@ -586,7 +749,7 @@ Ostap::StatusCode Ostap::TMVA::addChoppingResponse
   bool first = true ;
   for ( auto& r : readers ) 
   {
-    Ostap::StatusCode sc =  r.build( first ? options : "" ) ;
+    Ostap::StatusCode sc =  r.build( first ? options : "" , nthreads ) ;
     if   ( sc.isFailure () ) { return sc ; }  
     first = false ;
   }
@@ -615,6 +778,7 @@ Ostap::StatusCode Ostap::TMVA::addChoppingResponse
  *  @param suffix       (INPUT) the suffix for added variables 
  *  @param aux          (INPUT) obligatory for the cuts method
  *                              where it represents the efficiency cutoff
+ *  @param nthreads     (INPUT) number of threads for TMVA evaluation
  */ 
 // ============================================================================
 Ostap::StatusCode Ostap::TMVA::addChoppingResponse 
@@ -627,7 +791,8 @@ Ostap::StatusCode Ostap::TMVA::addChoppingResponse
   const std::string&       options       ,
   const std::string&       prefix        , 
   const std::string&       suffix        ,
-  const double             aux           ) 
+  const double             aux           ,
+  const unsigned short     nthreads      )
 {
   if ( nullptr == tree ) { return InvalidTree ; }
   // ==========================================================================
@@ -647,7 +812,7 @@ Ostap::StatusCode Ostap::TMVA::addChoppingResponse
   bool first = true ;
   for ( auto& r : readers ) 
   {
-    Ostap::StatusCode sc =  r.build( first ? options : "" ) ;
+    Ostap::StatusCode sc =  r.build( first ? options : "" , nthreads ) ;
     if   ( sc.isFailure () ) { return sc ; }  
     first = false ;
   }
@@ -666,6 +831,3 @@ Ostap::StatusCode Ostap::TMVA::addChoppingResponse
 // ============================================================================
 //                                                                      The END 
 // ============================================================================
-
-
-
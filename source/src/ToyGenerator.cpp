@@ -0,0 +1,430 @@
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <cmath>
+#include <algorithm>
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/ToyGenerator.h"
+// ============================================================================
+// Local
+// ============================================================================
+#include "Exception.h"
+#include "local_parallel.h"
+// ============================================================================
+/** @file
+ *  Implementation file for classes Ostap::Math::ToyGenerator
+ *  and Ostap::Math::ToyGenerator2D
+ *  @see Ostap::Math::ToyGenerator
+ *  @see Ostap::Math::ToyGenerator2D
+ *  @author agent agent@local
+ *  @date   2026-10-19
+ */
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  /// the minimal number of events per thread
+  const std::size_t    s_CHUNK    = 16384     ;
+  /// the maximal depth of bin splitting for 1D-generator
+  const unsigned short s_MAXDEPTH = 16        ;
+  /// the maximal number of cells for 2D-generator
+  const std::size_t    s_MAXCELLS = 1u << 20  ;
+  // ==========================================================================
+  /** invert the CDF for the linear density at [0,1] with
+   *  the values <code>fa</code> and <code>fb</code> at the edges
+   *  @param v  the fraction of the bin integral
+   *  @return t such as \f$ \int_0^t f = v \int_0^1 f \f$
+   */
+  inline double _invert_
+  ( const double v  ,
+    const double fa ,
+    const double fb )
+  {
+    const double s = fa + fb ;
+    if ( !( 0 < s ) ) { return v ; }
+    const double d = fb - fa ;
+    //  solve fa*t + 0.5*d*t^2 = 0.5*v*s  in the numerically stable form
+    const double q = fa * fa + d * v * s ;
+    const double r = fa + std::sqrt ( std::max ( q , 0.0 ) ) ;
+    const double t = 0 < r ? v * s / r : v ;
+    return std::min ( std::max ( t , 0.0 ) , 1.0 ) ;
+  }
+  // ==========================================================================
+  /// the integral of the linear density at [0,t] in units of the full integral
+  inline double _fraction_
+  ( const double t  ,
+    const double fa ,
+    const double fb )
+  {
+    const double s = fa + fb ;
+    if ( !( 0 < s ) ) { return t ; }
+    return ( 2 * fa * t + ( fb - fa ) * t * t ) / s ;
+  }
+  // ==========================================================================
+  /** build the guide table for the cumulative integrals
+   *  <code>guide[j]</code> is the first bin with
+   *  <code>cdf[i+1] > j*total/M</code>
+   */
+  std::vector<unsigned int> _guide_ ( const std::vector<double>& cdf )
+  {
+    const std::size_t N     = cdf.size () - 1 ;
+    const double      total = cdf.back () ;
+    std::vector<unsigned int> guide ( N , 0 ) ;
+    std::size_t i = 0 ;
+    for ( std::size_t j = 0 ; j < N ; ++j )
+    {
+      const double target = total * j / N ;
+      while ( i + 1 < N && cdf [ i + 1 ] <= target ) { ++i ; }
+      guide [ j ] = i ;
+    }
+    return guide ;
+  }
+  // ==========================================================================
+  /// locate the bin for the target value of the cumulative integral
+  inline std::size_t _locate_
+  ( const std::vector<double>&       cdf    ,
+    const std::vector<unsigned int>& guide  ,
+    const double                     target )
+  {
+    const std::size_t N = guide.size () ;
+    std::size_t j = static_cast<std::size_t> ( target / cdf.back () * N ) ;
+    std::size_t i = guide [ std::min ( j , N - 1 ) ] ;
+    while ( i + 1 < N && cdf [ i + 1 ] <= target ) { ++i ; }
+    return i ;
+  }
+  // ==========================================================================
+  /** add the bin [a,b] to the table, splitting it
+   *  while the trapezoidal estimate of the integral is not precise enough
+   */
+  void _add_bin_
+  ( const Ostap::Math::ToyGenerator::function1& density  ,
+    const Ostap::Math::ToyGenerator::integral1& integral ,
+    const double         a        ,
+    const double         b        ,
+    const double         fa       ,
+    const double         fb       ,
+    const double         I        ,
+    const double         tol      ,
+    const unsigned short depth    ,
+    std::vector<double>& x        ,
+    std::vector<double>& f        ,
+    std::vector<double>& cdf      )
+  {
+    const double trapezoid = 0.5 * ( fa + fb ) * ( b - a ) ;
+    if ( s_MAXDEPTH <= depth || std::abs ( I - trapezoid ) <= tol )
+    {
+      x   .push_back ( b ) ;
+      f   .push_back ( fb ) ;
+      cdf .push_back ( cdf.back () + I ) ;
+      return ;                                                        // RETURN
+    }
+    //
+    const double m  = 0.5 * ( a + b ) ;
+    const double fm = std::max ( density ( m ) , 0.0 ) ;
+    const double I1 = std::max ( std::min ( integral ( a , m ) , I ) , 0.0 ) ;
+    //
+    _add_bin_ ( density , integral , a , m , fa , fm , I1     , 0.5 * tol , depth + 1 , x , f , cdf ) ;
+    _add_bin_ ( density , integral , m , b , fm , fb , I - I1 , 0.5 * tol , depth + 1 , x , f , cdf ) ;
+  }
+  // ==========================================================================
+} //                                                 end of anonymous namespace
+// ============================================================================
+// constructor from the density and its integral
+// ============================================================================
+Ostap::Math::ToyGenerator::ToyGenerator
+( const Ostap::Math::ToyGenerator::function1& density   ,
+  const Ostap::Math::ToyGenerator::integral1& integral  ,
+  const double                                xmin      ,
+  const double                                xmax      ,
+  const unsigned short                        nbins     ,
+  const double                                precision )
+{
+  Ostap::Assert ( xmin < xmax && 1 <= nbins        ,
+                  "Invalid range or number of bins" ,
+                  "Ostap::Math::ToyGenerator"       ) ;
+  //
+  // the coarse bins
+  const double h = ( xmax - xmin ) / nbins ;
+  std::vector<double> x0 ( nbins + 1 ) ;
+  std::vector<double> f0 ( nbins + 1 ) ;
+  std::vector<double> I0 ( nbins     ) ;
+  long double total = 0 ;
+  for ( unsigned int i = 0 ; i <= nbins ; ++i )
+  {
+    x0 [ i ] = i < nbins ? xmin + i * h : xmax ;
+    f0 [ i ] = std::max ( density ( x0 [ i ] ) , 0.0 ) ;
+  }
+  for ( unsigned int i = 0 ; i < nbins ; ++i )
+  {
+    I0 [ i ] = std::max ( integral ( x0 [ i ] , x0 [ i + 1 ] ) , 0.0 ) ;
+    total   += I0 [ i ] ;
+  }
+  //
+  Ostap::Assert ( 0 < total                          ,
+                  "Non-positive integral of the shape" ,
+                  "Ostap::Math::ToyGenerator"        ) ;
+  //
+  // refine the bins
+  const double tol = std::abs ( precision ) * total / nbins ;
+  m_x   .reserve ( 2 * nbins + 1 ) ;
+  m_f   .reserve ( 2 * nbins + 1 ) ;
+  m_cdf .reserve ( 2 * nbins + 1 ) ;
+  m_x   .push_back ( x0 [ 0 ] ) ;
+  m_f   .push_back ( f0 [ 0 ] ) ;
+  m_cdf .push_back ( 0        ) ;
+  for ( unsigned int i = 0 ; i < nbins ; ++i )
+  {
+    _add_bin_ ( density , integral ,
+                x0 [ i ] , x0 [ i + 1 ] ,
+                f0 [ i ] , f0 [ i + 1 ] , I0 [ i ] , tol , 0 ,
+                m_x , m_f , m_cdf ) ;
+  }
+  //
+  m_guide = _guide_ ( m_cdf ) ;
+}
+// ============================================================================
+// the (tabulated) quantile function: inverse CDF
+// ============================================================================
+double Ostap::Math::ToyGenerator::quantile ( const double u ) const
+{
+  if      ( u <= 0 ) { return xmin () ; }
+  else if ( u >= 1 ) { return xmax () ; }
+  //
+  const double      target = u * m_cdf.back () ;
+  const std::size_t i      = _locate_ ( m_cdf , m_guide , target ) ;
+  const double      I      = m_cdf [ i + 1 ] - m_cdf [ i ] ;
+  const double      v      = 0 < I ? ( target - m_cdf [ i ] ) / I : 0.5 ;
+  const double      t      = _invert_ ( std::min ( std::max ( v , 0.0 ) , 1.0 ) ,
+                                        m_f [ i ] , m_f [ i + 1 ] ) ;
+  return m_x [ i ] + t * ( m_x [ i + 1 ] - m_x [ i ] ) ;
+}
+// ============================================================================
+// the (tabulated) cumulative distribution function
+// ============================================================================
+double Ostap::Math::ToyGenerator::cdf ( const double x ) const
+{
+  if      ( x <= xmin () ) { return 0 ; }
+  else if ( x >= xmax () ) { return 1 ; }
+  //
+  const std::size_t i = std::upper_bound ( m_x.begin () , m_x.end () , x ) - m_x.begin () - 1 ;
+  const double      t = ( x - m_x [ i ] ) / ( m_x [ i + 1 ] - m_x [ i ] ) ;
+  const double      I = m_cdf [ i + 1 ] - m_cdf [ i ] ;
+  return ( m_cdf [ i ] + I * _fraction_ ( t , m_f [ i ] , m_f [ i + 1 ] ) ) / m_cdf.back () ;
+}
+// ============================================================================
+/*  generate <code>n</code> events
+ *  @param n        number of events
+ *  @param x        (OUTPUT) the events
+ *  @param rng      the random stream
+ *  @param first    the index of the first event in the stream
+ *  @param nthreads number of threads (0: all cores)
+ */
+// ============================================================================
+void Ostap::Math::ToyGenerator::generate
+( const std::size_t                 n        ,
+  double*                           x        ,
+  const Ostap::Utils::RandomStream& rng      ,
+  const std::uint64_t               first    ,
+  const unsigned short              nthreads ) const
+{
+  const unsigned int nt = n_threads ( nthreads , n / s_CHUNK ) ;
+  parallel_for ( nt , 0 , n ,
+                 [this,x,&rng,first] ( const unsigned int /* thread */ ,
+                                       const std::size_t  b            ,
+                                       const std::size_t  e            )
+                 {
+                   for ( std::size_t i = b ; i < e ; ++i )
+                   { x [ i ] = generate ( rng , first + i ) ; }
+                 } ) ;
+}
+// ============================================================================
+/*  generate <code>n</code> events
+ *  @param n        number of events
+ *  @param rng      the random stream
+ *  @param first    the index of the first event in the stream
+ *  @param nthreads number of threads (0: all cores)
+ *  @return the events
+ */
+// ============================================================================
+std::vector<double> Ostap::Math::ToyGenerator::generate
+( const std::size_t                 n        ,
+  const Ostap::Utils::RandomStream& rng      ,
+  const std::uint64_t               first    ,
+  const unsigned short              nthreads ) const
+{
+  std::vector<double> x ( n ) ;
+  generate ( n , x.data () , rng , first , nthreads ) ;
+  return x ;
+}
+// ============================================================================
+// constructor from the density and its integral
+// ============================================================================
+Ostap::Math::ToyGenerator2D::ToyGenerator2D
+( const Ostap::Math::ToyGenerator2D::function2& density   ,
+  const Ostap::Math::ToyGenerator2D::integral2& integral  ,
+  const double                                  xmin      ,
+  const double                                  xmax      ,
+  const double                                  ymin      ,
+  const double                                  ymax      ,
+  const unsigned short                          nx        ,
+  const unsigned short                          ny        ,
+  const double                                  precision )
+  : m_xmin ( std::min ( xmin , xmax ) )
+  , m_xmax ( std::max ( xmin , xmax ) )
+  , m_ymin ( std::min ( ymin , ymax ) )
+  , m_ymax ( std::max ( ymin , ymax ) )
+  , m_nx   ( nx )
+  , m_ny   ( ny )
+{
+  Ostap::Assert ( m_xmin < m_xmax && m_ymin < m_ymax && 1 <= nx && 1 <= ny ,
+                  "Invalid range or number of bins"                        ,
+                  "Ostap::Math::ToyGenerator2D"                            ) ;
+  //
+  // refine the grid till the bilinear approximation is precise enough
+  for ( ;; )
+  {
+    const double hx = ( m_xmax - m_xmin ) / m_nx ;
+    const double hy = ( m_ymax - m_ymin ) / m_ny ;
+    //
+    // the density at the nodes
+    m_f.resize ( ( m_nx + 1 ) * ( m_ny + 1 ) ) ;
+    for ( unsigned int ix = 0 ; ix <= m_nx ; ++ix )
+    {
+      const double x = ix < m_nx ? m_xmin + ix * hx : m_xmax ;
+      for ( unsigned int iy = 0 ; iy <= m_ny ; ++iy )
+      {
+        const double y = iy < m_ny ? m_ymin + iy * hy : m_ymax ;
+        m_f [ ix * ( m_ny + 1 ) + iy ] = std::max ( density ( x , y ) , 0.0 ) ;
+      }
+    }
+    //
+    // the cell integrals, accumulated column-by-column
+    m_cdf.resize ( m_nx * m_ny + 1 ) ;
+    m_cdf [ 0 ] = 0 ;
+    double maxdiff = 0 ;
+    for ( unsigned int ix = 0 ; ix < m_nx ; ++ix )
+    {
+      const double xl = m_xmin + ix * hx ;
+      const double xh = ix + 1 < m_nx ? xl + hx : m_xmax ;
+      for ( unsigned int iy = 0 ; iy < m_ny ; ++iy )
+      {
+        const double yl = m_ymin + iy * hy ;
+        const double yh = iy + 1 < m_ny ? yl + hy : m_ymax ;
+        const double I  = std::max ( integral ( xl , xh , yl , yh ) , 0.0 ) ;
+        const double B  = 0.25 * hx * hy *
+          ( m_f [   ix       * ( m_ny + 1 ) + iy     ] +
+            m_f [   ix       * ( m_ny + 1 ) + iy + 1 ] +
+            m_f [ ( ix + 1 ) * ( m_ny + 1 ) + iy     ] +
+            m_f [ ( ix + 1 ) * ( m_ny + 1 ) + iy + 1 ] ) ;
+        maxdiff = std::max ( maxdiff , std::abs ( I - B ) ) ;
+        const std::size_t k = ix * m_ny + iy ;
+        m_cdf [ k + 1 ] = m_cdf [ k ] + I ;
+      }
+    }
+    //
+    Ostap::Assert ( 0 < m_cdf.back ()                     ,
+                    "Non-positive integral of the shape"  ,
+                    "Ostap::Math::ToyGenerator2D"         ) ;
+    //
+    const std::size_t ncells = m_nx * m_ny ;
+    if ( maxdiff <= std::abs ( precision ) * m_cdf.back () / ncells ) { break ; }
+    if ( s_MAXCELLS < 4 * ncells || 16384 < 2 * std::max ( m_nx , m_ny ) ) { break ; }
+    //
+    m_nx *= 2 ;
+    m_ny *= 2 ;
+  }
+  //
+  m_guide = _guide_ ( m_cdf ) ;
+}
+// ============================================================================
+/*  generate single event
+ *  @param rng   the random stream
+ *  @param index the index of the event in the stream
+ *  @param x     (OUTPUT) x-value
+ *  @param y     (OUTPUT) y-value
+ */
+// ============================================================================
+void Ostap::Math::ToyGenerator2D::generate
+( const Ostap::Utils::RandomStream& rng   ,
+  const std::uint64_t               index ,
+  double&                           x     ,
+  double&                           y     ) const
+{
+  // the cell & the position in x from the first random number
+  const double      target = rng.uniform ( 2 * index ) * m_cdf.back () ;
+  const std::size_t k      = _locate_ ( m_cdf , m_guide , target ) ;
+  const double      I      = m_cdf [ k + 1 ] - m_cdf [ k ] ;
+  const double      v      = 0 < I ? ( target - m_cdf [ k ] ) / I : 0.5 ;
+  //
+  const unsigned short ix = k / m_ny ;
+  const unsigned short iy = k % m_ny ;
+  //
+  const double f00 = m_f [   ix       * ( m_ny + 1 ) + iy     ] ;
+  const double f01 = m_f [   ix       * ( m_ny + 1 ) + iy + 1 ] ;
+  const double f10 = m_f [ ( ix + 1 ) * ( m_ny + 1 ) + iy     ] ;
+  const double f11 = m_f [ ( ix + 1 ) * ( m_ny + 1 ) + iy + 1 ] ;
+  //
+  // x from the (linear) marginal of the bilinear density
+  const double tx = _invert_ ( std::min ( std::max ( v , 0.0 ) , 1.0 ) , f00 + f01 , f10 + f11 ) ;
+  // y from the (linear) conditional of the bilinear density
+  const double ty = _invert_ ( rng.uniform ( 2 * index + 1 ) ,
+                               f00 + tx * ( f10 - f00 ) ,
+                               f01 + tx * ( f11 - f01 ) ) ;
+  //
+  const double hx = ( m_xmax - m_xmin ) / m_nx ;
+  const double hy = ( m_ymax - m_ymin ) / m_ny ;
+  x = std::min ( m_xmin + ( ix + tx ) * hx , m_xmax ) ;
+  y = std::min ( m_ymin + ( iy + ty ) * hy , m_ymax ) ;
+}
+// ============================================================================
+/*  generate <code>n</code> events
+ *  @param n        number of events
+ *  @param xy       (OUTPUT) the events, <code>2*n</code> row-major array
+ *  @param rng      the random stream
+ *  @param first    the index of the first event in the stream
+ *  @param nthreads number of threads (0: all cores)
+ */
+// ============================================================================
+void Ostap::Math::ToyGenerator2D::generate
+( const std::size_t                 n        ,
+  double*                           xy       ,
+  const Ostap::Utils::RandomStream& rng      ,
+  const std::uint64_t               first    ,
+  const unsigned short              nthreads ) const
+{
+  const unsigned int nt = n_threads ( nthreads , n / s_CHUNK ) ;
+  parallel_for ( nt , 0 , n ,
+                 [this,xy,&rng,first] ( const unsigned int /* thread */ ,
+                                        const std::size_t  b            ,
+                                        const std::size_t  e            )
+                 {
+                   for ( std::size_t i = b ; i < e ; ++i )
+                   { generate ( rng , first + i , xy [ 2 * i ] , xy [ 2 * i + 1 ] ) ; }
+                 } ) ;
+}
+// ============================================================================
+/*  generate <code>n</code> events
+ *  @param n        number of events
+ *  @param rng      the random stream
+ *  @param first    the index of the first event in the stream
+ *  @param nthreads number of threads (0: all cores)
+ *  @return the events, <code>2*n</code> row-major array
+ */
+// ============================================================================
+std::vector<double> Ostap::Math::ToyGenerator2D::generate
+( const std::size_t                 n        ,
+  const Ostap::Utils::RandomStream& rng      ,
+  const std::uint64_t               first    ,
+  const unsigned short              nthreads ) const
+{
+  std::vector<double> xy ( 2 * n ) ;
+  generate ( n , xy.data () , rng , first , nthreads ) ;
+  return xy ;
+}
+// ============================================================================
+//                                                                      The END
+// ============================================================================
@@ -29,6 +29,7 @@
 #include "Ostap/Power.h"
 #include "Ostap/UStat.h"
 #include "Ostap/Iterator.h"
+#include "Ostap/DataSnapshot.h"
 // ============================================================================
 /** @file
  *  Implementation file for class Analysis::UStat
@@ -39,28 +40,6 @@
 // ============================================================================
 namespace 
 {
-  // ==========================================================================
-  double getDistance ( const RooArgSet* x , 
-                       const RooArgSet* y )
-  {
-    if ( 0 == x || 0 == y ) { return -1 ; } // RETURN 
-    //
-    double result = 0.;
-    //
-    Ostap::Utils::Iterator xIter ( *x ) ;
-    Ostap::Utils::Iterator yIter ( *y ) ;
-    //
-    RooRealVar* xVar = 0 ;
-    RooRealVar* yVar = 0 ;
-    while ( ( xVar = (RooRealVar*)xIter -> Next() ) && 
-            ( yVar = (RooRealVar*)yIter -> Next() )    ) 
-    {
-      const double val  = xVar->getVal() - yVar->getVal() ;
-      result           += val*val ;
-    }
-    //
-    return std::sqrt ( result ) ;
-  }
   // ==========================================================================
   /// get the volume of n-ball with unit radius 
   double nBallVolume ( const unsigned int n )
@@ -100,53 +79,52 @@ Ostap::StatusCode Ostap::UStat::calculate
   typedef std::vector<double> TStat ;
   TStat tstat ;
   //
-  const RooDataSet*  cloned = (RooDataSet*)data.Clone() ;
+  // columnar snapshot of the observables: avoid O(N^2) virtual calls 
+  Ostap::DataSnapshot::Names names ;
+  std::vector<RooRealVar*>   vars  ;
+  Ostap::Utils::Iterator iter  ( *args ) ;
+  RooRealVar * var = 0 ;
+  while ( ( var = (RooRealVar*)iter->Next() ) ) 
+  { 
+    if ( nullptr == data.get()->find ( var->GetName() ) ) 
+    { return Ostap::StatusCode ( InvalidItem2 ) ; }             // RETURN 
+    names.push_back ( var->GetName() ) ; 
+    vars .push_back ( var            ) ; 
+  }
   //
-  const unsigned int num    = data.numEntries () ;
+  Ostap::DataSnapshot snapshot ( data , names ) ;
+  std::vector<const double*> columns ;
+  for ( const auto& n : names ) { columns.push_back ( snapshot.column ( n ).data () ) ; }
   //
-  const RooArgSet * event_x = 0 ;
-  const RooArgSet * event_y = 0 ;
+  const unsigned int num    = snapshot.size () ;
+  if ( 0 == num ) { return Ostap::StatusCode ( InvalidItem1 ) ; }  // RETURN 
   //
   for ( unsigned int i = 0 ; i < num ; ++i ) 
   {
     //
-    // 1. Get "Event"
-    event_x = data . get(i) ;      
-    if ( 0 == event_x || 0 == event_x->getSize() ) 
-    { return Ostap::StatusCode ( InvalidItem1 ) ; }             // RETURN 
-    //
-    std::unique_ptr<RooArgSet> event_i ( ( RooArgSet*)event_x->selectCommon( *args ) ) ;
-    if ( !event_i || 0 == event_i->getSize() ) 
-    { return Ostap::StatusCode ( InvalidItem2 ) ; }             // RETURN 
-    //
-    // 2.Evaluate PDF 
-    Ostap::Utils::Iterator iter  ( *args ) ;
-    RooRealVar * var = 0 ;
-    while ( (var = (RooRealVar*)iter->Next() ) ) 
-    { var->setVal( event_i->getRealValue( var->GetName() ) ); }
+    // 1. Evaluate PDF 
+    for ( unsigned int k = 0 ; k < dim ; ++k ) { vars [ k ]->setVal ( columns [ k ][ i ] ) ; }
     //
     const double pdfValue = pdf . getVal( args ) ;
     //
-    double min_distance  = 1.e+100 ;
+    // 2. find the nearest neighbour 
+    double min_distance2 = 1.e+100 ;
     for ( unsigned int j = 0 ; j < num ; ++j ) 
     {
       if ( i == j ) { continue ; }
       //
-      event_y = cloned->get(j) ;      
-      if ( 0 == event_y || 0 == event_y->getSize() ) 
-      { return Ostap::StatusCode ( InvalidItem1 ) ; }            // RETURN 
-      //
-      std::unique_ptr<RooArgSet> event_j ( ( RooArgSet*)event_y->selectCommon( *args ) ) ;
-      if ( !event_j || 0 == event_j->getSize() )  
-      { return Ostap::StatusCode ( InvalidItem2 ) ; }            // RETURN 
-      //
-      const double distance = getDistance ( event_i.get() , event_j.get() ) ;
-      if ( 0 > distance ) { return Ostap::StatusCode( InvalidDist ) ; }  // RETURN 
+      double distance2 = 0 ;
+      for ( unsigned int k = 0 ; k < dim ; ++k ) 
+      {
+        const double d = columns [ k ][ i ] - columns [ k ][ j ] ;
+        distance2 += d * d ;
+      }
       //
-      if ( 0 == j || distance < min_distance ) 
-      { min_distance = distance  ; }
+      if ( 0 == j || distance2 < min_distance2 ) 
+      { min_distance2 = distance2 ; }
       //
     }
+    const double min_distance = std::sqrt ( min_distance2 ) ;
     //
     // volume of n-ball: 
     const double val1 = volume * Ostap::Math::pow ( min_distance , dim ) ;
@@ -158,7 +136,6 @@ Ostap::StatusCode Ostap::UStat::calculate
     tstat.push_back ( value ) ; 
     //
   } 
-  delete cloned ;
   //
   // calculate T-statistics
   //
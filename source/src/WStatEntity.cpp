@@ -48,7 +48,7 @@ Ostap::WStatEntity::add
   if ( 0 == n() ) 
   {
     m_mu  = value ;
-    m_mu2 = value ;
+    m_mu2 = 0     ;
     if ( !s_zero ( weight ) ) { m_values += value ; }
     m_weights += weight ;    
     //
@@ -20,8 +20,14 @@
 #include "Ostap/Chi2Solution.h"
 #include "Ostap/Choose.h"
 #include "Ostap/Clenshaw.h"
+#include "Ostap/ColumnCache.h"
 #include "Ostap/Combine.h"
+#include "Ostap/Convolution.h"
+#include "Ostap/CutIndex.h"
 #include "Ostap/Dalitz.h"
+#include "Ostap/DalitzIntegrator.h"
+#include "Ostap/DataFrameBooker.h"
+#include "Ostap/DataSnapshot.h"
 #include "Ostap/Digit.h"
 #include "Ostap/EigenSystem.h"
 #include "Ostap/Error2Exception.h"
@@ -35,10 +41,14 @@
 #include "Ostap/GSL_utils.h"
 #include "Ostap/Hesse.h"
 #include "Ostap/HFuncs.h"
+#include "Ostap/HistoAccumulator.h"
 #include "Ostap/HistoDump.h"
 #include "Ostap/HistoInterpolation.h"
+#include "Ostap/HistoInterpolators.h"
 #include "Ostap/HistoMake.h"
+#include "Ostap/HistoParam.h"
 #include "Ostap/HistoProject.h"
+#include "Ostap/HistoSampler.h"
 #include "Ostap/HistoStat.h"
 #include "Ostap/Interpolation.h"
 #include "Ostap/Iterator.h"
@@ -47,6 +57,7 @@
 #include "Ostap/Lomont.h"
 #include "Ostap/LorentzVectorWithError.h"
 #include "Ostap/Kinematics.h"
+#include "Ostap/KinematicsBatch.h"
 #include "Ostap/Math.h"
 #include "Ostap/MatrixUtils.h"
 #include "Ostap/MatrixTransforms.h"
@@ -78,7 +89,10 @@
 #include "Ostap/PyVar.h"     
 #include "Ostap/PyBLOB.h"
 #include "Ostap/Polarization.h"
+#include "Ostap/RandomStream.h"
 #include "Ostap/SFactor.h"
+#include "Ostap/ShapeNLL.h"
+#include "Ostap/SPlot.h"
 #include "Ostap/StatEntity.h"
 #include "Ostap/StatVar.h"
 #include "Ostap/StatusCode.h"
@@ -86,7 +100,9 @@
 #include "Ostap/SymmetricMatrixTypes.h"
 #include "Ostap/Tensors.h"
 #include "Ostap/Tee.h"
+#include "Ostap/ThreadPool.h"
 #include "Ostap/ToStream.h"
+#include "Ostap/ToyGenerator.h"
 #include "Ostap/TypeWrapper.h"
 #include "Ostap/Tmva.h"
 #include "Ostap/Valid.h"
@@ -301,6 +317,43 @@ namespace
     Ostap::Math::LessOrEqual<double>     __eq_7 ;
     Ostap::Math::GreaterOrEqual<double>  __eq_8 ;
     //
+    Ostap::Math::ShapeNLL<Ostap::Math::BifurcatedGauss>  __nll_1 ;
+    Ostap::Math::ShapeNLL<Ostap::Math::CrystalBall>      __nll_2 ;
+    Ostap::Math::ShapeNLL<Ostap::Math::StudentT>         __nll_3 ;
+    Ostap::Math::ShapeNLL<Ostap::Math::Bukin>            __nll_4 ;
+    Ostap::Math::ShapeNLL<Ostap::Math::Apolonios>        __nll_5 ;
+    Ostap::Math::ShapeNLL<Ostap::Math::Apolonios2>       __nll_6 ;
+    //
+    // the template constructors for the common shapes 
+    static void __template_constructors () 
+    {
+      const Ostap::Math::Gauss           g    {} ;
+      const Ostap::Math::BifurcatedGauss bg   {} ;
+      const Ostap::Math::CrystalBall     cb   {} ;
+      const Ostap::Math::StudentT        st   {} ;
+      const Ostap::Math::Bukin           bk   {} ;
+      const Ostap::Math::Apolonios2      ap   {} ;
+      const Ostap::Math::Positive2D      p2   {} ;
+      const Ostap::Math::Positive2DSym   p2s  {} ;
+      //
+      Ostap::Math::ToyGenerator   __tg_1 ( g   , -1 , 1 ) ;
+      Ostap::Math::ToyGenerator   __tg_2 ( bg  , -1 , 1 ) ;
+      Ostap::Math::ToyGenerator   __tg_3 ( cb  , -1 , 1 ) ;
+      Ostap::Math::ToyGenerator   __tg_4 ( st  , -1 , 1 ) ;
+      Ostap::Math::ToyGenerator   __tg_5 ( bk  , -1 , 1 ) ;
+      Ostap::Math::ToyGenerator   __tg_6 ( ap  , -1 , 1 ) ;
+      Ostap::Math::ToyGenerator2D __tg_7 ( p2  ) ;
+      Ostap::Math::ToyGenerator2D __tg_8 ( p2s ) ;
+      //
+      Ostap::Math::Convolution    __cnv_1 ( g   , g   , -1 , 1 , -1 , 1 ) ;
+      Ostap::Math::Convolution    __cnv_2 ( bg  , g   , -1 , 1 , -1 , 1 ) ;
+      Ostap::Math::Convolution    __cnv_3 ( cb  , g   , -1 , 1 , -1 , 1 ) ;
+      Ostap::Math::Convolution    __cnv_4 ( st  , g   , -1 , 1 , -1 , 1 ) ;
+      Ostap::Math::Convolution    __cnv_5 ( bk  , g   , -1 , 1 , -1 , 1 ) ;
+      Ostap::Math::Convolution    __cnv_6 ( ap  , g   , -1 , 1 , -1 , 1 ) ;
+      Ostap::Math::Convolution    __cnv_7 ( g   , bg  , -1 , 1 , -1 , 1 ) ;
+    }
+    //
   };
   // ==========================================================================
 } //                                             The end of anonymous namespace 
@@ -0,0 +1,180 @@
+// ============================================================================
+#ifndef OSTAP_LOCAL_CACHE_H
+#define OSTAP_LOCAL_CACHE_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <atomic>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <iomanip>
+#include <functional>
+// ============================================================================
+// POSIX
+// ============================================================================
+#include <sys/stat.h>
+// ============================================================================
+// ROOT
+// ============================================================================
+#include "TTree.h"
+#include "TChain.h"
+#include "TFile.h"
+#include "TDirectory.h"
+#include "TSystem.h"
+#include "TList.h"
+#include "TFriendElement.h"
+// ============================================================================
+/** @file
+ *  Helpers for the persistent caches of the derived data
+ *  (cut-indices, columns), that are kept alongside the input files
+ *  @see Ostap::Trees::CutIndex
+ *  @see Ostap::Trees::ColumnCache
+ *  @author agent agent@local
+ *  @date   2026-10-19
+ */
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  /** the precise time stamp of the local file: modification time with
+   *  sub-second resolution and the inode number (the file, rewritten
+   *  and renamed within one second, gets the new inode)
+   *  @return empty string for non-local files
+   */
+  inline std::string file_stamp ( const std::string& path )
+  {
+    struct stat st ;
+    if ( 0 != ::stat ( path.c_str () , &st ) ) { return "" ; }      // RETURN
+#if defined ( __APPLE__ )
+    const long nsec = st.st_mtimespec.tv_nsec ;
+#else
+    const long nsec = st.st_mtim.tv_nsec ;
+#endif
+    return std::to_string ( nsec ) + ':' + std::to_string ( st.st_ino ) ;
+  }
+  // ==========================================================================
+  /** get the identity of the input tree:
+   *  the full path of the tree (directory and name), number of entries
+   *  and the names, sizes and modification times
+   *  (with sub-second resolution for the local files) for all input files.
+   *  The friend trees (recursively) contribute with their aliases
+   *  and their own identities.
+   *  Any change of the input files, including the files of the friends,
+   *  changes the identity.
+   *  @param tree  (INPUT)  the tree
+   *  @param dir   (OUTPUT) the directory of the first input file
+   *  @param depth (INPUT)  the recursion depth for the friends
+   *  @return the identity, empty string if it can't be established
+   *          (e.g. for the memory-resident trees or friends)
+   */
+  inline std::string tree_identity
+  ( TTree*               tree      ,
+    std::string&         dir       ,
+    const unsigned short depth = 0 )
+  {
+    if ( nullptr == tree || 8 < depth ) { return "" ; }              // RETURN
+    //
+    // the files and the full paths of the trees inside them
+    std::vector<std::string> files {} ;
+    std::vector<std::string> trees {} ;
+    TChain* chain = dynamic_cast<TChain*> ( tree ) ;
+    if ( chain )
+    {
+      const TObjArray* lst = chain->GetListOfFiles () ;
+      if ( !lst ) { return "" ; }                                    // RETURN
+      for ( int i = 0 ; i < lst->GetEntries () ; ++i )
+      {
+        // chain element: name is the tree path, title is the file name
+        const TObject* e = lst->At ( i ) ;
+        if ( !e ) { return "" ; }                                    // RETURN
+        files.push_back ( e->GetTitle () ) ;
+        trees.push_back ( e->GetName  () ) ;
+      }
+    }
+    else
+    {
+      const TFile*      file = tree->GetCurrentFile () ;
+      const TDirectory* tdir = tree->GetDirectory   () ;
+      if ( !file || !tdir ) { return "" ; }                          // RETURN
+      files.push_back ( file->GetName () ) ;
+      trees.push_back ( std::string ( tdir->GetPath () ) + "/" + tree->GetName () ) ;
+    }
+    if ( files.empty () ) { return "" ; }                            // RETURN
+    //
+    std::ostringstream key ;
+    key << tree->GetName () << '|' << tree->GetEntries () ;
+    for ( std::size_t i = 0 ; i < files.size () ; ++i )
+    {
+      const std::string& f = files [ i ] ;
+      FileStat_t st ;
+      if ( 0 != gSystem->GetPathInfo ( f.c_str () , st ) ) { return "" ; }
+      key << '|' << f << ':' << trees [ i ] << ':' << st.fSize << ':' << st.fMtime
+          << ':' << file_stamp ( f ) ;
+    }
+    //
+    // the friends
+    const TList* friends = tree->GetListOfFriends () ;
+    if ( friends )
+    {
+      for ( const TObject* o : *friends )
+      {
+        const TFriendElement* fe = dynamic_cast<const TFriendElement*> ( o ) ;
+        if ( !fe ) { return "" ; }                                   // RETURN
+        std::string       fdir {} ;
+        const std::string fkey = tree_identity
+          ( const_cast<TFriendElement*> ( fe )->GetTree () , fdir , depth + 1 ) ;
+        if ( fkey.empty () ) { return "" ; }                         // RETURN
+        key << "|friend:" << fe->GetName () << '{' << fkey << '}' ;
+      }
+    }
+    //
+    dir = gSystem->GetDirName ( files.front ().c_str () ) ;
+    return key.str () ;
+  }
+  // ==========================================================================
+  /** the name of the file in the cache directory
+   *  @param dir the cache directory
+   *  @param key the key
+   *  @param ext the file extension
+   */
+  inline std::string cache_path
+  ( const std::string& dir ,
+    const std::string& key ,
+    const std::string& ext )
+  {
+    std::ostringstream name ;
+    name << dir << "/" << std::hex << std::setw ( 16 ) << std::setfill ( '0' )
+         << std::hash<std::string>() ( key ) << ext ;
+    return name.str () ;
+  }
+  // ==========================================================================
+  /** create (if needed) the cache directory
+   *  @return true if the directory exists and is writable
+   */
+  inline bool cache_directory ( const std::string& dir )
+  {
+    // NB: AccessPathName returns false if the path is accessible
+    if ( gSystem->AccessPathName ( dir.c_str () ) &&
+         0 != gSystem->mkdir ( dir.c_str () , true ) ) { return false ; }
+    return !gSystem->AccessPathName ( dir.c_str () , kWritePermission ) ;
+  }
+  // ==========================================================================
+  /** the unique name of the temporary file for the given path:
+   *  the file is written as temporary and then renamed,
+   *  therefore the concurrent writers (processes or threads) are safe
+   */
+  inline std::string temporary_path ( const std::string& path )
+  {
+    static std::atomic<unsigned long> s_counter { 0 } ;
+    return path + "." + std::to_string ( gSystem->GetPid () ) + "." + std::to_string ( s_counter++ ) ;
+  }
+  // ==========================================================================
+} //                                             The end of anonymous namespace
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_LOCAL_CACHE_H
+// ============================================================================
@@ -0,0 +1,85 @@
+// ============================================================================
+#ifndef OSTAP_LOCAL_PARALLEL_H
+#define OSTAP_LOCAL_PARALLEL_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <algorithm>
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/ThreadPool.h"
+// ============================================================================
+/** @file
+ *  Simple helpers to split the loop over the range into several threads
+ *  of the process-wide Ostap::Utils::ThreadPool
+ *  @see Ostap::Utils::ThreadPool
+ *  @author agent agent@local
+ *  @date   2026-10-19
+ */
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  /** get the actual number of threads to be used
+   *  - 0 means "all threads of the pool" (Ostap::Utils::ThreadPool::concurrency)
+   *  - never more than number of items to process
+   */
+  inline unsigned int n_threads
+  ( const unsigned int  nthreads ,
+    const std::size_t   nitems   )
+  {
+    unsigned int n = nthreads ;
+    if ( 0 == n ) { n = Ostap::Utils::ThreadPool::concurrency () ; }
+    if ( nitems < n ) { n = std::max ( std::size_t ( 1 ) , nitems ) ; }
+    return n ;
+  }
+  // ==========================================================================
+  /** process the range <code>[first,last)</code> in <code>nthreads</code>
+   *  tasks of the process-wide thread pool, splitting it into contiguous subranges:
+   *  <code>func ( thread , begin , end )</code> is invoked once for each subrange,
+   *  and <code>thread</code> is the index of the subrange.
+   *  The calling thread participates in the processing.
+   *  Exceptions from the tasks are propagated to the caller
+   *  @param nthreads number of threads
+   *  @param first    begin of the range
+   *  @param last     end  of the range
+   *  @param func     the function  <code>void func ( unsigned int , std::size_t , std::size_t )</code>
+   */
+  template <class FUNCTION>
+  inline void parallel_for
+  ( const unsigned int nthreads ,
+    const std::size_t  first    ,
+    const std::size_t  last     ,
+    FUNCTION           func     )
+  {
+    if ( last <= first ) { return ; }
+    //
+    const std::size_t  N = last - first ;
+    const unsigned int n = n_threads ( nthreads , N ) ;
+    //
+    if ( 1 == n ) { func ( 0u , first , last ) ; return ; }       // RETURN
+    //
+    const std::size_t chunk = N / n ;
+    const std::size_t extra = N % n ;
+    //
+    Ostap::Utils::TaskGroup group ;
+    std::size_t b = first ;
+    for ( unsigned int i = 0 ; i < n ; ++i )
+    {
+      const std::size_t e = b + chunk + ( i < extra ? 1 : 0 ) ;
+      group.run ( [&func,i,b,e] () { func ( i , b , e ) ; } ) ;
+      b = e ;
+    }
+    //
+    group.wait () ;
+  }
+  // ==========================================================================
+} //                                             The end of anonymous namespace
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_LOCAL_PARALLEL_H
+// ============================================================================
@@ -0,0 +1,315 @@
+// ============================================================================
+#ifndef OSTAP_LOCAL_TREE_H
+#define OSTAP_LOCAL_TREE_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <cmath>
+#include <string>
+#include <vector>
+#include <algorithm>
+// ============================================================================
+// ROOT
+// ============================================================================
+#include "TTree.h"
+#include "TBranch.h"
+#include "TLeaf.h"
+#include "TLeafC.h"
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/StatEntity.h"
+#include "Ostap/ColumnCache.h"
+// ============================================================================
+// Local
+// ============================================================================
+#include "Exception.h"
+// ============================================================================
+/** @file
+ *  Helpers for the fast reading of the primitive scalar branches,
+ *  that bypass both TTreeFormula and <code>TTree::GetEntry</code>
+ *  @author agent agent@local
+ *  @date   2026-10-19
+ */
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  /** get the leaf for the primitive scalar numerical variable
+   *  - the leaf must be the only leaf of the plain <code>TBranch</code>
+   *  - fixed-length (scalar) leaf only
+   *  - no strings
+   *  - no leaves of the friend trees
+   *  @return the leaf or nullptr
+   */
+  inline TLeaf* primitive_leaf
+  ( TTree*             tree ,
+    const std::string& name )
+  {
+    if ( nullptr == tree || name.empty()                     ) { return nullptr ; }
+    TLeaf* leaf = tree->GetLeaf ( name.c_str() ) ;
+    if ( nullptr == leaf                                     ) { return nullptr ; }
+    if ( nullptr != leaf->GetLeafCount ()                    ) { return nullptr ; }
+    if ( 1       != leaf->GetLenStatic ()                    ) { return nullptr ; }
+    if ( leaf->InheritsFrom ( TLeafC::Class () )             ) { return nullptr ; }
+    const TBranch* branch = leaf->GetBranch () ;
+    if ( nullptr == branch                                   ) { return nullptr ; }
+    if ( TBranch::Class () != branch->IsA ()                 ) { return nullptr ; }
+    if ( 1 != branch->GetNleaves ()                          ) { return nullptr ; }
+    if ( branch->GetTree () != tree->GetTree ()              ) { return nullptr ; }
+    return leaf ;
+  }
+  // ==========================================================================
+  /// all names are primitive scalar branches ?
+  inline bool primitive_leaves
+  ( TTree*                          tree  ,
+    const std::vector<std::string>& names )
+  {
+    if ( nullptr == tree || names.empty() ) { return false ; }
+    for ( const auto& name : names )
+    { if ( nullptr == primitive_leaf ( tree , name ) ) { return false ; } }
+    return true ;
+  }
+  // ==========================================================================
+  /** @class Columns
+   *  Read several primitive scalar branches block-by-block into
+   *  the contiguous columns of doubles.
+   *  Only the requested branches are read (<code>TBranch::GetEntry</code>),
+   *  the values are taken from the leaf buffers, exactly as TTreeFormula does,
+   *  therefore the branch addresses, set by user, are not affected.
+   *  For <code>TChain</code> the leaves are rebound for each new tree.
+   *  If the column cache is enabled (and requested), the blocks are taken
+   *  directly from the cached (memory-mapped) columns without copying.
+   *  Since the missing columns are built in one pass over the whole tree,
+   *  the cache should be requested only for the full-range loops
+   *  @see Ostap::Trees::ColumnCache
+   */
+  class Columns
+  {
+  public:
+    // ========================================================================
+    /// the default size of the block
+    enum { BlockSize = 1024 } ;
+    // ========================================================================
+  public:
+    // ========================================================================
+    Columns ( TTree*                          tree                   ,
+              const std::vector<std::string>& names                  ,
+              const unsigned long             blocksize = BlockSize  ,
+              const bool                      cached    = true       )
+      : m_tree      ( tree  )
+      , m_names     ( names )
+      , m_leaves    ( names.size() , nullptr )
+      , m_branches  ( names.size() , nullptr )
+      , m_blocksize ( std::max ( 1UL , blocksize ) )
+      , m_cached    ( cached ? Ostap::Trees::ColumnCache::get ( tree , names )
+                      : Ostap::Trees::ColumnCache::COLUMNS () )
+      , m_columns   ( m_cached.empty() ? names.size() : 0 ,
+                      std::vector<double> ( m_blocksize , 0.0 ) )
+    {}
+    // ========================================================================
+  public:
+    // ========================================================================
+    /** read the next block of entries, starting from <code>entry</code>
+     *  and not exceeding <code>last</code>
+     *  @return number of read entries (0 at the end/error)
+     */
+    unsigned long read ( const unsigned long entry ,
+                         const unsigned long last  )
+    {
+      // the cached columns: no reading, no copying
+      if ( !m_cached.empty() )
+      {
+        const unsigned long size = m_cached.front()->size() ;
+        if ( size <= entry || last <= entry ) { return 0 ; }    // RETURN
+        m_offset = entry ;
+        return std::min ( m_blocksize , std::min ( last , size ) - entry ) ;
+      }
+      //
+      const unsigned long N = m_names.size() ;
+      unsigned long n = 0 ;
+      for ( ; n < m_blocksize && entry + n < last ; ++n )
+      {
+        long ievent = m_tree->GetEntryNumber ( entry + n ) ;
+        if ( 0 > ievent ) { break ; }                           // BREAK
+        ievent      = m_tree->LoadTree ( ievent ) ;
+        if ( 0 > ievent ) { break ; }                           // BREAK
+        //
+        if ( m_tree->GetTree () != m_current ) { bind () ; }
+        //
+        for ( unsigned long i = 0 ; i < N ; ++i )
+        {
+          m_branches [ i ] -> GetEntry ( ievent ) ;
+          m_columns  [ i ] [ n ] = m_leaves [ i ] -> GetValue ( 0 ) ;
+        }
+      }
+      return n ;
+    }
+    // ========================================================================
+    /// get the column
+    const double* column ( const unsigned long i ) const
+    {
+      return m_cached.empty() ? m_columns [ i ].data ()
+        : m_cached [ i ]->data () + m_offset ;
+    }
+    // ========================================================================
+  private:
+    // ========================================================================
+    /// (re)bind the leaves for the current tree
+    void bind ()
+    {
+      m_current = m_tree->GetTree () ;
+      for ( unsigned long i = 0 ; i < m_names.size() ; ++i )
+      {
+        TLeaf* leaf = primitive_leaf ( m_current , m_names [ i ] ) ;
+        Ostap::Assert ( nullptr != leaf ,
+                        "Invalid/non-primitive branch: " + m_names [ i ] ,
+                        "Ostap::Columns" ) ;
+        m_leaves   [ i ] = leaf ;
+        m_branches [ i ] = leaf->GetBranch () ;
+      }
+    }
+    // ========================================================================
+  private:
+    // ========================================================================
+    TTree*                             m_tree      { nullptr } ;
+    TTree*                             m_current   { nullptr } ;
+    std::vector<std::string>           m_names     {} ;
+    std::vector<TLeaf*>                m_leaves    {} ;
+    std::vector<TBranch*>              m_branches  {} ;
+    unsigned long                      m_blocksize { BlockSize } ;
+    Ostap::Trees::ColumnCache::COLUMNS m_cached    {} ;
+    unsigned long                      m_offset    { 0 } ;
+    std::vector<std::vector<double>>   m_columns   {} ;
+    // ========================================================================
+  } ;
+  // ==========================================================================
+  /** sum and sum of squares for the block of values
+   *  The reductions use several independent accumulators
+   *  to allow the compiler to vectorize them
+   */
+  inline void block_sums
+  ( const unsigned long n      ,
+    const double*       values ,
+    double&             sum    ,
+    double&             sum2   )
+  {
+    double s1 [ 4 ] = { 0 , 0 , 0 , 0 } ;
+    double s2 [ 4 ] = { 0 , 0 , 0 , 0 } ;
+    unsigned long i = 0 ;
+    for ( ; i + 4 <= n ; i += 4 )
+    {
+      for ( unsigned short k = 0 ; k < 4 ; ++k )
+      {
+        const double v = values [ i + k ] ;
+        s1 [ k ] += v     ;
+        s2 [ k ] += v * v ;
+      }
+    }
+    for ( ; i < n ; ++i )
+    {
+      const double v = values [ i ] ;
+      s1 [ 0 ] += v     ;
+      s2 [ 0 ] += v * v ;
+    }
+    sum  = ( s1 [ 0 ] + s1 [ 1 ] ) + ( s1 [ 2 ] + s1 [ 3 ] ) ;
+    sum2 = ( s2 [ 0 ] + s2 [ 1 ] ) + ( s2 [ 2 ] + s2 [ 3 ] ) ;
+  }
+  // ==========================================================================
+  /** minimal and maximal values for the block of values
+   *  @see block_sums
+   */
+  inline void block_minmax
+  ( const unsigned long n      ,
+    const double*       values ,
+    double&             vmin   ,
+    double&             vmax   )
+  {
+    double s1 [ 4 ] = { values [ 0 ] , values [ 0 ] , values [ 0 ] , values [ 0 ] } ;
+    double s2 [ 4 ] = { values [ 0 ] , values [ 0 ] , values [ 0 ] , values [ 0 ] } ;
+    unsigned long i = 0 ;
+    for ( ; i + 4 <= n ; i += 4 )
+    {
+      for ( unsigned short k = 0 ; k < 4 ; ++k )
+      {
+        const double v = values [ i + k ] ;
+        s1 [ k ] = v < s1 [ k ] ? v : s1 [ k ] ;
+        s2 [ k ] = s2 [ k ] < v ? v : s2 [ k ] ;
+      }
+    }
+    for ( ; i < n ; ++i )
+    {
+      const double v = values [ i ] ;
+      s1 [ 0 ] = v < s1 [ 0 ] ? v : s1 [ 0 ] ;
+      s2 [ 0 ] = s2 [ 0 ] < v ? v : s2 [ 0 ] ;
+    }
+    vmin = std::min ( std::min ( s1 [ 0 ] , s1 [ 1 ] ) , std::min ( s1 [ 2 ] , s1 [ 3 ] ) ) ;
+    vmax = std::max ( std::max ( s2 [ 0 ] , s2 [ 1 ] ) , std::max ( s2 [ 2 ] , s2 [ 3 ] ) ) ;
+  }
+  // ==========================================================================
+  /** sum of squared deviations from the mean for the block of values
+   *  @see block_sums
+   */
+  inline double block_moment2
+  ( const unsigned long n      ,
+    const double*       values ,
+    const double        mean   )
+  {
+    double s2 [ 4 ] = { 0 , 0 , 0 , 0 } ;
+    unsigned long i = 0 ;
+    for ( ; i + 4 <= n ; i += 4 )
+    {
+      for ( unsigned short k = 0 ; k < 4 ; ++k )
+      {
+        const double d = values [ i + k ] - mean ;
+        s2 [ k ] += d * d ;
+      }
+    }
+    for ( ; i < n ; ++i )
+    {
+      const double d = values [ i ] - mean ;
+      s2 [ 0 ] += d * d ;
+    }
+    return ( s2 [ 0 ] + s2 [ 1 ] ) + ( s2 [ 2 ] + s2 [ 3 ] ) ;
+  }
+  // ==========================================================================
+  /** statistics for the block of values
+   *  - the mean and minmax are obtained via the vectorizable reductions,
+   *  - the second central moment is obtained in the second pass
+   *  For non-finite values the statistics is accumulated value-by-value
+   */
+  inline Ostap::StatEntity block_stat
+  ( const unsigned long n      ,
+    const double*       values )
+  {
+    Ostap::StatEntity result {} ;
+    if ( 0 == n ) { return result ; }
+    //
+    double sum  = 0 ;
+    double sum2 = 0 ;
+    block_sums ( n , values , sum , sum2 ) ;
+    //
+    if ( !std::isfinite ( sum ) || !std::isfinite ( sum2 ) )
+    {
+      for ( unsigned long i = 0 ; i < n ; ++i ) { result += values [ i ] ; }
+      return result ;
+    }
+    //
+    double vmin = 0 ;
+    double vmax = 0 ;
+    block_minmax ( n , values , vmin , vmax ) ;
+    //
+    const double mean = std::min ( std::max ( sum / n , vmin ) , vmax ) ;
+    const double mu2  = block_moment2 ( n , values , mean ) / n ;
+    //
+    return Ostap::StatEntity ( n , mean , mu2 , vmin , vmax ) ;
+  }
+  // ==========================================================================
+} //                                             The end of anonymous namespace
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_LOCAL_TREE_H
+// ============================================================================